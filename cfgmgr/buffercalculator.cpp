@@ -0,0 +1,719 @@
+#include <math.h>
+#include <algorithm>
+#include <stdlib.h>
+#include "logger.h"
+#include "tokenize.h"
+#include "orch.h"
+#include "buffercalculator.h"
+
+using namespace std;
+using namespace swss;
+
+#define CFG_LOSSLESS_TRAFFIC_PATTERN_TABLE "LOSSLESS_TRAFFIC_PATTERN"
+#define STATE_ASIC_TABLE "ASIC_TABLE"
+
+// Constants of the Mellanox model, see buffer_pool_mellanox.lua and buffer_headroom_mellanox.lua
+#define MLNX_PRIVATE_HEADROOM           (10 * 1024)
+#define MLNX_MGMT_POOL_SIZE             (256 * 1024)
+#define MLNX_EGRESS_MIRROR_HEADROOM     (10 * 1024)
+#define MLNX_DEFAULT_SHP_SIZE           655360
+#define MLNX_SPEED_OF_LIGHT             198000000
+#define MLNX_MINIMAL_PACKET_SIZE        64
+
+static unsigned long toNumber(const string &value)
+{
+    return strtoul(value.c_str(), nullptr, 10);
+}
+
+static string toSizeString(double value)
+{
+    return to_string((long long)ceil(value));
+}
+
+shared_ptr<BufferCalculator> BufferCalculator::create(const string &platform, DBConnector *cfgDb, DBConnector *stateDb)
+{
+    // The virtual switch shares the lua plugins with Mellanox
+    if (platform == "mellanox" || platform == "vs")
+    {
+        return make_shared<MellanoxBufferCalculator>(cfgDb, stateDb);
+    }
+
+    return nullptr;
+}
+
+BufferCalculator::BufferCalculator(DBConnector *cfgDb, DBConnector *stateDb) :
+        m_cfgLosslessTrafficPatternTable(cfgDb, CFG_LOSSLESS_TRAFFIC_PATTERN_TABLE),
+        m_stateAsicTable(stateDb, STATE_ASIC_TABLE),
+        m_totalUsage(),
+        m_losslessPortCount(0),
+        m_configuredPortCount(0)
+{
+}
+
+unsigned long BufferCalculator::getNumberOfIds(const string &key)
+{
+    auto pos = key.rfind(delimiter);
+    if (pos == string::npos)
+    {
+        return 0;
+    }
+
+    auto ids = tokenize(key.substr(pos + 1), '-');
+    if (ids.size() == 1)
+    {
+        return 1;
+    }
+
+    auto low = toNumber(ids[0]), high = toNumber(ids[1]);
+    return high >= low ? high - low + 1 : 0;
+}
+
+const BufferCalculator::calc_profile_t *BufferCalculator::findProfile(const string &name) const
+{
+    auto it = m_profiles.find(name);
+    return it == m_profiles.end() ? nullptr : &it->second;
+}
+
+void BufferCalculator::referenceProfile(const string &profile, const string &port)
+{
+    // References are not removed when a buffer item is updated,
+    // which costs at most a redundant recalculation of the port's usage
+    m_profileReferences[profile].insert(port);
+}
+
+void BufferCalculator::setPort(const string &port, long laneCount, bool adminUp)
+{
+    auto &portRef = m_ports[port];
+
+    if (!portRef.configured)
+    {
+        m_configuredPortCount++;
+    }
+    portRef.configured = true;
+    portRef.lane_count = laneCount;
+    portRef.admin_up = adminUp;
+
+    m_dirtyPorts.insert(port);
+}
+
+void BufferCalculator::removePort(const string &port)
+{
+    auto it = m_ports.find(port);
+    if (it == m_ports.end() || !it->second.configured)
+    {
+        return;
+    }
+
+    m_configuredPortCount--;
+    it->second.configured = false;
+    it->second.admin_up = false;
+
+    m_dirtyPorts.insert(port);
+}
+
+void BufferCalculator::setProfile(const string &name, const vector<FieldValueTuple> &fvs)
+{
+    calc_profile_t profile = {};
+
+    for (auto &fv : fvs)
+    {
+        if (fvField(fv) == "size")
+            profile.size = toNumber(fvValue(fv));
+        else if (fvField(fv) == "xon")
+            profile.xon = toNumber(fvValue(fv));
+        else if (fvField(fv) == "xoff")
+        {
+            profile.xoff = toNumber(fvValue(fv));
+            profile.lossless = true;
+        }
+        else if (fvField(fv) == "pool")
+            profile.pool = fvValue(fv);
+    }
+
+    m_profiles[name] = profile;
+
+    for (auto &port : m_profileReferences[name])
+    {
+        m_dirtyPorts.insert(port);
+    }
+}
+
+void BufferCalculator::removeProfile(const string &name)
+{
+    m_profiles.erase(name);
+
+    for (auto &port : m_profileReferences[name])
+    {
+        m_dirtyPorts.insert(port);
+    }
+}
+
+void BufferCalculator::setObject(buffer_direction_t dir, const string &key, const string &profile)
+{
+    auto port = key.substr(0, key.find(delimiter));
+
+    m_ports[port].objects[dir][key] = profile;
+    referenceProfile(profile, port);
+
+    m_dirtyPorts.insert(port);
+}
+
+void BufferCalculator::removeObject(buffer_direction_t dir, const string &key)
+{
+    auto port = key.substr(0, key.find(delimiter));
+    auto it = m_ports.find(port);
+    if (it == m_ports.end())
+    {
+        return;
+    }
+
+    if (it->second.objects[dir].erase(key))
+    {
+        m_dirtyPorts.insert(port);
+    }
+}
+
+void BufferCalculator::setProfileList(buffer_direction_t dir, const string &port, const string &profileList)
+{
+    auto &profiles = m_ports[port].profile_lists[dir];
+
+    profiles = tokenize(profileList, list_item_delimiter);
+    for (auto &profile : profiles)
+    {
+        referenceProfile(profile, port);
+    }
+
+    m_dirtyPorts.insert(port);
+}
+
+void BufferCalculator::removeProfileList(buffer_direction_t dir, const string &port)
+{
+    auto it = m_ports.find(port);
+    if (it == m_ports.end())
+    {
+        return;
+    }
+
+    it->second.profile_lists[dir].clear();
+    m_dirtyPorts.insert(port);
+}
+
+void BufferCalculator::invalidatePortUsage()
+{
+    for (auto &port : m_ports)
+    {
+        m_dirtyPorts.insert(port.first);
+    }
+}
+
+// Recalculate the usage of the ports updated since the last time and apply the delta to the accumulated usage
+void BufferCalculator::refreshPortUsage()
+{
+    // Ports failed last time are retried, the profiles they reference can be ready now
+    m_dirtyPorts.insert(m_invalidPorts.begin(), m_invalidPorts.end());
+
+    for (auto &portName : m_dirtyPorts)
+    {
+        auto it = m_ports.find(portName);
+        if (it == m_ports.end())
+        {
+            continue;
+        }
+
+        auto &port = it->second;
+        if (port.usage_valid)
+        {
+            m_totalUsage.occupied -= port.usage.occupied;
+            m_totalUsage.xoff -= port.usage.xoff;
+            if (port.usage.lossless)
+                m_losslessPortCount--;
+            port.usage_valid = false;
+        }
+
+        bool hasItems = false;
+        for (auto dir = 0; dir < BUFFER_DIR_MAX; dir++)
+        {
+            hasItems |= (!port.objects[dir].empty() || !port.profile_lists[dir].empty());
+        }
+
+        if (!port.configured && !hasItems)
+        {
+            m_invalidPorts.erase(portName);
+            m_ports.erase(it);
+            continue;
+        }
+
+        port_buffer_usage_t usage = {};
+        if (calculatePortUsage(port, usage))
+        {
+            port.usage = usage;
+            port.usage_valid = true;
+            m_totalUsage.occupied += usage.occupied;
+            m_totalUsage.xoff += usage.xoff;
+            if (usage.lossless)
+                m_losslessPortCount++;
+            m_invalidPorts.erase(portName);
+        }
+        else
+        {
+            m_invalidPorts.insert(portName);
+        }
+    }
+
+    m_dirtyPorts.clear();
+}
+
+vector<string> BufferCalculator::calculateSharedBufferPool(const buffer_pool_lookup_t &pools, unsigned long mmuSize, const string &sharedHeadroomPoolSize, const string &overSubscribeRatio)
+{
+    if (!loadParameters())
+    {
+        return {};
+    }
+
+    set<string> ingressPools;
+    for (auto &pool : pools)
+    {
+        if (pool.second.direction == BUFFER_INGRESS)
+        {
+            ingressPools.insert(pool.first);
+        }
+    }
+
+    // Whether a profile is an ingress lossy one depends on its pool
+    if (ingressPools != m_ingressPools)
+    {
+        m_ingressPools.swap(ingressPools);
+        invalidatePortUsage();
+    }
+
+    refreshPortUsage();
+
+    if (!m_invalidPorts.empty())
+    {
+        SWSS_LOG_INFO("Unable to calculate the buffer usage of %zu port(s), e.g. %s, referenced profiles are not ready",
+                      m_invalidPorts.size(), m_invalidPorts.begin()->c_str());
+        return {};
+    }
+
+    return calculatePoolSizes(pools, mmuSize, sharedHeadroomPoolSize, overSubscribeRatio);
+}
+
+MellanoxBufferCalculator::MellanoxBufferCalculator(DBConnector *cfgDb, DBConnector *stateDb) :
+        BufferCalculator(cfgDb, stateDb),
+        m_parametersValid(false),
+        m_cellSize(0),
+        m_pipelineLatency(0),
+        m_macPhyDelay(0),
+        m_peerResponseTime(0),
+        m_losslessMtu(0),
+        m_smallPacketPercentage(0)
+{
+}
+
+bool MellanoxBufferCalculator::loadParameters()
+{
+    unsigned long cellSize = 0;
+    double pipelineLatency = 0;
+    double macPhyDelay = 0;
+    double peerResponseTime = 0;
+    unsigned long losslessMtu = 0;
+    unsigned long smallPacketPercentage = 0;
+
+    vector<string> keys;
+    vector<FieldValueTuple> fvs;
+
+    m_parametersValid = false;
+
+    // Only one key should exist in either table
+    m_stateAsicTable.getKeys(keys);
+    if (keys.empty() || !m_stateAsicTable.get(keys[0], fvs))
+    {
+        return false;
+    }
+
+    for (auto &fv : fvs)
+    {
+        if (fvField(fv) == "cell_size")
+            cellSize = toNumber(fvValue(fv));
+        else if (fvField(fv) == "pipeline_latency")
+            pipelineLatency = atof(fvValue(fv).c_str());
+        else if (fvField(fv) == "mac_phy_delay")
+            macPhyDelay = atof(fvValue(fv).c_str());
+        else if (fvField(fv) == "peer_response_time")
+            peerResponseTime = atof(fvValue(fv).c_str());
+    }
+
+    keys.clear();
+    fvs.clear();
+    m_cfgLosslessTrafficPatternTable.getKeys(keys);
+    if (keys.empty() || !m_cfgLosslessTrafficPatternTable.get(keys[0], fvs))
+    {
+        return false;
+    }
+
+    for (auto &fv : fvs)
+    {
+        if (fvField(fv) == "mtu")
+            losslessMtu = toNumber(fvValue(fv));
+        else if (fvField(fv) == "small_packet_percentage")
+            smallPacketPercentage = toNumber(fvValue(fv));
+    }
+
+    if (!cellSize || pipelineLatency == 0 || !losslessMtu)
+    {
+        SWSS_LOG_INFO("ASIC parameters or lossless traffic pattern are incomplete, unable to calculate buffer natively");
+        return false;
+    }
+
+    if (cellSize != m_cellSize || pipelineLatency != m_pipelineLatency || macPhyDelay != m_macPhyDelay ||
+        peerResponseTime != m_peerResponseTime || losslessMtu != m_losslessMtu || smallPacketPercentage != m_smallPacketPercentage)
+    {
+        m_cellSize = cellSize;
+        m_pipelineLatency = pipelineLatency;
+        m_macPhyDelay = macPhyDelay;
+        m_peerResponseTime = peerResponseTime;
+        m_losslessMtu = losslessMtu;
+        m_smallPacketPercentage = smallPacketPercentage;
+
+        // The usage of the ports depends on the pipeline latency
+        invalidatePortUsage();
+
+        SWSS_LOG_NOTICE("Buffer calculator loaded: cell size %lu, pipeline latency %.1f, mac phy delay %.1f, peer response time %.1f, lossless mtu %lu, small packet percentage %lu",
+                        m_cellSize, m_pipelineLatency, m_macPhyDelay, m_peerResponseTime, m_losslessMtu, m_smallPacketPercentage);
+    }
+
+    m_parametersValid = true;
+
+    return true;
+}
+
+vector<string> MellanoxBufferCalculator::calculateHeadroom(const buffer_profile_t &headroom, const string &gearboxDelay, bool sharedHeadroomPoolEnabled)
+{
+    // pause quanta should be taken for each operating speed is defined in IEEE 802.3 31B.3.7
+    static const map<unsigned long, unsigned long> pauseQuantaPerSpeed = {
+        {800000, 905},
+        {400000, 905},
+        {200000, 453},
+        {100000, 394},
+        {50000, 147},
+        {40000, 118},
+        {25000, 80},
+        {10000, 67},
+        {1000, 2},
+        {100, 1}
+    };
+
+    if (!loadParameters() || headroom.cable_length.empty())
+    {
+        return {};
+    }
+
+    double portSpeed = (double)toNumber(headroom.speed);
+    double cableLength = (double)toNumber(headroom.cable_length.substr(0, headroom.cable_length.size() - 1));
+    double portMtu = (double)toNumber(headroom.port_mtu);
+    double gearbox = gearboxDelay.empty() ? 0 : atof(gearboxDelay.c_str());
+
+    double peerResponseTime;
+    auto quantaRef = pauseQuantaPerSpeed.find((unsigned long)portSpeed);
+    if (quantaRef != pauseQuantaPerSpeed.end())
+    {
+        peerResponseTime = (double)quantaRef->second * 512 / 8;
+    }
+    else if (m_peerResponseTime != 0)
+    {
+        peerResponseTime = m_peerResponseTime * 1024;
+    }
+    else
+    {
+        return {};
+    }
+
+    double pipelineLatency = m_pipelineLatency * 1024;
+    double speedOverhead = 0;
+    // Adjustment for 8-lane port
+    if (headroom.lane_count == 8)
+    {
+        pipelineLatency = pipelineLatency * 2 - 1024;
+        speedOverhead = portMtu;
+    }
+
+    double cellSize = (double)m_cellSize;
+    double worstCaseFactor;
+    if (cellSize > 2 * MLNX_MINIMAL_PACKET_SIZE)
+        worstCaseFactor = cellSize / MLNX_MINIMAL_PACKET_SIZE;
+    else
+        worstCaseFactor = (2 * cellSize) / (1 + cellSize);
+
+    double smallPacketPercentage = (double)m_smallPacketPercentage;
+    double cellOccupancy = (100 - smallPacketPercentage + smallPacketPercentage * worstCaseFactor) / 100;
+
+    double bytesOnGearbox = (gearbox == 0) ? 0 : portSpeed * gearbox / (8 * 1024);
+    double bytesOnCable = 2 * cableLength * portSpeed * 1000000000 / MLNX_SPEED_OF_LIGHT / (8 * 1024);
+    double propagationDelay = portMtu + bytesOnCable + 2 * bytesOnGearbox + m_macPhyDelay * 1024 + peerResponseTime;
+
+    // Calculate the xoff and xon and then round up at 1024 bytes
+    double xoff = ceil(((double)m_losslessMtu + propagationDelay * cellOccupancy) / 1024) * 1024;
+    double xon = ceil(pipelineLatency / 1024) * 1024;
+    double size = sharedHeadroomPoolEnabled ? xon : xoff + xon + speedOverhead;
+    size = ceil(size / 1024) * 1024;
+
+    return {
+        "xon:" + toSizeString(xon),
+        "xoff:" + toSizeString(xoff),
+        "size:" + toSizeString(size)
+    };
+}
+
+vector<string> MellanoxBufferCalculator::checkHeadroom(const string &port, const string &maxHeadroomSize, const string &profileName, const string &profileSize, const string &newPg)
+{
+    if (maxHeadroomSize.empty())
+    {
+        return {"result:true"};
+    }
+
+    if (!loadParameters())
+    {
+        return {};
+    }
+
+    auto portRef = m_ports.find(port);
+    bool is8Lanes = (portRef != m_ports.end() && portRef->second.lane_count == 8);
+
+    double pipelineLatency = m_pipelineLatency;
+    // Egress mirror size: 2 * maximum MTU (10k)
+    unsigned long egressMirrorSize = 20 * 1024;
+    if (is8Lanes)
+    {
+        // The pipeline latency should be adjusted accordingly for ports with 2 buffer units
+        pipelineLatency = pipelineLatency * 2 - 1;
+        egressMirrorSize *= 2;
+    }
+    unsigned long lossyPgSize = (unsigned long)(pipelineLatency * 1024);
+
+    // Initialize the accumulative size with 4096 to absorb the possible deviation
+    unsigned long accumulativeSize = 4096 + lossyPgSize + egressMirrorSize;
+
+    map<string, string> pgs;
+    if (portRef != m_ports.end())
+    {
+        pgs = portRef->second.objects[BUFFER_PG];
+    }
+    if (getNumberOfIds(newPg) != 0)
+    {
+        pgs[newPg] = profileName;
+    }
+
+    for (auto &pg : pgs)
+    {
+        unsigned long size;
+        if (pg.second == profileName)
+        {
+            size = toNumber(profileSize);
+        }
+        else
+        {
+            auto profile = findProfile(pg.second);
+            if (!profile)
+            {
+                return {};
+            }
+            size = profile->size;
+        }
+
+        if (size == 0)
+        {
+            size = lossyPgSize;
+        }
+        accumulativeSize += size * getNumberOfIds(pg.first);
+    }
+
+    auto maxSize = toNumber(maxHeadroomSize);
+    if (maxSize > accumulativeSize)
+    {
+        return {"result:true",
+                "debug:Accumulative headroom on port " + to_string(accumulativeSize) + ", the maximum available headroom " + maxHeadroomSize};
+    }
+
+    return {"result:false",
+            "debug:Accumulative headroom on port " + to_string(accumulativeSize) + " exceeds the maximum available headroom which is " + maxHeadroomSize};
+}
+
+bool MellanoxBufferCalculator::calculatePortUsage(const calc_port_t &port, port_buffer_usage_t &usage)
+{
+    // Parameters are loaded by calculateSharedBufferPool
+    if (!m_parametersValid)
+    {
+        return false;
+    }
+
+    unsigned long lossyPgReserved = (unsigned long)(m_pipelineLatency * 1024);
+    unsigned long lossyPgReserved8Lanes = (unsigned long)((2 * m_pipelineLatency - 1) * 1024);
+    bool is8Lanes = (port.lane_count == 8);
+
+    auto accumulate = [&usage](const calc_profile_t &profile, unsigned long size, unsigned long count)
+    {
+        if (size == 0)
+            return;
+        if (profile.lossless && profile.xon + profile.xoff > size)
+            usage.xoff += (profile.xon + profile.xoff - size) * count;
+        usage.occupied += size * count;
+    };
+
+    for (auto dir = 0; dir < BUFFER_DIR_MAX; dir++)
+    {
+        for (auto &object : port.objects[dir])
+        {
+            auto profile = findProfile(object.second);
+            if (!profile)
+            {
+                return false;
+            }
+
+            auto count = getNumberOfIds(object.first);
+            auto size = profile->size;
+
+            // Buffer is implicitly reserved for lossy profiles applied on PGs, even more on 8-lane ports
+            if (isIngressLossyProfile(*profile))
+            {
+                size += lossyPgReserved;
+                if (is8Lanes)
+                    usage.occupied += (lossyPgReserved8Lanes - lossyPgReserved) * count;
+            }
+            else if (dir == BUFFER_PG && profile->lossless && m_ingressPools.find(profile->pool) != m_ingressPools.end())
+            {
+                usage.lossless = true;
+            }
+
+            accumulate(*profile, size, count);
+        }
+
+        for (auto &profileName : port.profile_lists[dir])
+        {
+            auto profile = findProfile(profileName);
+            if (!profile)
+            {
+                return false;
+            }
+
+            // A lossy profile in the ingress profile list doesn't occupy buffer
+            if (isIngressLossyProfile(*profile))
+                continue;
+
+            accumulate(*profile, profile->size, 1);
+        }
+    }
+
+    // Management PG and egress mirror
+    if (port.configured && port.admin_up)
+    {
+        usage.occupied += (is8Lanes ? lossyPgReserved8Lanes : lossyPgReserved) + MLNX_EGRESS_MIRROR_HEADROOM;
+    }
+
+    return true;
+}
+
+vector<string> MellanoxBufferCalculator::calculatePoolSizes(const buffer_pool_lookup_t &pools, unsigned long mmuSize, const string &sharedHeadroomPoolSize, const string &overSubscribeRatio)
+{
+    if (!m_parametersValid || mmuSize == 0)
+    {
+        return {};
+    }
+
+    vector<string> result;
+    double overSubscribe = overSubscribeRatio.empty() ? 0 : atof(overSubscribeRatio.c_str());
+    double shpSize = sharedHeadroomPoolSize.empty() ? 0 : atof(sharedHeadroomPoolSize.c_str());
+    bool shpEnabled = (overSubscribe != 0 || shpSize != 0);
+
+    double occupied = (double)m_totalUsage.occupied + MLNX_MGMT_POOL_SIZE;
+    // The headroom exceeding the reserved size is accumulated only if the shared headroom pool size isn't configured
+    double xoff = (shpSize == 0) ? (double)m_totalUsage.xoff : 0;
+
+    bool forceEnableShp = false;
+    if (xoff > 0 && !shpEnabled)
+    {
+        forceEnableShp = true;
+        shpSize = MLNX_DEFAULT_SHP_SIZE;
+        shpEnabled = true;
+    }
+
+    double privateHeadroom = 0;
+    if (shpEnabled)
+    {
+        privateHeadroom = (double)m_losslessPortCount * MLNX_PRIVATE_HEADROOM;
+        occupied += privateHeadroom;
+        xoff = max(xoff - privateHeadroom, 0.0);
+    }
+
+    // Fetch all the pools that need update
+    vector<string> poolsNeedUpdate;
+    unsigned long ingressPoolCount = 0;
+    string ingressLosslessPoolSize;
+    for (auto &poolRef : pools)
+    {
+        auto &pool = poolRef.second;
+        if (pool.dynamic_size)
+        {
+            poolsNeedUpdate.push_back(poolRef.first);
+            if (pool.direction == BUFFER_INGRESS)
+                ingressPoolCount++;
+        }
+        else if (poolRef.first == INGRESS_LOSSLESS_PG_POOL_NAME && shpEnabled && shpSize == 0)
+        {
+            ingressLosslessPoolSize = pool.configured_size;
+        }
+    }
+
+    if (shpEnabled && shpSize == 0)
+    {
+        shpSize = ceil(xoff / overSubscribe);
+        if (shpSize == 0)
+            shpSize = MLNX_DEFAULT_SHP_SIZE;
+    }
+
+    occupied += shpSize;
+
+    // Align mmu_size at cell size boundary
+    double ceilingMmuSize = (double)(mmuSize / m_cellSize * m_cellSize);
+    double availableBuffer = (double)mmuSize - occupied;
+    double poolSize = (ingressPoolCount == 1) ? availableBuffer : availableBuffer / 2;
+    if (poolSize > ceilingMmuSize)
+        poolSize = ceilingMmuSize;
+
+    bool shpDeployed = false;
+    for (auto &poolName : poolsNeedUpdate)
+    {
+        auto &percentage = pools.at(poolName).percentage;
+        double effectivePoolSize = poolSize;
+        if (!percentage.empty() && atof(percentage.c_str()) >= 0)
+            effectivePoolSize = availableBuffer * atof(percentage.c_str()) / 100;
+
+        if (shpSize != 0 && poolName == INGRESS_LOSSLESS_PG_POOL_NAME)
+        {
+            result.push_back(poolName + ":" + toSizeString(effectivePoolSize) + ":" + toSizeString(shpSize));
+            shpDeployed = true;
+        }
+        else
+        {
+            result.push_back(poolName + ":" + toSizeString(effectivePoolSize));
+        }
+    }
+
+    if (!shpDeployed && shpSize != 0 && !ingressLosslessPoolSize.empty())
+    {
+        result.push_back(string(INGRESS_LOSSLESS_PG_POOL_NAME) + ":" + ingressLosslessPoolSize + ":" + toSizeString(shpSize));
+    }
+
+    result.push_back("debug:mmu_size:" + to_string(mmuSize));
+    result.push_back("debug:accumulative size:" + toSizeString(occupied));
+    if (shpEnabled)
+    {
+        result.push_back("debug:accumulative_private_headroom:" + toSizeString(privateHeadroom));
+        result.push_back("debug:accumulative xoff:" + toSizeString(xoff));
+        result.push_back(string("debug:force enabled shp:") + (forceEnableShp ? "true" : "false"));
+    }
+    result.push_back(string("debug:shp_enabled:") + (shpEnabled ? "true" : "false"));
+    result.push_back("debug:shp_size:" + toSizeString(shpSize));
+    result.push_back("debug:total port:" + to_string(m_configuredPortCount) + " lossless port:" + to_string(m_losslessPortCount));
+
+    return result;
+}
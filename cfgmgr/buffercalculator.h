@@ -0,0 +1,147 @@
+#ifndef __BUFFERCALCULATOR__
+#define __BUFFERCALCULATOR__
+
+#include "dbconnector.h"
+#include "table.h"
+#include "buffermgrdyn.h"
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace swss {
+
+// Buffer occupied by the items on a port, accumulated into the shared buffer pool calculation
+typedef struct {
+    unsigned long occupied;
+    // Headroom exceeding the reserved size, which is the base of the shared headroom pool size
+    unsigned long xoff;
+    bool lossless;
+} port_buffer_usage_t;
+
+/*
+ * BufferCalculator
+ *
+ * In-process replacement of the vendor lua plugins (buffer_headroom_<vendor>.lua,
+ * buffer_pool_<vendor>.lua and buffer_check_headroom_<vendor>.lua).
+ *
+ * The lua plugins read all the ports, buffer items and profiles from the databases on each call.
+ * Instead, the calculator keeps a mirror of the buffer items programmed to APPL_DB by the buffer manager,
+ * which updates it whenever it writes to APPL_DB, and caches the buffer usage per port.
+ * When the shared buffer pool sizes are calculated, only the usage of the ports updated since the last
+ * calculation is recalculated and applied as a delta to the accumulated usage.
+ *
+ * The results are in the same format as those of the lua plugins so that they are handled in the same way.
+ * An empty result means the calculator is unable to calculate, e.g. some parameters are not available yet,
+ * in which case the buffer manager falls back to the lua plugin.
+ */
+class BufferCalculator
+{
+public:
+    // Returns the model of the vendor, nullptr if there is no native model for it
+    static std::shared_ptr<BufferCalculator> create(const std::string &platform, DBConnector *cfgDb, DBConnector *stateDb);
+
+    BufferCalculator(DBConnector *cfgDb, DBConnector *stateDb);
+    virtual ~BufferCalculator() = default;
+
+    virtual std::vector<std::string> calculateHeadroom(const buffer_profile_t &headroom, const std::string &gearboxDelay, bool sharedHeadroomPoolEnabled) = 0;
+    virtual std::vector<std::string> checkHeadroom(const std::string &port, const std::string &maxHeadroomSize, const std::string &profileName, const std::string &profileSize, const std::string &newPg) = 0;
+    std::vector<std::string> calculateSharedBufferPool(const buffer_pool_lookup_t &pools, unsigned long mmuSize, const std::string &sharedHeadroomPoolSize, const std::string &overSubscribeRatio);
+
+    // Mirror of APPL_DB, keys are in the format of APPL_DB without table name
+    void setPort(const std::string &port, long laneCount, bool adminUp);
+    void removePort(const std::string &port);
+    void setProfile(const std::string &name, const std::vector<FieldValueTuple> &fvs);
+    void removeProfile(const std::string &name);
+    void setObject(buffer_direction_t dir, const std::string &key, const std::string &profile);
+    void removeObject(buffer_direction_t dir, const std::string &key);
+    void setProfileList(buffer_direction_t dir, const std::string &port, const std::string &profileList);
+    void removeProfileList(buffer_direction_t dir, const std::string &port);
+
+protected:
+    typedef struct {
+        unsigned long size;
+        unsigned long xon;
+        unsigned long xoff;
+        bool lossless;
+        std::string pool;
+    } calc_profile_t;
+
+    typedef struct {
+        bool configured;
+        bool admin_up;
+        long lane_count;
+        // key of buffer item => profile
+        std::map<std::string, std::string> objects[BUFFER_DIR_MAX];
+        std::vector<std::string> profile_lists[BUFFER_DIR_MAX];
+        bool usage_valid;
+        port_buffer_usage_t usage;
+    } calc_port_t;
+
+    Table m_cfgLosslessTrafficPatternTable;
+    Table m_stateAsicTable;
+
+    std::map<std::string, calc_profile_t> m_profiles;
+    std::map<std::string, calc_port_t> m_ports;
+    // profile name => ports referencing it
+    std::map<std::string, std::set<std::string>> m_profileReferences;
+    std::set<std::string> m_ingressPools;
+
+    // Ports whose usage need to be recalculated, and those failed to, e.g. due to a profile not being in APPL_DB yet
+    std::set<std::string> m_dirtyPorts;
+    std::set<std::string> m_invalidPorts;
+    port_buffer_usage_t m_totalUsage;
+    unsigned long m_losslessPortCount;
+    unsigned long m_configuredPortCount;
+
+    // Number of priorities or queues in a buffer item key, like 2 for "Ethernet0:3-4"
+    static unsigned long getNumberOfIds(const std::string &key);
+    bool isIngressLossyProfile(const calc_profile_t &profile) const
+    {
+        return !profile.lossless && m_ingressPools.find(profile.pool) != m_ingressPools.end();
+    }
+    const calc_profile_t *findProfile(const std::string &name) const;
+    void referenceProfile(const std::string &profile, const std::string &port);
+    void invalidatePortUsage();
+    void refreshPortUsage();
+
+    // Vendor specific parts
+    // Reads the parameters the calculation depends on, returns false if they are not available
+    virtual bool loadParameters() = 0;
+    virtual bool calculatePortUsage(const calc_port_t &port, port_buffer_usage_t &usage) = 0;
+    virtual std::vector<std::string> calculatePoolSizes(const buffer_pool_lookup_t &pools, unsigned long mmuSize, const std::string &sharedHeadroomPoolSize, const std::string &overSubscribeRatio) = 0;
+};
+
+/*
+ * Native model of buffer_*_mellanox.lua, which are also used on the virtual switch.
+ * The ASIC parameters and lossless traffic pattern are read on each calculation, as the plugins do.
+ * A change of them invalidates the cached buffer usage of all the ports.
+ */
+class MellanoxBufferCalculator : public BufferCalculator
+{
+public:
+    MellanoxBufferCalculator(DBConnector *cfgDb, DBConnector *stateDb);
+
+    std::vector<std::string> calculateHeadroom(const buffer_profile_t &headroom, const std::string &gearboxDelay, bool sharedHeadroomPoolEnabled) override;
+    std::vector<std::string> checkHeadroom(const std::string &port, const std::string &maxHeadroomSize, const std::string &profileName, const std::string &profileSize, const std::string &newPg) override;
+
+private:
+    bool m_parametersValid;
+    unsigned long m_cellSize;
+    // In the unit of KB, as in STATE_DB.ASIC_TABLE
+    double m_pipelineLatency;
+    double m_macPhyDelay;
+    double m_peerResponseTime;
+    unsigned long m_losslessMtu;
+    unsigned long m_smallPacketPercentage;
+
+    bool loadParameters() override;
+    bool calculatePortUsage(const calc_port_t &port, port_buffer_usage_t &usage) override;
+    std::vector<std::string> calculatePoolSizes(const buffer_pool_lookup_t &pools, unsigned long mmuSize, const std::string &sharedHeadroomPoolSize, const std::string &overSubscribeRatio) override;
+};
+
+}
+
+#endif /* __BUFFERCALCULATOR__ */
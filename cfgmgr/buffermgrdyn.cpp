@@ -1,6 +1,7 @@
 #include <fstream>
 #include <iostream>
 #include <string.h>
+#include <inttypes.h>
 #include "logger.h"
 #include "dbconnector.h"
 #include "producerstatetable.h"
@@ -8,6 +9,7 @@
 #include "ipprefix.h"
 #include "timer.h"
 #include "buffermgrdyn.h"
+#include "buffercalculator.h"
 #include "bufferorch.h"
 #include "exec.h"
 #include "shellcmd.h"
@@ -49,6 +51,12 @@ BufferMgrDynamic::BufferMgrDynamic(DBConnector *cfgDb, DBConnector *stateDb, DBC
         m_applPortTable(applDb, APP_PORT_TABLE_NAME),
         m_portInitDone(false),
         m_bufferPoolReady(false),
+        m_sharedBufferPoolUpdatePending(false),
+        m_sharedBufferPoolUpdatesCoalescedInBatch(0),
+        m_sharedBufferPoolUpdatesCoalesced(0),
+        m_sharedBufferPoolRecalculations(0),
+        m_sharedBufferPoolRecalculationTime(std::chrono::steady_clock::duration::zero()),
+        m_sharedBufferPoolTimeSaved(std::chrono::steady_clock::duration::zero()),
         m_bufferObjectsPending(true),
         m_bufferCompletelyInitialized(false),
         m_mmuSizeNumber(0)
@@ -99,6 +107,13 @@ BufferMgrDynamic::BufferMgrDynamic(DBConnector *cfgDb, DBConnector *stateDb, DBC
         }
     }
 
+    // The lua plugins are still loaded as the fallback of the native model
+    m_bufferCalculator = BufferCalculator::create(platform, cfgDb, stateDb);
+    if (m_bufferCalculator)
+    {
+        SWSS_LOG_NOTICE("Native buffer calculation model is used for platform %s", platform.c_str());
+    }
+
     try
     {
         string headroomLuaScript = swss::loadLuaScript(headroomPluginName);
@@ -355,6 +370,8 @@ void BufferMgrDynamic::loadZeroPoolAndProfiles()
             }
             m_applBufferProfileTable.set(key, fvs);
             m_stateBufferProfileTable.set(key, fvs);
+            if (m_bufferCalculator)
+                m_bufferCalculator->setProfile(key, fvs);
             SWSS_LOG_NOTICE("Loaded zero buffer profile %s", key.c_str());
         }
         else
@@ -415,6 +432,8 @@ void BufferMgrDynamic::unloadZeroPoolAndProfiles()
         }
         m_applBufferProfileTable.del(zeroProfileName);
         m_stateBufferProfileTable.del(zeroProfileName);
+        if (m_bufferCalculator)
+            m_bufferCalculator->removeProfile(zeroProfileName);
         SWSS_LOG_NOTICE("Unloaded zero buffer profile %s", zeroProfileName.c_str());
     }
 
@@ -611,7 +630,19 @@ void BufferMgrDynamic::calculateHeadroomSize(buffer_profile_t &headroom)
 
     try
     {
-        auto ret = swss::runRedisScript(*m_applDb, m_headroomSha, keys, argv);
+        vector<string> ret;
+
+        // Take the native model if there is one and it is able to calculate
+        if (m_bufferCalculator)
+        {
+            bool sharedHeadroomPoolEnabled = isNonZero(m_configuredSharedHeadroomPoolSize) || isNonZero(m_overSubscribeRatio);
+            ret = m_bufferCalculator->calculateHeadroom(headroom, m_identifyGearboxDelay, sharedHeadroomPoolEnabled);
+        }
+
+        if (ret.empty())
+        {
+            ret = swss::runRedisScript(*m_applDb, m_headroomSha, keys, argv);
+        }
 
         if (ret.empty())
         {
@@ -688,7 +719,27 @@ void BufferMgrDynamic::recalculateSharedBufferPool()
             }
         }
 
-        auto ret = runRedisScript(*m_applDb, m_bufferpoolSha, keys, argv);
+        vector<string> ret;
+
+        // The native model recalculates the usage of the ports updated since the last time only
+        if (m_bufferCalculator)
+        {
+            // Same as the lua plugin, the current sizes are kept until orchagent has handled all the buffer items in APPL_DB.
+            // Otherwise the pools could shrink before the items being added free their buffer on the ASIC.
+            // The timer retries later.
+            if (hasBufferObjectsPendingInOrchagent())
+            {
+                SWSS_LOG_INFO("Buffer items are pending in orchagent, keep the current shared buffer pool sizes");
+                return;
+            }
+
+            ret = m_bufferCalculator->calculateSharedBufferPool(m_bufferPoolLookup, m_mmuSizeNumber, m_configuredSharedHeadroomPoolSize, m_overSubscribeRatio);
+        }
+
+        if (ret.empty())
+        {
+            ret = runRedisScript(*m_applDb, m_bufferpoolSha, keys, argv);
+        }
 
         // The format of the result:
         // a list of lines containing key, value pairs with colon as separator
@@ -815,8 +866,44 @@ void BufferMgrDynamic::recalculateSharedBufferPool()
         m_bufferPoolReady = true;
 }
 
+/*
+ * Each port speed, cable length, admin status, buffer PG or profile update requires the shared buffer pool sizes to be updated.
+ * Calculating the sizes involves all the ports and buffer items and rewriting all the pools,
+ * which can take place hundreds of times for a single "config reload" or "config qos reload".
+ * So a request is only recorded here and the calculation takes place once at the end of handling a batch of table updates.
+ * The timer flow forces an immediate calculation, which also serves any pending request.
+ */
 void BufferMgrDynamic::checkSharedBufferPoolSize(bool force_update_during_initialization = false)
 {
+    if (force_update_during_initialization)
+    {
+        updateSharedBufferPoolSize(true);
+        return;
+    }
+
+    if (m_sharedBufferPoolUpdatePending)
+    {
+        m_sharedBufferPoolUpdatesCoalesced++;
+        m_sharedBufferPoolUpdatesCoalescedInBatch++;
+    }
+    m_sharedBufferPoolUpdatePending = true;
+}
+
+void BufferMgrDynamic::flushSharedBufferPoolUpdate()
+{
+    if (!m_sharedBufferPoolUpdatePending)
+        return;
+
+    updateSharedBufferPoolSize(false);
+}
+
+void BufferMgrDynamic::updateSharedBufferPoolSize(bool force_update_during_initialization)
+{
+    auto coalesced = m_sharedBufferPoolUpdatesCoalescedInBatch;
+
+    m_sharedBufferPoolUpdatePending = false;
+    m_sharedBufferPoolUpdatesCoalescedInBatch = 0;
+
     // PortInitDone indicates all steps of port initialization has been done
     // Only after that does the buffer pool size update starts
     if (!m_portInitDone && !force_update_during_initialization)
@@ -852,8 +939,29 @@ void BufferMgrDynamic::checkSharedBufferPoolSize(bool force_update_during_initia
         }
     }
 
-    if (!m_mmuSize.empty())
-        recalculateSharedBufferPool();
+    if (m_mmuSize.empty())
+        return;
+
+    auto start = std::chrono::steady_clock::now();
+    recalculateSharedBufferPool();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    m_sharedBufferPoolRecalculations++;
+    m_sharedBufferPoolRecalculationTime += elapsed;
+
+    if (coalesced > 0)
+    {
+        // Each request coalesced would have cost a calculation as long as this one
+        m_sharedBufferPoolTimeSaved += elapsed * coalesced;
+
+        auto usecs = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+        auto totalUsecs = std::chrono::duration_cast<std::chrono::microseconds>(m_sharedBufferPoolRecalculationTime).count();
+        auto savedUsecs = std::chrono::duration_cast<std::chrono::microseconds>(m_sharedBufferPoolTimeSaved).count();
+        SWSS_LOG_INFO("Shared buffer pool recalculated in %ld us for %" PRIu64 " requests, total %" PRIu64 " recalculations in %ld us, "
+                      "%" PRIu64 " avoided, %ld us saved",
+                      static_cast<long>(usecs), coalesced + 1, m_sharedBufferPoolRecalculations, static_cast<long>(totalUsecs),
+                      m_sharedBufferPoolUpdatesCoalesced, static_cast<long>(savedUsecs));
+    }
 }
 
 // For buffer pool, only size can be updated on-the-fly
@@ -902,6 +1010,9 @@ void BufferMgrDynamic::updateBufferProfileToDb(const string &name, const buffer_
 
     m_applBufferProfileTable.set(name, fvVector);
     m_stateBufferProfileTable.set(name, fvVector);
+
+    if (m_bufferCalculator)
+        m_bufferCalculator->setProfile(name, fvVector);
 }
 
 // Database operation
@@ -924,13 +1035,31 @@ void BufferMgrDynamic::updateBufferObjectToDb(const string &key, const string &p
         fvVector.emplace_back(buffer_profile_field_name, profile);
 
         table.set(key, fvVector);
+
+        if (m_bufferCalculator)
+            m_bufferCalculator->setObject(dir, key, profile);
     }
     else
     {
         table.del(key);
+
+        if (m_bufferCalculator)
+            m_bufferCalculator->removeObject(dir, key);
     }
 }
 
+// The keys of a ProducerStateTable stay in its key set until orchagent takes them
+bool BufferMgrDynamic::hasBufferObjectsPendingInOrchagent()
+{
+    for (auto dir = 0; dir < BUFFER_DIR_MAX; dir++)
+    {
+        if (m_applBufferObjectTables[dir].count() > 0 || m_applBufferProfileListTables[dir].count() > 0)
+            return true;
+    }
+
+    return false;
+}
+
 void BufferMgrDynamic::updateBufferObjectListToDb(const string &key, const string &profileList, buffer_direction_t dir)
 {
     auto &table = m_applBufferProfileListTables[dir];
@@ -939,6 +1068,9 @@ void BufferMgrDynamic::updateBufferObjectListToDb(const string &key, const strin
     fvVector.emplace_back(buffer_profile_list_field_name, profileList);
 
     table.set(key, fvVector);
+
+    if (m_bufferCalculator)
+        m_bufferCalculator->setProfileList(dir, key, profileList);
 }
 
 // We have to check the headroom ahead of applying them
@@ -1031,6 +1163,9 @@ void BufferMgrDynamic::releaseProfile(const string &profile_name)
 
     m_stateBufferProfileTable.del(profile_name);
 
+    if (m_bufferCalculator)
+        m_bufferCalculator->removeProfile(profile_name);
+
     m_bufferProfileLookup.erase(profile_name);
 
     SWSS_LOG_NOTICE("BUFFER_PROFILE %s has been released successfully", profile_name.c_str());
@@ -1067,7 +1202,19 @@ bool BufferMgrDynamic::isHeadroomResourceValid(const string &port, const buffer_
 
     try
     {
-        auto ret = runRedisScript(*m_applDb, m_checkHeadroomSha, keys, argv);
+        vector<string> ret;
+
+        if (m_bufferCalculator)
+        {
+            const auto &portRef = m_portInfoLookup.find(port);
+            const string &maxHeadroomSize = (portRef != m_portInfoLookup.end()) ? portRef->second.max_headroom_size : "";
+            ret = m_bufferCalculator->checkHeadroom(port, maxHeadroomSize, profile.name, profile.size, new_pg);
+        }
+
+        if (ret.empty())
+        {
+            ret = runRedisScript(*m_applDb, m_checkHeadroomSha, keys, argv);
+        }
 
         // The format of the result:
         // a list of strings containing key, value pairs with colon as separator
@@ -1188,7 +1335,7 @@ void BufferMgrDynamic::removeSupportedButNotConfiguredItemsOnPort(port_info_t &p
         {
             for (auto &it: portInfo.supported_but_not_configured_buffer_objects[dir])
             {
-                m_applBufferObjectTables[dir].del(portPrefix + it);
+                updateBufferObjectToDb(portPrefix + it, "", false, dir);
             }
             portInfo.supported_but_not_configured_buffer_objects[dir].clear();
         }
@@ -1208,7 +1355,6 @@ void BufferMgrDynamic::removeSupportedButNotConfiguredItemsOnPort(port_info_t &p
  */
 void BufferMgrDynamic::applyNormalBufferObjectsOnPort(const string &port)
 {
-    vector<FieldValueTuple> fvVector;
     auto &portQueues = m_portQueueLookup[port];
 
     for (auto &queue : portQueues)
@@ -1222,9 +1368,7 @@ void BufferMgrDynamic::applyNormalBufferObjectsOnPort(const string &port)
         auto &profileList = m_portProfileListLookups[dir][port];
         if (!profileList.empty())
         {
-            fvVector.emplace_back(buffer_profile_list_field_name, profileList);
-            m_applBufferProfileListTables[dir].set(port, fvVector);
-            fvVector.clear();
+            updateBufferObjectListToDb(port, profileList, dir);
         }
     }
 }
@@ -1380,15 +1524,12 @@ template<class T> task_process_status BufferMgrDynamic::reclaimReservedBufferFor
         }
     }
 
-    vector<FieldValueTuple> fvVector;
-
     SWSS_LOG_NOTICE("Reclaiming buffer reserved for ingress profile list from port %s", port.c_str());
     const auto &profileList = m_portProfileListLookups[dir][port];
     if (!profileList.empty())
     {
         const string &zeroIngressProfileNameList = constructZeroProfileListFromNormalProfileList(profileList, port);
-        fvVector.emplace_back(buffer_profile_list_field_name, zeroIngressProfileNameList);
-        m_applBufferProfileListTables[dir].set(port, fvVector);
+        updateBufferObjectListToDb(port, zeroIngressProfileNameList, dir);
     }
 
     return task_process_status::task_success;
@@ -1820,7 +1961,7 @@ task_process_status BufferMgrDynamic::doUpdateBufferProfileForSize(buffer_profil
  *    - max_headroom_size, represents the maximum headroom size of the port.
  *      It is used for checking whether the accumulative headroom of the port exceeds the port's threshold
  *      before applying a new priority group on a port or changing an existing buffer profile.
- *      It is referenced by lua plugin "check headroom size" only and will not be handled in this function.
+ *      It is recorded here for the native calculation model and referenced by lua plugin "check headroom size" as well.
  */
 task_process_status BufferMgrDynamic::handleBufferMaxParam(KeyOpFieldsValuesTuple &tuple)
 {
@@ -1884,6 +2025,10 @@ task_process_status BufferMgrDynamic::handleBufferMaxParam(KeyOpFieldsValuesTupl
                         SWSS_LOG_NOTICE("Admin-down port %s is handled after maximum buffer parameter has been received", key.c_str());
                     }
                 }
+                else if (fvField(i) == "max_headroom_size")
+                {
+                    portInfo.max_headroom_size = value;
+                }
             }
         }
         else
@@ -2299,6 +2444,9 @@ task_process_status BufferMgrDynamic::handlePortTable(KeyOpFieldsValuesTuple &tu
             need_handle_admin_down = true;
         }
 
+        if (m_bufferCalculator)
+            m_bufferCalculator->setPort(port, portInfo.lane_count, portInfo.state != PORT_ADMIN_DOWN);
+
         // In case both need_handle_admin_down and need_refresh_all_buffer_objects are true, the need_handle_admin_down will take effect.
         // This can happen when both effective speed (or mtu) is changed and the admin_status is down.
         // In this case, we just need record the new effective speed (or mtu) but don't need to refresh all PGs on the port since the port is administratively down
@@ -2365,6 +2513,8 @@ task_process_status BufferMgrDynamic::handlePortTable(KeyOpFieldsValuesTuple &tu
         m_portProfileListLookups[BUFFER_INGRESS].erase(port);
         m_portProfileListLookups[BUFFER_EGRESS].erase(port);
         m_portInfoLookup.erase(port);
+        if (m_bufferCalculator)
+            m_bufferCalculator->removePort(port);
         SWSS_LOG_NOTICE("Port %s is removed", port.c_str());
     }
 
@@ -2388,6 +2538,8 @@ task_process_status BufferMgrDynamic::handleBufferPoolTable(KeyOpFieldsValuesTup
         string newSHPSize = "0";
 
         bufferPool.dynamic_size = true;
+        bufferPool.configured_size.clear();
+        bufferPool.percentage.clear();
         for (auto i = kfvFieldsValues(tuple).begin(); i != kfvFieldsValues(tuple).end(); i++)
         {
             string &field = fvField(*i);
@@ -2397,6 +2549,11 @@ task_process_status BufferMgrDynamic::handleBufferPoolTable(KeyOpFieldsValuesTup
             if (field == buffer_size_field_name)
             {
                 bufferPool.dynamic_size = false;
+                bufferPool.configured_size = value;
+            }
+            else if (field == "percentage")
+            {
+                bufferPool.percentage = value;
             }
             else if (field == buffer_pool_xoff_field_name)
             {
@@ -2699,6 +2856,8 @@ task_process_status BufferMgrDynamic::handleBufferProfileTable(KeyOpFieldsValues
             {
                 m_applBufferProfileTable.del(profileName);
                 m_stateBufferProfileTable.del(profileName);
+                if (m_bufferCalculator)
+                    m_bufferCalculator->removeProfile(profileName);
             }
 
             m_bufferProfileLookup.erase(profileName);
@@ -2719,7 +2878,6 @@ task_process_status BufferMgrDynamic::handleBufferProfileTable(KeyOpFieldsValues
 void BufferMgrDynamic::handleSetSingleBufferObjectOnAdminDownPort(buffer_direction_t direction, const string &port, const string &key, const string &profile)
 {
     auto &idsToZero = m_bufferObjectIdsToZero[direction];
-    auto &table = m_applBufferObjectTables[direction];
     auto const &objectName = m_bufferObjectNames[direction];
     auto &portInfo = m_portInfoLookup[port];
 
@@ -2767,7 +2925,7 @@ void BufferMgrDynamic::handleSetSingleBufferObjectOnAdminDownPort(buffer_directi
                     auto const &keyToRemove = portPrefix + ids;
                     SWSS_LOG_INFO("Buffer %s %s overlapped with existing zero item %s, remove the latter first",
                                   objectName.c_str(), key.c_str(), keyToRemove.c_str());
-                    table.del(keyToRemove);
+                    updateBufferObjectToDb(keyToRemove, "", false, direction);
                     overlappedUnconfiguredIdsMap = (idsBitmap ^ idsToAddBitmap);
                     overlappedUnconfiguredIdsStr = ids;
                     break;
@@ -2819,7 +2977,7 @@ void BufferMgrDynamic::handleSetSingleBufferObjectOnAdminDownPort(buffer_directi
             // This is to guarantee the port can be "ready" in orchagent
             // In case the port is admin down during initialization, the PG will be removed from the port,
             // which effectively notifies bufferOrch to add the item to the m_ready_list
-            table.del(key);
+            updateBufferObjectToDb(key, "", false, direction);
         }
     }
     else
@@ -3082,7 +3240,7 @@ task_process_status BufferMgrDynamic::handleSingleBufferPgEntry(const string &ke
         else
         {
             SWSS_LOG_NOTICE("Removing BUFFER_PG table entry %s from APPL_DB directly", key.c_str());
-            m_applBufferObjectTables[BUFFER_PG].del(key);
+            updateBufferObjectToDb(key, "", false, BUFFER_PG);
         }
 
         m_portPgLookup[port].erase(key);
@@ -3198,7 +3356,7 @@ task_process_status BufferMgrDynamic::handleSingleBufferQueueEntry(const string
         }
         else
         {
-            m_applBufferObjectTables[BUFFER_QUEUE].del(key);
+            updateBufferObjectToDb(key, "", false, BUFFER_QUEUE);
         }
     }
 
@@ -3262,10 +3420,8 @@ task_process_status BufferMgrDynamic::handleSingleBufferPortProfileListEntry(con
                 {
                     loadZeroPoolAndProfiles();
                 }
-                vector<FieldValueTuple> fvVector;
                 const string &zeroProfileNameList = constructZeroProfileListFromNormalProfileList(profileList, port);
-                fvVector.emplace_back(buffer_profile_list_field_name, zeroProfileNameList);
-                m_applBufferProfileListTables[dir].set(port, fvVector);
+                updateBufferObjectListToDb(port, zeroProfileNameList, dir);
             }
         }
     }
@@ -3275,6 +3431,8 @@ task_process_status BufferMgrDynamic::handleSingleBufferPortProfileListEntry(con
         SWSS_LOG_INFO("Removing entry %s:%s from APPL_DB", tableName.c_str(), key.c_str());
         profileListLookup.erase(port);
         appTable.del(key);
+        if (m_bufferCalculator)
+            m_bufferCalculator->removeProfileList(dir, port);
     }
 
     return task_process_status::task_success;
@@ -3438,6 +3596,8 @@ void BufferMgrDynamic::doTask(Consumer &consumer)
                 break;
         }
     }
+
+    flushSharedBufferPoolUpdate();
 }
 
 /*
@@ -5,7 +5,9 @@
 #include "producerstatetable.h"
 #include "orch.h"
 
+#include <chrono>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 
@@ -31,6 +33,9 @@ typedef struct {
     std::string mode;
     std::string xoff;
     std::string zero_profile_name;
+    // fields from CONFIG_DB, referenced when the pool sizes are calculated
+    std::string configured_size;
+    std::string percentage;
 } buffer_pool_t;
 
 // State of the profile.
@@ -114,6 +119,7 @@ typedef struct {
     std::string supported_speeds;
 
     long lane_count;
+    std::string max_headroom_size;
     sai_uint32_t maximum_buffer_objects[BUFFER_DIR_MAX];
     std::set<std::string> supported_but_not_configured_buffer_objects[BUFFER_DIR_MAX];
 } port_info_t;
@@ -144,6 +150,8 @@ typedef std::map<std::string, std::string> port_profile_list_lookup_t;
 //map from gearbox model to gearbox delay
 typedef std::map<std::string, std::string> gearbox_delay_t;
 
+class BufferCalculator;
+
 class BufferMgrDynamic : public Orch
 {
 public:
@@ -173,6 +181,14 @@ private:
 
     bool m_portInitDone;
     bool m_bufferPoolReady;
+
+    // Coalescing of shared buffer pool size updates, see checkSharedBufferPoolSize
+    bool m_sharedBufferPoolUpdatePending;
+    uint64_t m_sharedBufferPoolUpdatesCoalescedInBatch;
+    uint64_t m_sharedBufferPoolUpdatesCoalesced;
+    uint64_t m_sharedBufferPoolRecalculations;
+    std::chrono::steady_clock::duration m_sharedBufferPoolRecalculationTime;
+    std::chrono::steady_clock::duration m_sharedBufferPoolTimeSaved;
     bool m_bufferObjectsPending;
     bool m_bufferCompletelyInitialized;
 
@@ -256,6 +272,10 @@ private:
     std::string m_bufferpoolSha;
     std::string m_checkHeadroomSha;
 
+    // Native calculation model of the vendor, which is preferred to the lua plugins
+    // nullptr if the vendor doesn't have one
+    std::shared_ptr<BufferCalculator> m_bufferCalculator;
+
     // Parameters for headroom generation
     std::string m_mmuSize;
     unsigned long m_mmuSizeNumber;
@@ -286,11 +306,14 @@ private:
     void updateBufferProfileToDb(const std::string &name, const buffer_profile_t &profile);
     void updateBufferObjectToDb(const std::string &key, const std::string &profile, bool add, buffer_direction_t dir);
     void updateBufferObjectListToDb(const std::string &key, const std::string &profileList, buffer_direction_t dir);
+    bool hasBufferObjectsPendingInOrchagent();
 
     // Meta flows
     bool needRefreshPortDueToEffectiveSpeed(port_info_t &portInfo, std::string &portName);
     void calculateHeadroomSize(buffer_profile_t &headroom);
     void checkSharedBufferPoolSize(bool force_update_during_initialization);
+    void flushSharedBufferPoolUpdate();
+    void updateSharedBufferPoolSize(bool force_update_during_initialization);
     void recalculateSharedBufferPool();
     task_process_status allocateProfile(const std::string &speed, const std::string &cable, const std::string &mtu, const std::string &threshold, const std::string &gearbox_model, long lane_count, std::string &profile_name);
     void releaseProfile(const std::string &profile_name);
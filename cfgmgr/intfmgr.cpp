@@ -25,7 +25,7 @@ using namespace swss;
 #define VRF_PREFIX          "Vrf"
 #define VRF_MGMT            "mgmt"
 
-#define LOOPBACK_DEFAULT_MTU_STR "65536"
+#define LOOPBACK_DEFAULT_MTU     65536
 #define DEFAULT_MTU_STR 9100
 
 IntfMgr::IntfMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, const vector<string> &tableNames) :
@@ -78,21 +78,20 @@ IntfMgr::IntfMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, c
 void IntfMgr::setIntfIp(const string &alias, const string &opCmd,
                         const IpPrefix &ipPrefix)
 {
-    stringstream    cmd;
-    string          res;
-    string          ipPrefixStr = ipPrefix.to_string();
-    string          broadcastIpStr = ipPrefix.getBroadcastIp().to_string();
     int             prefixLen = ipPrefix.getMaskLength();
+    int             ret;
 
-    if (ipPrefix.isV4())
+    if (opCmd != "add")
     {
-        (prefixLen < 31) ?
-        (cmd << IP_CMD << " address " << shellquote(opCmd) << " " << shellquote(ipPrefixStr) << " broadcast " << shellquote(broadcastIpStr) <<" dev " << shellquote(alias)) :
-        (cmd << IP_CMD << " address " << shellquote(opCmd) << " " << shellquote(ipPrefixStr) << " dev " << shellquote(alias));
+        ret = m_kernelCfg.delAddress(alias, ipPrefix);
+    }
+    else if (ipPrefix.isV4())
+    {
+        ret = m_kernelCfg.addAddress(alias, ipPrefix, prefixLen < 31);
     }
     else
     {
-        string metric = "";
+        uint32_t metric = 0;
         // Kernel adds connected route with default metric of 256. But the metric is not
         // communicated to frr unless the ip address is added with explicit metric
         // In voq system, We need the static route to the remote neighbor and connected
@@ -102,67 +101,48 @@ void IntfMgr::setIntfIp(const string &alias, const string &opCmd,
         // to set the metric explicitly.
         if(mySwitchType == "voq")
         {
-           metric = " metric 256";
+           metric = 256;
         }
 
-        (prefixLen < 127) ?
-        (cmd << IP_CMD << " -6 address " << shellquote(opCmd) << " " << shellquote(ipPrefixStr) << " broadcast " << shellquote(broadcastIpStr) <<
-         " dev " << shellquote(alias) << metric) :
-        (cmd << IP_CMD << " -6 address " << shellquote(opCmd) << " " << shellquote(ipPrefixStr) << " dev " << shellquote(alias) << metric);
-    }
-
-    int ret = swss::exec(cmd.str(), res);
-    if (ret)
-    {
-        if (!ipPrefix.isV4() && opCmd == "add")
+        ret = m_kernelCfg.addAddress(alias, ipPrefix, false, metric);
+        if (ret)
         {
-            SWSS_LOG_NOTICE("Failed to assign IPv6 on interface %s with return code %d, trying to enable IPv6 and retry", alias.c_str(), ret);
+            SWSS_LOG_NOTICE("Failed to assign IPv6 on interface %s with error '%s', trying to enable IPv6 and retry",
+                            alias.c_str(), NlKernelCfg::errStr(ret).c_str());
             if (!enableIpv6Flag(alias))
             {
                 SWSS_LOG_ERROR("Failed to enable IPv6 on interface %s", alias.c_str());
                 return;
             }
-            ret = swss::exec(cmd.str(), res);
+            ret = m_kernelCfg.addAddress(alias, ipPrefix, false, metric);
         }
+    }
 
-        if (ret)
-        {
-            SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmd.str().c_str(), ret);
-        }
+    if (ret)
+    {
+        SWSS_LOG_ERROR("Failed to %s ip %s on %s: %s", opCmd.c_str(), ipPrefix.to_string().c_str(),
+                       alias.c_str(), NlKernelCfg::errStr(ret).c_str());
     }
 }
 
 void IntfMgr::setIntfMac(const string &alias, const string &mac_str)
 {
-    stringstream cmd;
-    string res;
-
-    cmd << IP_CMD << " link set " << alias << " address " << mac_str;
-
-    int ret = swss::exec(cmd.str(), res);
+    int ret = m_kernelCfg.setLinkMac(alias, MacAddress(mac_str));
     if (ret)
     {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmd.str().c_str(), ret);
+        SWSS_LOG_ERROR("Failed to set mac %s on %s: %s", mac_str.c_str(), alias.c_str(),
+                       NlKernelCfg::errStr(ret).c_str());
     }
 }
 
 void IntfMgr::setIntfVrf(const string &alias, const string &vrfName)
 {
-    stringstream cmd;
-    string res;
-
-    if (!vrfName.empty())
-    {
-        cmd << IP_CMD << " link set " << shellquote(alias) << " master " << shellquote(vrfName);
-    }
-    else
-    {
-        cmd << IP_CMD << " link set " << shellquote(alias) << " nomaster";
-    }
-    int ret = swss::exec(cmd.str(), res);
+    /* An empty vrf name detaches the interface from its vrf */
+    int ret = m_kernelCfg.setLinkMaster(alias, vrfName);
     if (ret)
     {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmd.str().c_str(), ret);
+        SWSS_LOG_ERROR("Failed to set vrf '%s' on %s: %s", vrfName.c_str(), alias.c_str(),
+                       NlKernelCfg::errStr(ret).c_str());
     }
 }
 
@@ -195,28 +175,19 @@ bool IntfMgr::setIntfMpls(const string &alias, const string& mpls)
 
 void IntfMgr::addLoopbackIntf(const string &alias)
 {
-    stringstream cmd;
-    string res;
-
-    cmd << IP_CMD << " link add " << alias << " mtu " << LOOPBACK_DEFAULT_MTU_STR << " type dummy && ";
-    cmd << IP_CMD << " link set " << alias << " up";
-    int ret = swss::exec(cmd.str(), res);
+    int ret = m_kernelCfg.addLink(alias, "dummy", LOOPBACK_DEFAULT_MTU, true);
     if (ret)
     {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmd.str().c_str(), ret);
+        SWSS_LOG_ERROR("Failed to add loopback device %s: %s", alias.c_str(), NlKernelCfg::errStr(ret).c_str());
     }
 }
 
 void IntfMgr::delLoopbackIntf(const string &alias)
 {
-    stringstream cmd;
-    string res;
-
-    cmd << IP_CMD << " link del " << alias;
-    int ret = swss::exec(cmd.str(), res);
+    int ret = m_kernelCfg.delLink(alias);
     if (ret)
     {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmd.str().c_str(), ret);
+        SWSS_LOG_ERROR("Failed to remove loopback device %s: %s", alias.c_str(), NlKernelCfg::errStr(ret).c_str());
     }
 }
 
@@ -331,11 +302,8 @@ bool IntfMgr::isIntfChangeVrf(const string &alias, const string &vrfName)
 
 void IntfMgr::addHostSubIntf(const string&intf, const string &subIntf, const string &vlan)
 {
-    stringstream cmd;
-    string res;
-
-    cmd << IP_CMD " link add link " << shellquote(intf) << " name " << shellquote(subIntf) << " type vlan id " << shellquote(vlan);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    NL_WITH_ERROR_THROW(m_kernelCfg.addVlanLink(intf, subIntf, static_cast<uint16_t>(stoul(vlan))),
+                        "Failed to add sub interface " + subIntf + " vlan " + vlan + " on " + intf);
 }
 
 
@@ -431,9 +399,6 @@ void IntfMgr::updateSubIntfMtu(const string &alias, const string &mtu)
 
 std::string IntfMgr::setHostSubIntfMtu(const string &alias, const string &mtu, const string &parent_mtu)
 {
-    stringstream cmd;
-    string res;
-
     string subifMtu = mtu;
     subIntf subIf(alias);
 
@@ -445,19 +410,18 @@ std::string IntfMgr::setHostSubIntfMtu(const string &alias, const string &mtu, c
         subifMtu = parent_mtu;
     }
     SWSS_LOG_INFO("subintf %s active mtu: %s", alias.c_str(), subifMtu.c_str());
-    cmd << IP_CMD " link set " << shellquote(alias) << " mtu " << shellquote(subifMtu);
-    std::string cmd_str = cmd.str();
-    int ret = swss::exec(cmd_str, res);
+    int ret = m_kernelCfg.setLinkMtu(alias, static_cast<uint32_t>(stoul(subifMtu)));
 
     if (ret && !isIntfStateOk(alias))
     {
         // Can happen when a SET notification on the PORT_TABLE in the State DB
         // followed by a new DEL notification that send by portmgrd
-        SWSS_LOG_WARN("Setting mtu to %s netdev failed with cmd:%s, rc:%d, error:%s", alias.c_str(), cmd_str.c_str(), ret, res.c_str());
+        SWSS_LOG_WARN("Setting mtu %s to %s netdev failed, error:%s", subifMtu.c_str(), alias.c_str(),
+                      NlKernelCfg::errStr(ret).c_str());
     }
     else if (ret)
     {
-        throw runtime_error(cmd_str + " : " + res);
+        throw runtime_error("Failed to set mtu " + subifMtu + " on " + alias + " : " + NlKernelCfg::errStr(ret));
     }
     return subifMtu;
 }
@@ -489,24 +453,20 @@ void IntfMgr::updateSubIntfAdminStatus(const string &alias, const string &admin)
 
 std::string IntfMgr::setHostSubIntfAdminStatus(const string &alias, const string &admin_status, const string &parent_admin_status)
 {
-    stringstream cmd;
-    string res, cmd_str;
-
     if (parent_admin_status == "up" || admin_status == "down")
     {
         SWSS_LOG_INFO("subintf %s admin_status: %s", alias.c_str(), admin_status.c_str());
-        cmd << IP_CMD " link set " << shellquote(alias) << " " << shellquote(admin_status);
-        cmd_str = cmd.str();
-        int ret = swss::exec(cmd_str, res);
+        int ret = m_kernelCfg.setLinkAdminState(alias, admin_status);
         if (ret && !isIntfStateOk(alias))
         {
             // Can happen when a DEL notification is sent by portmgrd immediately followed by a new SET notification
-            SWSS_LOG_WARN("Setting admin_status to %s netdev failed with cmd:%s, rc:%d, error:%s",
-                          alias.c_str(), cmd_str.c_str(), ret, res.c_str());
+            SWSS_LOG_WARN("Setting admin_status %s to %s netdev failed, error:%s",
+                          admin_status.c_str(), alias.c_str(), NlKernelCfg::errStr(ret).c_str());
         }
         else if (ret)
         {
-            throw runtime_error(cmd_str + " : " + res);
+            throw runtime_error("Failed to set admin_status " + admin_status + " on " + alias + " : " +
+                                NlKernelCfg::errStr(ret));
         }
         return admin_status;
     }
@@ -518,11 +478,7 @@ std::string IntfMgr::setHostSubIntfAdminStatus(const string &alias, const string
 
 void IntfMgr::removeHostSubIntf(const string &subIntf)
 {
-    stringstream cmd;
-    string res;
-
-    cmd << IP_CMD " link del " << shellquote(subIntf);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    NL_WITH_ERROR_THROW(m_kernelCfg.delLink(subIntf), "Failed to remove sub interface " + subIntf);
 }
 
 void IntfMgr::setSubIntfStateOk(const string &alias)
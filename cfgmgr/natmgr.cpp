@@ -15,6 +15,7 @@
  */
 
 #include <string.h>
+#include <inttypes.h>
 #include "logger.h"
 #include "producerstatetable.h"
 #include "macaddress.h"
@@ -40,6 +41,7 @@ NatMgr::NatMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, con
         m_stateInterfaceTable(stateDb, STATE_INTERFACE_TABLE_NAME),
         m_stateWarmRestartEnableTable(stateDb, STATE_WARM_RESTART_ENABLE_TABLE_NAME),
         m_stateWarmRestartTable(stateDb, STATE_WARM_RESTART_TABLE_NAME),
+        m_stateNatMgrStatsTable(stateDb, STATE_NATMGR_STATS_TABLE_NAME),
         m_appNatTableProducer(appDb, APP_NAT_TABLE_NAME),
         m_appNaptTableProducer(appDb, APP_NAPT_TABLE_NAME),
         m_appTwiceNatTableProducer(appDb, APP_NAT_TWICE_TABLE_NAME),
@@ -64,6 +66,11 @@ NatMgr::NatMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, con
     /* Set NAT default udp timeout as 300 seconds */
     m_natUdpTimeout = NAT_UDP_TIMEOUT_DEFAULT;
 
+    m_iptablesBatching     = false;
+    m_iptablesBatchBytes   = 0;
+    m_iptablesRulesApplied = 0;
+    m_iptablesApplyTime    = std::chrono::steady_clock::duration::zero();
+
     /* Start the timer to refresh static conntrack entries for every 1 day (86400) */
     SWSS_LOG_INFO("Start the NAT Refresh Timer ");
     auto refresh_interval      = timespec { .tv_sec = NAT_ENTRY_REFRESH_PERIOD, .tv_nsec = 0 };
@@ -372,16 +379,21 @@ void NatMgr::flushAllNatEntries(void)
 /* To Update a conntrack entry for the Dynamic Single NAT entry in the kernel */
 void NatMgr::updateDynamicSingleNatConnTrackTimeout(string key, int timeout)
 {
-    std::string res;
-    std::string cmds = std::string("") + CONNTRACK_CMD;
-    IpAddress   ip_address = IpAddress(key);
+    IpAddress           ip_address = IpAddress(key);
+    NlConntrack::Filter filter;
 
-    cmds += (" -U -s " + ip_address.to_string() + " -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
-    int ret = swss::exec(cmds, res);
+    if (!NlConntrack::toHostIp(ip_address.to_string(), filter.srcIp))
+    {
+        SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack update", ip_address.to_string().c_str());
+        return;
+    }
+
+    int ret = m_conntrack.updateTimeout(filter, static_cast<uint32_t>(timeout));
 
     if (ret)
     {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
+        SWSS_LOG_ERROR("Updating conntrack entries with src-ip %s failed, error %s",
+                       ip_address.to_string().c_str(), NlConntrack::errStr(ret).c_str());
     }
     else
     {
@@ -393,19 +405,26 @@ void NatMgr::updateDynamicSingleNatConnTrackTimeout(string key, int timeout)
 /* To Update a conntrack entry for the Dynamic Single NAPT entry in the kernel */
 void NatMgr::updateDynamicSingleNaptConnTrackTimeout(string key, int timeout)
 {
-    std::string     res;
-    vector<string>  keys = tokenize(key, ':');
-    IpAddress       ip_address = IpAddress(keys[1]);
-    int             l4_port = stoi(keys[2]);
-    string          prototype = ((keys[0] == string("TCP")) ? "tcp" : "udp");
-    std::string     cmds = std::string("") + CONNTRACK_CMD;
-    
-    cmds += (" -U -s " + ip_address.to_string() + " -p " + prototype + " --orig-port-src " + to_string(l4_port) + " -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
-    int ret = swss::exec(cmds, res);
+    vector<string>      keys = tokenize(key, ':');
+    IpAddress           ip_address = IpAddress(keys[1]);
+    int                 l4_port = stoi(keys[2]);
+    string              prototype = ((keys[0] == string("TCP")) ? "tcp" : "udp");
+    NlConntrack::Filter filter;
+
+    filter.protocol = NlConntrack::toProtocol(prototype);
+    if (!NlConntrack::toHostIp(ip_address.to_string(), filter.srcIp))
+    {
+        SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack update", ip_address.to_string().c_str());
+        return;
+    }
+    filter.srcPort  = static_cast<uint16_t>(l4_port);
+
+    int ret = m_conntrack.updateTimeout(filter, static_cast<uint32_t>(timeout));
 
     if (ret)
     {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
+        SWSS_LOG_ERROR("Updating conntrack entries with protocol %s, src-ip %s, src-port %d failed, error %s",
+                       prototype.c_str(), ip_address.to_string().c_str(), l4_port, NlConntrack::errStr(ret).c_str());
     }
     else
     {
@@ -417,15 +436,23 @@ void NatMgr::updateDynamicSingleNaptConnTrackTimeout(string key, int timeout)
 /* To Update a conntrack entry for the Dynamic Twice NAT entry in the kernel */
 void NatMgr::updateDynamicTwiceNatConnTrackTimeout(string key, int timeout)
 {
-    std::string     res;
-    std::string     cmd = std::string("") + CONNTRACK_CMD;
-    vector<string>  keys = tokenize(key, ':');
-    IpAddress       src_ip = IpAddress(keys[1]);
-    IpAddress       dst_ip = IpAddress(keys[1]);
+    vector<string>      keys = tokenize(key, ':');
+    IpAddress           src_ip = IpAddress(keys[0]);
+    IpAddress           dst_ip = IpAddress(keys[1]);
+    NlConntrack::Filter filter;
 
-    cmd += (" -U -s " + src_ip.to_string() + " -d " + dst_ip.to_string() + " -t " + std::to_string(timeout) + REDIRECT_TO_DEV_NULL);
+    if (!NlConntrack::toHostIp(src_ip.to_string(), filter.srcIp))
+    {
+        SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack update", src_ip.to_string().c_str());
+        return;
+    }
+    if (!NlConntrack::toHostIp(dst_ip.to_string(), filter.dstIp))
+    {
+        SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack update", dst_ip.to_string().c_str());
+        return;
+    }
 
-    swss::exec(cmd, res);
+    m_conntrack.updateTimeout(filter, static_cast<uint32_t>(timeout));
 
     SWSS_LOG_INFO("Updated active Twice NAT conntrack entry with src-ip %s, dst-ip %s, timeout %u",
                   src_ip.to_string().c_str(), dst_ip.to_string().c_str(), timeout);
@@ -434,20 +461,29 @@ void NatMgr::updateDynamicTwiceNatConnTrackTimeout(string key, int timeout)
 /* To Update a conntrack entry for the Dynamic Twice NAPT entry in the kernel */
 void NatMgr::updateDynamicTwiceNaptConnTrackTimeout(string key, int timeout)
 {
-    std::string     res;
-    std::string     cmd = std::string("") + CONNTRACK_CMD;
-    vector<string>  keys = tokenize(key, ':');
-    IpAddress       src_ip      = IpAddress(keys[1]);
-    int             src_l4_port = stoi(keys[2]);
-    IpAddress       dst_ip      = IpAddress(keys[3]);
-    int             dst_l4_port = stoi(keys[4]);
-    string          prototype = ((keys[0] == string("TCP")) ? "tcp" : "udp");
-
-    cmd += (" -U -s " + src_ip.to_string() + " -p " + prototype + " --orig-port-src " + to_string(src_l4_port) +
-            " -d " + dst_ip.to_string() + " --orig-port-dst " + std::to_string(dst_l4_port) +
-            " -t " + std::to_string(timeout) + REDIRECT_TO_DEV_NULL);
+    vector<string>      keys = tokenize(key, ':');
+    IpAddress           src_ip      = IpAddress(keys[1]);
+    int                 src_l4_port = stoi(keys[2]);
+    IpAddress           dst_ip      = IpAddress(keys[3]);
+    int                 dst_l4_port = stoi(keys[4]);
+    string              prototype = ((keys[0] == string("TCP")) ? "tcp" : "udp");
+    NlConntrack::Filter filter;
+
+    filter.protocol = NlConntrack::toProtocol(prototype);
+    if (!NlConntrack::toHostIp(src_ip.to_string(), filter.srcIp))
+    {
+        SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack update", src_ip.to_string().c_str());
+        return;
+    }
+    filter.srcPort  = static_cast<uint16_t>(src_l4_port);
+    if (!NlConntrack::toHostIp(dst_ip.to_string(), filter.dstIp))
+    {
+        SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack update", dst_ip.to_string().c_str());
+        return;
+    }
+    filter.dstPort  = static_cast<uint16_t>(dst_l4_port);
 
-    swss::exec(cmd, res);
+    m_conntrack.updateTimeout(filter, static_cast<uint32_t>(timeout));
 
     SWSS_LOG_INFO("Updated active Twice NAPT conntrack entry with protocol %s, src-ip %s, src-port %d, dst-ip %s, dst-port %d, timeout %u",
                   prototype.c_str(), src_ip.to_string().c_str(), src_l4_port, dst_ip.to_string().c_str(), dst_l4_port, timeout);
@@ -605,47 +641,72 @@ void NatMgr::addConntrackStaticTwiceNaptEntry(const string &snatKey, const strin
 /* To Update a dummy conntrack entry for the Static Single NAT entry in the kernel */
 void NatMgr::updateConntrackStaticSingleNatEntry(const string &key)
 {
-    std::string res, cmds = std::string("") + CONNTRACK_CMD;
     int timeout = NAT_TIMEOUT_MAX;
+    NlConntrack::Filter filter;
+
+    filter.protocol = IPPROTO_UDP;
 
     if (m_staticNatEntry[key].nat_type == DNAT_NAT_TYPE)
     {
         SWSS_LOG_INFO("Update static NAT conntrack entry with src-ip %s, timeout %d",
                       m_staticNatEntry[key].local_ip.c_str(), timeout);
 
-        cmds += (" -U --src " + m_staticNatEntry[key].local_ip + " -p udp -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
+        if (!NlConntrack::toHostIp(m_staticNatEntry[key].local_ip, filter.srcIp))
+        {
+            SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack update", m_staticNatEntry[key].local_ip.c_str());
+            return;
+        }
     }
     else if (m_staticNatEntry[key].nat_type == SNAT_NAT_TYPE)
     {
         SWSS_LOG_INFO("Update static NAT conntrack entry with src-ip %s, timeout %d",
                       key.c_str(), timeout);
 
-        cmds += (" -U --src " + key + " -p udp -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
+        if (!NlConntrack::toHostIp(key, filter.srcIp))
+        {
+            SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack update", key.c_str());
+            return;
+        }
+    }
+    else
+    {
+        return;
     }
 
-    swss::exec(cmds, res);
+    m_conntrack.updateTimeout(filter, static_cast<uint32_t>(timeout));
 }
 
 /* To Update a dummy conntrack entry for the Static Twice NAT entry in the kernel */
 void NatMgr::updateConntrackStaticTwiceNatEntry(const string &snatKey, const string &dnatKey)
 {
-    std::string res, cmds = std::string("") + CONNTRACK_CMD;
     int timeout = NAT_TIMEOUT_MAX;
+    NlConntrack::Filter filter;
 
     SWSS_LOG_INFO("Update static Twice NAT conntrack entry with src-ip %s, dst-ip %s, timeout %u",
                   snatKey.c_str(), dnatKey.c_str(), timeout);
-   
-    cmds += (" -U --src " + snatKey + " -p udp -t " + to_string(timeout) + " --dst " + dnatKey + REDIRECT_TO_DEV_NULL);
 
-    swss::exec(cmds, res);
+    filter.protocol = IPPROTO_UDP;
+    if (!NlConntrack::toHostIp(snatKey, filter.srcIp))
+    {
+        SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack update", snatKey.c_str());
+        return;
+    }
+    if (!NlConntrack::toHostIp(dnatKey, filter.dstIp))
+    {
+        SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack update", dnatKey.c_str());
+        return;
+    }
+
+    m_conntrack.updateTimeout(filter, static_cast<uint32_t>(timeout));
 }
 
 /* To update a dummy conntrack entry for the Static NAPT entry in the kernel */
 void NatMgr::updateConntrackStaticSingleNaptEntry(const string &key)
 {
     int timeout = NAT_TIMEOUT_MAX;
-    std::string res, prototype, cmds = std::string("") + CONNTRACK_CMD;
+    std::string prototype;
     vector<string> keys = tokenize(key, config_db_key_delimiter);
+    NlConntrack::Filter filter;
 
     if (keys[1] == to_upper(IP_PROTOCOL_UDP))
     {
@@ -656,33 +717,49 @@ void NatMgr::updateConntrackStaticSingleNaptEntry(const string &key)
         prototype = IP_PROTOCOL_TCP;
     }
 
+    filter.protocol = NlConntrack::toProtocol(prototype);
+
     if (m_staticNaptEntry[key].nat_type == DNAT_NAT_TYPE)
     {
 
         SWSS_LOG_INFO("Update static NAPT conntrack entry with protocol %s, src-ip %s, src-port %s, timeout %d",
                       prototype.c_str(), m_staticNaptEntry[key].local_ip.c_str(), m_staticNaptEntry[key].local_port.c_str(), timeout);
- 
-        cmds += (" -U --src " + m_staticNaptEntry[key].local_ip + " -p " + prototype + " --sport " + m_staticNaptEntry[key].local_port + " -t " 
-                 + to_string(timeout) + REDIRECT_TO_DEV_NULL);
+
+        if (!NlConntrack::toHostIp(m_staticNaptEntry[key].local_ip, filter.srcIp))
+        {
+            SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack update", m_staticNaptEntry[key].local_ip.c_str());
+            return;
+        }
+        filter.srcPort = to_uint<uint16_t>(m_staticNaptEntry[key].local_port);
     }
     else if (m_staticNaptEntry[key].nat_type == SNAT_NAT_TYPE)
     {
         SWSS_LOG_INFO("Update static NAPT conntrack entry with protocol %s, src-ip %s, src-port %s, timeout %d",
                       prototype.c_str(), keys[0].c_str(), keys[2].c_str(), timeout);
 
-        cmds += (" -U --src " + keys[0] + " -p " + prototype + " --sport " + keys[2] + " -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
+        if (!NlConntrack::toHostIp(keys[0], filter.srcIp))
+        {
+            SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack update", keys[0].c_str());
+            return;
+        }
+        filter.srcPort = to_uint<uint16_t>(keys[2]);
+    }
+    else
+    {
+        return;
     }
 
-    swss::exec(cmds, res);
+    m_conntrack.updateTimeout(filter, static_cast<uint32_t>(timeout));
 }
 
 /* To Update a dummy conntrack entry for the Static Twice NAPT entry in the kernel */
 void NatMgr::updateConntrackStaticTwiceNaptEntry(const string &snatKey, const string &dnatKey)
 {
     int timeout = NAT_TIMEOUT_MAX;
-    std::string res, prototype, cmds = std::string("") + CONNTRACK_CMD;
+    std::string prototype;
     vector<string> snatKeys = tokenize(snatKey, config_db_key_delimiter);
     vector<string> dnatKeys = tokenize(dnatKey, config_db_key_delimiter);
+    NlConntrack::Filter filter;
 
     if (snatKeys[1] == to_upper(IP_PROTOCOL_UDP))
     {
@@ -696,35 +773,60 @@ void NatMgr::updateConntrackStaticTwiceNaptEntry(const string &snatKey, const st
     SWSS_LOG_DEBUG("Update static Twice NAPT conntrack entry with protocol %s, src-ip %s, src-port %s, dst-ip %s, dst-port %s, timeout %u",
                    prototype.c_str(), snatKeys[0].c_str(), snatKeys[2].c_str(), dnatKeys[0].c_str(), dnatKeys[2].c_str(), timeout);
 
-    cmds += (" -U --src " + snatKeys[0] + " --dst " + dnatKeys[0] + " -p udp " + " --sport " + snatKeys[2] + " --dport " + dnatKeys[2]
-             + " -p udp -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
+    filter.protocol = NlConntrack::toProtocol(prototype);
+    if (!NlConntrack::toHostIp(snatKeys[0], filter.srcIp))
+    {
+        SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack update", snatKeys[0].c_str());
+        return;
+    }
+    filter.srcPort  = to_uint<uint16_t>(snatKeys[2]);
+    if (!NlConntrack::toHostIp(dnatKeys[0], filter.dstIp))
+    {
+        SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack update", dnatKeys[0].c_str());
+        return;
+    }
+    filter.dstPort  = to_uint<uint16_t>(dnatKeys[2]);
 
-    swss::exec(cmds, res);
+    m_conntrack.updateTimeout(filter, static_cast<uint32_t>(timeout));
 }
 
 /* To Delete conntrack entry for Static Single NAT entry */
 void NatMgr::deleteConntrackStaticSingleNatEntry(const string &key)
 {
-    std::string res, cmds = std::string("") + CONNTRACK_CMD;
+    NlConntrack::Filter filter;
+
+    filter.protocol = IPPROTO_UDP;
 
     if (m_staticNatEntry[key].nat_type == DNAT_NAT_TYPE)
     {
         SWSS_LOG_INFO("Delete static NAT conntrack entry with src-ip %s", m_staticNatEntry[key].local_ip.c_str());
 
-        cmds += (" -D -s " + m_staticNatEntry[key].local_ip + " -p udp" + REDIRECT_TO_DEV_NULL);
+        if (!NlConntrack::toHostIp(m_staticNatEntry[key].local_ip, filter.srcIp))
+        {
+            SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack deletion", m_staticNatEntry[key].local_ip.c_str());
+            return;
+        }
     }
     else if (m_staticNatEntry[key].nat_type == SNAT_NAT_TYPE)
     {
         SWSS_LOG_INFO("Delete static NAT conntrack entry with src-ip %s", key.c_str());
 
-        cmds += (" -D -s " + key + " -p udp" + REDIRECT_TO_DEV_NULL);
+        if (!NlConntrack::toHostIp(key, filter.srcIp))
+        {
+            SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack deletion", key.c_str());
+            return;
+        }
+    }
+    else
+    {
+        return;
     }
 
-    int ret = swss::exec(cmds, res);
+    int ret = m_conntrack.deleteEntries(filter);
 
     if (ret)
     {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
+        SWSS_LOG_ERROR("Deleting Static NAT conntrack entry failed, error %s", NlConntrack::errStr(ret).c_str());
     }
     else
     {
@@ -735,17 +837,26 @@ void NatMgr::deleteConntrackStaticSingleNatEntry(const string &key)
 /* To Delete conntrack entry for Static Twice NAT entry */
 void NatMgr::deleteConntrackStaticTwiceNatEntry(const string &snatKey, const string &dnatKey)
 {
-    std::string res, cmds = std::string("") + CONNTRACK_CMD;
+    NlConntrack::Filter filter;
 
     SWSS_LOG_INFO("Delete static Twice NAT conntrack entry with src-ip %s and dst-ip %s", snatKey.c_str(), dnatKey.c_str());
 
-    cmds += (" -D -s " + snatKey + " -d " + dnatKey + REDIRECT_TO_DEV_NULL);
+    if (!NlConntrack::toHostIp(snatKey, filter.srcIp))
+    {
+        SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack deletion", snatKey.c_str());
+        return;
+    }
+    if (!NlConntrack::toHostIp(dnatKey, filter.dstIp))
+    {
+        SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack deletion", dnatKey.c_str());
+        return;
+    }
 
-    int ret = swss::exec(cmds, res);
+    int ret = m_conntrack.deleteEntries(filter);
 
     if (ret)
     {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
+        SWSS_LOG_ERROR("Deleting Static Twice NAT conntrack entry failed, error %s", NlConntrack::errStr(ret).c_str());
     }
     else
     {
@@ -756,8 +867,9 @@ void NatMgr::deleteConntrackStaticTwiceNatEntry(const string &snatKey, const str
 /* To Delete conntrack entry for Static Single NAPT entry */
 void NatMgr::deleteConntrackStaticSingleNaptEntry(const string &key)
 {
-    std::string res, prototype, cmds = std::string("") + CONNTRACK_CMD;
+    std::string prototype;
     vector<string> keys = tokenize(key, config_db_key_delimiter);
+    NlConntrack::Filter filter;
 
     if (keys[1] == to_upper(IP_PROTOCOL_UDP))
     {
@@ -768,26 +880,42 @@ void NatMgr::deleteConntrackStaticSingleNaptEntry(const string &key)
         prototype = IP_PROTOCOL_TCP;
     }
 
+    filter.protocol = NlConntrack::toProtocol(prototype);
+
     if (m_staticNaptEntry[key].nat_type == DNAT_NAT_TYPE)
     {
         SWSS_LOG_INFO("Delete static NAPT conntrack entry with protocol %s, src-ip %s, src-port %s",
                       prototype.c_str(), m_staticNaptEntry[key].local_ip.c_str(), m_staticNaptEntry[key].local_port.c_str());
 
-        cmds += (" -D -s " + m_staticNaptEntry[key].local_ip + " -p " + prototype + " --sport " + m_staticNaptEntry[key].local_port + REDIRECT_TO_DEV_NULL);
+        if (!NlConntrack::toHostIp(m_staticNaptEntry[key].local_ip, filter.srcIp))
+        {
+            SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack deletion", m_staticNaptEntry[key].local_ip.c_str());
+            return;
+        }
+        filter.srcPort = to_uint<uint16_t>(m_staticNaptEntry[key].local_port);
     }
     else if (m_staticNaptEntry[key].nat_type == SNAT_NAT_TYPE)
     {
         SWSS_LOG_INFO("Delete static NAPT conntrack entry with protocol %s, src-ip %s, src-port %s",
                       prototype.c_str(), keys[0].c_str(), keys[2].c_str());
 
-        cmds += (" -D -s " + keys[0] + " -p " + prototype + " --sport " + keys[2] + REDIRECT_TO_DEV_NULL);
+        if (!NlConntrack::toHostIp(keys[0], filter.srcIp))
+        {
+            SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack deletion", keys[0].c_str());
+            return;
+        }
+        filter.srcPort = to_uint<uint16_t>(keys[2]);
+    }
+    else
+    {
+        return;
     }
 
-    int ret = swss::exec(cmds, res);
+    int ret = m_conntrack.deleteEntries(filter);
 
     if (ret)
     {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
+        SWSS_LOG_ERROR("Deleting Static NAPT conntrack entry failed, error %s", NlConntrack::errStr(ret).c_str());
     }
     else
     {
@@ -798,9 +926,10 @@ void NatMgr::deleteConntrackStaticSingleNaptEntry(const string &key)
 /* To Delete conntrack entry for Static Twice NAPT entry */
 void NatMgr::deleteConntrackStaticTwiceNaptEntry(const string &snatKey, const string &dnatKey)
 {
-    std::string res, prototype, cmds = std::string("") + CONNTRACK_CMD;
+    std::string prototype;
     vector<string> snatKeys = tokenize(snatKey, config_db_key_delimiter);
     vector<string> dnatKeys = tokenize(dnatKey, config_db_key_delimiter);
+    NlConntrack::Filter filter;
 
     if (snatKeys[1] == to_upper(IP_PROTOCOL_UDP))
     {
@@ -814,13 +943,25 @@ void NatMgr::deleteConntrackStaticTwiceNaptEntry(const string &snatKey, const st
     SWSS_LOG_INFO("Delete static Twice NAPT conntrack entry with protocol %s, src-ip %s, src-port %s, dst-ip %s, dst-port %s",
                   prototype.c_str(), snatKeys[0].c_str(), snatKeys[2].c_str(), dnatKeys[0].c_str(), dnatKeys[2].c_str());
 
-    cmds += (" -D -s " + snatKeys[0] + " -p " + prototype + " --orig-port-src " + snatKeys[2] + " -d " + dnatKeys[0] + " --orig-port-dst " + dnatKeys[2] + REDIRECT_TO_DEV_NULL);
+    filter.protocol = NlConntrack::toProtocol(prototype);
+    if (!NlConntrack::toHostIp(snatKeys[0], filter.srcIp))
+    {
+        SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack deletion", snatKeys[0].c_str());
+        return;
+    }
+    filter.srcPort  = to_uint<uint16_t>(snatKeys[2]);
+    if (!NlConntrack::toHostIp(dnatKeys[0], filter.dstIp))
+    {
+        SWSS_LOG_ERROR("Invalid IPv4 address %s, skipping the conntrack deletion", dnatKeys[0].c_str());
+        return;
+    }
+    filter.dstPort  = to_uint<uint16_t>(dnatKeys[2]);
 
-    int ret = swss::exec(cmds, res);
+    int ret = m_conntrack.deleteEntries(filter);
 
     if (ret)
     {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
+        SWSS_LOG_ERROR("Deleting Static Twice NAPT conntrack entry failed, error %s", NlConntrack::errStr(ret).c_str());
     }
     else
     {
@@ -831,10 +972,8 @@ void NatMgr::deleteConntrackStaticTwiceNaptEntry(const string &snatKey, const st
 /* To Delete conntrack entries for matching Pool ip address */
 void NatMgr::deleteConntrackDynamicEntries(const string &ip_range)
 {
-    std::string res, cmds;
-
-    uint32_t ipv4_addr_low, ipv4_addr_high, ip, setIp;
-    char ipAddr[INET_ADDRSTRLEN];
+    NlConntrack::Filter filter;
+    size_t count = 0;
 
     vector<string> nat_ip = tokenize(ip_range, range_specifier);
 
@@ -844,41 +983,220 @@ void NatMgr::deleteConntrackDynamicEntries(const string &ip_range)
         SWSS_LOG_INFO("NAT pool is not valid");
         return;
     }
-    else if (nat_ip.size() == 2)
+
+    /* Entries translated to any of the pool addresses, removed with a single conntrack dump */
+    if (!NlConntrack::toHostIp(nat_ip[0], filter.replyDstLow) ||
+        !NlConntrack::toHostIp(nat_ip.back(), filter.replyDstHigh))
+    {
+        SWSS_LOG_INFO("NAT pool %s is not valid", ip_range.c_str());
+        return;
+    }
+
+    SWSS_LOG_INFO("Delete dynamic conntrack entries with translated-src-ip in %s", ip_range.c_str());
+
+    int ret = m_conntrack.deleteEntries(filter, &count);
+
+    if (ret)
     {
-        inet_pton(AF_INET, nat_ip[1].c_str(), &ipv4_addr_high);
-        ipv4_addr_high = ntohl(ipv4_addr_high);
-        inet_pton(AF_INET, nat_ip[0].c_str(), &ipv4_addr_low);
-        ipv4_addr_low = ntohl(ipv4_addr_low);
+        SWSS_LOG_ERROR("Deleting dynamic conntrack entries for pool %s failed, error %s",
+                       ip_range.c_str(), NlConntrack::errStr(ret).c_str());
     }
     else
     {
-        inet_pton(AF_INET, nat_ip[0].c_str(), &ipv4_addr_low);
-        ipv4_addr_high = ntohl(ipv4_addr_low);
-        ipv4_addr_low = ntohl(ipv4_addr_low);
+        SWSS_LOG_INFO("Deleted %zu dynamic conntrack entries", count);
     }
+}
 
-    for (ip = ipv4_addr_low; ip <= ipv4_addr_high; ip++)
+NatMgr::BatchGuard::BatchGuard(NatMgr &natMgr) :
+    m_natMgr(natMgr)
+{
+    m_natMgr.beginIptablesBatch();
+    m_natMgr.m_conntrack.beginBatch();
+}
+
+NatMgr::BatchGuard::~BatchGuard()
+{
+    /* The staged changes are already accounted in the caches, so they are applied
+     * even when the scope is left by an exception, which must not escape from here.
+     */
+    try
+    {
+        m_natMgr.commitIptablesBatch();
+        m_natMgr.commitConntrackBatch();
+    }
+    catch (const std::exception &e)
     {
-        setIp = htonl(ip);
-        inet_ntop(AF_INET, &setIp, ipAddr, INET_ADDRSTRLEN);
-        std::string ipAddrString(ipAddr);
+        SWSS_LOG_ERROR("Failed to commit the NAT batch: %s", e.what());
+    }
+}
 
-        SWSS_LOG_INFO("Delete dynamic conntrack entry with translated-src-ip %s", ipAddr);
+/* To start staging the iptables rules instead of executing them one by one */
+void NatMgr::beginIptablesBatch(void)
+{
+    m_iptablesBatching = true;
+}
 
-        cmds = (std::string("") + CONNTRACK_CMD + " -D -q " + ipAddrString + REDIRECT_TO_DEV_NULL);
+/* To apply the staged iptables rules as a single iptables-restore transaction.
+ * The staged rules all belong to one table, so a rejected transaction has not
+ * applied anything and the original commands are replayed one by one to apply
+ * the valid rules and log the others.
+ * Returns 0 when every staged rule was applied, else the rc of the first failed command.
+ */
+int NatMgr::commitIptablesBatch(void)
+{
+    SWSS_LOG_ENTER();
 
-        int ret = swss::exec(cmds, res);
+    m_iptablesBatching = false;
 
-        if (ret)
+    if (m_iptablesBatchCmds.empty())
+    {
+        return 0;
+    }
+
+    std::string res, cmds, rules;
+    size_t count = m_iptablesBatchRules.size();
+    int status = 0;
+
+    rules = "*" + m_iptablesBatchTable + "\n";
+    for (const auto &rule : m_iptablesBatchRules)
+    {
+        rules += rule + "\n";
+    }
+    rules += "COMMIT\n";
+
+    cmds = std::string("") + IPTABLES_RESTORE_CMD + " --noflush <<'EOF'\n" + rules + "EOF";
+
+    auto start = std::chrono::steady_clock::now();
+    int ret = swss::exec(cmds, res);
+
+    if (ret)
+    {
+        SWSS_LOG_WARN("iptables-restore of %zu rules failed with rc %d, applying the commands one by one", count, ret);
+
+        for (const auto &cmd : m_iptablesBatchCmds)
         {
-            SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
+            ret = swss::exec(cmd, res);
+            if (ret)
+            {
+                SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmd.c_str(), ret);
+                if (!status)
+                {
+                    status = ret;
+                }
+            }
         }
-        else
+    }
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    m_iptablesRulesApplied += count;
+    m_iptablesApplyTime += elapsed;
+
+    auto usecs = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+    auto totalUsecs = std::chrono::duration_cast<std::chrono::microseconds>(m_iptablesApplyTime).count();
+    uint64_t rate = usecs ? (count * 1000000 / static_cast<uint64_t>(usecs)) : 0;
+    uint64_t totalRate = totalUsecs ? (m_iptablesRulesApplied * 1000000 / static_cast<uint64_t>(totalUsecs)) : 0;
+
+    if (count >= IPTABLES_RESTORE_LOG_MIN)
+    {
+        SWSS_LOG_NOTICE("Applied %zu iptables rules in %ld us (%" PRIu64 " rules/sec), total %" PRIu64 " rules at %" PRIu64 " rules/sec",
+                        count, static_cast<long>(usecs), rate, m_iptablesRulesApplied, totalRate);
+    }
+    else
+    {
+        SWSS_LOG_INFO("Applied %zu iptables rules in %ld us (%" PRIu64 " rules/sec), total %" PRIu64 " rules at %" PRIu64 " rules/sec",
+                      count, static_cast<long>(usecs), rate, m_iptablesRulesApplied, totalRate);
+    }
+
+    vector<FieldValueTuple> stats = {
+        { "last_batch_rules",       to_string(count) },
+        { "last_batch_time_us",     to_string(usecs) },
+        { "last_batch_rules_per_sec", to_string(rate) },
+        { "rules_applied",          to_string(m_iptablesRulesApplied) },
+        { "apply_time_us",          to_string(totalUsecs) },
+        { "rules_per_sec",          to_string(totalRate) },
+    };
+    m_stateNatMgrStatsTable.set(NATMGR_STATS_IPTABLES_KEY, stats);
+
+    m_iptablesBatchTable.clear();
+    m_iptablesBatchRules.clear();
+    m_iptablesBatchCmds.clear();
+    m_iptablesBatchBytes = 0;
+
+    return status;
+}
+
+/* To execute the iptables commands right away. The staged rules are applied
+ * first to keep the ordering, so the returned status is the real one and the
+ * callers can update their state from it.
+ */
+int NatMgr::execIptablesCmd(const string &cmds, string &res)
+{
+    if (m_iptablesBatching)
+    {
+        commitIptablesBatch();
+        beginIptablesBatch();
+    }
+
+    return swss::exec(cmds, res);
+}
+
+/* To stage the iptables commands when a batch is open, for the callers that
+ * only log the result. Only "iptables -t <table> <rule> && ..." chains on a
+ * single table are staged, anything else is executed right away. A staged
+ * command returns 0, its failure is reported when the batch is committed.
+ */
+int NatMgr::stageIptablesCmd(const string &cmds, string &res)
+{
+    const std::string prefix = std::string("") + IPTABLES_CMD + " -t ";
+    const std::string separator = " && ";
+    std::vector<std::string> rules;
+    std::string table;
+
+    if (!m_iptablesBatching)
+    {
+        return swss::exec(cmds, res);
+    }
+
+    size_t start = 0;
+    while (start <= cmds.size())
+    {
+        size_t end = cmds.find(separator, start);
+        std::string cmd = cmds.substr(start, end == std::string::npos ? std::string::npos : end - start);
+        size_t tableEnd = cmd.find(' ', prefix.size());
+
+        if ((cmd.compare(0, prefix.size(), prefix) != 0) || (tableEnd == std::string::npos) ||
+            (cmd.find_first_of("&|;<>`$\n", prefix.size()) != std::string::npos) ||
+            (!table.empty() && cmd.compare(prefix.size(), tableEnd - prefix.size(), table) != 0))
         {
-            SWSS_LOG_INFO("Deleted the dynamic conntrack entry");
+            /* Not a plain rule on a single table */
+            return execIptablesCmd(cmds, res);
         }
+
+        table = cmd.substr(prefix.size(), tableEnd - prefix.size());
+        rules.push_back(cmd.substr(tableEnd + 1));
+
+        if (end == std::string::npos)
+        {
+            break;
+        }
+        start = end + separator.size();
     }
+
+    /* A transaction covers a single table so that a rejected one has applied nothing */
+    if ((!m_iptablesBatchCmds.empty() && table != m_iptablesBatchTable) ||
+        (m_iptablesBatchBytes + cmds.size() > IPTABLES_RESTORE_MAX_BYTES))
+    {
+        commitIptablesBatch();
+        beginIptablesBatch();
+    }
+
+    m_iptablesBatchTable = table;
+    m_iptablesBatchRules.insert(m_iptablesBatchRules.end(), rules.begin(), rules.end());
+    m_iptablesBatchCmds.push_back(cmds);
+    m_iptablesBatchBytes += cmds.size();
+
+    res.clear();
+    return 0;
 }
 
 /* Iptable rules are added in the mangles table, to support use of Loopback IP as NAT Public IP which is a typical use-case in DC scenarios. The way it works is that:
@@ -912,7 +1230,7 @@ bool NatMgr::setMangleIptablesRules(const string &opCmd, const string &interface
           + IPTABLES_CMD + " -t mangle " + "-" + opCmd + " PREROUTING -i " + interface + " -j MARK --set-mark " + nat_zone + " && "
           + IPTABLES_CMD + " -t mangle " + "-" + opCmd + " POSTROUTING -o " + interface + " -j MARK --set-mark " + nat_zone ;
 
-    ret = swss::exec(cmds, res);
+    ret = stageIptablesCmd(cmds, res);
 
     if (ret)
     {
@@ -937,7 +1255,7 @@ bool NatMgr::setFullConeDnatIptablesRule(const string &opCmd)
     const std::string cmds = std::string("")
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " PREROUTING " + " -j DNAT --to-destination 1.1.1.1 --fullcone";
         
-    ret = swss::exec(cmds, res);
+    ret = stageIptablesCmd(cmds, res);
 
     if (ret)
     {
@@ -968,7 +1286,7 @@ bool NatMgr::setStaticNatIptablesRules(const string &opCmd, const string &interf
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " PREROUTING " + markStr + " -j DNAT -d " + external_ip + " --to-destination " + internal_ip + " && "
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING " + markStr + " -j SNAT -s " + internal_ip + " --to-source " + external_ip ;
         
-        ret = swss::exec(cmds, res);
+        ret = stageIptablesCmd(cmds, res);
 
         if (ret)
         {
@@ -982,7 +1300,7 @@ bool NatMgr::setStaticNatIptablesRules(const string &opCmd, const string &interf
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " PREROUTING" + " -j DNAT -d " + internal_ip + " --to-destination " + external_ip + " && "
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING" + " -j SNAT -s " + external_ip + " --to-source " + internal_ip ;
 
-        ret = swss::exec(cmds, res);
+        ret = stageIptablesCmd(cmds, res);
 
         if (ret)
         {
@@ -1018,7 +1336,7 @@ bool NatMgr::setStaticNaptIptablesRules(const string &opCmd, const string &inter
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING " + markStr + " -p " + prototype + " -j SNAT -s " + internal_ip + " --sport " + internal_port + " --to-source " 
           + external_ip + ":" + external_port;
 
-        ret = swss::exec(cmds, res);
+        ret = stageIptablesCmd(cmds, res);
 
         if (ret)
         {
@@ -1034,7 +1352,7 @@ bool NatMgr::setStaticNaptIptablesRules(const string &opCmd, const string &inter
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING" + " -p " + prototype + " -j SNAT -s " + external_ip + " --sport " + external_port + " --to-source "
           + internal_ip + ":" + internal_port;
 
-        ret = swss::exec(cmds, res);
+        ret = stageIptablesCmd(cmds, res);
 
         if (ret)
         {
@@ -1076,7 +1394,7 @@ bool NatMgr::setStaticTwiceNatIptablesRules(const string &opCmd, const string &i
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING " + markStr + " -j SNAT -s " + translated_dest_ip
           + " --to-source " + dest_ip + " -d " + src_ip;
 
-    ret = swss::exec(cmds, res);
+    ret = execIptablesCmd(cmds, res);
 
     if (ret)
     {
@@ -1122,7 +1440,7 @@ bool NatMgr::setStaticTwiceNaptIptablesRules(const string &opCmd, const string &
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING " + markStr + " -p " + prototype + " -j SNAT -s " + translated_dest_ip + " --sport " + translated_dest_port
           + " --to-source " + dest_ip + ":" + dest_port + " -d " + src_ip + " --dport " +src_port;
 
-    ret = swss::exec(cmds, res);
+    ret = execIptablesCmd(cmds, res);
 
     if (ret)
     {
@@ -1219,7 +1537,7 @@ bool NatMgr::setDynamicNatIptablesRulesWithoutAcl(const string &opCmd, const str
         }
     }
 
-    int ret = swss::exec(cmds, res);
+    int ret = execIptablesCmd(cmds, res);
     if (ret)
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
@@ -1448,7 +1766,7 @@ bool NatMgr::setDynamicNatIptablesRulesWithAcl(const string &opCmd, const string
         }
     }
 
-    int ret = swss::exec(cmds, res);
+    int ret = execIptablesCmd(cmds, res);
     if (ret)
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
@@ -5771,6 +6089,9 @@ void NatMgr::doNatRefreshTimerTask()
 {
     SWSS_LOG_ENTER();
 
+    /* The refresh of all the static entries shares one conntrack dump */
+    BatchGuard batch(*this);
+
     /* Update conntrack static NAT entries */
     SWSS_LOG_INFO("Updating conntrack for Static NAT entries");
     setStaticNatConntrackEntries("UPDATE");
@@ -8150,6 +8471,10 @@ void NatMgr::doTask(Consumer &consumer)
 
     string table_name = consumer.getTableName();
 
+    /* All the iptables rules derived from this batch of config changes go in one transaction
+     * and the conntrack updates and deletes share one conntrack dump */
+    BatchGuard batch(*this);
+
     if (table_name == CFG_STATIC_NAT_TABLE_NAME)
     {
         SWSS_LOG_INFO("Received update from CFG_STATIC_NAT_TABLE_NAME");
@@ -8198,6 +8523,36 @@ void NatMgr::doTask(Consumer &consumer)
     }
 }
 
+/* To apply the conntrack updates and deletes staged since m_conntrack.beginBatch() */
+void NatMgr::commitConntrackBatch(void)
+{
+    size_t count = 0;
+
+    int ret = m_conntrack.commitBatch(&count);
+
+    if (ret)
+    {
+        SWSS_LOG_ERROR("Updating or deleting the staged conntrack entries failed, error %s", NlConntrack::errStr(ret).c_str());
+    }
+    else
+    {
+        SWSS_LOG_INFO("Updated or deleted %zu conntrack entries", count);
+    }
+}
+
+/* To parse a batch of timeout notifications, applied with a single conntrack dump */
+void NatMgr::timeoutNotifications(const std::deque<KeyOpFieldsValuesTuple> &entries)
+{
+    SWSS_LOG_ENTER();
+
+    BatchGuard batch(*this);
+
+    for (const auto &entry : entries)
+    {
+        timeoutNotifications(kfvOp(entry), kfvKey(entry));
+    }
+}
+
 /* To parse the timeout notifications */
 void NatMgr::timeoutNotifications(string op, string data)
 {
@@ -23,10 +23,14 @@
 #include "orch.h"
 #include "notificationproducer.h"
 #include "timer.h"
+#include "nlconntrack.h"
 #include <unistd.h>
+#include <chrono>
+#include <deque>
 #include <set>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace swss {
 
@@ -125,6 +129,10 @@ namespace swss {
 #define NAT_ENTRY_REFRESH_PERIOD   86400    // 1 day
 #define REDIRECT_TO_DEV_NULL       " &> /dev/null"
 #define FLUSH                      " -F"
+#define IPTABLES_RESTORE_MAX_BYTES (96 * 1024)
+#define IPTABLES_RESTORE_LOG_MIN   100
+#define STATE_NATMGR_STATS_TABLE_NAME "NATMGR_STATS"
+#define NATMGR_STATS_IPTABLES_KEY  "iptables"
 
 const char ip_address_delimiter = '/';
 
@@ -247,17 +255,38 @@ public:
     void cleanupMangleIpTables();
     bool isPortInitDone(DBConnector *app_db);
     void timeoutNotifications(std::string op, std::string data);
+    void timeoutNotifications(const std::deque<KeyOpFieldsValuesTuple> &entries);
     void flushNotifications(std::string op, std::string data);
     void removeStaticNatIptables(const std::string port = NONE_STRING);
     void removeStaticNaptIptables(const std::string port = NONE_STRING);
     void removeDynamicNatRules(const std::string port = NONE_STRING, const std::string ipPrefix = NONE_STRING);
 
+    /* iptables commands issued between begin and commit are applied as one iptables-restore transaction */
+    void beginIptablesBatch(void);
+    int  commitIptablesBatch(void);
+
+    /* Opens the iptables and conntrack batches for its scope and commits them
+     * when the scope is left, also when a handler throws.
+     */
+    class BatchGuard
+    {
+    public:
+        explicit BatchGuard(NatMgr &natMgr);
+        ~BatchGuard();
+
+        BatchGuard(const BatchGuard &) = delete;
+        BatchGuard &operator=(const BatchGuard &) = delete;
+
+    private:
+        NatMgr &m_natMgr;
+    };
+
 private:
     /* Declare APPL_DB, CFG_DB and STATE_DB tables */
     ProducerStateTable m_appNatTableProducer, m_appNaptTableProducer, m_appNatGlobalTableProducer;
     ProducerStateTable m_appTwiceNatTableProducer, m_appTwiceNaptTableProducer, m_appNatDnatPoolProducer;
     Table m_statePortTable, m_stateLagTable, m_stateVlanTable, m_stateInterfaceTable, m_appNaptPoolIpTable;
-    Table m_stateWarmRestartEnableTable, m_stateWarmRestartTable;
+    Table m_stateWarmRestartEnableTable, m_stateWarmRestartTable, m_stateNatMgrStatsTable;
 
     /* Declare containers to store NAT Info */
     int          m_natTimeout;
@@ -275,6 +304,19 @@ private:
     natAclRule_map_t         m_natAclRuleInfo;
     natDnatPool_map_t        m_natDnatPoolInfo;
     SelectableTimer          *m_natRefreshTimer;
+    NlConntrack              m_conntrack;
+
+    /* iptables rules staged for a single iptables-restore transaction,
+     * m_iptablesBatchRules holds the restore lines of m_iptablesBatchTable in
+     * order and m_iptablesBatchCmds the original commands for the per-command fallback.
+     */
+    bool                                             m_iptablesBatching;
+    size_t                                           m_iptablesBatchBytes;
+    std::string                                      m_iptablesBatchTable;
+    std::vector<std::string>                         m_iptablesBatchRules;
+    std::vector<std::string>                         m_iptablesBatchCmds;
+    uint64_t                                         m_iptablesRulesApplied;
+    std::chrono::steady_clock::duration              m_iptablesApplyTime;
 
     /* Declare doTask related functions */
     void doTask(Consumer &consumer);
@@ -289,6 +331,10 @@ private:
     void doNatAclTableTask(Consumer &consumer);
     void doNatAclRuleTask(Consumer &consumer);
 
+    int  execIptablesCmd(const std::string &cmds, std::string &res);
+    int  stageIptablesCmd(const std::string &cmds, std::string &res);
+    void commitConntrackBatch(void);
+
     /* Declare all NAT functionality member functions*/
     void enableNatFeature(void);
     void disableNatFeature(void);
@@ -3,6 +3,7 @@
 #include "logger.h"
 #include "shellcmd.h"
 #include "tokenize.h"
+#include "converter.h"
 #include "warm_restart.h"
 #include "portmgr.h"
 #include <swss/redisutility.h>
@@ -486,12 +487,9 @@ bool TeamMgr::setLagAdminStatus(const string &alias, const string &admin_status)
 {
     SWSS_LOG_ENTER();
 
-    stringstream cmd;
-    string res;
-
     // ip link set dev <port_channel_name> [up|down]
-    cmd << IP_CMD << " link set dev " << shellquote(alias) << " " << shellquote(admin_status);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    NL_WITH_ERROR_THROW(m_kernelCfg.setLinkAdminState(alias, admin_status),
+                        "Failed to set " + alias + " admin status " + admin_status);
 
     SWSS_LOG_NOTICE("Set port channel %s admin status to %s",
             alias.c_str(), admin_status.c_str());
@@ -503,12 +501,20 @@ bool TeamMgr::setLagMtu(const string &alias, const string &mtu)
 {
     SWSS_LOG_ENTER();
 
-    stringstream cmd;
-    string res;
+    uint32_t mtu_value;
+    try
+    {
+        mtu_value = to_uint<uint32_t>(mtu);
+    }
+    catch (const std::exception &e)
+    {
+        SWSS_LOG_ERROR("Invalid mtu %s for port channel %s: %s", mtu.c_str(), alias.c_str(), e.what());
+        return false;
+    }
 
     // ip link set dev <port_channel_name> mtu <mtu_value>
-    cmd << IP_CMD << " link set dev " << shellquote(alias) << " mtu " << shellquote(mtu);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    NL_WITH_ERROR_THROW(m_kernelCfg.setLinkMtu(alias, mtu_value),
+                        "Failed to set " + alias + " mtu " + mtu);
 
     vector<FieldValueTuple> fvs;
     FieldValueTuple fv("mtu", mtu);
@@ -777,7 +783,15 @@ task_process_status TeamMgr::addLagMember(const string &lag, const string &membe
     // ip link set dev <member> down;
     // teamdctl <port_channel_name> port config update <member> { "lacp_key": <lacp_key>, "link_watch": { "name": "ethtool" } };
     // teamdctl <port_channel_name> port add <member>;
-    cmd << IP_CMD << " link set dev " << shellquote(member) << " down; ";
+    int ret = m_kernelCfg.setLinkAdminState(member, false);
+    if (ret)
+    {
+        // teamdctl port add would fail on a member which is still up
+        SWSS_LOG_WARN("Failed to set %s admin status down: %s, retry...",
+                member.c_str(), NlKernelCfg::errStr(ret).c_str());
+        return task_need_retry;
+    }
+
     cmd << TEAMDCTL_CMD << " " << shellquote(lag) << " port config update " << shellquote(member)
         << " '{\"lacp_key\":"
         << keyId
@@ -834,9 +848,8 @@ task_process_status TeamMgr::addLagMember(const string &lag, const string &membe
     }
 
     // ip link set dev <member> [up|down]
-    cmd.str(string());
-    cmd << IP_CMD << " link set dev " << shellquote(member) << " " << shellquote(admin_status);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    NL_WITH_ERROR_THROW(m_kernelCfg.setLinkAdminState(member, admin_status),
+                        "Failed to set " + member + " admin status " + admin_status);
 
     fvs.clear();
     FieldValueTuple fv("mtu", mtu);
@@ -858,7 +871,8 @@ bool TeamMgr::removeLagMember(const string &lag, const string &member)
     string res;
 
     // teamdctl <port_channel_name> port remove <member>;
-    cmd << TEAMDCTL_CMD << " " << lag << " port remove " << member << "; ";
+    cmd << TEAMDCTL_CMD << " " << lag << " port remove " << member;
+    exec(cmd.str(), res);
 
     vector<FieldValueTuple> fvs;
     m_cfgPortTable.get(member, fvs);
@@ -878,12 +892,25 @@ bool TeamMgr::removeLagMember(const string &lag, const string &member)
         }
     }
 
+    uint32_t mtu_value;
+    try
+    {
+        mtu_value = to_uint<uint32_t>(mtu);
+    }
+    catch (const std::exception &e)
+    {
+        SWSS_LOG_ERROR("Invalid mtu %s for port %s, restoring the default mtu: %s", mtu.c_str(), member.c_str(), e.what());
+        mtu = DEFAULT_MTU_STR;
+        mtu_value = to_uint<uint32_t>(mtu);
+    }
+
     // ip link set dev <port_name> [up|down];
     // ip link set dev <port_name> mtu
-    cmd << IP_CMD << " link set dev " << shellquote(member) << " " << shellquote(admin_status) << "; ";
-    cmd << IP_CMD << " link set dev " << shellquote(member) << " mtu " << shellquote(mtu);
+    m_kernelCfg.beginBatch();
+    m_kernelCfg.setLinkAdminState(member, admin_status);
+    m_kernelCfg.setLinkMtu(member, mtu_value);
+    NL_WITH_ERROR_THROW(m_kernelCfg.commitBatch(), "Failed to restore " + member + " admin status and mtu");
 
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
     fvs.clear();
     FieldValueTuple fv("admin_status", admin_status);
     fvs.push_back(fv);
@@ -6,6 +6,7 @@
 #include "dbconnector.h"
 #include "netmsg.h"
 #include "orch.h"
+#include "nlkernelcfg.h"
 #include "producerstatetable.h"
 #include <sys/types.h>
 
@@ -35,6 +36,7 @@ private:
     std::set<std::string> m_lagList;
 
     MacAddress m_mac;
+    NlKernelCfg m_kernelCfg;
 
     void doTask(Consumer &consumer);
     void doLagTask(Consumer &consumer);
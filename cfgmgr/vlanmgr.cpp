@@ -15,7 +15,7 @@ using namespace swss;
 #define DOT1Q_BRIDGE_NAME   "Bridge"
 #define VLAN_PREFIX         "Vlan"
 #define LAG_PREFIX          "PortChannel"
-#define DEFAULT_VLAN_ID     "1"
+#define DEFAULT_VLAN_ID     1
 #define DEFAULT_MTU_STR     "9100"
 #define VLAN_HLEN            4
 
@@ -58,12 +58,7 @@ VlanMgr::VlanMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, c
             WarmStart::setWarmStartState("vlanmgrd", WarmStart::RECONCILED);
             SWSS_LOG_NOTICE("vlanmgr warmstart state set to RECONCILED");
         }
-        const std::string cmds = std::string("")
-          + IP_CMD + " link show " + DOT1Q_BRIDGE_NAME + " 2>/dev/null";
-
-        std::string res;
-        int ret = swss::exec(cmds, res);
-        if (ret == 0)
+        if (m_kernelCfg.linkExists(DOT1Q_BRIDGE_NAME))
         {
             // Don't reset vlan aware bridge upon swss docker warm restart.
             SWSS_LOG_INFO("vlanmgrd warm start, skipping bridge create");
@@ -87,7 +82,7 @@ VlanMgr::VlanMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, c
       + IP_CMD + " link add " + DOT1Q_BRIDGE_NAME + " up type bridge && "
       + IP_CMD + " link set " + DOT1Q_BRIDGE_NAME + " mtu " + DEFAULT_MTU_STR + " && "
       + IP_CMD + " link set " + DOT1Q_BRIDGE_NAME + " address " + gMacAddress.to_string() + " && "
-      + BRIDGE_CMD + " vlan del vid " + DEFAULT_VLAN_ID + " dev " + DOT1Q_BRIDGE_NAME + " self; "
+      + BRIDGE_CMD + " vlan del vid " + std::to_string(DEFAULT_VLAN_ID) + " dev " + DOT1Q_BRIDGE_NAME + " self; "
       + IP_CMD + " link del dev dummy 2>/dev/null; "
       + IP_CMD + " link add dummy type dummy && "
       + IP_CMD + " link set dummy master " + DOT1Q_BRIDGE_NAME + "\"";
@@ -108,24 +103,19 @@ bool VlanMgr::addHostVlan(int vlan_id)
 {
     SWSS_LOG_ENTER();
 
-    // The command should be generated as:
-    // /bin/bash -c "/sbin/bridge vlan add vid {{vlan_id}} dev Bridge self &&
-    //               /sbin/ip link add link Bridge up name Vlan{{vlan_id}} address {{gMacAddress}} type vlan id {{vlan_id}}"
-    const std::string cmds = std::string("")
-      + BASH_CMD + " -c \""
-      + BRIDGE_CMD + " vlan add vid " + std::to_string(vlan_id) + " dev " + DOT1Q_BRIDGE_NAME + " self && "
-      + IP_CMD + " link add link " + DOT1Q_BRIDGE_NAME
-               + " up"
-               + " name " + VLAN_PREFIX + std::to_string(vlan_id)
-               + " address " + gMacAddress.to_string()
-               + " type vlan id " + std::to_string(vlan_id) + "\"";
+    // Equivalent of:
+    // /sbin/bridge vlan add vid {{vlan_id}} dev Bridge self &&
+    // /sbin/ip link add link Bridge up name Vlan{{vlan_id}} address {{gMacAddress}} type vlan id {{vlan_id}}
+    const std::string vlan_alias = VLAN_PREFIX + std::to_string(vlan_id);
 
-    std::string res;
-    EXEC_WITH_ERROR_THROW(cmds, res);
+    m_kernelCfg.beginBatch();
+    m_kernelCfg.addBridgeVlan(DOT1Q_BRIDGE_NAME, static_cast<uint16_t>(vlan_id), false, true);
+    m_kernelCfg.addVlanLink(DOT1Q_BRIDGE_NAME, vlan_alias, static_cast<uint16_t>(vlan_id), gMacAddress, true);
+    NL_WITH_ERROR_THROW(m_kernelCfg.commitBatch(), "Failed to add host vlan " + vlan_alias);
 
-    res.clear();
+    std::string res;
     const std::string echo_cmd = std::string("")
-      + ECHO_CMD + " 0 > /proc/sys/net/ipv4/conf/" + VLAN_PREFIX + std::to_string(vlan_id) + "/arp_evict_nocarrier";
+      + ECHO_CMD + " 0 > /proc/sys/net/ipv4/conf/" + vlan_alias + "/arp_evict_nocarrier";
     swss::exec(echo_cmd, res);
 
     return true;
@@ -135,16 +125,14 @@ bool VlanMgr::removeHostVlan(int vlan_id)
 {
     SWSS_LOG_ENTER();
 
-    // The command should be generated as:
-    // /bin/bash -c "/sbin/ip link del Vlan{{vlan_id}} &&
-    //               /sbin/bridge vlan del vid {{vlan_id}} dev Bridge self"
-    const std::string cmds = std::string("")
-      + BASH_CMD + " -c \""
-      + IP_CMD + " link del " + VLAN_PREFIX + std::to_string(vlan_id) + " && "
-      + BRIDGE_CMD + " vlan del vid " + std::to_string(vlan_id) + " dev " + DOT1Q_BRIDGE_NAME + " self\"";
+    // Equivalent of:
+    // /sbin/ip link del Vlan{{vlan_id}} &&
+    // /sbin/bridge vlan del vid {{vlan_id}} dev Bridge self
+    const std::string vlan_alias = VLAN_PREFIX + std::to_string(vlan_id);
 
-    std::string res;
-    EXEC_WITH_ERROR_THROW(cmds, res);
+    NL_WITH_ERROR_THROW(m_kernelCfg.delLink(vlan_alias), "Failed to remove host vlan " + vlan_alias);
+    NL_WITH_ERROR_THROW(m_kernelCfg.delBridgeVlan(DOT1Q_BRIDGE_NAME, static_cast<uint16_t>(vlan_id), true),
+                        "Failed to remove vlan " + std::to_string(vlan_id) + " from " DOT1Q_BRIDGE_NAME);
 
     return true;
 }
@@ -153,13 +141,12 @@ bool VlanMgr::setHostVlanAdminState(int vlan_id, const string &admin_status)
 {
     SWSS_LOG_ENTER();
 
-    // The command should be generated as:
+    // Equivalent of:
     // /sbin/ip link set Vlan{{vlan_id}} {{admin_status}}
-    ostringstream cmds;
-    cmds << IP_CMD " link set " VLAN_PREFIX + std::to_string(vlan_id) + " " << shellquote(admin_status);
+    const std::string vlan_alias = VLAN_PREFIX + std::to_string(vlan_id);
 
-    std::string res;
-    EXEC_WITH_ERROR_THROW(cmds.str(), res);
+    NL_WITH_ERROR_THROW(m_kernelCfg.setLinkAdminState(vlan_alias, admin_status),
+                        "Failed to set " + vlan_alias + " admin status " + admin_status);
 
     return true;
 }
@@ -168,14 +155,9 @@ bool VlanMgr::setHostVlanMtu(int vlan_id, uint32_t mtu)
 {
     SWSS_LOG_ENTER();
 
-    // The command should be generated as:
+    // Equivalent of:
     // /sbin/ip link set Vlan{{vlan_id}} mtu {{mtu}}
-    const std::string cmds = std::string("")
-      + IP_CMD + " link set " + VLAN_PREFIX + std::to_string(vlan_id) + " mtu " + std::to_string(mtu);
-
-    std::string res;
-    int ret = swss::exec(cmds, res);
-    if (ret == 0)
+    if (m_kernelCfg.setLinkMtu(VLAN_PREFIX + std::to_string(vlan_id), mtu) == 0)
     {
         return true;
     }
@@ -188,14 +170,16 @@ bool VlanMgr::setHostVlanMac(int vlan_id, const string &mac)
 {
     SWSS_LOG_ENTER();
 
-    // The command should be generated as:
-    // /sbin/ip link set Vlan{{vlan_id}} address {{mac}}
-    ostringstream cmds;
-    cmds << IP_CMD " link set " VLAN_PREFIX + std::to_string(vlan_id) + " address " << shellquote(mac) << " && "
-            IP_CMD " link set " DOT1Q_BRIDGE_NAME " address " << shellquote(mac);
+    // Equivalent of:
+    // /sbin/ip link set Vlan{{vlan_id}} address {{mac}} &&
+    // /sbin/ip link set Bridge address {{mac}}
+    const std::string vlan_alias = VLAN_PREFIX + std::to_string(vlan_id);
+    const MacAddress host_mac(mac);
 
-    std::string res;
-    EXEC_WITH_ERROR_THROW(cmds.str(), res);
+    m_kernelCfg.beginBatch();
+    m_kernelCfg.setLinkMac(vlan_alias, host_mac);
+    m_kernelCfg.setLinkMac(DOT1Q_BRIDGE_NAME, host_mac);
+    NL_WITH_ERROR_THROW(m_kernelCfg.commitBatch(), "Failed to set " + vlan_alias + " mac " + mac);
 
     return true;
 }
@@ -204,24 +188,18 @@ bool VlanMgr::addHostVlanMember(int vlan_id, const string &port_alias, const str
 {
     SWSS_LOG_ENTER();
 
-    std::string tagging_cmd;
-    if (tagging_mode == "untagged" || tagging_mode == "priority_tagged")
-    {
-        tagging_cmd = "pvid untagged";
-    }
-
-    // The command should be generated as:
-    // /bin/bash -c "/sbin/ip link set {{port_alias}} master Bridge &&
-    //               /sbin/bridge vlan del vid 1 dev {{ port_alias }} &&
-    //               /sbin/bridge vlan add vid {{vlan_id}} dev {{port_alias}} {{tagging_mode}}"
-    ostringstream cmds, inner;
-    inner << IP_CMD " link set " << shellquote(port_alias) << " master " DOT1Q_BRIDGE_NAME " && "
-      BRIDGE_CMD " vlan del vid " DEFAULT_VLAN_ID " dev " << shellquote(port_alias) << " && "
-      BRIDGE_CMD " vlan add vid " + std::to_string(vlan_id) + " dev " << shellquote(port_alias) << " " + tagging_cmd;
-    cmds << BASH_CMD " -c " << shellquote(inner.str());
+    bool untagged = (tagging_mode == "untagged" || tagging_mode == "priority_tagged");
 
-    std::string res;
-    EXEC_WITH_ERROR_THROW(cmds.str(), res);
+    // Equivalent of:
+    // /sbin/ip link set {{port_alias}} master Bridge &&
+    // /sbin/bridge vlan del vid 1 dev {{ port_alias }} &&
+    // /sbin/bridge vlan add vid {{vlan_id}} dev {{port_alias}} {{tagging_mode}}
+    m_kernelCfg.beginBatch();
+    m_kernelCfg.setLinkMaster(port_alias, DOT1Q_BRIDGE_NAME);
+    m_kernelCfg.delBridgeVlan(port_alias, DEFAULT_VLAN_ID);
+    m_kernelCfg.addBridgeVlan(port_alias, static_cast<uint16_t>(vlan_id), untagged);
+    NL_WITH_ERROR_THROW(m_kernelCfg.commitBatch(),
+                        "Failed to add " + port_alias + " to vlan " + std::to_string(vlan_id));
 
     return true;
 }
@@ -230,34 +208,25 @@ bool VlanMgr::removeHostVlanMember(int vlan_id, const string &port_alias)
 {
     SWSS_LOG_ENTER();
 
-    // The command should be generated as:
-    // /bin/bash -c '/sbin/bridge vlan del vid {{vlan_id}} dev {{port_alias}} &&
-    //               ( vlanShow=$(/sbin/bridge vlan show dev {{port_alias}});
-    //               ret=$?;
-    //               if [ $ret -eq 0 ]; then
-    //               if (! echo "$vlanShow" | grep -q {{port_alias}})
-    //                 || (echo "$vlanShow" | grep -q None$)
-    //                 || (echo "$vlanShow" | grep -q {{port_alias}}$); then
-    //               /sbin/ip link set {{port_alias}} nomaster;
-    //               fi;
-    //               else exit $ret; fi )'
+    // Equivalent of:
+    // /sbin/bridge vlan del vid {{vlan_id}} dev {{port_alias}} &&
+    // /sbin/ip link set {{port_alias}} nomaster, if no vlan is left on the port
+    NL_WITH_ERROR_THROW(m_kernelCfg.delBridgeVlan(port_alias, static_cast<uint16_t>(vlan_id)),
+                        "Failed to remove " + port_alias + " from vlan " + std::to_string(vlan_id));
 
     // When port is not member of any VLAN, it shall be detached from Dot1Q bridge!
-    ostringstream cmds, inner;
-    inner << BRIDGE_CMD " vlan del vid " + std::to_string(vlan_id) + " dev " << shellquote(port_alias) << " && ( "
-      "vlanShow=$(" BRIDGE_CMD " vlan show dev " << shellquote(port_alias) << "); "
-      "ret=$?; "
-      "if [ $ret -eq 0 ]; then "
-      "if (! echo \"$vlanShow\" | " GREP_CMD " -q " << shellquote(port_alias) << ") "
-      " || (echo \"$vlanShow\" | " GREP_CMD " -q None$) "
-      " || (echo \"$vlanShow\" | " GREP_CMD " -q " << shellquote(port_alias) << "$); then "
-      IP_CMD " link set " << shellquote(port_alias) << " nomaster; "
-      "fi; "
-      "else exit $ret; fi )";
-    cmds << BASH_CMD " -c " << shellquote(inner.str());
-
-    std::string res;
-    EXEC_WITH_ERROR_THROW(cmds.str(), res);
+    size_t vlan_count = 0;
+    NL_WITH_ERROR_THROW(m_kernelCfg.getBridgeVlanCount(port_alias, vlan_count),
+                        "Failed to get vlans of " + port_alias);
+    if (vlan_count == 0)
+    {
+        int ret = m_kernelCfg.setLinkMaster(port_alias, "");
+        if (ret)
+        {
+            SWSS_LOG_WARN("Failed to detach %s from %s: %s", port_alias.c_str(),
+                          DOT1Q_BRIDGE_NAME, NlKernelCfg::errStr(ret).c_str());
+        }
+    }
 
     return true;
 }
@@ -0,0 +1,374 @@
+#include <string.h>
+#include <strings.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netlink/netlink.h>
+#include <netlink/cache.h>
+#include <netlink/addr.h>
+#include <netlink/netfilter/nfnl.h>
+#include <netlink/netfilter/ct.h>
+
+#include "logger.h"
+#include "nlconntrack.h"
+
+using namespace std;
+using namespace swss;
+
+#define NL_CT_RCVBUF_SIZE   (4 * 1024 * 1024)
+
+namespace
+{
+    struct ConntrackWalk
+    {
+        struct nl_sock *sock;
+        /* The last matching request applies */
+        const vector<NlConntrack::Request> *requests;
+        size_t count;
+        int err;
+    };
+
+    bool matchAddr(const struct nl_addr *addr, uint32_t low, uint32_t high)
+    {
+        if (!low)
+        {
+            return true;
+        }
+
+        if (!addr || nl_addr_get_len(addr) != sizeof(uint32_t))
+        {
+            return false;
+        }
+
+        uint32_t ip;
+        memcpy(&ip, nl_addr_get_binary_addr(addr), sizeof(ip));
+        ip = ntohl(ip);
+
+        return ip >= low && ip <= high;
+    }
+
+    /* A filter without any address would match the whole table */
+    bool hasAddr(const NlConntrack::Filter &filter)
+    {
+        return filter.srcIp || filter.dstIp || filter.replyDstLow;
+    }
+
+    /* A filter on the complete original tuple, which the kernel looks up directly */
+    bool isExactTuple(const NlConntrack::Filter &filter)
+    {
+        return filter.protocol && filter.srcIp && filter.dstIp && filter.srcPort &&
+               filter.dstPort && !filter.replyDstLow;
+    }
+
+    void setAddr(struct nfnl_ct *ct, bool src, uint32_t hostIp)
+    {
+        uint32_t ip = htonl(hostIp);
+        struct nl_addr *addr = nl_addr_build(AF_INET, &ip, sizeof(ip));
+
+        if (!addr)
+        {
+            return;
+        }
+
+        if (src)
+        {
+            nfnl_ct_set_src(ct, 0, addr);
+        }
+        else
+        {
+            nfnl_ct_set_dst(ct, 0, addr);
+        }
+        nl_addr_put(addr);
+    }
+
+    bool matchEntry(struct nfnl_ct *ct, const NlConntrack::Filter &filter)
+    {
+        if (nfnl_ct_get_family(ct) != AF_INET)
+        {
+            return false;
+        }
+
+        if (filter.protocol && nfnl_ct_get_proto(ct) != filter.protocol)
+        {
+            return false;
+        }
+
+        if (!matchAddr(nfnl_ct_get_src(ct, 0), filter.srcIp, filter.srcIp) ||
+            !matchAddr(nfnl_ct_get_dst(ct, 0), filter.dstIp, filter.dstIp) ||
+            !matchAddr(nfnl_ct_get_dst(ct, 1), filter.replyDstLow,
+                       filter.replyDstHigh ? filter.replyDstHigh : filter.replyDstLow))
+        {
+            return false;
+        }
+
+        if (filter.srcPort && nfnl_ct_get_src_port(ct, 0) != filter.srcPort)
+        {
+            return false;
+        }
+
+        if (filter.dstPort && nfnl_ct_get_dst_port(ct, 0) != filter.dstPort)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    void walkEntry(struct nl_object *obj, void *arg)
+    {
+        auto walk = static_cast<ConntrackWalk *>(arg);
+        auto ct = reinterpret_cast<struct nfnl_ct *>(obj);
+
+        auto match = walk->requests->rbegin();
+        while (match != walk->requests->rend() && !matchEntry(ct, match->filter))
+        {
+            ++match;
+        }
+
+        if (match == walk->requests->rend())
+        {
+            return;
+        }
+
+        int err;
+        if (match->del)
+        {
+            err = nfnl_ct_del(walk->sock, ct, 0);
+        }
+        else
+        {
+            nfnl_ct_set_timeout(ct, match->timeout);
+            err = nfnl_ct_add(walk->sock, ct, 0);
+        }
+
+        /* The flow may have expired since the dump */
+        if (err == -NLE_OBJ_NOTFOUND)
+        {
+            return;
+        }
+
+        if (err < 0)
+        {
+            if (!walk->err)
+            {
+                walk->err = err;
+            }
+            return;
+        }
+
+        walk->count++;
+    }
+}
+
+NlConntrack::NlConntrack() :
+    m_sock(NULL),
+    m_batching(false)
+{
+    int err = 0;
+
+    m_sock = nl_socket_alloc();
+    if (!m_sock)
+    {
+        SWSS_LOG_ERROR("Netlink socket alloc failed");
+        return;
+    }
+
+    err = nl_connect(m_sock, NETLINK_NETFILTER);
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("Netfilter netlink socket connect failed, error %s", nl_geterror(err));
+        nl_socket_free(m_sock);
+        m_sock = NULL;
+        return;
+    }
+
+    /* A dump of a busy conntrack table easily overruns the default buffer */
+    nl_socket_set_buffer_size(m_sock, NL_CT_RCVBUF_SIZE, 0);
+}
+
+NlConntrack::~NlConntrack()
+{
+    if (m_sock)
+    {
+        nl_close(m_sock);
+        nl_socket_free(m_sock);
+    }
+}
+
+int NlConntrack::updateTimeout(const Filter &filter, uint32_t timeout, size_t *count)
+{
+    return submit(Request{ filter, timeout, false }, count);
+}
+
+int NlConntrack::deleteEntries(const Filter &filter, size_t *count)
+{
+    return submit(Request{ filter, 0, true }, count);
+}
+
+void NlConntrack::beginBatch()
+{
+    m_batching = true;
+}
+
+int NlConntrack::commitBatch(size_t *count)
+{
+    Requests requests;
+
+    m_batching = false;
+    requests.swap(m_pendingRequests);
+
+    if (requests.empty())
+    {
+        if (count)
+        {
+            *count = 0;
+        }
+        return 0;
+    }
+
+    return apply(requests, count);
+}
+
+int NlConntrack::submit(const Request &request, size_t *count)
+{
+    if (count)
+    {
+        *count = 0;
+    }
+
+    if (!hasAddr(request.filter))
+    {
+        return -NLE_INVAL;
+    }
+
+    if (m_batching)
+    {
+        m_pendingRequests.push_back(request);
+        return 0;
+    }
+
+    if (isExactTuple(request.filter))
+    {
+        return applyEntry(request, count);
+    }
+
+    return apply(Requests{ request }, count);
+}
+
+/* To update or delete the single entry of an exact tuple without dumping the table */
+int NlConntrack::applyEntry(const Request &request, size_t *count)
+{
+    if (!m_sock)
+    {
+        return -NLE_BAD_SOCK;
+    }
+
+    struct nfnl_ct *ct = nfnl_ct_alloc();
+    if (!ct)
+    {
+        return -NLE_NOMEM;
+    }
+
+    nfnl_ct_set_family(ct, AF_INET);
+    nfnl_ct_set_proto(ct, request.filter.protocol);
+    setAddr(ct, true, request.filter.srcIp);
+    setAddr(ct, false, request.filter.dstIp);
+    nfnl_ct_set_src_port(ct, 0, request.filter.srcPort);
+    nfnl_ct_set_dst_port(ct, 0, request.filter.dstPort);
+
+    int err;
+    if (request.del)
+    {
+        err = nfnl_ct_del(m_sock, ct, 0);
+    }
+    else
+    {
+        /* Without NLM_F_CREATE an existing entry is updated, never created */
+        nfnl_ct_set_timeout(ct, request.timeout);
+        err = nfnl_ct_add(m_sock, ct, 0);
+    }
+    nfnl_ct_put(ct);
+
+    if (err == -NLE_OBJ_NOTFOUND)
+    {
+        return 0;
+    }
+
+    if (err < 0)
+    {
+        return err;
+    }
+
+    if (count)
+    {
+        *count = 1;
+    }
+    return 0;
+}
+
+int NlConntrack::apply(const Requests &requests, size_t *count)
+{
+    struct nl_cache *cache = NULL;
+
+    if (count)
+    {
+        *count = 0;
+    }
+
+    if (!m_sock)
+    {
+        return -NLE_BAD_SOCK;
+    }
+
+    int err = nfnl_ct_alloc_cache(m_sock, &cache);
+    if (err < 0)
+    {
+        return err;
+    }
+
+    ConntrackWalk walk = { m_sock, &requests, 0, 0 };
+    nl_cache_foreach(cache, walkEntry, &walk);
+    nl_cache_free(cache);
+
+    if (count)
+    {
+        *count = walk.count;
+    }
+
+    return walk.err;
+}
+
+bool NlConntrack::toHostIp(const string &ip, uint32_t &hostIp)
+{
+    struct in_addr addr;
+
+    if (inet_pton(AF_INET, ip.c_str(), &addr) != 1 || addr.s_addr == INADDR_ANY)
+    {
+        return false;
+    }
+
+    hostIp = ntohl(addr.s_addr);
+    return true;
+}
+
+uint8_t NlConntrack::toProtocol(const string &proto)
+{
+    if (!strcasecmp(proto.c_str(), "tcp"))
+    {
+        return IPPROTO_TCP;
+    }
+    else if (!strcasecmp(proto.c_str(), "udp"))
+    {
+        return IPPROTO_UDP;
+    }
+    else if (!strcasecmp(proto.c_str(), "icmp"))
+    {
+        return IPPROTO_ICMP;
+    }
+
+    return 0;
+}
+
+string NlConntrack::errStr(int err)
+{
+    return nl_geterror(err < 0 ? -err : err);
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct nl_sock;
+
+namespace swss {
+
+/*
+ * IPv4 conntrack maintenance over ctnetlink.
+ *
+ * Replaces the /usr/sbin/conntrack -U/-D shell-outs used by natmgrd. The
+ * updates and deletes issued between beginBatch() and commitBatch() are applied
+ * with a single dump of the conntrack table, so e.g. removing the entries of a
+ * whole NAT pool costs one dump rather than one process per pool address.
+ * Outside a batch, a filter on the complete original tuple is sent as a single
+ * request for that entry and only a partial filter falls back to a dump.
+ * Methods return 0 on success or a negative libnl error code.
+ */
+class NlConntrack
+{
+public:
+    /* Zero valued fields match anything, addresses and ports in host order.
+     * A filter without any address is rejected rather than matching the whole table.
+     */
+    struct Filter
+    {
+        uint8_t  protocol = 0;
+        uint32_t srcIp = 0;
+        uint32_t dstIp = 0;
+        uint16_t srcPort = 0;
+        uint16_t dstPort = 0;
+        /* Reply direction destination, i.e. the translated source address */
+        uint32_t replyDstLow = 0;
+        uint32_t replyDstHigh = 0;
+    };
+
+    NlConntrack();
+    ~NlConntrack();
+
+    NlConntrack(const NlConntrack &) = delete;
+    NlConntrack &operator=(const NlConntrack &) = delete;
+
+    int updateTimeout(const Filter &filter, uint32_t timeout, size_t *count = nullptr);
+    int deleteEntries(const Filter &filter, size_t *count = nullptr);
+
+    void beginBatch();
+    int commitBatch(size_t *count = nullptr);
+
+    /* Helpers to fill a Filter from the strings kept in CONFIG_DB,
+     * toHostIp fails rather than returning the zero "any" address.
+     */
+    static bool toHostIp(const std::string &ip, uint32_t &hostIp);
+    static uint8_t toProtocol(const std::string &proto);
+
+    static std::string errStr(int err);
+
+    /* A filtered operation, the timeout is ignored by the deletes */
+    struct Request
+    {
+        Filter filter;
+        uint32_t timeout;
+        bool del;
+    };
+
+private:
+    typedef std::vector<Request> Requests;
+
+    struct nl_sock *m_sock;
+    bool m_batching;
+    Requests m_pendingRequests;
+
+    int submit(const Request &request, size_t *count);
+    int applyEntry(const Request &request, size_t *count);
+    int apply(const Requests &requests, size_t *count);
+};
+
+}
@@ -0,0 +1,616 @@
+#include <netinet/in.h>
+#include <net/if.h>
+#include <net/ethernet.h>
+#include <linux/if_bridge.h>
+#include <linux/if_link.h>
+#include <linux/rtnetlink.h>
+#include <netlink/netlink.h>
+#include <netlink/msg.h>
+#include <netlink/attr.h>
+
+#include "logger.h"
+#include "nlkernelcfg.h"
+
+using namespace std;
+using namespace swss;
+
+/* Number of requests written back to back before waiting for their acks */
+#define NL_BATCH_MAX        128
+#define NL_RCVBUF_SIZE      (1024 * 1024)
+
+#ifndef IFA_RT_PRIORITY
+#define IFA_RT_PRIORITY     9
+#endif
+
+namespace
+{
+    struct BridgeVlanQuery
+    {
+        int ifindex;
+        size_t count;
+    };
+
+    int parseBridgeVlanInfo(struct nl_msg *msg, void *arg)
+    {
+        auto query = static_cast<BridgeVlanQuery *>(arg);
+        struct nlmsghdr *hdr = nlmsg_hdr(msg);
+
+        if (hdr->nlmsg_type != RTM_NEWLINK)
+        {
+            return NL_OK;
+        }
+
+        auto ifi = static_cast<struct ifinfomsg *>(nlmsg_data(hdr));
+        if (ifi->ifi_index != query->ifindex)
+        {
+            return NL_OK;
+        }
+
+        struct nlattr *tb[IFLA_MAX + 1];
+        if (nlmsg_parse(hdr, sizeof(struct ifinfomsg), tb, IFLA_MAX, NULL) < 0 || !tb[IFLA_AF_SPEC])
+        {
+            return NL_OK;
+        }
+
+        struct nlattr *attr;
+        int rem;
+        nla_for_each_nested(attr, tb[IFLA_AF_SPEC], rem)
+        {
+            if (nla_type(attr) == IFLA_BRIDGE_VLAN_INFO)
+            {
+                query->count++;
+            }
+        }
+
+        return NL_OK;
+    }
+}
+
+NlKernelCfg::NlKernelCfg() :
+    m_sock(NULL),
+    m_batching(false)
+{
+    int err = 0;
+
+    m_sock = nl_socket_alloc();
+    if (!m_sock)
+    {
+        SWSS_LOG_ERROR("Netlink socket alloc failed");
+        return;
+    }
+
+    if ((err = nl_connect(m_sock, NETLINK_ROUTE)) < 0)
+    {
+        SWSS_LOG_ERROR("Netlink socket connect failed, error '%s'", nl_geterror(err));
+        nl_socket_free(m_sock);
+        m_sock = NULL;
+        return;
+    }
+
+    /* Acks of a batch are collected after all requests have been written */
+    nl_socket_disable_seq_check(m_sock);
+    nl_socket_set_buffer_size(m_sock, NL_RCVBUF_SIZE, 0);
+}
+
+NlKernelCfg::~NlKernelCfg()
+{
+    for (auto &queued : m_batch)
+    {
+        nlmsg_free(queued.first);
+    }
+
+    if (m_sock)
+    {
+        nl_socket_free(m_sock);
+    }
+}
+
+void NlKernelCfg::beginBatch()
+{
+    m_batching = true;
+}
+
+int NlKernelCfg::commitBatch(vector<int> *results)
+{
+    int err = 0;
+
+    flush();
+
+    for (size_t i = 0; i < m_batchResults.size(); i++)
+    {
+        if (!m_batchResults[i])
+        {
+            continue;
+        }
+
+        SWSS_LOG_ERROR("Netlink request %zu of %zu in the batch failed, error '%s'",
+                       i + 1, m_batchResults.size(), errStr(m_batchResults[i]).c_str());
+        if (!err)
+        {
+            err = m_batchResults[i];
+        }
+    }
+
+    if (results)
+    {
+        results->swap(m_batchResults);
+    }
+
+    m_batching = false;
+    m_batchResults.clear();
+    return err;
+}
+
+int NlKernelCfg::error(int err)
+{
+    /* Requests rejected before being queued have their failure in the batch results too */
+    if (m_batching && err)
+    {
+        m_batchResults.push_back(err);
+    }
+
+    return err;
+}
+
+string NlKernelCfg::errStr(int err)
+{
+    return nl_geterror(err < 0 ? -err : err);
+}
+
+int NlKernelCfg::getIfIndex(const string &ifname) const
+{
+    return static_cast<int>(if_nametoindex(ifname.c_str()));
+}
+
+bool NlKernelCfg::linkExists(const string &ifname) const
+{
+    return getIfIndex(ifname) != 0;
+}
+
+struct nl_msg *NlKernelCfg::allocLinkMsg(int type, int flags, int family, int ifindex, const string &ifname)
+{
+    struct nl_msg *msg = nlmsg_alloc_simple(type, flags);
+    if (!msg)
+    {
+        return NULL;
+    }
+
+    struct ifinfomsg ifi = {};
+    ifi.ifi_family = static_cast<unsigned char>(family);
+    ifi.ifi_index = ifindex;
+
+    if (nlmsg_append(msg, &ifi, sizeof(ifi), NLMSG_ALIGNTO) < 0 ||
+        (!ifname.empty() && nla_put_string(msg, IFLA_IFNAME, ifname.c_str()) < 0))
+    {
+        nlmsg_free(msg);
+        return NULL;
+    }
+
+    return msg;
+}
+
+int NlKernelCfg::send(struct nl_msg *msg)
+{
+    if (!msg)
+    {
+        return error(-NLE_NOMEM);
+    }
+
+    if (!m_sock)
+    {
+        nlmsg_free(msg);
+        return error(-NLE_BAD_SOCK);
+    }
+
+    if (m_batching)
+    {
+        /* The failures are reported by commitBatch() */
+        m_batchResults.push_back(0);
+        m_batch.emplace_back(msg, m_batchResults.size() - 1);
+        if (m_batch.size() >= NL_BATCH_MAX)
+        {
+            flush();
+        }
+        return 0;
+    }
+
+    int err = nl_send_auto(m_sock, msg);
+    nlmsg_free(msg);
+    if (err < 0)
+    {
+        return err;
+    }
+
+    return nl_wait_for_ack(m_sock);
+}
+
+int NlKernelCfg::flush()
+{
+    int rc = 0;
+    vector<size_t> sent;
+
+    for (auto &queued : m_batch)
+    {
+        int err = m_sock ? nl_send_auto(m_sock, queued.first) : -NLE_BAD_SOCK;
+        if (err >= 0)
+        {
+            sent.push_back(queued.second);
+        }
+        else
+        {
+            m_batchResults[queued.second] = err;
+            if (!rc)
+            {
+                rc = err;
+            }
+        }
+        nlmsg_free(queued.first);
+    }
+    m_batch.clear();
+
+    /* The acks come back in the order the requests were sent */
+    for (auto index : sent)
+    {
+        int err = nl_wait_for_ack(m_sock);
+        if (err < 0)
+        {
+            m_batchResults[index] = err;
+            if (!rc)
+            {
+                rc = err;
+            }
+        }
+    }
+
+    return rc;
+}
+
+int NlKernelCfg::addLink(const string &ifname, const string &kind, uint32_t mtu, bool up)
+{
+    SWSS_LOG_ENTER();
+
+    struct nl_msg *msg = allocLinkMsg(RTM_NEWLINK, NLM_F_CREATE | NLM_F_EXCL, AF_UNSPEC, 0, ifname);
+    if (!msg)
+    {
+        return error(-NLE_NOMEM);
+    }
+
+    if (up)
+    {
+        auto ifi = static_cast<struct ifinfomsg *>(nlmsg_data(nlmsg_hdr(msg)));
+        ifi->ifi_flags = IFF_UP;
+        ifi->ifi_change = IFF_UP;
+    }
+
+    struct nlattr *linkinfo;
+    if ((mtu && nla_put_u32(msg, IFLA_MTU, mtu) < 0) ||
+        !(linkinfo = nla_nest_start(msg, IFLA_LINKINFO)) ||
+        nla_put_string(msg, IFLA_INFO_KIND, kind.c_str()) < 0)
+    {
+        nlmsg_free(msg);
+        return error(-NLE_NOMEM);
+    }
+    nla_nest_end(msg, linkinfo);
+
+    return send(msg);
+}
+
+int NlKernelCfg::addVlanLink(const string &parent, const string &ifname, uint16_t vlanId, const MacAddress &mac, bool up)
+{
+    SWSS_LOG_ENTER();
+
+    int parentIndex = getIfIndex(parent);
+    if (!parentIndex)
+    {
+        return error(-NLE_OBJ_NOTFOUND);
+    }
+
+    struct nl_msg *msg = allocLinkMsg(RTM_NEWLINK, NLM_F_CREATE | NLM_F_EXCL, AF_UNSPEC, 0, ifname);
+    if (!msg)
+    {
+        return error(-NLE_NOMEM);
+    }
+
+    if (up)
+    {
+        auto ifi = static_cast<struct ifinfomsg *>(nlmsg_data(nlmsg_hdr(msg)));
+        ifi->ifi_flags = IFF_UP;
+        ifi->ifi_change = IFF_UP;
+    }
+
+    struct nlattr *linkinfo, *data;
+    if (nla_put_u32(msg, IFLA_LINK, parentIndex) < 0 ||
+        (!!mac && nla_put(msg, IFLA_ADDRESS, ETHER_ADDR_LEN, mac.getMac()) < 0) ||
+        !(linkinfo = nla_nest_start(msg, IFLA_LINKINFO)) ||
+        nla_put_string(msg, IFLA_INFO_KIND, "vlan") < 0 ||
+        !(data = nla_nest_start(msg, IFLA_INFO_DATA)) ||
+        nla_put_u16(msg, IFLA_VLAN_ID, vlanId) < 0)
+    {
+        nlmsg_free(msg);
+        return error(-NLE_NOMEM);
+    }
+    nla_nest_end(msg, data);
+    nla_nest_end(msg, linkinfo);
+
+    return send(msg);
+}
+
+int NlKernelCfg::delLink(const string &ifname)
+{
+    SWSS_LOG_ENTER();
+
+    return send(allocLinkMsg(RTM_DELLINK, 0, AF_UNSPEC, 0, ifname));
+}
+
+int NlKernelCfg::setLinkAdminState(const string &ifname, bool up)
+{
+    SWSS_LOG_ENTER();
+
+    struct nl_msg *msg = allocLinkMsg(RTM_NEWLINK, 0, AF_UNSPEC, 0, ifname);
+    if (!msg)
+    {
+        return error(-NLE_NOMEM);
+    }
+
+    auto ifi = static_cast<struct ifinfomsg *>(nlmsg_data(nlmsg_hdr(msg)));
+    ifi->ifi_flags = up ? IFF_UP : 0;
+    ifi->ifi_change = IFF_UP;
+
+    return send(msg);
+}
+
+int NlKernelCfg::setLinkAdminState(const string &ifname, const string &adminStatus)
+{
+    if (adminStatus != "up" && adminStatus != "down")
+    {
+        return error(-NLE_INVAL);
+    }
+
+    return setLinkAdminState(ifname, adminStatus == "up");
+}
+
+int NlKernelCfg::setLinkMtu(const string &ifname, uint32_t mtu)
+{
+    SWSS_LOG_ENTER();
+
+    struct nl_msg *msg = allocLinkMsg(RTM_NEWLINK, 0, AF_UNSPEC, 0, ifname);
+    if (!msg || nla_put_u32(msg, IFLA_MTU, mtu) < 0)
+    {
+        nlmsg_free(msg);
+        return error(-NLE_NOMEM);
+    }
+
+    return send(msg);
+}
+
+int NlKernelCfg::setLinkMac(const string &ifname, const MacAddress &mac)
+{
+    SWSS_LOG_ENTER();
+
+    struct nl_msg *msg = allocLinkMsg(RTM_NEWLINK, 0, AF_UNSPEC, 0, ifname);
+    if (!msg || nla_put(msg, IFLA_ADDRESS, ETHER_ADDR_LEN, mac.getMac()) < 0)
+    {
+        nlmsg_free(msg);
+        return error(-NLE_NOMEM);
+    }
+
+    return send(msg);
+}
+
+int NlKernelCfg::setLinkMaster(const string &ifname, const string &master)
+{
+    SWSS_LOG_ENTER();
+
+    int masterIndex = 0;
+    if (!master.empty() && !(masterIndex = getIfIndex(master)))
+    {
+        return error(-NLE_OBJ_NOTFOUND);
+    }
+
+    struct nl_msg *msg = allocLinkMsg(RTM_NEWLINK, 0, AF_UNSPEC, 0, ifname);
+    if (!msg || nla_put_u32(msg, IFLA_MASTER, masterIndex) < 0)
+    {
+        nlmsg_free(msg);
+        return error(-NLE_NOMEM);
+    }
+
+    return send(msg);
+}
+
+int NlKernelCfg::addBridgeVlan(const string &ifname, uint16_t vlanId, bool untagged, bool self)
+{
+    SWSS_LOG_ENTER();
+
+    int ifindex = getIfIndex(ifname);
+    if (!ifindex)
+    {
+        return error(-NLE_OBJ_NOTFOUND);
+    }
+
+    struct bridge_vlan_info vinfo = {};
+    vinfo.vid = vlanId;
+    if (untagged)
+    {
+        vinfo.flags = static_cast<__u16>(BRIDGE_VLAN_INFO_PVID | BRIDGE_VLAN_INFO_UNTAGGED);
+    }
+
+    struct nl_msg *msg = allocLinkMsg(RTM_SETLINK, 0, AF_BRIDGE, ifindex);
+    struct nlattr *afspec;
+    if (!msg ||
+        !(afspec = nla_nest_start(msg, IFLA_AF_SPEC)) ||
+        (self && nla_put_u16(msg, IFLA_BRIDGE_FLAGS, BRIDGE_FLAGS_SELF) < 0) ||
+        nla_put(msg, IFLA_BRIDGE_VLAN_INFO, sizeof(vinfo), &vinfo) < 0)
+    {
+        nlmsg_free(msg);
+        return error(-NLE_NOMEM);
+    }
+    nla_nest_end(msg, afspec);
+
+    return send(msg);
+}
+
+int NlKernelCfg::delBridgeVlan(const string &ifname, uint16_t vlanId, bool self)
+{
+    SWSS_LOG_ENTER();
+
+    int ifindex = getIfIndex(ifname);
+    if (!ifindex)
+    {
+        return error(-NLE_OBJ_NOTFOUND);
+    }
+
+    struct bridge_vlan_info vinfo = {};
+    vinfo.vid = vlanId;
+
+    struct nl_msg *msg = allocLinkMsg(RTM_DELLINK, 0, AF_BRIDGE, ifindex);
+    struct nlattr *afspec;
+    if (!msg ||
+        !(afspec = nla_nest_start(msg, IFLA_AF_SPEC)) ||
+        (self && nla_put_u16(msg, IFLA_BRIDGE_FLAGS, BRIDGE_FLAGS_SELF) < 0) ||
+        nla_put(msg, IFLA_BRIDGE_VLAN_INFO, sizeof(vinfo), &vinfo) < 0)
+    {
+        nlmsg_free(msg);
+        return error(-NLE_NOMEM);
+    }
+    nla_nest_end(msg, afspec);
+
+    return send(msg);
+}
+
+int NlKernelCfg::getBridgeVlanCount(const string &ifname, size_t &count)
+{
+    SWSS_LOG_ENTER();
+
+    count = 0;
+
+    /* The dump must observe every request queued so far, their failures are
+     * reported by commitBatch() as this query is not part of the batch */
+    flush();
+
+    BridgeVlanQuery query = { getIfIndex(ifname), 0 };
+    if (!query.ifindex)
+    {
+        return -NLE_OBJ_NOTFOUND;
+    }
+
+    if (!m_sock)
+    {
+        return -NLE_BAD_SOCK;
+    }
+
+    struct nl_msg *msg = allocLinkMsg(RTM_GETLINK, NLM_F_DUMP, AF_BRIDGE, 0);
+    if (!msg || nla_put_u32(msg, IFLA_EXT_MASK, RTEXT_FILTER_BRVLAN) < 0)
+    {
+        nlmsg_free(msg);
+        return -NLE_NOMEM;
+    }
+
+    int err = nl_send_auto(m_sock, msg);
+    nlmsg_free(msg);
+    if (err < 0)
+    {
+        return err;
+    }
+
+    struct nl_cb *cb = nl_cb_clone(nl_socket_get_cb(m_sock));
+    if (!cb)
+    {
+        return -NLE_NOMEM;
+    }
+    nl_cb_set(cb, NL_CB_VALID, NL_CB_CUSTOM, parseBridgeVlanInfo, &query);
+    err = nl_recvmsgs(m_sock, cb);
+    nl_cb_put(cb);
+    if (err < 0)
+    {
+        return err;
+    }
+
+    count = query.count;
+    return 0;
+}
+
+int NlKernelCfg::addAddress(const string &ifname, const IpPrefix &prefix, bool broadcast, uint32_t metric)
+{
+    SWSS_LOG_ENTER();
+
+    int ifindex = getIfIndex(ifname);
+    if (!ifindex)
+    {
+        return error(-NLE_OBJ_NOTFOUND);
+    }
+
+    struct nl_msg *msg = nlmsg_alloc_simple(RTM_NEWADDR, NLM_F_CREATE | NLM_F_EXCL);
+    if (!msg)
+    {
+        return error(-NLE_NOMEM);
+    }
+
+    auto ip = prefix.getIp().getIp();
+    bool isV4 = prefix.isV4();
+    int addrLen = static_cast<int>(isV4 ? sizeof(ip.ip_addr.ipv4_addr) : sizeof(ip.ip_addr.ipv6_addr));
+    const void *addr = isV4 ? static_cast<const void *>(&ip.ip_addr.ipv4_addr) :
+                              static_cast<const void *>(ip.ip_addr.ipv6_addr);
+
+    struct ifaddrmsg ifa = {};
+    ifa.ifa_family = static_cast<unsigned char>(isV4 ? AF_INET : AF_INET6);
+    ifa.ifa_prefixlen = static_cast<unsigned char>(prefix.getMaskLength());
+    ifa.ifa_index = ifindex;
+
+    if (nlmsg_append(msg, &ifa, sizeof(ifa), NLMSG_ALIGNTO) < 0 ||
+        nla_put(msg, IFA_LOCAL, addrLen, addr) < 0 ||
+        nla_put(msg, IFA_ADDRESS, addrLen, addr) < 0 ||
+        (metric && nla_put_u32(msg, IFA_RT_PRIORITY, metric) < 0))
+    {
+        nlmsg_free(msg);
+        return error(-NLE_NOMEM);
+    }
+
+    if (isV4 && broadcast)
+    {
+        auto bcast = prefix.getBroadcastIp().getIp();
+        if (nla_put(msg, IFA_BROADCAST, addrLen, &bcast.ip_addr.ipv4_addr) < 0)
+        {
+            nlmsg_free(msg);
+            return error(-NLE_NOMEM);
+        }
+    }
+
+    return send(msg);
+}
+
+int NlKernelCfg::delAddress(const string &ifname, const IpPrefix &prefix)
+{
+    SWSS_LOG_ENTER();
+
+    int ifindex = getIfIndex(ifname);
+    if (!ifindex)
+    {
+        return error(-NLE_OBJ_NOTFOUND);
+    }
+
+    struct nl_msg *msg = nlmsg_alloc_simple(RTM_DELADDR, 0);
+    if (!msg)
+    {
+        return error(-NLE_NOMEM);
+    }
+
+    auto ip = prefix.getIp().getIp();
+    bool isV4 = prefix.isV4();
+    int addrLen = static_cast<int>(isV4 ? sizeof(ip.ip_addr.ipv4_addr) : sizeof(ip.ip_addr.ipv6_addr));
+    const void *addr = isV4 ? static_cast<const void *>(&ip.ip_addr.ipv4_addr) :
+                              static_cast<const void *>(ip.ip_addr.ipv6_addr);
+
+    struct ifaddrmsg ifa = {};
+    ifa.ifa_family = static_cast<unsigned char>(isV4 ? AF_INET : AF_INET6);
+    ifa.ifa_prefixlen = static_cast<unsigned char>(prefix.getMaskLength());
+    ifa.ifa_index = ifindex;
+
+    if (nlmsg_append(msg, &ifa, sizeof(ifa), NLMSG_ALIGNTO) < 0 ||
+        nla_put(msg, IFA_LOCAL, addrLen, addr) < 0)
+    {
+        nlmsg_free(msg);
+        return error(-NLE_NOMEM);
+    }
+
+    return send(msg);
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ipprefix.h"
+#include "macaddress.h"
+
+#define NL_WITH_ERROR_THROW(op, desc)   ({                                      \
+    int ret = (op);                                                             \
+    if (ret != 0)                                                               \
+    {                                                                           \
+        throw std::runtime_error(std::string(desc) + " : " +                    \
+                                 swss::NlKernelCfg::errStr(ret));               \
+    }                                                                           \
+})
+
+struct nl_sock;
+struct nl_msg;
+
+namespace swss {
+
+/*
+ * Kernel network configuration over rtnetlink.
+ *
+ * Replaces the /sbin/ip and /sbin/bridge shell-outs used by the cfgmgr
+ * daemons for link, VLAN, bridge, address, MTU and admin state operations.
+ * All methods return 0 on success or a negative libnl error code, which can
+ * be turned into a message with errStr().
+ *
+ * Between beginBatch() and commitBatch() requests are queued instead of being
+ * sent; commitBatch() writes all of them to the socket back to back and then
+ * collects the acknowledgements, so a sequence of operations costs a single
+ * round trip. The kernel handles the requests in order, but a failing request
+ * does not stop the ones queued after it. commitBatch() logs every failed
+ * request, returns the first error and can hand out the status of each request
+ * in the order they were issued.
+ */
+class NlKernelCfg
+{
+public:
+    NlKernelCfg();
+    ~NlKernelCfg();
+
+    NlKernelCfg(const NlKernelCfg &) = delete;
+    NlKernelCfg &operator=(const NlKernelCfg &) = delete;
+
+    void beginBatch();
+    int commitBatch(std::vector<int> *results = nullptr);
+
+    /* Link */
+    int addLink(const std::string &ifname, const std::string &kind, uint32_t mtu = 0, bool up = false);
+    int addVlanLink(const std::string &parent, const std::string &ifname, uint16_t vlanId,
+                    const MacAddress &mac = MacAddress(), bool up = false);
+    int delLink(const std::string &ifname);
+    int setLinkAdminState(const std::string &ifname, bool up);
+    int setLinkAdminState(const std::string &ifname, const std::string &adminStatus);
+    int setLinkMtu(const std::string &ifname, uint32_t mtu);
+    int setLinkMac(const std::string &ifname, const MacAddress &mac);
+    /* An empty master detaches the link from its current master */
+    int setLinkMaster(const std::string &ifname, const std::string &master);
+    bool linkExists(const std::string &ifname) const;
+
+    /* Bridge VLAN, "self" targets the bridge device itself rather than a port */
+    int addBridgeVlan(const std::string &ifname, uint16_t vlanId, bool untagged, bool self = false);
+    int delBridgeVlan(const std::string &ifname, uint16_t vlanId, bool self = false);
+    int getBridgeVlanCount(const std::string &ifname, size_t &count);
+
+    /* Address */
+    int addAddress(const std::string &ifname, const IpPrefix &prefix, bool broadcast = false, uint32_t metric = 0);
+    int delAddress(const std::string &ifname, const IpPrefix &prefix);
+
+    static std::string errStr(int err);
+
+private:
+    struct nl_sock *m_sock;
+    bool m_batching;
+    /* Status of each request issued in the batch, the queued ones are
+     * updated when their ack is received */
+    std::vector<int> m_batchResults;
+    /* Queued requests with the index of their status */
+    std::vector<std::pair<struct nl_msg *, size_t>> m_batch;
+
+    struct nl_msg *allocLinkMsg(int type, int flags, int family, int ifindex, const std::string &ifname = "");
+    int getIfIndex(const std::string &ifname) const;
+    int send(struct nl_msg *msg);
+    int flush();
+    int error(int err);
+};
+
+}
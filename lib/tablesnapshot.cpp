@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <hiredis/hiredis.h>
+#include "tablesnapshot.h"
+
+using namespace std;
+
+namespace swss {
+
+/* HGETALL the redis keys in one pipeline, the table key follows the first prefixSize characters */
+static size_t readEntries(redisContext *ctx, size_t prefixSize, const vector<string> &keys,
+                          const function<void(KeyOpFieldsValuesTuple &&)> &onEntry)
+{
+    size_t count = 0;
+
+    for (const auto &key : keys)
+    {
+        if (redisAppendCommand(ctx, "HGETALL %b", key.data(), key.size()) != REDIS_OK)
+        {
+            throw runtime_error("Failed to queue HGETALL " + key);
+        }
+    }
+
+    for (const auto &key : keys)
+    {
+        redisReply *reply = nullptr;
+        if (redisGetReply(ctx, (void **)&reply) != REDIS_OK || reply == nullptr)
+        {
+            throw runtime_error("Failed to read HGETALL " + key);
+        }
+        unique_ptr<redisReply, void (*)(void *)> guard(reply, freeReplyObject);
+
+        if (reply->type != REDIS_REPLY_ARRAY || reply->elements % 2)
+        {
+            throw runtime_error("Unexpected HGETALL reply for " + key);
+        }
+
+        /* Same as Table::get(), skip keys without any field */
+        if (!reply->elements)
+        {
+            continue;
+        }
+
+        KeyOpFieldsValuesTuple kco;
+        kfvKey(kco) = key.substr(prefixSize);
+        kfvOp(kco) = SET_COMMAND;
+
+        auto &fvs = kfvFieldsValues(kco);
+        fvs.reserve(reply->elements / 2);
+        for (size_t i = 0; i < reply->elements; i += 2)
+        {
+            fvs.emplace_back(string(reply->element[i]->str, reply->element[i]->len),
+                             string(reply->element[i + 1]->str, reply->element[i + 1]->len));
+        }
+
+        onEntry(std::move(kco));
+        count++;
+    }
+
+    return count;
+}
+
+size_t readTableSnapshot(const DBConnector *db, const string &tableName, const string &separator,
+                         size_t windowSize, const function<void(KeyOpFieldsValuesTuple &&)> &onEntry)
+{
+    unique_ptr<DBConnector> conn(db->newConnector(0));
+    redisContext *ctx = conn->getContext();
+
+    const string prefix = tableName + separator;
+    const string pattern = prefix + "*";
+    size_t window = max<size_t>(windowSize, 1);
+    size_t count = 0;
+    int cursor = 0;
+
+    do
+    {
+        auto res = conn->scan(cursor, pattern.c_str(), static_cast<uint32_t>(window));
+        cursor = res.first;
+        count += readEntries(ctx, prefix.size(), res.second, onEntry);
+    } while (cursor != 0);
+
+    return count;
+}
+
+size_t readTableEntries(DBConnector *db, const string &tableName, const string &separator,
+                        const vector<string> &keys, size_t windowSize,
+                        const function<void(KeyOpFieldsValuesTuple &&)> &onEntry)
+{
+    redisContext *ctx = db->getContext();
+
+    const string prefix = tableName + separator;
+    size_t window = max<size_t>(windowSize, 1);
+    size_t count = 0;
+
+    vector<string> redisKeys;
+    redisKeys.reserve(min(window, keys.size()));
+    for (size_t start = 0; start < keys.size(); start += window)
+    {
+        redisKeys.clear();
+        for (size_t i = start; i < keys.size() && i < start + window; i++)
+        {
+            redisKeys.push_back(prefix + keys[i]);
+        }
+
+        count += readEntries(ctx, prefix.size(), redisKeys, onEntry);
+    }
+
+    return count;
+}
+
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "dbconnector.h"
+#include "table.h"
+
+/* Number of keys read per SCAN/HGETALL window when reading a table snapshot */
+#define DEFAULT_SNAPSHOT_WINDOW_SIZE 1024
+
+namespace swss {
+    /*
+     * Read the whole content of a table on a dedicated connection, with SCAN
+     * and pipelined HGETALL in windows of windowSize keys. Each entry is handed
+     * over as a SET tuple, keys without any field are skipped like Table::get()
+     * does. Returns the number of entries read, throws on redis errors.
+     */
+    size_t readTableSnapshot(const DBConnector *db, const std::string &tableName,
+                             const std::string &separator, size_t windowSize,
+                             const std::function<void(KeyOpFieldsValuesTuple &&)> &onEntry);
+
+    /*
+     * Read the given keys of a table on the connection of db, with pipelined
+     * HGETALL in windows of windowSize keys. The connection must not be used
+     * by anyone else meanwhile. Entries are handed over in the order of keys,
+     * keys without any field are skipped. Returns the number of entries read,
+     * throws on redis errors.
+     */
+    size_t readTableEntries(DBConnector *db, const std::string &tableName,
+                            const std::string &separator, const std::vector<std::string> &keys,
+                            size_t windowSize,
+                            const std::function<void(KeyOpFieldsValuesTuple &&)> &onEntry);
+}
@@ -2,6 +2,7 @@
 #include <limits.h>
 #include <unordered_map>
 #include <algorithm>
+#include <typeinfo>
 #include "aclorch.h"
 #include "logger.h"
 #include "schema.h"
@@ -11,6 +12,7 @@
 #include "timer.h"
 #include "crmorch.h"
 #include "sai_serialize.h"
+#include "bulker.h"
 
 using namespace std;
 using namespace swss;
@@ -26,6 +28,7 @@ extern sai_acl_api_t*    sai_acl_api;
 extern sai_port_api_t*   sai_port_api;
 extern sai_switch_api_t* sai_switch_api;
 extern sai_object_id_t   gSwitchId;
+extern size_t            gMaxBulkSize;
 extern PortsOrch*        gPortsOrch;
 extern CrmOrch *gCrmOrch;
 extern SwitchOrch *gSwitchOrch;
@@ -818,20 +821,20 @@ bool AclRule::validateAddMatch(string attr_name, string attr_value)
 
             for (auto alias : ports)
             {
-                Port port;
-                if (!gPortsOrch->getPort(alias, port))
+                const Port *port = gPortsOrch->getPortPtr(alias);
+                if (port == nullptr)
                 {
                     SWSS_LOG_ERROR("Failed to locate port %s", alias.c_str());
                     return false;
                 }
 
-                if (port.m_type != Port::PHY)
+                if (port->m_type != Port::PHY)
                 {
                     SWSS_LOG_ERROR("Cannot bind rule to %s: IN_PORTS can only match physical interfaces", alias.c_str());
                     return false;
                 }
 
-                inPorts.push_back(port.m_port_id);
+                inPorts.push_back(port->m_port_id);
             }
 
             matchData.data.objlist.count = static_cast<uint32_t>(inPorts.size());
@@ -848,20 +851,20 @@ bool AclRule::validateAddMatch(string attr_name, string attr_value)
 
             for (auto alias : ports)
             {
-                Port port;
-                if (!gPortsOrch->getPort(alias, port))
+                const Port *port = gPortsOrch->getPortPtr(alias);
+                if (port == nullptr)
                 {
                     SWSS_LOG_ERROR("Failed to locate port %s", alias.c_str());
                     return false;
                 }
 
-                if (port.m_type != Port::PHY)
+                if (port->m_type != Port::PHY)
                 {
                     SWSS_LOG_ERROR("Cannot bind rule to %s: OUT_PORTS can only match physical interfaces", alias.c_str());
                     return false;
                 }
 
-                outPorts.push_back(port.m_port_id);
+                outPorts.push_back(port->m_port_id);
             }
 
             matchData.data.objlist.count = static_cast<uint32_t>(outPorts.size());
@@ -870,19 +873,19 @@ bool AclRule::validateAddMatch(string attr_name, string attr_value)
         else if (attr_name == MATCH_OUT_PORT)
         {
             auto alias = attr_value;
-            Port port;
-            if (!gPortsOrch->getPort(alias, port))
+            const Port *port = gPortsOrch->getPortPtr(alias);
+            if (port == nullptr)
             {
                 SWSS_LOG_ERROR("Failed to locate port %s", alias.c_str());
                 return false;
             }
-            if (port.m_type != Port::PHY)
+            if (port->m_type != Port::PHY)
             {
                 SWSS_LOG_ERROR("Cannot bind rule to %s: OUT_PORT can only match physical interfaces", alias.c_str());
                 return false;
             }
 
-            matchData.data.oid = port.m_port_id;
+            matchData.data.oid = port->m_port_id;
         }
         else if (attr_name == MATCH_IP_TYPE)
         {
@@ -1112,11 +1115,41 @@ bool AclRule::createRule()
     SWSS_LOG_ENTER();
 
     vector<sai_attribute_t> rule_attrs;
-    sai_object_id_t range_objects[2];
-    sai_object_list_t range_object_list = {0, range_objects};
+    if (!getRuleAttrs(rule_attrs))
+    {
+        return false;
+    }
+
+    sai_object_id_t ruleOid = SAI_NULL_OBJECT_ID;
+    sai_status_t status = sai_acl_api->create_acl_entry(&ruleOid, gSwitchId, (uint32_t)rule_attrs.size(), rule_attrs.data());
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        if (status == SAI_STATUS_ITEM_ALREADY_EXISTS)
+        {
+            SWSS_LOG_NOTICE("ACL rule %s already exists", m_id.c_str());
+            return true;
+        }
+        SWSS_LOG_ERROR("Failed to create ACL rule %s, rv:%d",
+                m_id.c_str(), status);
+        onRuleCreateFailed();
+        return false;
+    }
+
+    onRuleCreated(ruleOid);
+
+    return true;
+}
+
+bool AclRule::isBulkCreateSupported() const
+{
+    return false;
+}
+
+bool AclRule::getRuleAttrs(vector<sai_attribute_t> &rule_attrs)
+{
+    SWSS_LOG_ENTER();
 
     sai_attribute_t attr;
-    sai_status_t status;
 
     // store table oid this rule belongs to
     attr.id = SAI_ACL_ENTRY_ATTR_TABLE_ID;
@@ -1142,6 +1175,9 @@ bool AclRule::createRule()
 
     if (!m_rangeConfig.empty())
     {
+        // The range list is referenced by the attribute, keep it in the rule
+        // so that it stays valid until a bulk create is flushed
+        m_rangeOids.clear();
         for (const auto& rangeConfig: m_rangeConfig)
         {
             SWSS_LOG_INFO("Creating range object %u..%u", rangeConfig.min, rangeConfig.max);
@@ -1150,17 +1186,19 @@ bool AclRule::createRule()
             if (!range)
             {
                 // release already created range if any
-                AclRange::remove(range_objects, range_object_list.count);
+                AclRange::remove(m_rangeOids.data(), static_cast<int>(m_rangeOids.size()));
+                m_rangeOids.clear();
                 return false;
             }
 
             m_ranges.push_back(range);
-            range_objects[range_object_list.count++] = range->getOid();
+            m_rangeOids.push_back(range->getOid());
         }
 
         attr.id = SAI_ACL_ENTRY_ATTR_FIELD_ACL_RANGE_TYPE;
         attr.value.aclfield.enable = true;
-        attr.value.aclfield.data.objlist = range_object_list;
+        attr.value.aclfield.data.objlist.count = static_cast<uint32_t>(m_rangeOids.size());
+        attr.value.aclfield.data.objlist.list = m_rangeOids.data();
         rule_attrs.push_back(attr);
     }
 
@@ -1178,26 +1216,20 @@ bool AclRule::createRule()
         rule_attrs.push_back(attr);
     }
 
-    status = sai_acl_api->create_acl_entry(&m_ruleOid, gSwitchId, (uint32_t)rule_attrs.size(), rule_attrs.data());
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        if (status == SAI_STATUS_ITEM_ALREADY_EXISTS)
-        {
-            SWSS_LOG_NOTICE("ACL rule %s already exists", m_id.c_str());
-            return true;
-        }
-        SWSS_LOG_ERROR("Failed to create ACL rule %s, rv:%d",
-                m_id.c_str(), status);
-        AclRange::remove(range_objects, range_object_list.count);
-        decreaseNextHopRefCount();
-    }
+    return true;
+}
 
-    if (status == SAI_STATUS_SUCCESS)
-    {
-        gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, m_pTable->getOid());
-    }
+void AclRule::onRuleCreated(sai_object_id_t ruleOid)
+{
+    m_ruleOid = ruleOid;
+    gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, m_pTable->getOid());
+}
 
-    return (status == SAI_STATUS_SUCCESS);
+void AclRule::onRuleCreateFailed()
+{
+    AclRange::remove(m_rangeOids.data(), static_cast<int>(m_rangeOids.size()));
+    m_rangeOids.clear();
+    decreaseNextHopRefCount();
 }
 
 void AclRule::decreaseNextHopRefCount()
@@ -1329,8 +1361,32 @@ bool AclRule::update(const AclRule& updatedRule)
     return true;
 }
 
+bool AclRule::isUpdateSupported(const AclRule& updatedRule) const
+{
+    return typeid(*this) == typeid(updatedRule) &&
+           m_rangeConfig.empty() && updatedRule.m_rangeConfig.empty();
+}
+
+void AclRule::takeRedirectTargets(AclRule& updatedRule)
+{
+    // The updated rule took its own next hop references when its redirect
+    // action was parsed, release the ones held for the old action.
+    decreaseNextHopRefCount();
+
+    m_redirect_target_next_hop = updatedRule.m_redirect_target_next_hop;
+    m_redirect_target_next_hop_group = updatedRule.m_redirect_target_next_hop_group;
+    updatedRule.m_redirect_target_next_hop.clear();
+    updatedRule.m_redirect_target_next_hop_group.clear();
+}
+
 bool AclRule::updateCounter(const AclRule& updatedRule)
 {
+    if (updatedRule.m_createCounter == m_createCounter &&
+        m_createCounter == (m_counterOid != SAI_NULL_OBJECT_ID))
+    {
+        return true;
+    }
+
     if (updatedRule.m_createCounter)
     {
         if (!enableCounter())
@@ -1364,7 +1420,7 @@ bool AclRule::updatePriority(const AclRule& updatedRule)
 
     sai_attribute_t attr {};
     attr.id = SAI_ACL_ENTRY_ATTR_PRIORITY;
-    attr.value.s32 = updatedRule.m_priority;
+    attr.value.u32 = updatedRule.m_priority;
     if (!setAttribute(attr))
     {
         return false;
@@ -1402,25 +1458,27 @@ bool AclRule::updateMatches(const AclRule& updatedRule)
         }
     );
 
-    for (const auto& attrPair: matchesDisabled)
+    // Set new and changed matches before disabling the removed ones, so
+    // that in between the rule never matches more than either version.
+    for (const auto& attrPair: matchesUpdated)
     {
         auto attr = attrPair.second.getSaiAttr();
-        attr.value.aclfield.enable = false;
         if (!setAttribute(attr))
         {
             return false;
         }
-        m_matches.erase(attrPair.first);
+        setMatch(attrPair.first, attr.value.aclfield);
     }
 
-    for (const auto& attrPair: matchesUpdated)
+    for (const auto& attrPair: matchesDisabled)
     {
         auto attr = attrPair.second.getSaiAttr();
+        attr.value.aclfield.enable = false;
         if (!setAttribute(attr))
         {
             return false;
         }
-        setMatch(attrPair.first, attr.value.aclfield);
+        m_matches.erase(attrPair.first);
     }
 
     return true;
@@ -1730,14 +1788,30 @@ bool AclRule::createCounter()
 {
     SWSS_LOG_ENTER();
 
-    sai_attribute_t attr;
-    vector<sai_attribute_t> counter_attrs;
-
     if (m_counterOid != SAI_NULL_OBJECT_ID)
     {
         return true;
     }
 
+    auto counter_attrs = getCounterAttrs();
+
+    sai_object_id_t counterOid = SAI_NULL_OBJECT_ID;
+    if (sai_acl_api->create_acl_counter(&counterOid, gSwitchId, (uint32_t)counter_attrs.size(), counter_attrs.data()) != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("Failed to create counter for the rule %s in table %s", m_id.c_str(), m_pTable->getId().c_str());
+        return false;
+    }
+
+    onCounterCreated(counterOid);
+
+    return true;
+}
+
+vector<sai_attribute_t> AclRule::getCounterAttrs() const
+{
+    sai_attribute_t attr;
+    vector<sai_attribute_t> counter_attrs;
+
     attr.id = SAI_ACL_COUNTER_ATTR_TABLE_ID;
     attr.value.oid = m_pTable->getOid();
     counter_attrs.push_back(attr);
@@ -1749,17 +1823,16 @@ bool AclRule::createCounter()
         counter_attrs.push_back(attr);
     }
 
-    if (sai_acl_api->create_acl_counter(&m_counterOid, gSwitchId, (uint32_t)counter_attrs.size(), counter_attrs.data()) != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_ERROR("Failed to create counter for the rule %s in table %s", m_id.c_str(), m_pTable->getId().c_str());
-        return false;
-    }
+    return counter_attrs;
+}
+
+void AclRule::onCounterCreated(sai_object_id_t counterOid)
+{
+    m_counterOid = counterOid;
 
     gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_COUNTER, m_pTable->getOid());
 
     SWSS_LOG_INFO("Created counter for the rule %s in table %s", m_id.c_str(), m_pTable->getId().c_str());
-
-    return true;
 }
 
 bool AclRule::removeRanges()
@@ -1893,16 +1966,16 @@ sai_object_id_t AclRulePacket::getRedirectObjectId(const string& redirect_value)
     string target = redirect_value;
 
     // Try to parse physical port and LAG first
-    Port port;
-    if (gPortsOrch->getPort(target, port))
+    const Port *port = gPortsOrch->getPortPtr(target);
+    if (port != nullptr)
     {
-        if (port.m_type == Port::PHY)
+        if (port->m_type == Port::PHY)
         {
-            return port.m_port_id;
+            return port->m_port_id;
         }
-        else if (port.m_type == Port::LAG)
+        else if (port->m_type == Port::LAG)
         {
-            return port.m_lag_id;
+            return port->m_lag_id;
         }
         else
         {
@@ -1977,6 +2050,11 @@ void AclRulePacket::onUpdate(SubjectType, void *)
     // Do nothing
 }
 
+bool AclRulePacket::isBulkCreateSupported() const
+{
+    return true;
+}
+
 AclRuleMirror::AclRuleMirror(AclOrch *aclOrch, MirrorOrch *mirror, string rule, string table) :
         AclRule(aclOrch, rule, table),
         m_state(false),
@@ -2122,6 +2200,11 @@ bool AclRuleMirror::deactivate()
     return true;
 }
 
+bool AclRuleMirror::isUpdateSupported(const AclRule&) const
+{
+    return false;
+}
+
 bool AclRuleMirror::update(const AclRule& rule)
 {
     auto mirrorRule = dynamic_cast<const AclRuleMirror*>(&rule);
@@ -2944,6 +3027,11 @@ void AclRuleDTelWatchListEntry::onUpdate(SubjectType type, void *cntx)
     }
 }
 
+bool AclRuleDTelWatchListEntry::isUpdateSupported(const AclRule&) const
+{
+    return false;
+}
+
 bool AclRuleDTelWatchListEntry::update(const AclRule& rule)
 {
     auto dtelWatchListRule = dynamic_cast<const AclRuleDTelWatchListEntry*>(&rule);
@@ -3675,7 +3763,9 @@ AclOrch::AclOrch(vector<TableConnector>& connectors, DBConnector* stateDb, Switc
             StatsMode::READ,
             ACL_COUNTER_DEFAULT_POLLING_INTERVAL_MS,
             ACL_COUNTER_DEFAULT_ENABLED_STATE
-        )
+        ),
+        m_aclCounterBulker(sai_acl_api, gSwitchId, gMaxBulkSize, SAI_OBJECT_TYPE_ACL_COUNTER),
+        m_aclEntryBulker(sai_acl_api, gSwitchId, gMaxBulkSize, SAI_OBJECT_TYPE_ACL_ENTRY)
 {
     SWSS_LOG_ENTER();
 
@@ -3700,6 +3790,16 @@ AclOrch::~AclOrch()
     deleteDTelWatchListTables();
 }
 
+/* Mirror rules need their session, and rules are bound to ports and LAGs */
+vector<string> AclOrch::getWarmStartDependencies() const
+{
+    return {
+        CFG_MIRROR_SESSION_TABLE_NAME,
+        APP_PORT_TABLE_NAME,
+        APP_LAG_MEMBER_TABLE_NAME
+    };
+}
+
 void AclOrch::update(SubjectType type, void *cntx)
 {
     SWSS_LOG_ENTER();
@@ -3994,6 +4094,7 @@ bool AclOrch::addAclTable(AclTable &newTable)
     if (createBindAclTable(newTable, table_oid))
     {
         m_AclTables[table_oid] = newTable;
+        m_AclTableIds[newTable.id] = table_oid;
         SWSS_LOG_NOTICE("Created ACL table %s oid:%" PRIx64,
                 newTable.id.c_str(), table_oid);
 
@@ -4069,6 +4170,7 @@ bool AclOrch::removeAclTable(string table_id)
         }
 
         SWSS_LOG_NOTICE("Successfully deleted ACL table %s", table_id.c_str());
+        m_AclTableIds.erase(m_AclTables[table_oid].id);
         m_AclTables.erase(table_oid);
 
         // Clear mirror table information
@@ -4351,6 +4453,27 @@ bool AclOrch::updateAclRule(shared_ptr<AclRule> updatedRule)
     return true;
 }
 
+bool AclOrch::updateAclRuleInPlace(shared_ptr<AclRule> rule, shared_ptr<AclRule> updatedRule)
+{
+    SWSS_LOG_ENTER();
+
+    if (!rule->isUpdateSupported(*updatedRule))
+    {
+        return false;
+    }
+
+    if (!updateAclRule(updatedRule))
+    {
+        SWSS_LOG_WARN("Failed to update ACL rule %s in table %s in place, recreating it",
+                rule->getId().c_str(), rule->getTableId().c_str());
+        return false;
+    }
+
+    rule->takeRedirectTargets(*updatedRule);
+
+    return true;
+}
+
 bool AclOrch::isCombinedMirrorV6Table()
 {
     return m_isCombinedMirrorV6Table;
@@ -4586,6 +4709,8 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
 
+    AclRuleBulk bulk;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -4598,6 +4723,12 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
 
         SWSS_LOG_INFO("OP: %s, TABLE_ID: %s, RULE_ID: %s", op.c_str(), table_id.c_str(), rule_id.c_str());
 
+        // Keep the order of operations on a rule queued for bulk creation
+        if (bulk.keys.find(key) != bulk.keys.end())
+        {
+            flushAclRuleBulk(consumer, bulk);
+        }
+
         if (table_id.empty())
         {
             SWSS_LOG_WARN("ACL rule with RULE_ID: %s is not valid as TABLE_ID is empty", rule_id.c_str());
@@ -4646,6 +4777,7 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
             {
                 SWSS_LOG_ERROR("Error while creating ACL rule %s: %s", rule_id.c_str(), e.what());
                 it = consumer.m_toSync.erase(it);
+                flushAclRuleBulk(consumer, bulk);
                 return;
             }
             bool bHasTCPFlag = false;
@@ -4730,7 +4862,19 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
             // validate and create ACL rule
             if (bAllAttributesOk && newRule->validate())
             {
-                if (addAclRule(newRule, table_id))
+                // New rules are created in bulk once the pass is over. An
+                // existing rule is updated in place where possible, else it
+                // is removed and recreated by AclTable::add().
+                auto &tableRules = m_AclTables[table_oid].rules;
+                auto ruleIt = tableRules.find(rule_id);
+                if (ruleIt == tableRules.end() && newRule->isBulkCreateSupported())
+                {
+                    bulk.rules.push_back({ newRule, table_id, it });
+                    bulk.keys.insert(key);
+                    it++;
+                }
+                else if ((ruleIt != tableRules.end() && updateAclRuleInPlace(ruleIt->second, newRule)) ||
+                         addAclRule(newRule, table_id))
                 {
                     setAclRuleStatus(table_id, rule_id, AclObjectStatus::ACTIVE);
                     it = consumer.m_toSync.erase(it);
@@ -4769,6 +4913,120 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
             SWSS_LOG_ERROR("Unknown operation type %s", op.c_str());
         }
     }
+
+    flushAclRuleBulk(consumer, bulk);
+}
+
+void AclOrch::flushAclRuleBulk(Consumer &consumer, AclRuleBulk &bulk)
+{
+    SWSS_LOG_ENTER();
+
+    if (bulk.rules.empty())
+    {
+        return;
+    }
+
+    size_t count = bulk.rules.size();
+    vector<vector<sai_attribute_t>> attrs(count);
+    vector<sai_object_id_t> oids(count, SAI_NULL_OBJECT_ID);
+    vector<sai_status_t> statuses(count, SAI_STATUS_SUCCESS);
+    vector<bool> failed(count, false);
+
+    // Counters first, the entries refer to them
+    for (size_t i = 0; i < count; i++)
+    {
+        auto &rule = bulk.rules[i].rule;
+        if (rule->getCreateCounter())
+        {
+            attrs[i] = rule->getCounterAttrs();
+            m_aclCounterBulker.create_entry(&oids[i], (uint32_t)attrs[i].size(), attrs[i].data(), &statuses[i]);
+        }
+    }
+    m_aclCounterBulker.flush();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        auto &entry = bulk.rules[i];
+        auto &rule = entry.rule;
+        if (rule->getCreateCounter())
+        {
+            if (statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("Failed to create counter for the rule %s in table %s, rv:%d",
+                        rule->getId().c_str(), entry.tableId.c_str(), statuses[i]);
+                failed[i] = true;
+            }
+            else
+            {
+                rule->onCounterCreated(oids[i]);
+            }
+        }
+
+        attrs[i].clear();
+        oids[i] = SAI_NULL_OBJECT_ID;
+
+        if (failed[i])
+        {
+            continue;
+        }
+
+        if (!rule->getRuleAttrs(attrs[i]))
+        {
+            rule->rollbackCounter();
+            failed[i] = true;
+            continue;
+        }
+        m_aclEntryBulker.create_entry(&oids[i], (uint32_t)attrs[i].size(), attrs[i].data(), &statuses[i]);
+    }
+    m_aclEntryBulker.flush();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        auto &entry = bulk.rules[i];
+        auto &rule = entry.rule;
+        auto rule_id = rule->getId();
+
+        if (!failed[i] && statuses[i] == SAI_STATUS_ITEM_ALREADY_EXISTS)
+        {
+            // Same as AclRule::createRule
+            SWSS_LOG_NOTICE("ACL rule %s already exists", rule_id.c_str());
+        }
+        else if (!failed[i] && statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to create ACL rule %s in table %s, rv:%d",
+                    rule_id.c_str(), entry.tableId.c_str(), statuses[i]);
+            rule->onRuleCreateFailed();
+            rule->rollbackCounter();
+            failed[i] = true;
+        }
+
+        if (failed[i])
+        {
+            // Everything of the rule is rolled back, it stays in m_toSync and
+            // is created again by the next pass
+            setAclRuleStatus(entry.tableId, rule_id, AclObjectStatus::PENDING_CREATION);
+            continue;
+        }
+
+        if (statuses[i] == SAI_STATUS_SUCCESS)
+        {
+            rule->onRuleCreated(oids[i]);
+        }
+        m_AclTables[getTableById(entry.tableId)].rules[rule_id] = rule;
+        SWSS_LOG_NOTICE("Successfully created ACL rule %s in table %s",
+                rule_id.c_str(), entry.tableId.c_str());
+
+        if (rule->hasCounter())
+        {
+            registerFlexCounter(*rule);
+        }
+
+        setAclRuleStatus(entry.tableId, rule_id, AclObjectStatus::ACTIVE);
+        consumer.m_toSync.erase(entry.it);
+    }
+
+    bulk.rules.clear();
+    bulk.keys.clear();
 }
 
 void AclOrch::doAclTableTypeTask(Consumer &consumer)
@@ -4900,7 +5158,7 @@ const AclTableType* AclOrch::getAclTableType(const string& tableTypeName) const
     return &it->second;
 }
 
-sai_object_id_t AclOrch::getTableById(string table_id)
+sai_object_id_t AclOrch::getTableById(const string &table_id)
 {
     SWSS_LOG_ENTER();
 
@@ -4910,12 +5168,10 @@ sai_object_id_t AclOrch::getTableById(string table_id)
         return SAI_NULL_OBJECT_ID;
     }
 
-    for (auto it : m_AclTables)
+    auto it = m_AclTableIds.find(table_id);
+    if (it != m_AclTableIds.end())
     {
-        if (it.second.id == table_id)
-        {
-            return it.first;
-        }
+        return it->second;
     }
 
     // Check if the table is a mirror table and a sibling mirror table is created
@@ -7,9 +7,11 @@
 #include <mutex>
 #include <tuple>
 #include <map>
+#include <unordered_map>
 #include <condition_variable>
 
 #include "orch.h"
+#include "bulker.h"
 #include "switchorch.h"
 #include "portsorch.h"
 #include "mirrororch.h"
@@ -263,6 +265,9 @@ public:
 
     virtual bool create();
     virtual bool update(const AclRule& updatedRule);
+    // Whether update() can turn this rule into updatedRule in place
+    virtual bool isUpdateSupported(const AclRule& updatedRule) const;
+    void takeRedirectTargets(AclRule& updatedRule);
     virtual bool remove();
     virtual void onUpdate(SubjectType, void *) = 0;
     virtual void updateInPorts();
@@ -279,6 +284,18 @@ public:
     bool getCreateCounter() const;
 
     const vector<AclRangeConfig>& getRangeConfig() const;
+
+    // Split creation steps used by AclOrch to bulk create the counters and
+    // entries of a batch of rules. Rules with their own createRule() logic
+    // keep going through create().
+    virtual bool isBulkCreateSupported() const;
+    vector<sai_attribute_t> getCounterAttrs() const;
+    void onCounterCreated(sai_object_id_t counterOid);
+    bool getRuleAttrs(vector<sai_attribute_t> &rule_attrs);
+    void onRuleCreated(sai_object_id_t ruleOid);
+    void onRuleCreateFailed();
+    bool rollbackCounter() { return removeCounter(); }
+
     static shared_ptr<AclRule> makeShared(AclOrch *acl, MirrorOrch *mirror, DTelOrch *dtel, const string& rule, const string& table, const KeyOpFieldsValuesTuple&);
     virtual ~AclRule() {}
 
@@ -319,6 +336,7 @@ protected:
 
     vector<AclRangeConfig> m_rangeConfig;
     vector<AclRange*> m_ranges;
+    vector<sai_object_id_t> m_rangeOids;
 
 private:
     bool m_createCounter;
@@ -332,6 +350,7 @@ public:
     bool validateAddAction(string attr_name, string attr_value);
     bool validate();
     void onUpdate(SubjectType, void *) override;
+    bool isBulkCreateSupported() const override;
 
 protected:
     sai_object_id_t getRedirectObjectId(const string& redirect_param);
@@ -351,6 +370,7 @@ public:
     bool deactivate();
 
     bool update(const AclRule& updatedRule) override;
+    bool isUpdateSupported(const AclRule& updatedRule) const override;
 protected:
     bool m_state {false};
     string m_sessionName;
@@ -371,6 +391,7 @@ public:
     bool deactivate();
 
     bool update(const AclRule& updatedRule) override;
+    bool isUpdateSupported(const AclRule& updatedRule) const override;
 protected:
     DTelOrch *m_pDTelOrch;
     string m_intSessionId;
@@ -472,9 +493,10 @@ public:
             RouteOrch               *routeOrch,
             DTelOrch                *m_dTelOrch = NULL);
     ~AclOrch();
+    std::vector<std::string> getWarmStartDependencies() const override;
     void update(SubjectType, void *);
 
-    sai_object_id_t getTableById(string table_id);
+    sai_object_id_t getTableById(const string &table_id);
     const AclTable* getTableByOid(sai_object_id_t oid) const;
     const AclTableType* getAclTableType(const std::string& tableTypeName) const;
 
@@ -500,6 +522,8 @@ public:
     bool updateAclRule(shared_ptr<AclRule> updatedAclRule);
     bool updateAclRule(string table_id, string rule_id, string attr_name, void *data, bool oper);
     bool updateAclRule(string table_id, string rule_id, bool enableCounter);
+    // Update an installed rule to updatedRule setting only the changed attributes
+    bool updateAclRuleInPlace(shared_ptr<AclRule> rule, shared_ptr<AclRule> updatedRule);
     AclRule* getAclRule(string table_id, string rule_id);
 
     bool isCombinedMirrorV6Table();
@@ -533,6 +557,20 @@ private:
     void doAclTableTask(Consumer &consumer);
     void doAclRuleTask(Consumer &consumer);
     void doAclTableTypeTask(Consumer &consumer);
+
+    // New rules of one doAclRuleTask() pass, created in bulk at its end
+    struct AclRuleBulkEntry
+    {
+        shared_ptr<AclRule> rule;
+        string tableId;
+        SyncMap::iterator it;
+    };
+    struct AclRuleBulk
+    {
+        vector<AclRuleBulkEntry> rules;
+        unordered_set<string> keys;
+    };
+    void flushAclRuleBulk(Consumer &consumer, AclRuleBulk &bulk);
     void init(vector<TableConnector>& connectors, PortsOrch *portOrch, MirrorOrch *mirrorOrch, NeighOrch *neighOrch, RouteOrch *routeOrch);
     void initDefaultTableTypes(const string& platform, const string& sub_platform);
 
@@ -578,6 +616,8 @@ private:
     void removeAllAclRuleStatus();
 
     map<sai_object_id_t, AclTable> m_AclTables;
+    // Table name to OID index of m_AclTables, kept in sync on table add/remove
+    unordered_map<string, sai_object_id_t> m_AclTableIds;
     // TODO: Move all ACL tables into one map: name -> instance
     map<string, AclTable> m_ctrlAclTables;
     map<string, AclTableType> m_AclTableTypes;
@@ -596,6 +636,10 @@ private:
     acl_capabilities_t m_aclCapabilities;
     acl_action_enum_values_capabilities_t m_aclEnumActionCapabilities;
     FlexCounterManager m_flex_counter_manager;
+
+    // Bulk creation of the new rules of a doAclRuleTask() pass
+    ObjectBulker<sai_acl_api_t> m_aclCounterBulker;
+    ObjectBulker<sai_acl_api_t> m_aclEntryBulker;
 };
 
 #endif /* SWSS_ACLORCH_H */
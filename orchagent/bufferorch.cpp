@@ -1,5 +1,6 @@
 #include "tokenize.h"
 #include "bufferorch.h"
+#include "pfcactionhandler.h"
 #include "directory.h"
 #include "logger.h"
 #include "sai_serialize.h"
@@ -8,6 +9,7 @@
 #include <inttypes.h>
 #include <sstream>
 #include <iostream>
+#include <unordered_set>
 
 using namespace std;
 
@@ -19,6 +21,7 @@ extern sai_buffer_api_t *sai_buffer_api;
 extern PortsOrch *gPortsOrch;
 extern Directory<Orch*> gDirectory;
 extern sai_object_id_t gSwitchId;
+extern size_t gMaxBulkSize;
 extern string gMySwitchType;
 extern string gMyHostName;
 extern string gMyAsicName;
@@ -894,9 +897,13 @@ task_process_status BufferOrch::processQueue(KeyOpFieldsValuesTuple &tuple)
         return task_process_status::task_invalid_entry;
     }
 
-    sai_attribute_t attr;
-    attr.id = SAI_QUEUE_ATTR_BUFFER_PROFILE_ID;
-    attr.value.oid = sai_buffer_profile;
+    BufferBulkTask task;
+    task.type = SAI_OBJECT_TYPE_QUEUE;
+    task.key = key;
+    task.op = op;
+    task.indexes = tokens.back();
+    task.need_update_sai = need_update_sai;
+
     for (string port_name : port_names)
     {
         Port port;
@@ -943,104 +950,15 @@ task_process_status BufferOrch::processQueue(KeyOpFieldsValuesTuple &tuple)
                 queue_id = port.m_queue_ids[ind];
             }
 
-            if (need_update_sai)
-            {
-                SWSS_LOG_DEBUG("Applying buffer profile:0x%" PRIx64 " to queue index:%zd, queue sai_id:0x%" PRIx64, sai_buffer_profile, ind, queue_id);
-                sai_status_t sai_status = sai_queue_api->set_queue_attribute(queue_id, &attr);
-                if (sai_status != SAI_STATUS_SUCCESS)
-                {
-                    SWSS_LOG_ERROR("Failed to set queue's buffer profile attribute, status:%d", sai_status);
-                    task_process_status handle_status = handleSaiSetStatus(SAI_API_QUEUE, sai_status);
-                    if (handle_status != task_process_status::task_success)
-                    {
-                        return handle_status;
-                    }
-                }
-                // create/remove a port queue counter for the queue buffer.
-                // For VOQ chassis, flexcounterorch adds the Queue Counters for all egress and VOQ queues of all front panel and system ports
-                // to  the FLEX_COUNTER_DB irrespective of BUFFER_QUEUE configuration. So Port Queue counter needs to be updated only for non VOQ switch.
-                else if (gMySwitchType != "voq")
-                {
-                    auto flexCounterOrch = gDirectory.get<FlexCounterOrch*>();
-                    auto queues = tokens[1];
-                    if (op == SET_COMMAND &&
-                        (flexCounterOrch->getQueueCountersState() || flexCounterOrch->getQueueWatermarkCountersState()))
-                    {
-                        gPortsOrch->createPortBufferQueueCounters(port, queues);
-                    }
-                    else if (op == DEL_COMMAND &&
-                             (flexCounterOrch->getQueueCountersState() || flexCounterOrch->getQueueWatermarkCountersState()))
-                    {
-                        gPortsOrch->removePortBufferQueueCounters(port, queues);
-                    }
-                }
-            }
-
-            /* when we apply buffer configuration we need to increase the ref counter of this port
-             * or decrease the ref counter for this port when we remove buffer cfg
-             * so for each priority cfg in each port we will increase/decrease the ref counter
-             * also we need to know when the set command is for creating a buffer cfg or modifying buffer cfg -
-             * we need to increase ref counter only on create flow.
-             * so we added a map that will help us to know what was the last command for this port and priority -
-             * if the last command was set command then it is a modify command and we dont need to increase the buffer counter
-             * all other cases (no last command exist or del command was the last command) it means that we need to increase the ref counter */
-            if (op == SET_COMMAND)
-            {
-                if (queue_port_flags[port_name][ind] != SET_COMMAND)
-                {
-                    /* if the last operation was not "set" then it's create and not modify - need to increase ref counter */
-                    gPortsOrch->increasePortRefCount(port_name);
-                }
-            }
-            else if (op == DEL_COMMAND)
-            {
-                if (queue_port_flags[port_name][ind] == SET_COMMAND)
-		{
-                    /* we need to decrease ref counter only if the last operation was "SET_COMMAND" */
-                    gPortsOrch->decreasePortRefCount(port_name);
-                }
-            }
-            else
-            {
-                SWSS_LOG_ERROR("operation value is not SET or DEL (op = %s)", op.c_str());
-                return task_process_status::task_invalid_entry;
-            }
-            /* save the last command (set or delete) */
-            queue_port_flags[port_name][ind] = op;
-
+            task.entries.push_back({ port_name, ind, queue_id, sai_buffer_profile, SAI_STATUS_NOT_EXECUTED });
         }
-    }
 
-    if (m_ready_list.find(key) != m_ready_list.end())
-    {
-        m_ready_list[key] = true;
-    }
-    else
-    {
-        // If a buffer queue profile is not in the initial CONFIG_DB BUFFER_QUEUE table
-        // at BufferOrch object instantiation, it is considered being applied
-        // at run time, and, in this case, is not tracked in the m_ready_list. It is up to
-        // the application to guarantee the set order that the buffer queue profile
-        // should be applied to a physical port before the physical port is brought up to
-        // carry traffic. Here, we alert to application through syslog when such a wrong
-        // set order is detected.
-        for (const auto &port_name : port_names)
-        {
-            if(local_port == true)
-            {
-                if (gPortsOrch->isPortAdminUp(local_port_name)) {
-                    SWSS_LOG_WARN("Queue profile '%s' applied after port %s is up", key.c_str(), port_name.c_str());
-                }
-            }
-            else
-            {
-                if (gPortsOrch->isPortAdminUp(port_name)) {
-                    SWSS_LOG_WARN("Queue profile '%s' applied after port %s is up", key.c_str(), port_name.c_str());
-                }
-            }
-        }
+        task.port_names.push_back(port_name);
     }
 
+    /* SAI is updated and the task completed by flushBufferBulkTasks() */
+    m_bufferBulkTasks.push_back(std::move(task));
+
     return task_process_status::task_success;
 }
 
@@ -1119,9 +1037,13 @@ task_process_status BufferOrch::processPriorityGroup(KeyOpFieldsValuesTuple &tup
         return task_process_status::task_invalid_entry;
     }
 
-    sai_attribute_t attr;
-    attr.id = SAI_INGRESS_PRIORITY_GROUP_ATTR_BUFFER_PROFILE;
-    attr.value.oid = sai_buffer_profile;
+    BufferBulkTask task;
+    task.type = SAI_OBJECT_TYPE_INGRESS_PRIORITY_GROUP;
+    task.key = key;
+    task.op = op;
+    task.indexes = tokens.back();
+    task.need_update_sai = need_update_sai;
+
     for (string port_name : port_names)
     {
         Port port;
@@ -1139,98 +1061,16 @@ task_process_status BufferOrch::processPriorityGroup(KeyOpFieldsValuesTuple &tup
                 SWSS_LOG_ERROR("Invalid pg index specified:%zd", ind);
                 return task_process_status::task_invalid_entry;
             }
-            else
-            {
-                if (need_update_sai)
-                {
-                    sai_object_id_t pg_id;
-                    pg_id = port.m_priority_group_ids[ind];
-                    SWSS_LOG_DEBUG("Applying buffer profile:0x%" PRIx64 " to port:%s pg index:%zd, pg sai_id:0x%" PRIx64, sai_buffer_profile, port_name.c_str(), ind, pg_id);
-                    sai_status_t sai_status = sai_buffer_api->set_ingress_priority_group_attribute(pg_id, &attr);
-                    if (sai_status != SAI_STATUS_SUCCESS)
-                    {
-                        SWSS_LOG_ERROR("Failed to set port:%s pg:%zd buffer profile attribute, status:%d", port_name.c_str(), ind, sai_status);
-                        task_process_status handle_status = handleSaiSetStatus(SAI_API_BUFFER, sai_status);
-                        if (handle_status != task_process_status::task_success)
-                        {
-                            return handle_status;
-                        }
-                    }
-                    // create or remove a port PG counter for the PG buffer
-                    else
-                    {
-                        auto flexCounterOrch = gDirectory.get<FlexCounterOrch*>();
-                        auto pgs = tokens[1];
-                        if (op == SET_COMMAND &&
-                            (flexCounterOrch->getPgCountersState() || flexCounterOrch->getPgWatermarkCountersState()))
-                        {
-                            gPortsOrch->createPortBufferPgCounters(port, pgs);
-                        }
-                        else if (op == DEL_COMMAND &&
-                                 (flexCounterOrch->getPgCountersState() || flexCounterOrch->getPgWatermarkCountersState()))
-                        {
-                            gPortsOrch->removePortBufferPgCounters(port, pgs);
-                        }
-                    }
-                }
-            }
-
-            /* when we apply buffer configuration we need to increase the ref counter of this port
-             * or decrease the ref counter for this port when we remove buffer cfg
-             * so for each priority cfg in each port we will increase/decrease the ref counter
-             * also we need to know when the set command is for creating a buffer cfg or modifying buffer cfg -
-             * we need to increase ref counter only on create flow.
-             * so we added a map that will help us to know what was the last command for this port and priority -
-             * if the last command was set command then it is a modify command and we dont need to increase the buffer counter
-             * all other cases (no last command exist or del command was the last command) it means that we need to increase the ref counter */
-            if (op == SET_COMMAND)
-            {
-                if (pg_port_flags[port_name][ind] != SET_COMMAND)
-                {
-                    /* if the last operation was not "set" then it's create and not modify - need to increase ref counter */
-                    gPortsOrch->increasePortRefCount(port_name);
-                }
-            }
-            else if (op == DEL_COMMAND)
-            {
-                if (pg_port_flags[port_name][ind] == SET_COMMAND)
-                {
-                    /* we need to decrease ref counter only if the last operation was "SET_COMMAND" */
-                    gPortsOrch->decreasePortRefCount(port_name);
-                }
-            }
-            else
-            {
-                SWSS_LOG_ERROR("operation value is not SET or DEL (op = %s)", op.c_str());
-                return task_process_status::task_invalid_entry;
-            }
-            /* save the last command (set or delete) */
-            pg_port_flags[port_name][ind] = op;
 
+            task.entries.push_back({ port_name, ind, port.m_priority_group_ids[ind], sai_buffer_profile, SAI_STATUS_NOT_EXECUTED });
         }
-    }
 
-    if (m_ready_list.find(key) != m_ready_list.end())
-    {
-        m_ready_list[key] = true;
-    }
-    else
-    {
-        // If a buffer pg profile is not in the initial CONFIG_DB BUFFER_PG table
-        // at BufferOrch object instantiation, it is considered being applied
-        // at run time, and, in this case, is not tracked in the m_ready_list. It is up to
-        // the application to guarantee the set order that the buffer pg profile
-        // should be applied to a physical port before the physical port is brought up to
-        // carry traffic. Here, we alert to application through syslog when such a wrong
-        // set order is detected.
-        for (const auto &port_name : port_names)
-        {
-            if (gPortsOrch->isPortAdminUp(port_name)) {
-                SWSS_LOG_WARN("PG profile '%s' applied after port %s is up", key.c_str(), port_name.c_str());
-            }
-        }
+        task.port_names.push_back(port_name);
     }
 
+    /* SAI is updated and the task completed by flushBufferBulkTasks() */
+    m_bufferBulkTasks.push_back(std::move(task));
+
     return task_process_status::task_success;
 }
 
@@ -1428,6 +1268,248 @@ void BufferOrch::doTask()
     }
 }
 
+void BufferOrch::setBufferObjectsBulk(sai_object_type_t type, std::vector<BufferBulkEntry*> &entries)
+{
+    SWSS_LOG_ENTER();
+
+    if (entries.empty())
+    {
+        return;
+    }
+
+    std::vector<sai_object_key_t> keys(entries.size());
+    std::vector<sai_attribute_t> attrs(entries.size());
+    std::vector<sai_status_t> statuses(entries.size(), SAI_STATUS_NOT_EXECUTED);
+
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        keys[i].key.object_id = entries[i]->oid;
+        attrs[i].id = (type == SAI_OBJECT_TYPE_QUEUE) ?
+                      (sai_attr_id_t)SAI_QUEUE_ATTR_BUFFER_PROFILE_ID :
+                      (sai_attr_id_t)SAI_INGRESS_PRIORITY_GROUP_ATTR_BUFFER_PROFILE;
+        attrs[i].value.oid = entries[i]->profile;
+    }
+
+    sai_status_t status = SAI_STATUS_NOT_IMPLEMENTED;
+
+    /* A single object is not worth a bulk call */
+    if (entries.size() > 1 && m_isBulkSetSupported)
+    {
+        status = sai_bulk_object_set_attribute(type, (uint32_t)entries.size(), keys.data(), attrs.data(),
+                                               SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+        {
+            SWSS_LOG_NOTICE("Bulk set is not supported for queues and PGs, falling back to per object set");
+            m_isBulkSetSupported = false;
+        }
+    }
+
+    if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+    {
+        for (size_t i = 0; i < entries.size(); i++)
+        {
+            statuses[i] = (type == SAI_OBJECT_TYPE_QUEUE) ?
+                          sai_queue_api->set_queue_attribute(entries[i]->oid, &attrs[i]) :
+                          sai_buffer_api->set_ingress_priority_group_attribute(entries[i]->oid, &attrs[i]);
+        }
+    }
+
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        entries[i]->status = statuses[i];
+    }
+
+    SWSS_LOG_INFO("Applied buffer profiles to %zu %s", entries.size(),
+                  type == SAI_OBJECT_TYPE_QUEUE ? "queues" : "priority groups");
+
+    entries.clear();
+}
+
+task_process_status BufferOrch::completeBufferBulkTask(BufferBulkTask &task)
+{
+    SWSS_LOG_ENTER();
+
+    bool is_queue = (task.type == SAI_OBJECT_TYPE_QUEUE);
+    auto &port_flags = is_queue ? queue_port_flags : pg_port_flags;
+    const auto &op = task.op;
+
+    for (const auto &entry : task.entries)
+    {
+        const auto &port_name = entry.port_name;
+        auto ind = entry.index;
+
+        if (task.need_update_sai)
+        {
+            if (entry.status != SAI_STATUS_SUCCESS)
+            {
+                if (is_queue)
+                {
+                    SWSS_LOG_ERROR("Failed to set queue's buffer profile attribute, status:%d", entry.status);
+                }
+                else
+                {
+                    SWSS_LOG_ERROR("Failed to set port:%s pg:%zd buffer profile attribute, status:%d", port_name.c_str(), ind, entry.status);
+                }
+                task_process_status handle_status = handleSaiSetStatus(is_queue ? SAI_API_QUEUE : SAI_API_BUFFER, entry.status);
+                if (handle_status != task_process_status::task_success)
+                {
+                    return handle_status;
+                }
+            }
+            // create/remove a port queue/PG counter for the buffer.
+            // For VOQ chassis, flexcounterorch adds the Queue Counters for all egress and VOQ queues of all front panel and system ports
+            // to  the FLEX_COUNTER_DB irrespective of BUFFER_QUEUE configuration. So Port Queue counter needs to be updated only for non VOQ switch.
+            else if (!is_queue || gMySwitchType != "voq")
+            {
+                Port port;
+                auto flexCounterOrch = gDirectory.get<FlexCounterOrch*>();
+                bool counters_enabled = is_queue ?
+                    (flexCounterOrch->getQueueCountersState() || flexCounterOrch->getQueueWatermarkCountersState()) :
+                    (flexCounterOrch->getPgCountersState() || flexCounterOrch->getPgWatermarkCountersState());
+
+                if (counters_enabled && gPortsOrch->getPort(port_name, port))
+                {
+                    if (is_queue && op == SET_COMMAND)
+                    {
+                        gPortsOrch->createPortBufferQueueCounters(port, task.indexes);
+                    }
+                    else if (is_queue)
+                    {
+                        gPortsOrch->removePortBufferQueueCounters(port, task.indexes);
+                    }
+                    else if (op == SET_COMMAND)
+                    {
+                        gPortsOrch->createPortBufferPgCounters(port, task.indexes);
+                    }
+                    else
+                    {
+                        gPortsOrch->removePortBufferPgCounters(port, task.indexes);
+                    }
+                }
+            }
+
+            if (is_queue && entry.status == SAI_STATUS_SUCCESS)
+            {
+                /* The PFC watchdog restores this profile when a storm on the queue is over */
+                PfcWdZeroBufferHandler::updateQueueBufferProfile(entry.oid, entry.profile);
+            }
+        }
+
+        /* when we apply buffer configuration we need to increase the ref counter of this port
+         * or decrease the ref counter for this port when we remove buffer cfg
+         * so for each priority cfg in each port we will increase/decrease the ref counter
+         * also we need to know when the set command is for creating a buffer cfg or modifying buffer cfg -
+         * we need to increase ref counter only on create flow.
+         * so we added a map that will help us to know what was the last command for this port and priority -
+         * if the last command was set command then it is a modify command and we dont need to increase the buffer counter
+         * all other cases (no last command exist or del command was the last command) it means that we need to increase the ref counter */
+        if (op == SET_COMMAND)
+        {
+            if (port_flags[port_name][ind] != SET_COMMAND)
+            {
+                /* if the last operation was not "set" then it's create and not modify - need to increase ref counter */
+                gPortsOrch->increasePortRefCount(port_name);
+            }
+        }
+        else if (op == DEL_COMMAND)
+        {
+            if (port_flags[port_name][ind] == SET_COMMAND)
+            {
+                /* we need to decrease ref counter only if the last operation was "SET_COMMAND" */
+                gPortsOrch->decreasePortRefCount(port_name);
+            }
+        }
+        /* save the last command (set or delete) */
+        port_flags[port_name][ind] = op;
+    }
+
+    if (m_ready_list.find(task.key) != m_ready_list.end())
+    {
+        m_ready_list[task.key] = true;
+    }
+    else
+    {
+        // If a buffer queue/PG profile is not in the initial CONFIG_DB BUFFER_QUEUE/BUFFER_PG table
+        // at BufferOrch object instantiation, it is considered being applied
+        // at run time, and, in this case, is not tracked in the m_ready_list. It is up to
+        // the application to guarantee the set order that the buffer profile
+        // should be applied to a physical port before the physical port is brought up to
+        // carry traffic. Here, we alert to application through syslog when such a wrong
+        // set order is detected.
+        for (const auto &port_name : task.port_names)
+        {
+            if (gPortsOrch->isPortAdminUp(port_name)) {
+                SWSS_LOG_WARN("%s profile '%s' applied after port %s is up", is_queue ? "Queue" : "PG", task.key.c_str(), port_name.c_str());
+            }
+        }
+    }
+
+    return task_process_status::task_success;
+}
+
+void BufferOrch::flushBufferBulkTasks(Consumer &consumer)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_bufferBulkTasks.empty())
+    {
+        return;
+    }
+
+    /*
+     * Set the buffer profiles of all the queues and PGs of the batch with as few
+     * bulk calls as possible. An object updated twice in the batch, e.g. DEL then
+     * SET of the same key, starts a new bulk call so the order is preserved.
+     */
+    std::vector<BufferBulkEntry*> entries;
+    std::unordered_set<sai_object_id_t> oids;
+    sai_object_type_t type = SAI_OBJECT_TYPE_NULL;
+
+    for (auto &task : m_bufferBulkTasks)
+    {
+        if (!task.need_update_sai)
+        {
+            continue;
+        }
+
+        for (auto &entry : task.entries)
+        {
+            if (task.type != type || oids.find(entry.oid) != oids.end() || entries.size() >= gMaxBulkSize)
+            {
+                setBufferObjectsBulk(type, entries);
+                oids.clear();
+                type = task.type;
+            }
+
+            entries.push_back(&entry);
+            oids.insert(entry.oid);
+        }
+    }
+
+    setBufferObjectsBulk(type, entries);
+
+    for (auto &task : m_bufferBulkTasks)
+    {
+        auto task_status = completeBufferBulkTask(task);
+        switch(task_status)
+        {
+            case task_process_status::task_need_retry:
+                SWSS_LOG_INFO("Failed to process buffer task, retry it");
+                break;
+            case task_process_status::task_success:
+            case task_process_status::task_ignore:
+                consumer.m_toSync.erase(task.task);
+                break;
+            default:
+                SWSS_LOG_ERROR("Failed to process buffer task %s, drop it", task.key.c_str());
+                consumer.m_toSync.erase(task.task);
+                break;
+        }
+    }
+
+    m_bufferBulkTasks.clear();
+}
+
 void BufferOrch::doTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
@@ -1458,7 +1540,15 @@ void BufferOrch::doTask(Consumer &consumer)
             continue;
         }
 
+        auto bulk_task_count = m_bufferBulkTasks.size();
         auto task_status = (this->*(m_bufferHandlerMap[map_type_name]))(it->second);
+        if (task_status == task_process_status::task_success && m_bufferBulkTasks.size() > bulk_task_count)
+        {
+            /* Completed once the whole batch is flushed */
+            m_bufferBulkTasks.back().task = it++;
+            continue;
+        }
+
         switch(task_status)
         {
             case task_process_status::task_success :
@@ -1472,6 +1562,7 @@ void BufferOrch::doTask(Consumer &consumer)
             case task_process_status::task_failed:
                 SWSS_LOG_ERROR("Failed to process buffer task, drop it");
                 it = consumer.m_toSync.erase(it);
+                flushBufferBulkTasks(consumer);
                 return;
             case task_process_status::task_need_retry:
                 SWSS_LOG_INFO("Failed to process buffer task, retry it");
@@ -1483,4 +1574,6 @@ void BufferOrch::doTask(Consumer &consumer)
                 break;
         }
     }
+
+    flushBufferBulkTasks(consumer);
 }
@@ -40,6 +40,29 @@ public:
     const object_reference_map &getBufferPoolNameOidMap(void);
 
 private:
+    /* A queue or PG whose buffer profile is set when the batch is flushed */
+    struct BufferBulkEntry
+    {
+        std::string port_name;
+        size_t index;
+        sai_object_id_t oid;
+        sai_object_id_t profile;
+        sai_status_t status;
+    };
+
+    /* A BUFFER_QUEUE or BUFFER_PG task waiting for its SAI objects to be set */
+    struct BufferBulkTask
+    {
+        SyncMap::iterator task;
+        sai_object_type_t type;
+        std::string key;
+        std::string op;
+        std::string indexes;
+        bool need_update_sai;
+        std::vector<std::string> port_names;
+        std::vector<BufferBulkEntry> entries;
+    };
+
     typedef task_process_status (BufferOrch::*buffer_table_handler)(KeyOpFieldsValuesTuple &tuple);
     typedef map<string, buffer_table_handler> buffer_table_handler_map;
     typedef pair<string, buffer_table_handler> buffer_handler_pair;
@@ -59,6 +82,9 @@ private:
     task_process_status processPriorityGroup(KeyOpFieldsValuesTuple &tuple);
     task_process_status processIngressBufferProfileList(KeyOpFieldsValuesTuple &tuple);
     task_process_status processEgressBufferProfileList(KeyOpFieldsValuesTuple &tuple);
+    void setBufferObjectsBulk(sai_object_type_t type, std::vector<BufferBulkEntry*> &entries);
+    task_process_status completeBufferBulkTask(BufferBulkTask &task);
+    void flushBufferBulkTasks(Consumer &consumer);
 
     buffer_table_handler_map m_bufferHandlerMap;
     std::unordered_map<std::string, bool> m_ready_list;
@@ -70,6 +96,8 @@ private:
 
     bool m_isBufferPoolWatermarkCounterIdListGenerated = false;
     set<string> m_partiallyAppliedQueues;
+    std::vector<BufferBulkTask> m_bufferBulkTasks;
+    bool m_isBulkSetSupported = true;
 };
 #endif /* SWSS_BUFFORCH_H */
 
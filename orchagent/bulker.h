@@ -139,6 +139,24 @@ static inline bool operator==(const sai_outbound_routing_entry_t& a, const sai_o
         ;
 }
 
+static inline bool operator==(const sai_nat_entry_t& a, const sai_nat_entry_t& b)
+{
+    return a.switch_id == b.switch_id
+        && a.vr_id == b.vr_id
+        && a.nat_type == b.nat_type
+        && a.data.key.src_ip == b.data.key.src_ip
+        && a.data.key.dst_ip == b.data.key.dst_ip
+        && a.data.key.proto == b.data.key.proto
+        && a.data.key.l4_src_port == b.data.key.l4_src_port
+        && a.data.key.l4_dst_port == b.data.key.l4_dst_port
+        && a.data.mask.src_ip == b.data.mask.src_ip
+        && a.data.mask.dst_ip == b.data.mask.dst_ip
+        && a.data.mask.proto == b.data.mask.proto
+        && a.data.mask.l4_src_port == b.data.mask.l4_src_port
+        && a.data.mask.l4_dst_port == b.data.mask.l4_dst_port
+        ;
+}
+
 static inline std::size_t hash_value(const sai_ip_prefix_t& a)
 {
     size_t seed = 0;
@@ -199,6 +217,24 @@ namespace std
         }
     };
 
+    template <>
+    struct hash<sai_nat_entry_t>
+    {
+        size_t operator()(const sai_nat_entry_t& a) const noexcept
+        {
+            size_t seed = 0;
+            boost::hash_combine(seed, a.switch_id);
+            boost::hash_combine(seed, a.vr_id);
+            boost::hash_combine(seed, a.nat_type);
+            boost::hash_combine(seed, a.data.key.src_ip);
+            boost::hash_combine(seed, a.data.key.dst_ip);
+            boost::hash_combine(seed, a.data.key.proto);
+            boost::hash_combine(seed, a.data.key.l4_src_port);
+            boost::hash_combine(seed, a.data.key.l4_dst_port);
+            return seed;
+        }
+    };
+
     template <>
     struct hash<sai_inseg_entry_t>
     {
@@ -368,6 +404,30 @@ struct SaiBulkerTraits<sai_neighbor_api_t>
     using bulk_set_entry_attribute_fn = sai_bulk_set_neighbor_entry_attribute_fn;
 };
 
+template<>
+struct SaiBulkerTraits<sai_nat_api_t>
+{
+    using entry_t = sai_nat_entry_t;
+    using api_t = sai_nat_api_t;
+    using create_entry_fn = sai_create_nat_entry_fn;
+    using remove_entry_fn = sai_remove_nat_entry_fn;
+    using set_entry_attribute_fn = sai_set_nat_entry_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_create_nat_entry_fn;
+    using bulk_remove_entry_fn = sai_bulk_remove_nat_entry_fn;
+    using bulk_set_entry_attribute_fn = sai_bulk_set_nat_entry_attribute_fn;
+};
+
+template<>
+struct SaiBulkerTraits<sai_acl_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_acl_api_t;
+    // ACL counters and entries share the API, the object type is chosen
+    // when constructing the ObjectBulker
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+};
+
 template<>
 struct SaiBulkerTraits<sai_dash_vnet_api_t>
 {
@@ -854,6 +914,15 @@ inline EntityBulker<sai_neighbor_api_t>::EntityBulker(sai_neighbor_api_t *api, s
     set_entries_attribute = api->set_neighbor_entries_attribute;
 }
 
+template <>
+inline EntityBulker<sai_nat_api_t>::EntityBulker(sai_nat_api_t *api, size_t max_bulk_size) :
+    max_bulk_size(max_bulk_size)
+{
+    create_entries = api->create_nat_entries;
+    remove_entries = api->remove_nat_entries;
+    set_entries_attribute = api->set_nat_entries_attribute;
+}
+
 template <>
 inline EntityBulker<sai_dash_inbound_routing_api_t>::EntityBulker(sai_dash_inbound_routing_api_t *api, size_t max_bulk_size) : max_bulk_size(max_bulk_size)
 {
@@ -886,6 +955,141 @@ inline EntityBulker<sai_dash_outbound_routing_api_t>::EntityBulker(sai_dash_outb
     set_entries_attribute = nullptr;
 }
 
+// sai_acl_api_t has no bulk create/remove for ACL counters and entries. Use
+// the generic bulk object API and fall back to the per-object calls when the
+// platform does not support it.
+extern sai_acl_api_t *sai_acl_api;
+
+template <typename BulkCreateFn, typename CreateFn>
+inline sai_status_t sai_bulk_create_acl_objects(
+        _In_ BulkCreateFn bulk_create,
+        _In_ sai_object_type_t object_type,
+        _In_ CreateFn create,
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses)
+{
+    sai_status_t status = bulk_create(switch_id, object_type, object_count, attr_count,
+                                      attr_list, mode, object_id, object_statuses);
+    if (status != SAI_STATUS_NOT_IMPLEMENTED && status != SAI_STATUS_NOT_SUPPORTED)
+    {
+        return status;
+    }
+
+    SWSS_LOG_INFO("Bulk create of %s is not supported, creating %u objects one by one",
+                  sai_serialize_object_type(object_type).c_str(), object_count);
+
+    status = SAI_STATUS_SUCCESS;
+
+    for (uint32_t i = 0; i < object_count; i++)
+    {
+        object_id[i] = SAI_NULL_OBJECT_ID;
+        if (status != SAI_STATUS_SUCCESS && mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR)
+        {
+            object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+
+        object_statuses[i] = create(&object_id[i], switch_id, attr_count[i], attr_list[i]);
+        if (object_statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            object_id[i] = SAI_NULL_OBJECT_ID;
+            status = SAI_STATUS_FAILURE;
+        }
+    }
+
+    return status;
+}
+
+template <typename BulkRemoveFn, typename RemoveFn>
+inline sai_status_t sai_bulk_remove_acl_objects(
+        _In_ BulkRemoveFn bulk_remove,
+        _In_ sai_object_type_t object_type,
+        _In_ RemoveFn remove,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+{
+    sai_status_t status = bulk_remove(object_type, object_count, object_id, mode, object_statuses);
+    if (status != SAI_STATUS_NOT_IMPLEMENTED && status != SAI_STATUS_NOT_SUPPORTED)
+    {
+        return status;
+    }
+
+    SWSS_LOG_INFO("Bulk remove of %s is not supported, removing %u objects one by one",
+                  sai_serialize_object_type(object_type).c_str(), object_count);
+
+    status = SAI_STATUS_SUCCESS;
+
+    for (uint32_t i = 0; i < object_count; i++)
+    {
+        if (status != SAI_STATUS_SUCCESS && mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR)
+        {
+            object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+
+        object_statuses[i] = remove(object_id[i]);
+        if (object_statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            status = SAI_STATUS_FAILURE;
+        }
+    }
+
+    return status;
+}
+
+inline sai_status_t sai_bulk_create_acl_counters(
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses)
+{
+    return sai_bulk_create_acl_objects(sai_bulk_object_create, SAI_OBJECT_TYPE_ACL_COUNTER, sai_acl_api->create_acl_counter,
+                                       switch_id, object_count, attr_count, attr_list, mode, object_id, object_statuses);
+}
+
+inline sai_status_t sai_bulk_remove_acl_counters(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+{
+    return sai_bulk_remove_acl_objects(sai_bulk_object_remove, SAI_OBJECT_TYPE_ACL_COUNTER, sai_acl_api->remove_acl_counter,
+                                       object_count, object_id, mode, object_statuses);
+}
+
+inline sai_status_t sai_bulk_create_acl_entries(
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses)
+{
+    return sai_bulk_create_acl_objects(sai_bulk_object_create, SAI_OBJECT_TYPE_ACL_ENTRY, sai_acl_api->create_acl_entry,
+                                       switch_id, object_count, attr_count, attr_list, mode, object_id, object_statuses);
+}
+
+inline sai_status_t sai_bulk_remove_acl_entries(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+{
+    return sai_bulk_remove_acl_objects(sai_bulk_object_remove, SAI_OBJECT_TYPE_ACL_ENTRY, sai_acl_api->remove_acl_entry,
+                                       object_count, object_id, mode, object_statuses);
+}
+
 template <typename T>
 class ObjectBulker
 {
@@ -898,10 +1102,19 @@ public:
         throw std::logic_error("Not implemented");
     }
 
+    // For APIs serving more than one object type
+    ObjectBulker(typename Ts::api_t* api, sai_object_id_t switch_id, size_t max_bulk_size, sai_object_type_t object_type) :
+        max_bulk_size(max_bulk_size)
+    {
+        throw std::logic_error("Not implemented");
+    }
+
+    // object_status, if given, receives the per-object status of the create on flush
     sai_status_t create_entry(
         _Out_ sai_object_id_t *object_id,
         _In_ uint32_t attr_count,
-        _In_ const sai_attribute_t *attr_list)
+        _In_ const sai_attribute_t *attr_list,
+        _Out_ sai_status_t *object_status = nullptr)
     {
         assert(object_id);
         if (!object_id) throw std::invalid_argument("object_id is null");
@@ -909,6 +1122,11 @@ public:
         if (!attr_list) throw std::invalid_argument("attr_list is null");
 
         creating_entries.emplace_back(std::piecewise_construct, std::forward_as_tuple(object_id), std::forward_as_tuple(attr_list, attr_list + attr_count));
+        if (object_status)
+        {
+            creating_statuses[object_id] = object_status;
+            *object_status = SAI_STATUS_NOT_EXECUTED;
+        }
 
         auto& last_attrs = std::get<1>(creating_entries.back());
         SWSS_LOG_INFO("ObjectBulker.create_entry %zu, %zu, %u\n", creating_entries.size(), last_attrs.size(), last_attrs[0].id);
@@ -1012,6 +1230,7 @@ public:
             flush_creating_entries(rs, tss, cs);
 
             creating_entries.clear();
+            creating_statuses.clear();
         }
 
         // Setting
@@ -1048,6 +1267,7 @@ public:
     {
         removing_entries.clear();
         creating_entries.clear();
+        creating_statuses.clear();
         setting_entries.clear();
     }
 
@@ -1083,11 +1303,17 @@ private:
 
     size_t max_bulk_size;
 
+    sai_bulk_op_error_mode_t error_mode = SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR;
+
     std::vector<std::pair<                                  // A vector of pair of
             sai_object_id_t *,                              // - object_id
             std::vector<sai_attribute_t>                    // - attrs
     >>                                                      creating_entries;
 
+                                                            // A map of
+                                                            // OUT object_id -> OUT object_status
+    std::unordered_map<sai_object_id_t *, sai_status_t *>   creating_statuses;
+
     std::unordered_map<                                     // A map of
             sai_object_id_t,                                // object_id -> (OUT object_status, attributes)
             std::pair<
@@ -1114,7 +1340,7 @@ private:
         }
         size_t count = rs.size();
         std::vector<sai_status_t> statuses(count);
-        sai_status_t status = (*remove_entries)((uint32_t)count, rs.data(), SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
+        sai_status_t status = (*remove_entries)((uint32_t)count, rs.data(), error_mode, statuses.data());
         if (status == SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_INFO("ObjectBulker.flush removing_entries %zu rc=%d statuses[0]=%d\n", removing_entries.size(), status, statuses[0]);
@@ -1150,7 +1376,7 @@ private:
         std::vector<sai_object_id_t> object_ids(count);
         std::vector<sai_status_t> statuses(count);
         sai_status_t status = (*create_entries)(switch_id, (uint32_t)count, cs.data(), tss.data()
-            , SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, object_ids.data(), statuses.data());
+            , error_mode, object_ids.data(), statuses.data());
         if (status == SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_INFO("ObjectBulker.flush creating_entries %zu\n", count);
@@ -1165,6 +1391,12 @@ private:
         {
             sai_object_id_t *pid = rs[i];
             *pid = (statuses[i] == SAI_STATUS_SUCCESS) ? object_ids[i] : SAI_NULL_OBJECT_ID;
+
+            auto found_status = creating_statuses.find(pid);
+            if (found_status != creating_statuses.end())
+            {
+                *found_status->second = statuses[i];
+            }
         }
 
         rs.clear();
@@ -1225,3 +1457,26 @@ inline ObjectBulker<sai_dash_vnet_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_
     create_entries = api->create_vnets;
     remove_entries = api->remove_vnets;
 }
+
+template <>
+inline ObjectBulker<sai_acl_api_t>::ObjectBulker(SaiBulkerTraits<sai_acl_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size, sai_object_type_t object_type) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    // Every ACL object is independent, so one failure must not hold back the rest of the batch
+    error_mode = SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR;
+
+    switch (object_type)
+    {
+        case SAI_OBJECT_TYPE_ACL_COUNTER:
+            create_entries = sai_bulk_create_acl_counters;
+            remove_entries = sai_bulk_remove_acl_counters;
+            break;
+        case SAI_OBJECT_TYPE_ACL_ENTRY:
+            create_entries = sai_bulk_create_acl_entries;
+            remove_entries = sai_bulk_remove_acl_entries;
+            break;
+        default:
+            throw std::logic_error("Not implemented");
+    }
+}
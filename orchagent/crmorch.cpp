@@ -1,4 +1,5 @@
 #include <sstream>
+#include <array>
 #include <inttypes.h>
 
 #include "crmorch.h"
@@ -15,6 +16,13 @@
 #define CRM_THRESHOLD_HIGH_DEFAULT 85
 #define CRM_EXCEEDED_MSG_MAX 10
 #define CRM_ACL_RESOURCE_COUNT 256
+// Per ACL table, extension table and DASH ACL group resources are only queried
+// again when their "used" counter changed, except on every Nth poll to catch
+// availability changes caused by other users of a shared hardware table
+#define CRM_FULL_POLL_MULTIPLE 6
+
+#define CRM_POLL_DURATION "poll_duration_usec"
+#define CRM_POLL_SAI_QUERIES "poll_sai_queries"
 
 extern sai_object_id_t gSwitchId;
 extern sai_switch_api_t *sai_switch_api;
@@ -370,7 +378,8 @@ const map<string, CrmResourceType> crmUsedCntsTableMap =
 CrmOrch::CrmOrch(DBConnector *db, string tableName):
     Orch(db, tableName),
     m_countersDb(new DBConnector("COUNTERS_DB", 0)),
-    m_countersCrmTable(new Table(m_countersDb.get(), COUNTERS_CRM_TABLE)),
+    m_countersPipeline(new RedisPipeline(m_countersDb.get())),
+    m_countersCrmTable(new Table(m_countersPipeline.get(), COUNTERS_CRM_TABLE, true)),
     m_timer(new SelectableTimer(timespec { .tv_sec = CRM_POLLING_INTERVAL_DEFAULT, .tv_nsec = 0 }))
 {
     SWSS_LOG_ENTER();
@@ -384,6 +393,7 @@ CrmOrch::CrmOrch(DBConnector *db, string tableName):
 
     // The CRM stats needs to be populated again
     m_countersCrmTable->del(CRM_COUNTERS_TABLE_KEY);
+    m_countersCrmTable->flush();
 
     // Note: ExecutableTimer will hold m_timer pointer and release the object later
     auto executor = new ExecutableTimer(m_timer, this, "CRM_COUNTERS_POLL");
@@ -584,8 +594,10 @@ void CrmOrch::decCrmAclUsedCounter(CrmResourceType resource, sai_acl_stage_t sta
                 }
             }
 
-            // remove ACL_TABLE_STATS in crm database
+            // remove ACL_TABLE_STATS in crm database, right away rather than
+            // with the writes of the next poll
             m_countersCrmTable->del(getCrmAclTableKey(oid));
+            m_countersCrmTable->flush();
         }
     }
     catch (...)
@@ -700,12 +712,14 @@ void CrmOrch::decCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
             decCrmResUsedCounter(resource);
             m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV4_ACL_RULE).countersMap.erase(getCrmDashAclGroupKey(tableId));
             m_countersCrmTable->del(getCrmDashAclGroupKey(tableId));
+            m_countersCrmTable->flush();
         }
         else if (resource == CrmResourceType::CRM_DASH_IPV6_ACL_GROUP)
         {
             decCrmResUsedCounter(resource);
             m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV6_ACL_RULE).countersMap.erase(getCrmDashAclGroupKey(tableId));
             m_countersCrmTable->del(getCrmDashAclGroupKey(tableId));
+            m_countersCrmTable->flush();
         }
         else 
         {
@@ -724,11 +738,34 @@ void CrmOrch::doTask(SelectableTimer &timer)
 {
     SWSS_LOG_ENTER();
 
+    auto start = chrono::steady_clock::now();
+
+    m_fullPoll = (m_pollCount++ % CRM_FULL_POLL_MULTIPLE) == 0;
+    m_pollSaiQueries = 0;
+
     getResAvailableCounters();
-    updateCrmCountersTable();
+
+    auto duration = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
+    SWSS_LOG_INFO("CRM %s poll took %" PRId64 " usec, %u SAI queries", m_fullPoll ? "full" : "incremental",
+                  static_cast<int64_t>(duration.count()), m_pollSaiQueries);
+
+    // The counters are flushed to COUNTERS_DB before the thresholds are checked,
+    // so an exceeded threshold event never reports counters not yet published
+    updateCrmCountersTable(duration);
     checkCrmThresholds();
 }
 
+bool CrmOrch::needsPoll(const CrmResourceCounter &cnt) const
+{
+    return m_fullPoll || !cnt.polled || (cnt.usedCounter != cnt.polledUsedCounter);
+}
+
+void CrmOrch::markPolled(CrmResourceCounter &cnt)
+{
+    cnt.polled = true;
+    cnt.polledUsedCounter = cnt.usedCounter;
+}
+
 bool CrmOrch::getResAvailability(CrmResourceType type, CrmResourceEntry &res)
 {
     sai_attribute_t attr;
@@ -770,6 +807,7 @@ bool CrmOrch::getResAvailability(CrmResourceType type, CrmResourceEntry &res)
                 break;
         }
 
+        m_pollSaiQueries++;
         status = sai_object_type_get_availability(gSwitchId, objType, attrCount, &attr, &availCount);
     }
 
@@ -778,6 +816,7 @@ bool CrmOrch::getResAvailability(CrmResourceType type, CrmResourceEntry &res)
         if (crmResSaiAvailAttrMap.find(type) != crmResSaiAvailAttrMap.end())
         {
             attr.id = crmResSaiAvailAttrMap.at(type);
+            m_pollSaiQueries++;
             status = sai_switch_api->get_switch_attribute(gSwitchId, 1, &attr);
         }
 
@@ -812,11 +851,17 @@ bool CrmOrch::getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEn
 
     for (auto &cnt : res.countersMap)
     { 
+        if (!needsPoll(cnt.second))
+        {
+            continue;
+        }
+
         sai_attribute_t attr;
         attr.id = SAI_DASH_ACL_RULE_ATTR_DASH_ACL_GROUP_ID;
         attr.value.oid = cnt.second.id;
 
         uint64_t availCount = 0;
+        m_pollSaiQueries++;
         sai_status_t status = sai_object_type_get_availability(gSwitchId, objType, 1, &attr, &availCount);
         if ((status == SAI_STATUS_NOT_SUPPORTED) ||
             (status == SAI_STATUS_NOT_IMPLEMENTED) ||
@@ -836,15 +881,117 @@ bool CrmOrch::getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEn
         }
 
         cnt.second.availableCounter = static_cast<uint32_t>(availCount);
+        markPolled(cnt.second);
     }
 
     return true;
 }
 
+void CrmOrch::getAclTableResAvailability()
+{
+    SWSS_LOG_ENTER();
+
+    const array<CrmResourceType, 2> types = {{ CrmResourceType::CRM_ACL_ENTRY, CrmResourceType::CRM_ACL_COUNTER }};
+
+    // ACL table key -> ACL entry and ACL counter resource counters to query
+    map<string, array<CrmResourceCounter *, 2>> tables;
+
+    for (size_t i = 0; i < types.size(); i++)
+    {
+        auto &res = m_resourcesMap.at(types[i]);
+        if (res.resStatus != CrmResourceStatus::CRM_RES_SUPPORTED)
+        {
+            continue;
+        }
+
+        for (auto &cnt : res.countersMap)
+        {
+            if (needsPoll(cnt.second))
+            {
+                tables[cnt.first][i] = &cnt.second;
+            }
+        }
+    }
+
+    for (auto &table : tables)
+    {
+        vector<sai_attribute_t> attrs;
+        vector<size_t> typeIdx;
+
+        for (size_t i = 0; i < types.size(); i++)
+        {
+            if ((table.second[i] == nullptr) ||
+                (m_resourcesMap.at(types[i]).resStatus != CrmResourceStatus::CRM_RES_SUPPORTED))
+            {
+                continue;
+            }
+
+            sai_attribute_t attr;
+            attr.id = crmResSaiAvailAttrMap.at(types[i]);
+            attrs.push_back(attr);
+            typeIdx.push_back(i);
+        }
+
+        // Query both resources of the table at once, failures are sorted out
+        // below by querying them one at a time
+        if (attrs.size() > 1)
+        {
+            m_pollSaiQueries++;
+            sai_status_t status = sai_acl_api->get_acl_table_attribute(table.second[typeIdx[0]]->id,
+                                                                       static_cast<uint32_t>(attrs.size()), attrs.data());
+            if (status == SAI_STATUS_SUCCESS)
+            {
+                for (size_t j = 0; j < attrs.size(); j++)
+                {
+                    auto &cnt = *table.second[typeIdx[j]];
+                    cnt.availableCounter = attrs[j].value.u32;
+                    markPolled(cnt);
+                }
+                continue;
+            }
+        }
+
+        for (size_t j = 0; j < attrs.size(); j++)
+        {
+            auto type = types[typeIdx[j]];
+            auto &res = m_resourcesMap.at(type);
+            auto &cnt = *table.second[typeIdx[j]];
+
+            if (res.resStatus != CrmResourceStatus::CRM_RES_SUPPORTED)
+            {
+                continue;
+            }
+
+            m_pollSaiQueries++;
+            sai_status_t status = sai_acl_api->get_acl_table_attribute(cnt.id, 1, &attrs[j]);
+            if ((status == SAI_STATUS_NOT_SUPPORTED) ||
+                (status == SAI_STATUS_NOT_IMPLEMENTED) ||
+                SAI_STATUS_IS_ATTR_NOT_SUPPORTED(status) ||
+                SAI_STATUS_IS_ATTR_NOT_IMPLEMENTED(status))
+            {
+                // mark unsupported resources
+                res.resStatus = CrmResourceStatus::CRM_RES_NOT_SUPPORTED;
+                SWSS_LOG_NOTICE("CRM resource %s not supported", crmResTypeNameMap.at(type).c_str());
+                continue;
+            }
+            if (status != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("Failed to get ACL table attribute %u , rv:%d", attrs[j].id, status);
+                continue;
+            }
+
+            cnt.availableCounter = attrs[j].value.u32;
+            markPolled(cnt);
+        }
+    }
+}
+
 void CrmOrch::getResAvailableCounters()
 {
     SWSS_LOG_ENTER();
 
+    bool aclTablesPolled = false;
+
     for (auto &res : m_resourcesMap)
     {
         // ignore unsupported resources
@@ -901,6 +1048,7 @@ void CrmOrch::getResAvailableCounters()
 
                 attr.value.aclresource.count = CRM_ACL_RESOURCE_COUNT;
                 attr.value.aclresource.list = resources.data();
+                m_pollSaiQueries++;
                 sai_status_t status = sai_switch_api->get_switch_attribute(gSwitchId, 1, &attr);
                 if ((status == SAI_STATUS_NOT_SUPPORTED) ||
                     (status == SAI_STATUS_NOT_IMPLEMENTED) ||
@@ -917,6 +1065,7 @@ void CrmOrch::getResAvailableCounters()
                 {
                     resources.resize(attr.value.aclresource.count);
                     attr.value.aclresource.list = resources.data();
+                    m_pollSaiQueries++;
                     status = sai_switch_api->get_switch_attribute(gSwitchId, 1, &attr);
                 }
 
@@ -942,31 +1091,12 @@ void CrmOrch::getResAvailableCounters()
             case CrmResourceType::CRM_ACL_ENTRY:
             case CrmResourceType::CRM_ACL_COUNTER:
             {
-                sai_attribute_t attr;
-                attr.id = crmResSaiAvailAttrMap.at(res.first);
-
-                for (auto &cnt : res.second.countersMap)
+                // Both are per ACL table attributes, polled together
+                if (!aclTablesPolled)
                 {
-                    sai_status_t status = sai_acl_api->get_acl_table_attribute(cnt.second.id, 1, &attr);
-                    if ((status == SAI_STATUS_NOT_SUPPORTED) ||
-                        (status == SAI_STATUS_NOT_IMPLEMENTED) ||
-                        SAI_STATUS_IS_ATTR_NOT_SUPPORTED(status) ||
-                        SAI_STATUS_IS_ATTR_NOT_IMPLEMENTED(status))
-                    {
-                        // mark unsupported resources
-                        res.second.resStatus = CrmResourceStatus::CRM_RES_NOT_SUPPORTED;
-                        SWSS_LOG_NOTICE("CRM resource %s not supported", crmResTypeNameMap.at(res.first).c_str());
-                        break;
-                    }
-                    if (status != SAI_STATUS_SUCCESS)
-                    {
-                        SWSS_LOG_ERROR("Failed to get ACL table attribute %u , rv:%d", attr.id, status);
-                        break;
-                    }
-
-                    cnt.second.availableCounter = attr.value.u32;
+                    getAclTableResAvailability();
+                    aclTablesPolled = true;
                 }
-
                 break;
             }
 
@@ -974,6 +1104,11 @@ void CrmOrch::getResAvailableCounters()
             {
                 for (auto &cnt : res.second.countersMap)
                 {
+                    if (!needsPoll(cnt.second))
+                    {
+                        continue;
+                    }
+
                     std::string table_name = cnt.first;
                     sai_object_type_t objType = crmResSaiObjAttrMap.at(res.first);
                     sai_attribute_t attr;
@@ -983,6 +1118,7 @@ void CrmOrch::getResAvailableCounters()
                     attr.value.s8list.count = (uint32_t)table_name.size();
                     attr.value.s8list.list = (int8_t *)const_cast<char *>(table_name.c_str());
 
+                    m_pollSaiQueries++;
                     sai_status_t status = sai_object_type_get_availability(
                                             gSwitchId, objType, 1, &attr, &availCount);
                     if (status != SAI_STATUS_SUCCESS)
@@ -993,6 +1129,7 @@ void CrmOrch::getResAvailableCounters()
                     }
 
                     cnt.second.availableCounter = static_cast<uint32_t>(availCount);
+                    markPolled(cnt.second);
                 }
                 break;
             }
@@ -1011,10 +1148,13 @@ void CrmOrch::getResAvailableCounters()
     }
 }
 
-void CrmOrch::updateCrmCountersTable()
+void CrmOrch::updateCrmCountersTable(chrono::microseconds pollDuration)
 {
     SWSS_LOG_ENTER();
 
+    // Collect all fields of a key and write them with a single pipelined flush
+    map<string, vector<FieldValueTuple>> fvsMap;
+
     // Update CRM used counters in COUNTERS_DB
     for (const auto &i : crmUsedCntsTableMap)
     {
@@ -1028,9 +1168,7 @@ void CrmOrch::updateCrmCountersTable()
 
             for (const auto &cnt : res.countersMap)
             {
-                FieldValueTuple attr(i.first, to_string(cnt.second.usedCounter));
-                vector<FieldValueTuple> attrs = { attr };
-                m_countersCrmTable->set(cnt.first, attrs);
+                fvsMap[cnt.first].emplace_back(i.first, to_string(cnt.second.usedCounter));
             }
         }
         catch(const out_of_range &e)
@@ -1052,9 +1190,7 @@ void CrmOrch::updateCrmCountersTable()
 
             for (const auto &cnt : res.countersMap)
             {
-                FieldValueTuple attr(i.first, to_string(cnt.second.availableCounter));
-                vector<FieldValueTuple> attrs = { attr };
-                m_countersCrmTable->set(cnt.first, attrs);
+                fvsMap[cnt.first].emplace_back(i.first, to_string(cnt.second.availableCounter));
             }
         }
         catch(const out_of_range &e)
@@ -1062,6 +1198,15 @@ void CrmOrch::updateCrmCountersTable()
             // expected when a resource is unavailable
         }
     }
+
+    fvsMap[CRM_COUNTERS_TABLE_KEY].emplace_back(CRM_POLL_DURATION, to_string(pollDuration.count()));
+    fvsMap[CRM_COUNTERS_TABLE_KEY].emplace_back(CRM_POLL_SAI_QUERIES, to_string(m_pollSaiQueries));
+
+    for (const auto &fvs : fvsMap)
+    {
+        m_countersCrmTable->set(fvs.first, fvs.second);
+    }
+    m_countersCrmTable->flush();
 }
 
 void CrmOrch::checkCrmThresholds()
@@ -91,6 +91,7 @@ public:
 
 private:
     std::shared_ptr<swss::DBConnector> m_countersDb = nullptr;
+    std::shared_ptr<swss::RedisPipeline> m_countersPipeline = nullptr;
     std::shared_ptr<swss::Table> m_countersCrmTable = nullptr;
     swss::SelectableTimer *m_timer = nullptr;
 
@@ -100,6 +101,9 @@ private:
         uint32_t availableCounter = 0;
         uint32_t usedCounter = 0;
         uint32_t exceededLogCounter = 0;
+        // "used" counter at the time "available" was last queried
+        uint32_t polledUsedCounter = 0;
+        bool polled = false;
     };
 
     struct CrmResourceEntry
@@ -121,13 +125,21 @@ private:
 
     std::map<CrmResourceType, CrmResourceEntry> m_resourcesMap;
 
+    // Poll statistics, published along with the counters
+    uint32_t m_pollCount = 0;
+    bool m_fullPoll = true;
+    uint32_t m_pollSaiQueries = 0;
+
     void doTask(Consumer &consumer);
     void handleSetCommand(const std::string& key, const std::vector<swss::FieldValueTuple>& data);
     void doTask(swss::SelectableTimer &timer);
     bool getResAvailability(CrmResourceType type, CrmResourceEntry &res);
     bool getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEntry &res);
+    bool needsPoll(const CrmResourceCounter &cnt) const;
+    void markPolled(CrmResourceCounter &cnt);
+    void getAclTableResAvailability();
     void getResAvailableCounters();
-    void updateCrmCountersTable();
+    void updateCrmCountersTable(std::chrono::microseconds pollDuration);
     void checkCrmThresholds();
     std::string getCrmAclKey(sai_acl_stage_t stage, sai_acl_bind_point_type_t bindPoint);
     std::string getCrmAclTableKey(sai_object_id_t id);
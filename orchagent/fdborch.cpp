@@ -73,10 +73,10 @@ bool FdbOrch::storeFdbEntryState(const FdbUpdate& update)
     const Port& port = update.port;
     const MacAddress& mac = entry.mac;
     string portName = port.m_alias;
-    Port vlan;
 
     oldFdbData.origin = FDB_ORIGIN_INVALID;
-    if (!m_portsOrch->getPort(entry.bv_id, vlan))
+    auto vlan = m_portsOrch->getPortPtr(entry.bv_id);
+    if (vlan == nullptr)
     {
         SWSS_LOG_NOTICE("FdbOrch notification: Failed to locate \
                          vlan port from bv_id 0x%" PRIx64, entry.bv_id);
@@ -84,7 +84,7 @@ bool FdbOrch::storeFdbEntryState(const FdbUpdate& update)
     }
 
     // ref: https://github.com/Azure/sonic-swss/blob/master/doc/swss-schema.md#fdb_table
-    string key = "Vlan" + to_string(vlan.m_vlan_info.vlan_id) + ":" + mac.to_string();
+    string key = "Vlan" + to_string(vlan->m_vlan_info.vlan_id) + ":" + mac.to_string();
 
     if (update.add)
     {
@@ -185,10 +185,10 @@ void FdbOrch::clearFdbEntry(const FdbEntry& entry)
     update.add = false;
 
     /* Fetch Vlan and decrement the counter */
-    Port temp_vlan;
-    if (m_portsOrch->getPort(entry.bv_id, temp_vlan))
+    auto temp_vlan = m_portsOrch->getPortPtr(entry.bv_id);
+    if (temp_vlan != nullptr)
     {
-        m_portsOrch->decrFdbCount(temp_vlan.m_alias, 1);
+        m_portsOrch->decrFdbCount(temp_vlan->m_alias, 1);
     }
 
     /* Decrement port fdb_counter */
@@ -286,7 +286,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
     update.entry.mac = entry->mac_address;
     update.entry.bv_id = entry->bv_id;
     update.type = "dynamic";
-    Port vlan;
+    const Port *vlanPtr = nullptr;
 
     SWSS_LOG_INFO("FDB event:%d, MAC: %s , BVID: 0x%" PRIx64 " , \
                    bridge port ID: 0x%" PRIx64 ".",
@@ -313,11 +313,13 @@ void FdbOrch::update(sai_fdb_event_t        type,
     }
 
     if (entry->bv_id &&
-        !m_portsOrch->getPort(entry->bv_id, vlan))
+        (vlanPtr = m_portsOrch->getPortPtr(entry->bv_id)) == nullptr)
     {
         SWSS_LOG_NOTICE("FdbOrch notification type %d: Failed to locate vlan port from bv_id 0x%" PRIx64, type, entry->bv_id);
         return;
     }
+    static const Port noVlan;
+    const Port &vlan = vlanPtr ? *vlanPtr : noVlan;
 
     switch (type)
     {
@@ -334,20 +336,18 @@ void FdbOrch::update(sai_fdb_event_t        type,
                 // If the bp is different MOVE the MAC entry.
                 if (existing_entry->second.bridge_port_id != bridge_port_id)
                 {
-                    Port port;
                     SWSS_LOG_NOTICE("FdbOrch LEARN notification: mac %s is already in bv_id 0x%" PRIx64 "with different existing-bp 0x%" PRIx64 " new-bp:0x%" PRIx64,
                             update.entry.mac.to_string().c_str(), entry->bv_id, existing_entry->second.bridge_port_id, bridge_port_id);
-                    if (!m_portsOrch->getPortByBridgePortId(existing_entry->second.bridge_port_id, port))
+                    auto port = m_portsOrch->getPortPtrByBridgePortId(existing_entry->second.bridge_port_id);
+                    if (port == nullptr)
                     {
                         SWSS_LOG_NOTICE("FdbOrch LEARN notification: Failed to get port by bridge port ID 0x%" PRIx64, existing_entry->second.bridge_port_id);
                         return;
                     }
                     else
                     {
-                        port.m_fdb_count--;
-                        m_portsOrch->setPort(port.m_alias, port);
-                        vlan.m_fdb_count--;
-                        m_portsOrch->setPort(vlan.m_alias, vlan);
+                        m_portsOrch->decrFdbCount(port->m_alias, 1);
+                        m_portsOrch->decrFdbCount(vlan.m_alias, 1);
                     }
                     // Continue to add (update/move) the MAC
                 }
@@ -408,8 +408,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
         update.type = "dynamic";
         update.port.m_fdb_count++;
         m_portsOrch->setPort(update.port.m_alias, update.port);
-        vlan.m_fdb_count++;
-        m_portsOrch->setPort(vlan.m_alias, vlan);
+        m_portsOrch->incrFdbCount(vlan.m_alias, 1);
 
         storeFdbEntryState(update);
         notify(SUBJECT_TYPE_FDB_CHANGE, &update);
@@ -536,8 +535,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
         }
         if (!vlan.m_alias.empty())
         {
-            vlan.m_fdb_count--;
-            m_portsOrch->setPort(vlan.m_alias, vlan);
+            m_portsOrch->decrFdbCount(vlan.m_alias, 1);
         }
         storeFdbEntryState(update);
 
@@ -1235,7 +1233,6 @@ void FdbOrch::updateVlanMember(const VlanMemberUpdate& update)
 bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
         FdbData fdbData)
 {
-    Port vlan;
     Port port;
     string end_point_ip = "";
 
@@ -1246,11 +1243,13 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
             entry.mac.to_string().c_str(), entry.bv_id, port_name.c_str(),
             fdbData.type.c_str(), fdbData.origin, fdbData.remote_ip.c_str());
 
-    if (!m_portsOrch->getPort(entry.bv_id, vlan))
+    auto vlanPtr = m_portsOrch->getPortPtr(entry.bv_id);
+    if (vlanPtr == nullptr)
     {
         SWSS_LOG_NOTICE("addFdbEntry: Failed to locate vlan port from bv_id 0x%" PRIx64, entry.bv_id);
         return false;
     }
+    const Port &vlan = *vlanPtr;
 
     /* Retry until port is created */
     if (!m_portsOrch->getPort(port_name, port) || (port.m_bridge_port_id == SAI_NULL_OBJECT_ID))
@@ -1498,8 +1497,7 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
         }
         port.m_fdb_count++;
         m_portsOrch->setPort(port.m_alias, port);
-        vlan.m_fdb_count++;
-        m_portsOrch->setPort(vlan.m_alias, vlan);
+        m_portsOrch->incrFdbCount(vlan.m_alias, 1);
     }
 
     FdbData storeFdbData = fdbData;
@@ -1586,18 +1584,19 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
 
 bool FdbOrch::removeFdbEntry(const FdbEntry& entry, FdbOrigin origin)
 {
-    Port vlan;
     Port port;
 
     SWSS_LOG_ENTER();
 
     SWSS_LOG_INFO("FdbOrch RemoveFDBEntry: mac=%s bv_id=0x%" PRIx64 "origin %d", entry.mac.to_string().c_str(), entry.bv_id, origin);
 
-    if (!m_portsOrch->getPort(entry.bv_id, vlan))
+    auto vlanPtr = m_portsOrch->getPortPtr(entry.bv_id);
+    if (vlanPtr == nullptr)
     {
         SWSS_LOG_NOTICE("FdbOrch notification: Failed to locate vlan port from bv_id 0x%" PRIx64, entry.bv_id);
         return false;
     }
+    const Port &vlan = *vlanPtr;
 
     auto it= m_entries.find(entry);
     if (it == m_entries.end())
@@ -1671,8 +1670,7 @@ bool FdbOrch::removeFdbEntry(const FdbEntry& entry, FdbOrigin origin)
 
     port.m_fdb_count--;
     m_portsOrch->setPort(port.m_alias, port);
-    vlan.m_fdb_count--;
-    m_portsOrch->setPort(vlan.m_alias, vlan);
+    m_portsOrch->decrFdbCount(vlan.m_alias, 1);
     (void)m_entries.erase(entry);
 
     // Remove in StateDb
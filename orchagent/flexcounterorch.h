@@ -53,6 +53,8 @@ public:
     bool getHostIfTrapCounterState() const {return m_hostif_trap_counter_enabled;}
     bool getRouteFlowCountersState() const {return m_route_flow_counter_enabled;}
     bool bake() override;
+    // bake() reads the flex counter table itself
+    bool isWarmBakeRefilled(const std::string &tableName) const override { return false; }
 
 private:
     bool m_port_counter_enabled = false;
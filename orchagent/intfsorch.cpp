@@ -108,11 +108,16 @@ IntfsOrch::IntfsOrch(DBConnector *db, string tableName, VRFOrch *vrf_orch, DBCon
 
 }
 
+/* Router interfaces are created on ports, LAGs and VLANs */
+vector<string> IntfsOrch::getWarmStartDependencies() const
+{
+    return { APP_PORT_TABLE_NAME, APP_LAG_TABLE_NAME, APP_VLAN_TABLE_NAME };
+}
+
 sai_object_id_t IntfsOrch::getRouterIntfsId(const string &alias)
 {
-    Port port;
-    gPortsOrch->getPort(alias, port);
-    return port.m_rif_id;
+    const Port *port = gPortsOrch->getPortPtr(alias);
+    return port ? port->m_rif_id : SAI_NULL_OBJECT_ID;
 }
 
 bool IntfsOrch::isPrefixSubnet(const IpPrefix &ip_prefix, const string &alias)
@@ -398,14 +403,14 @@ bool IntfsOrch::setIntfProxyArp(const string &alias, const string &proxy_arp)
         return true;
     }
 
-    Port port;
-    if (!gPortsOrch->getPort(alias, port))
+    const Port *port = gPortsOrch->getPortPtr(alias);
+    if (!port)
     {
         SWSS_LOG_ERROR("Failed to get port info for the interface \"%s\"", alias.c_str());
         return false;
     }
 
-    if (port.m_type == Port::VLAN)
+    if (port->m_type == Port::VLAN)
     {
         sai_vlan_flood_control_type_t vlan_flood_type;
         if (proxy_arp == "enabled")
@@ -417,7 +422,7 @@ bool IntfsOrch::setIntfProxyArp(const string &alias, const string &proxy_arp)
             vlan_flood_type = SAI_VLAN_FLOOD_CONTROL_TYPE_ALL;
         }
 
-        if (!setIntfVlanFloodType(port, vlan_flood_type))
+        if (!setIntfVlanFloodType(*port, vlan_flood_type))
         {
             return false;
         }
@@ -486,6 +491,7 @@ bool IntfsOrch::setIntf(const string& alias, sai_object_id_t vrf_id, const IpPre
         return false;
     }
 
+    /* A copy, addRouterIntfs() and the sub interface updates below modify it */
     Port port;
     gPortsOrch->getPort(alias, port);
 
@@ -604,15 +610,15 @@ bool IntfsOrch::removeIntf(const string& alias, sai_object_id_t vrf_id, const Ip
 {
     SWSS_LOG_ENTER();
 
-    Port port;
-    if (!gPortsOrch->getPort(alias, port))
+    const Port *port = gPortsOrch->getPortPtr(alias);
+    if (!port)
     {
         return false;
     }
 
     if (ip_prefix && m_syncdIntfses[alias].ip_addresses.count(*ip_prefix))
     {
-        removeIp2MeRoute(port.m_vr_id, *ip_prefix);
+        removeIp2MeRoute(port->m_vr_id, *ip_prefix);
 
         if(gMySwitchType == "voq")
         {
@@ -622,9 +628,9 @@ bool IntfsOrch::removeIntf(const string& alias, sai_object_id_t vrf_id, const Ip
             }
         }
 
-        if(port.m_type == Port::VLAN)
+        if(port->m_type == Port::VLAN)
         {
-            removeDirectedBroadcast(port, *ip_prefix);
+            removeDirectedBroadcast(*port, *ip_prefix);
         }
 
         m_syncdIntfses[alias].ip_addresses.erase(*ip_prefix);
@@ -632,13 +638,15 @@ bool IntfsOrch::removeIntf(const string& alias, sai_object_id_t vrf_id, const Ip
 
     if (!ip_prefix)
     {
-        if (m_syncdIntfses[alias].ip_addresses.size() == 0 && removeRouterIntfs(port))
+        /* A copy, removeRouterIntfs() modifies it and removeSubPort() erases the port */
+        Port rifPort = *port;
+        if (m_syncdIntfses[alias].ip_addresses.size() == 0 && removeRouterIntfs(rifPort))
         {
             gPortsOrch->decreasePortRefCount(alias);
             m_syncdIntfses.erase(alias);
             m_vrfOrch->decreaseVrfRefCount(vrf_id);
 
-            if (port.m_type == Port::SUBPORT)
+            if (rifPort.m_type == Port::SUBPORT)
             {
                 if (!gPortsOrch->removeSubPort(alias))
                 {
@@ -887,21 +895,23 @@ void IntfsOrch::doTask(Consumer &consumer)
                 }
             }
 
-            Port port;
-            if (!gPortsOrch->getPort(alias, port))
+            const Port *port = gPortsOrch->getPortPtr(alias);
+            if (!port)
             {
                 if (!ip_prefix_in_key && isSubIntf)
                 {
+                    Port subPort;
                     if (!adminStateChanged)
                     {
-                        adminUp = port.m_admin_state_up;
+                        adminUp = subPort.m_admin_state_up;
                     }
 
-                    if (!gPortsOrch->addSubPort(port, alias, vlan, adminUp, mtu))
+                    if (!gPortsOrch->addSubPort(subPort, alias, vlan, adminUp, mtu))
                     {
                         it++;
                         continue;
                     }
+                    port = gPortsOrch->getPortPtr(alias);
                 }
                 else
                 {
@@ -927,7 +937,7 @@ void IntfsOrch::doTask(Consumer &consumer)
 
                 if (!adminStateChanged)
                 {
-                    adminUp = port.m_admin_state_up;
+                    adminUp = port->m_admin_state_up;
                 }
 
                 if (!vnet_orch->setIntf(alias, vnet_name, ip_prefix_in_key ? &ip_prefix : nullptr, adminUp, mtu))
@@ -945,7 +955,7 @@ void IntfsOrch::doTask(Consumer &consumer)
             {
                 if (!adminStateChanged)
                 {
-                    adminUp = port.m_admin_state_up;
+                    adminUp = port->m_admin_state_up;
                 }
 
                 if (!setIntf(alias, vrf_id, ip_prefix_in_key ? &ip_prefix : nullptr, adminUp, mtu, loopbackAction))
@@ -954,37 +964,40 @@ void IntfsOrch::doTask(Consumer &consumer)
                     continue;
                 }
 
-                if (gPortsOrch->getPort(alias, port))
+                port = gPortsOrch->getPortPtr(alias);
+                if (port)
                 {
                     /* Set nat zone id */
-                    if ((!nat_zone.empty()) and (port.m_nat_zone_id != nat_zone_id))
+                    if ((!nat_zone.empty()) and (port->m_nat_zone_id != nat_zone_id))
                     {
-                        port.m_nat_zone_id = nat_zone_id;
+                        Port natPort = *port;
+                        natPort.m_nat_zone_id = nat_zone_id;
 
                         if (gIsNatSupported)
                         {
-                            setRouterIntfsNatZoneId(port);
+                            setRouterIntfsNatZoneId(natPort);
                         }
                         else
                         {
                             SWSS_LOG_NOTICE("Not set router interface %s NAT Zone Id to %u, as NAT is not supported",
-                                            port.m_alias.c_str(), port.m_nat_zone_id);
+                                            natPort.m_alias.c_str(), natPort.m_nat_zone_id);
                         }
-                        gPortsOrch->setPort(alias, port);
+                        gPortsOrch->setPort(alias, natPort);
                     }
                     /* Set MPLS */
-                    if ((!ip_prefix_in_key) && (port.m_mpls != mpls))
+                    if ((!ip_prefix_in_key) && (port->m_mpls != mpls))
                     {
-                        port.m_mpls = mpls;
+                        Port mplsPort = *port;
+                        mplsPort.m_mpls = mpls;
 
-                        setRouterIntfsMpls(port);
-                        gPortsOrch->setPort(alias, port);
+                        setRouterIntfsMpls(mplsPort);
+                        gPortsOrch->setPort(alias, mplsPort);
                     }
 
                     /* Set loopback action */
                     if (!loopbackAction.empty())
                     {
-                        setIntfLoopbackAction(port, loopbackAction);
+                        setIntfLoopbackAction(*port, loopbackAction);
                     }
                 }
             }
@@ -997,13 +1010,14 @@ void IntfsOrch::doTask(Consumer &consumer)
                 memcpy(attr.value.mac, mac.getMac(), sizeof(sai_mac_t));
 
                 /*port.m_rif_id is set in setIntf(), need get port again*/
-                if (gPortsOrch->getPort(alias, port))
+                port = gPortsOrch->getPortPtr(alias);
+                if (port)
                 {
-                    sai_status_t status = sai_router_intfs_api->set_router_interface_attribute(port.m_rif_id, &attr);
+                    sai_status_t status = sai_router_intfs_api->set_router_interface_attribute(port->m_rif_id, &attr);
                     if (status != SAI_STATUS_SUCCESS)
                     {
                         SWSS_LOG_ERROR("Failed to set router interface mac %s for port %s, rv:%d",
-                                                     mac.to_string().c_str(), port.m_alias.c_str(), status);
+                                                     mac.to_string().c_str(), port->m_alias.c_str(), status);
                         if (handleSaiSetStatus(SAI_API_ROUTER_INTERFACE, status) == task_need_retry)
                         {
                             it++;
@@ -1013,7 +1027,7 @@ void IntfsOrch::doTask(Consumer &consumer)
                     else
                     {
                         SWSS_LOG_NOTICE("Set router interface mac %s for port %s success",
-                                                      mac.to_string().c_str(), port.m_alias.c_str());
+                                                      mac.to_string().c_str(), port->m_alias.c_str());
                     }
                 }
                 else
@@ -1066,9 +1080,9 @@ void IntfsOrch::doTask(Consumer &consumer)
                 continue;
             }
 
-            Port port;
+            const Port *port = gPortsOrch->getPortPtr(alias);
             /* Cannot locate interface */
-            if (!gPortsOrch->getPort(alias, port))
+            if (!port)
             {
                 it = consumer.m_toSync.erase(it);
                 continue;
@@ -1113,7 +1127,7 @@ void IntfsOrch::doTask(Consumer &consumer)
             }
             else
             {
-                if (removeIntf(alias, port.m_vr_id, ip_prefix_in_key ? &ip_prefix : nullptr))
+                if (removeIntf(alias, port->m_vr_id, ip_prefix_in_key ? &ip_prefix : nullptr))
                 {
                     m_removingIntfses.erase(alias);
                     it = consumer.m_toSync.erase(it);
@@ -1612,15 +1626,15 @@ void IntfsOrch::doTask(SelectableTimer &timer)
 
 bool IntfsOrch::isRemoteSystemPortIntf(string alias)
 {
-    Port port;
-    if(gPortsOrch->getPort(alias, port))
+    const Port *port = gPortsOrch->getPortPtr(alias);
+    if(port)
     {
-        if (port.m_type == Port::LAG)
+        if (port->m_type == Port::LAG)
         {
-            return(port.m_system_lag_info.switch_id != gVoqMySwitchId);
+            return(port->m_system_lag_info.switch_id != gVoqMySwitchId);
         }
 
-        return(port.m_system_port_info.type == SAI_SYSTEM_PORT_TYPE_REMOTE);
+        return(port->m_system_port_info.type == SAI_SYSTEM_PORT_TYPE_REMOTE);
     }
     //Given alias is system port alias of the local port/LAG
     return false;
@@ -1628,15 +1642,15 @@ bool IntfsOrch::isRemoteSystemPortIntf(string alias)
 
 bool IntfsOrch::isLocalSystemPortIntf(string alias)
 {
-    Port port;
-    if(gPortsOrch->getPort(alias, port))
+    const Port *port = gPortsOrch->getPortPtr(alias);
+    if(port)
     {
-        if (port.m_type == Port::LAG)
+        if (port->m_type == Port::LAG)
         {
-            return(port.m_system_lag_info.switch_id == gVoqMySwitchId);
+            return(port->m_system_lag_info.switch_id == gVoqMySwitchId);
         }
 
-        return(port.m_system_port_info.type != SAI_SYSTEM_PORT_TYPE_REMOTE);
+        return(port->m_system_port_info.type != SAI_SYSTEM_PORT_TYPE_REMOTE);
     }
     //Given alias is system port alias of the local port/LAG
     return false;
@@ -1646,24 +1660,24 @@ void IntfsOrch::voqSyncAddIntf(string &alias)
 {
     //Sync only local interface. Confirm for the local interface and
     //get the system port alias for key for syncing to CHASSIS_APP_DB
-    Port port;
-    if(gPortsOrch->getPort(alias, port))
+    const Port *port = gPortsOrch->getPortPtr(alias);
+    if(port)
     {
-        if (port.m_type == Port::LAG)
+        if (port->m_type == Port::LAG)
         {
-            if (port.m_system_lag_info.switch_id != gVoqMySwitchId)
+            if (port->m_system_lag_info.switch_id != gVoqMySwitchId)
             {
                 return;
             }
-            alias = port.m_system_lag_info.alias;
+            alias = port->m_system_lag_info.alias;
         }
         else
         {
-            if(port.m_system_port_info.type == SAI_SYSTEM_PORT_TYPE_REMOTE)
+            if(port->m_system_port_info.type == SAI_SYSTEM_PORT_TYPE_REMOTE)
             {
                 return;
             }
-            alias = port.m_system_port_info.alias;
+            alias = port->m_system_port_info.alias;
         }
     }
     else
@@ -1673,7 +1687,7 @@ void IntfsOrch::voqSyncAddIntf(string &alias)
     }
 
 
-    string oper_status = port.m_oper_status == SAI_PORT_OPER_STATUS_UP ? "up" : "down";
+    string oper_status = port->m_oper_status == SAI_PORT_OPER_STATUS_UP ? "up" : "down";
 
     FieldValueTuple nullFv ("oper_status", oper_status);
     vector<FieldValueTuple> attrs;
@@ -1686,24 +1700,24 @@ void IntfsOrch::voqSyncDelIntf(string &alias)
 {
     //Sync only local interface. Confirm for the local interface and
     //get the system port alias for key for syncing to CHASSIS_APP_DB
-    Port port;
-    if(gPortsOrch->getPort(alias, port))
+    const Port *port = gPortsOrch->getPortPtr(alias);
+    if(port)
     {
-        if (port.m_type == Port::LAG)
+        if (port->m_type == Port::LAG)
         {
-            if (port.m_system_lag_info.switch_id != gVoqMySwitchId)
+            if (port->m_system_lag_info.switch_id != gVoqMySwitchId)
             {
                 return;
             }
-            alias = port.m_system_lag_info.alias;
+            alias = port->m_system_lag_info.alias;
         }
         else
         {
-            if(port.m_system_port_info.type == SAI_SYSTEM_PORT_TYPE_REMOTE)
+            if(port->m_system_port_info.type == SAI_SYSTEM_PORT_TYPE_REMOTE)
             {
                 return;
             }
-            alias = port.m_system_port_info.alias;
+            alias = port->m_system_port_info.alias;
         }
     }
     else
@@ -1717,30 +1731,30 @@ void IntfsOrch::voqSyncDelIntf(string &alias)
 
 void IntfsOrch::voqSyncIntfState(string &alias, bool isUp)
 {
-    Port port;
+    const Port *port = gPortsOrch->getPortPtr(alias);
     string port_alias;
-    if(gPortsOrch->getPort(alias, port))
+    if(port)
     {
         //if route interface is not created no need sync the state
-        if(port.m_rif_id == 0)
+        if(port->m_rif_id == 0)
         {
             return;
         }
-        if (port.m_type == Port::LAG)
+        if (port->m_type == Port::LAG)
         {
-            if (port.m_system_lag_info.switch_id != gVoqMySwitchId)
+            if (port->m_system_lag_info.switch_id != gVoqMySwitchId)
             {
                 return;
             }
-            port_alias = port.m_system_lag_info.alias;
+            port_alias = port->m_system_lag_info.alias;
         }
         else
         {
-            if(port.m_system_port_info.type == SAI_SYSTEM_PORT_TYPE_REMOTE)
+            if(port->m_system_port_info.type == SAI_SYSTEM_PORT_TYPE_REMOTE)
             {
                 return;
             }
-            port_alias = port.m_system_port_info.alias;
+            port_alias = port->m_system_port_info.alias;
         }
         SWSS_LOG_NOTICE("Syncing system interface state %s for port %s", isUp ? "up" : "down", port_alias.c_str());
         m_tableVoqSystemInterfaceTable->hset(port_alias, "oper_status", isUp ? "up" : "down");
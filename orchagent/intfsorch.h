@@ -35,6 +35,8 @@ class IntfsOrch : public Orch
 public:
     IntfsOrch(DBConnector *db, string tableName, VRFOrch *vrf_orch, DBConnector *chassisAppDb);
 
+    std::vector<std::string> getWarmStartDependencies() const override;
+
     sai_object_id_t getRouterIntfsId(const string&);
     bool isPrefixSubnet(const IpPrefix&, const string&);
     bool isInbandIntfInMgmtVrf(const string& alias);
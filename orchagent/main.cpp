@@ -72,7 +72,7 @@ bool gTraditionalFlexCounter = false;
 
 void usage()
 {
-    cout << "usage: orchagent [-h] [-r record_type] [-d record_location] [-f swss_rec_filename] [-j sairedis_rec_filename] [-b batch_size] [-m MAC] [-i INST_ID] [-s] [-z mode] [-k bulk_size] [-q zmq_server_address] [-c mode]" << endl;
+    cout << "usage: orchagent [-h] [-r record_type] [-d record_location] [-f swss_rec_filename] [-j sairedis_rec_filename] [-b batch_size] [-m MAC] [-i INST_ID] [-s] [-z mode] [-k bulk_size] [-q zmq_server_address] [-c mode] [-w window_size]" << endl;
     cout << "    -h: display this message" << endl;
     cout << "    -r record_type: record orchagent logs with type (default 3)" << endl;
     cout << "                    Bit 0: sairedis.rec, Bit 1: swss.rec, Bit 2: responsepublisher.rec. For example:" << endl;
@@ -92,6 +92,7 @@ void usage()
     cout << "    -k max bulk size in bulk mode (default 1000)" << endl;
     cout << "    -q zmq_server_address: ZMQ server address (default disable ZMQ)" << endl;
     cout << "    -c counter mode (traditional|asic_db), default: asic_db" << endl;
+    cout << "    -w number of keys read per window when reading a table snapshot (default 1024)" << endl;
 }
 
 void sighup_handler(int signo)
@@ -346,7 +347,7 @@ int main(int argc, char **argv)
     string responsepublisher_rec_filename = Recorder::RESPPUB_FNAME;
     int record_type = 3; // Only swss and sairedis recordings enabled by default.
 
-    while ((opt = getopt(argc, argv, "b:m:r:f:j:d:i:hsz:k:q:c:")) != -1)
+    while ((opt = getopt(argc, argv, "b:m:r:f:j:d:i:hsz:k:q:c:w:")) != -1)
     {
         switch (opt)
         {
@@ -430,6 +431,20 @@ int main(int argc, char **argv)
                 }
             }
             break;
+        case 'w':
+            {
+                auto window = atoi(optarg);
+                if (window > 0)
+                {
+                    gSnapshotWindowSize = window;
+                    SWSS_LOG_NOTICE("Setting table snapshot window size as %zu", gSnapshotWindowSize);
+                }
+                else
+                {
+                    SWSS_LOG_ERROR("Invalid input for table snapshot window size: %d. Ignoring.", window);
+                }
+            }
+            break;
         case 'q':
             if (optarg)
             {
@@ -107,6 +107,21 @@ MirrorOrch::MirrorOrch(TableConnector stateDbConnector, TableConnector confDbCon
     }
 }
 
+/* Mirror sessions resolve their monitor port through ports, neighbors, routes and FDB */
+std::vector<std::string> MirrorOrch::getWarmStartDependencies() const
+{
+    return {
+        APP_PORT_TABLE_NAME,
+        APP_LAG_MEMBER_TABLE_NAME,
+        APP_VLAN_MEMBER_TABLE_NAME,
+        APP_INTF_TABLE_NAME,
+        APP_NEIGH_TABLE_NAME,
+        APP_ROUTE_TABLE_NAME,
+        APP_FDB_TABLE_NAME,
+        CFG_POLICER_TABLE_NAME
+    };
+}
+
 bool MirrorOrch::bake()
 {
     SWSS_LOG_ENTER();
@@ -36,6 +36,7 @@ extern sai_object_id_t     gVirtualRouterId;
 extern sai_nat_api_t      *sai_nat_api;
 extern sai_hostif_api_t   *sai_hostif_api;
 extern bool               gIsNatSupported;
+extern size_t             gMaxBulkSize;
 #ifdef DEBUG_FRAMEWORK
 extern DebugDumpOrch      *gDebugDumpOrch;
 #endif
@@ -57,7 +58,10 @@ NatOrch::NatOrch(DBConnector *appDb, DBConnector *stateDb, vector<table_name_wit
          m_naptQueryTable(appDb, APP_NAPT_TABLE_NAME),
          m_twiceNatQueryTable(appDb, APP_NAT_TWICE_TABLE_NAME),
          m_twiceNaptQueryTable(appDb, APP_NAPT_TWICE_TABLE_NAME),
-         nullIpv4Addr(0)
+         nullIpv4Addr(0),
+         m_natBulker(sai_nat_api, gMaxBulkSize),
+         m_natBulking(false),
+         m_natQuerySliced(false)
 {
     /* Set NAT admin mode to disabled */
     admin_mode = "disabled";
@@ -543,12 +547,15 @@ void NatOrch::removeDnatFromNhCache(const IpAddress &translatedIp, const IpAddre
     }
     dnatEntries.dnatIp = nullIpv4Addr;
 
+    /* An entry in the hardware leaves the cache once its removal is complete */
     if ((dnatEntries.neighResolved) || (dnatEntries.nextHopGroup != NextHopGroupKey()))
     {
-        removeHwDnatEntry(dstIp);
+        removeHwDnatEntry(dstIp, true);
+    }
+    else
+    {
+        m_natEntries.erase(dstIp);
     }
-
-    m_natEntries.erase(dstIp);
  
     if (dnatEntries.dnapt.empty() && (dnatEntries.dnatIp == nullIpv4Addr) &&
         dnatEntries.twiceNat.empty() && dnatEntries.twiceNapt.empty())
@@ -629,13 +636,16 @@ void NatOrch::removeDnaptFromNhCache(const IpAddress &translatedIp, const NaptEn
                       key.ip_address.to_string().c_str(), key.l4_port);
         return;
     }
+    /* An entry in the hardware leaves the cache once its removal is complete */
     if ((dnatEntries.neighResolved) || (dnatEntries.nextHopGroup != NextHopGroupKey()))
     {
-        removeHwDnaptEntry(key);
+        removeHwDnaptEntry(key, true);
+    }
+    else
+    {
+        m_naptEntries.erase(key);
     }
     dnatEntries.dnapt.erase(key);
-
-    m_naptEntries.erase(key);
  
     if (dnatEntries.dnapt.empty() && (dnatEntries.dnatIp == nullIpv4Addr) &&
         dnatEntries.twiceNat.empty() && dnatEntries.twiceNapt.empty())
@@ -733,13 +743,86 @@ void NatOrch::removeTwiceNaptFromNhCache(const IpAddress &translatedIp, const Tw
     }
 }
 
+// Create the NAT entry in the hardware, queued in the NAT bulker while a table task is processed
+bool NatOrch::createHwNatEntry(const sai_nat_entry_t &nat_entry, uint32_t attr_count,
+                               const sai_attribute_t *attr_list, NatBulkCallback done)
+{
+    if (!m_natBulking)
+    {
+        return done(sai_nat_api->create_nat_entry(&nat_entry, attr_count, attr_list));
+    }
+
+    m_natBulkContexts.emplace_back();
+    auto &ctx = m_natBulkContexts.back();
+    ctx.done = std::move(done);
+    m_natBulker.create_entry(&ctx.status, &nat_entry, attr_count, attr_list);
+
+    return true;
+}
+
+// Remove the NAT entry from the hardware, queued in the NAT bulker while a table task is processed
+bool NatOrch::removeHwNatEntry(const sai_nat_entry_t &nat_entry, NatBulkCallback done)
+{
+    if (!m_natBulking)
+    {
+        return done(sai_nat_api->remove_nat_entry(&nat_entry));
+    }
+
+    m_natBulkContexts.emplace_back();
+    auto &ctx = m_natBulkContexts.back();
+    ctx.done = std::move(done);
+    m_natBulker.remove_entry(&ctx.status, &nat_entry);
+
+    return true;
+}
+
+// Execute the queued NAT entry creates/removes and complete them in the order they were queued,
+// returns false if any of the completions failed
+bool NatOrch::flushNatBulker(void)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_natBulkContexts.empty())
+    {
+        return true;
+    }
+
+    size_t count = m_natBulkContexts.size();
+
+    m_natBulker.flush();
+
+    /* Completions may queue new requests, which then go to the hardware right away */
+    std::deque<NatBulkContext> contexts;
+    contexts.swap(m_natBulkContexts);
+
+    size_t failed = 0;
+    bool bulking = m_natBulking;
+    m_natBulking = false;
+    for (auto &ctx : contexts)
+    {
+        if (!ctx.done(ctx.status))
+        {
+            failed++;
+        }
+    }
+    m_natBulking = bulking;
+
+    if (failed)
+    {
+        SWSS_LOG_ERROR("%zu of %zu NAT entry requests failed", failed, count);
+        return false;
+    }
+
+    SWSS_LOG_INFO("Flushed %zu NAT entry requests", count);
+    return true;
+}
+
 // Add the DNAT entry after nexthop resolution, to the hardware
 bool NatOrch::addHwDnatEntry(const IpAddress &ip_address)
 {
     uint32_t        attr_count;
     sai_nat_entry_t dnat_entry = {};
     sai_attribute_t nat_entry_attr[4] = {};
-    sai_status_t    status;
 
     SWSS_LOG_ENTER();
     SWSS_LOG_INFO("Create DNAT entry for ip %s, as nexthop is resolved", ip_address.to_string().c_str());
@@ -769,41 +852,53 @@ bool NatOrch::addHwDnatEntry(const IpAddress &ip_address)
     dnat_entry.data.key.dst_ip = ip_address.getV4Addr();
     dnat_entry.data.mask.dst_ip = 0xffffffff;
 
-    status = sai_nat_api->create_nat_entry(&dnat_entry, attr_count, nat_entry_attr);
-    if (status != SAI_STATUS_SUCCESS)
+    return createHwNatEntry(dnat_entry, attr_count, nat_entry_attr, [this, ip_address, entry, dnat_entry](sai_status_t status)
     {
-        SWSS_LOG_ERROR("Failed to create %s DNAT NAT entry with ip %s and it's translated ip %s",
-                       entry.entry_type.c_str(), ip_address.to_string().c_str(), entry.translated_ip.to_string().c_str());
+        if (m_natEntries.find(ip_address) == m_natEntries.end())
+        {
+            /* Removed from the cache while the create was queued */
+            if (status == SAI_STATUS_SUCCESS)
+            {
+                sai_nat_api->remove_nat_entry(&dnat_entry);
+            }
+            return false;
+        }
 
-        task_process_status handle_status = handleSaiCreateStatus(SAI_API_NAT, status);
-        if (handle_status != task_success)
+        if (status != SAI_STATUS_SUCCESS)
         {
-            return parseHandleSaiStatusFailure(handle_status);
+            SWSS_LOG_ERROR("Failed to create %s DNAT NAT entry with ip %s and it's translated ip %s",
+                           entry.entry_type.c_str(), ip_address.to_string().c_str(), entry.translated_ip.to_string().c_str());
+
+            task_process_status handle_status = handleSaiCreateStatus(SAI_API_NAT, status);
+            if (handle_status != task_success)
+            {
+                return parseHandleSaiStatusFailure(handle_status);
+            }
         }
-    }
 
-    SWSS_LOG_NOTICE("Created %s DNAT NAT entry with ip %s and it's translated ip %s",
-                    entry.entry_type.c_str(), ip_address.to_string().c_str(), entry.translated_ip.to_string().c_str());
+        SWSS_LOG_NOTICE("Created %s DNAT NAT entry with ip %s and it's translated ip %s",
+                        entry.entry_type.c_str(), ip_address.to_string().c_str(), entry.translated_ip.to_string().c_str());
 
-    updateNatCounters(ip_address, 0, 0);
-    m_natEntries[ip_address].addedToHw = true; 
-    gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_DNAT_ENTRY);
+        updateNatCounters(ip_address, 0, 0);
+        m_natEntries[ip_address].addedToHw = true; 
+        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_DNAT_ENTRY);
 
-    if (entry.entry_type == "static")
-    {
-        totalStaticNatEntries++;
-        updateStaticNatCounters(totalStaticNatEntries);
-    }
-    else
-    {
-        totalDynamicNatEntries++;
-        updateDynamicNatCounters(totalDynamicNatEntries);
-    }
-    totalDnatEntries++;
-    updateDnatCounters(totalDnatEntries);
-    totalEntries++;
+        if (entry.entry_type == "static")
+        {
+            totalStaticNatEntries++;
+            updateStaticNatCounters(totalStaticNatEntries);
+        }
+        else
+        {
+            totalDynamicNatEntries++;
+            updateDynamicNatCounters(totalDynamicNatEntries);
+        }
+        totalDnatEntries++;
+        updateDnatCounters(totalDnatEntries);
+        totalEntries++;
 
-    return true;
+        return true;
+    });
 }
 
 // Add the DNAPT entry after nexthop resolution, to the hardware
@@ -813,7 +908,6 @@ bool NatOrch::addHwDnaptEntry(const NaptEntryKey &key)
     sai_nat_entry_t dnat_entry = {};
     sai_attribute_t nat_entry_attr[5] = {};
     uint8_t         ip_protocol = ((key.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
-    sai_status_t    status;
 
     SWSS_LOG_ENTER();
     SWSS_LOG_INFO("Create DNAPT entry for proto %s, dest-ip %s, l4-port %d, as nexthop is resolved",
@@ -851,53 +945,70 @@ bool NatOrch::addHwDnaptEntry(const NaptEntryKey &key)
     dnat_entry.data.key.proto = ip_protocol;
     dnat_entry.data.mask.proto = 0xff;
 
-    status = sai_nat_api->create_nat_entry(&dnat_entry, attr_count, nat_entry_attr);
-    if (status != SAI_STATUS_SUCCESS)
+    return createHwNatEntry(dnat_entry, attr_count, nat_entry_attr, [this, key, entry, dnat_entry](sai_status_t status)
     {
-        SWSS_LOG_ERROR("Failed to create %s DNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
-                       entry.entry_type.c_str(), key.ip_address.to_string().c_str(), key.l4_port, key.prototype.c_str(),
-                       entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
-        task_process_status handle_status = handleSaiCreateStatus(SAI_API_NAT, status);
-        if (handle_status != task_success)
+        if (m_naptEntries.find(key) == m_naptEntries.end())
         {
-            return parseHandleSaiStatusFailure(handle_status);
+            /* Removed from the cache while the create was queued */
+            if (status == SAI_STATUS_SUCCESS)
+            {
+                sai_nat_api->remove_nat_entry(&dnat_entry);
+            }
+            return false;
         }
-    }
 
-    SWSS_LOG_NOTICE("Created %s DNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
-                    entry.entry_type.c_str(), key.ip_address.to_string().c_str(), key.l4_port, key.prototype.c_str(),
-                    entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to create %s DNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
+                           entry.entry_type.c_str(), key.ip_address.to_string().c_str(), key.l4_port, key.prototype.c_str(),
+                           entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
+            task_process_status handle_status = handleSaiCreateStatus(SAI_API_NAT, status);
+            if (handle_status != task_success)
+            {
+                return parseHandleSaiStatusFailure(handle_status);
+            }
+        }
 
-    m_naptEntries[key].addedToHw = true;
-    updateNaptCounters(key.prototype.c_str(), key.ip_address, key.l4_port, 0, 0);
-    gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_DNAT_ENTRY);
+        SWSS_LOG_NOTICE("Created %s DNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
+                        entry.entry_type.c_str(), key.ip_address.to_string().c_str(), key.l4_port, key.prototype.c_str(),
+                        entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
 
-    if (entry.entry_type == "static")
-    {
-        totalStaticNaptEntries++;
-        updateStaticNaptCounters(totalStaticNaptEntries);
-    }
-    else
-    {
-        totalDynamicNaptEntries++;
-        updateDynamicNaptCounters(totalDynamicNaptEntries);
-    }
-    totalDnatEntries++;
-    updateDnatCounters(totalDnatEntries);
-    totalEntries++;
+        m_naptEntries[key].addedToHw = true;
+        updateNaptCounters(key.prototype.c_str(), key.ip_address, key.l4_port, 0, 0);
+        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_DNAT_ENTRY);
 
-    return true;
+        if (entry.entry_type == "static")
+        {
+            totalStaticNaptEntries++;
+            updateStaticNaptCounters(totalStaticNaptEntries);
+        }
+        else
+        {
+            totalDynamicNaptEntries++;
+            updateDynamicNaptCounters(totalDynamicNaptEntries);
+        }
+        totalDnatEntries++;
+        updateDnatCounters(totalDnatEntries);
+        totalEntries++;
+
+        return true;
+    });
 }
 
 // Remove the DNAT entry from the hardware
-bool NatOrch::removeHwDnatEntry(const IpAddress &dstIp)
+bool NatOrch::removeHwDnatEntry(const IpAddress &dstIp, bool eraseEntry)
 {
     sai_nat_entry_t dnat_entry = {};
-    sai_status_t    status;
 
     SWSS_LOG_ENTER();
     SWSS_LOG_INFO("Deleting DNAT entry ip %s from hardware", dstIp.to_string().c_str());
 
+    /* Complete the queued creates first, the entry may be one of them */
+    if (m_natBulking && m_natBulker.creating_entries_count())
+    {
+        flushNatBulker();
+    }
+
     /* Check the entry is present in cache */
     if (m_natEntries.find(dstIp) == m_natEntries.end())
     {
@@ -910,6 +1021,11 @@ bool NatOrch::removeHwDnatEntry(const IpAddress &dstIp)
     {
         SWSS_LOG_INFO("DNAT entry isn't added to h/w, for ip %s", dstIp.to_string().c_str());
 
+        if (eraseEntry)
+        {
+            m_natEntries.erase(dstIp);
+        }
+
         return false;
     }
 
@@ -923,54 +1039,67 @@ bool NatOrch::removeHwDnatEntry(const IpAddress &dstIp)
     dnat_entry.data.key.dst_ip = dstIp.getV4Addr();
     dnat_entry.data.mask.dst_ip = 0xffffffff;
 
-    status = sai_nat_api->remove_nat_entry(&dnat_entry);
-    if (status != SAI_STATUS_SUCCESS)
+    /* The cache and the counters are updated once the SAI result is known,
+     * which is deferred to the bulk completion while bulking */
+    return removeHwNatEntry(dnat_entry, [this, dstIp, entry, eraseEntry](sai_status_t status)
     {
-        SWSS_LOG_INFO("Failed to remove %s DNAT NAT entry with ip %s and it's translated ip %s",
-                      entry.entry_type.c_str(), dstIp.to_string().c_str(), entry.translated_ip.to_string().c_str());
-
-        task_process_status handle_status = handleSaiRemoveStatus(SAI_API_NAT, status);
-        if (handle_status != task_success)
+        if (status != SAI_STATUS_SUCCESS)
         {
-            return parseHandleSaiStatusFailure(handle_status);
+            SWSS_LOG_INFO("Failed to remove %s DNAT NAT entry with ip %s and it's translated ip %s",
+                          entry.entry_type.c_str(), dstIp.to_string().c_str(), entry.translated_ip.to_string().c_str());
+
+            task_process_status handle_status = handleSaiRemoveStatus(SAI_API_NAT, status);
+            if (handle_status != task_success)
+            {
+                if (eraseEntry)
+                {
+                    m_natEntries.erase(dstIp);
+                }
+                return parseHandleSaiStatusFailure(handle_status);
+            }
         }
-    }
 
-    SWSS_LOG_NOTICE("Removed %s DNAT NAT entry with ip %s and it's translated ip %s",
-                    entry.entry_type.c_str(), dstIp.to_string().c_str(), entry.translated_ip.to_string().c_str());
-  
-    deleteNatCounters(dstIp);
-    gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_DNAT_ENTRY);
+        SWSS_LOG_NOTICE("Removed %s DNAT NAT entry with ip %s and it's translated ip %s",
+                        entry.entry_type.c_str(), dstIp.to_string().c_str(), entry.translated_ip.to_string().c_str());
 
-    if (entry.entry_type == "static")
-    {
-        if (totalStaticNatEntries)
+        deleteNatCounters(dstIp);
+        gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_DNAT_ENTRY);
+
+        if (entry.entry_type == "static")
         {
-            totalStaticNatEntries--;
-            updateStaticNatCounters(totalStaticNatEntries);
+            if (totalStaticNatEntries)
+            {
+                totalStaticNatEntries--;
+                updateStaticNatCounters(totalStaticNatEntries);
+            }
         }
-    }
-    else
-    {
-        if (totalDynamicNatEntries)
+        else
+        {
+            if (totalDynamicNatEntries)
+            {
+               totalDynamicNatEntries--;
+               updateDynamicNatCounters(totalDynamicNatEntries);
+            }
+        }
+
+        if (totalDnatEntries)
         {
-           totalDynamicNatEntries--;
-           updateDynamicNatCounters(totalDynamicNatEntries);
+            totalDnatEntries--;
+            updateDnatCounters(totalDnatEntries);
         }
-    }
 
-    if (totalDnatEntries)
-    {
-        totalDnatEntries--;
-        updateDnatCounters(totalDnatEntries);
-    }
+        if (totalEntries)
+        {
+            totalEntries--;
+        }
 
-    if (totalEntries)
-    {
-        totalEntries--;
-    }
- 
-    return true;
+        if (eraseEntry)
+        {
+            m_natEntries.erase(dstIp);
+        }
+
+        return true;
+    });
 }
 
 // Remove the Twice NAT entry from the hardware
@@ -1069,16 +1198,21 @@ bool NatOrch::removeHwTwiceNatEntry(const TwiceNatEntryKey &key)
 }
 
 // Remove the DNAPT entry from the hardware
-bool NatOrch::removeHwDnaptEntry(const NaptEntryKey &key)
+bool NatOrch::removeHwDnaptEntry(const NaptEntryKey &key, bool eraseEntry)
 {
     sai_nat_entry_t dnat_entry = {};
-    sai_status_t    status;
     uint8_t         ip_protocol = ((key.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
 
     SWSS_LOG_ENTER();
     SWSS_LOG_INFO("Delete DNAPT entry for proto %s, dest-ip %s, l4-port %d",
                    key.prototype.c_str(), key.ip_address.to_string().c_str(), key.l4_port);
 
+    /* Complete the queued creates first, the entry may be one of them */
+    if (m_natBulking && m_natBulker.creating_entries_count())
+    {
+        flushNatBulker();
+    }
+
     /* Check the entry is present in cache */
     if (m_naptEntries.find(key) == m_naptEntries.end())
     {
@@ -1091,6 +1225,11 @@ bool NatOrch::removeHwDnaptEntry(const NaptEntryKey &key)
     {
         SWSS_LOG_ERROR("DNAPT entry isn't added to hardware, for ip %s, l4-port %d", key.ip_address.to_string().c_str(), key.l4_port);
 
+        if (eraseEntry)
+        {
+            m_naptEntries.erase(key);
+        }
+
         return false;
     }
 
@@ -1108,57 +1247,70 @@ bool NatOrch::removeHwDnaptEntry(const NaptEntryKey &key)
     dnat_entry.data.key.proto = ip_protocol;
     dnat_entry.data.mask.proto = 0xff;
 
-    status = sai_nat_api->remove_nat_entry(&dnat_entry);
-    if (status != SAI_STATUS_SUCCESS)
+    /* The cache and the counters are updated once the SAI result is known,
+     * which is deferred to the bulk completion while bulking */
+    return removeHwNatEntry(dnat_entry, [this, key, entry, eraseEntry](sai_status_t status)
     {
-        SWSS_LOG_INFO("Failed to remove %s DNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
-                      entry.entry_type.c_str(), key.ip_address.to_string().c_str(), key.l4_port, key.prototype.c_str(),
-                      entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_INFO("Failed to remove %s DNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
+                          entry.entry_type.c_str(), key.ip_address.to_string().c_str(), key.l4_port, key.prototype.c_str(),
+                          entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
 
 
-        task_process_status handle_status = handleSaiRemoveStatus(SAI_API_NAT, status);
-        if (handle_status != task_success)
-        {
-            return parseHandleSaiStatusFailure(handle_status);
+            task_process_status handle_status = handleSaiRemoveStatus(SAI_API_NAT, status);
+            if (handle_status != task_success)
+            {
+                if (eraseEntry)
+                {
+                    m_naptEntries.erase(key);
+                }
+                return parseHandleSaiStatusFailure(handle_status);
+            }
         }
-    }
 
-    SWSS_LOG_NOTICE("Removed %s DNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
-                    entry.entry_type.c_str(), key.ip_address.to_string().c_str(), key.l4_port, key.prototype.c_str(), 
-                    entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
+        SWSS_LOG_NOTICE("Removed %s DNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
+                        entry.entry_type.c_str(), key.ip_address.to_string().c_str(), key.l4_port, key.prototype.c_str(), 
+                        entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
 
-    deleteNaptCounters(key.prototype.c_str(), key.ip_address, key.l4_port);
-    gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_DNAT_ENTRY);
+        deleteNaptCounters(key.prototype.c_str(), key.ip_address, key.l4_port);
+        gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_DNAT_ENTRY);
 
-    if (entry.entry_type == "static")
-    {
-        if (totalStaticNaptEntries)
+        if (entry.entry_type == "static")
         {
-            totalStaticNaptEntries--;
-            updateStaticNaptCounters(totalStaticNaptEntries);
+            if (totalStaticNaptEntries)
+            {
+                totalStaticNaptEntries--;
+                updateStaticNaptCounters(totalStaticNaptEntries);
+            }
         }
-    }
-    else
-    {
-        if (totalDynamicNaptEntries)
+        else
         {
-            totalDynamicNaptEntries--;
-            updateDynamicNaptCounters(totalDynamicNaptEntries);
+            if (totalDynamicNaptEntries)
+            {
+                totalDynamicNaptEntries--;
+                updateDynamicNaptCounters(totalDynamicNaptEntries);
+            }
         }
-    }
 
-    if (totalDnatEntries)
-    {
-        totalDnatEntries--;
-        updateDnatCounters(totalDnatEntries);
-    }
+        if (totalDnatEntries)
+        {
+            totalDnatEntries--;
+            updateDnatCounters(totalDnatEntries);
+        }
 
-    if (totalEntries)
-    {
-        totalEntries--;
-    }
+        if (totalEntries)
+        {
+            totalEntries--;
+        }
 
-    return true;
+        if (eraseEntry)
+        {
+            m_naptEntries.erase(key);
+        }
+
+        return true;
+    });
 }
 
 // Remove the Twice NAPT entry from the hardware
@@ -1272,7 +1424,6 @@ bool NatOrch::addHwSnatEntry(const IpAddress &ip_address)
     uint32_t        attr_count;
     sai_nat_entry_t snat_entry = {};
     sai_attribute_t nat_entry_attr[4] = {};
-    sai_status_t    status;
     struct timespec  time_now;
 
     SWSS_LOG_ENTER();
@@ -1302,40 +1453,52 @@ bool NatOrch::addHwSnatEntry(const IpAddress &ip_address)
     snat_entry.data.key.src_ip = ip_address.getV4Addr();
     snat_entry.data.mask.src_ip = 0xffffffff;
 
-    status = sai_nat_api->create_nat_entry(&snat_entry, attr_count, nat_entry_attr);
-    if (status != SAI_STATUS_SUCCESS)
+    return createHwNatEntry(snat_entry, attr_count, nat_entry_attr, [this, ip_address, entry, snat_entry, time_now](sai_status_t status)
     {
-        SWSS_LOG_ERROR("Failed to create %s SNAT NAT entry with ip %s and it's translated ip %s",
-                       entry.entry_type.c_str(), ip_address.to_string().c_str(), entry.translated_ip.to_string().c_str());
+        if (m_natEntries.find(ip_address) == m_natEntries.end())
+        {
+            /* Removed from the cache while the create was queued */
+            if (status == SAI_STATUS_SUCCESS)
+            {
+                sai_nat_api->remove_nat_entry(&snat_entry);
+            }
+            return false;
+        }
 
-        task_process_status handle_status = handleSaiCreateStatus(SAI_API_NAT, status);
-        if (handle_status != task_success)
+        if (status != SAI_STATUS_SUCCESS)
         {
-            return parseHandleSaiStatusFailure(handle_status);
+            SWSS_LOG_ERROR("Failed to create %s SNAT NAT entry with ip %s and it's translated ip %s",
+                           entry.entry_type.c_str(), ip_address.to_string().c_str(), entry.translated_ip.to_string().c_str());
+
+            task_process_status handle_status = handleSaiCreateStatus(SAI_API_NAT, status);
+            if (handle_status != task_success)
+            {
+                return parseHandleSaiStatusFailure(handle_status);
+            }
         }
-    }
 
-    SWSS_LOG_NOTICE("Created %s SNAT NAT entry with ip %s and it's translated ip %s",
-                    entry.entry_type.c_str(), ip_address.to_string().c_str(), entry.translated_ip.to_string().c_str());
+        SWSS_LOG_NOTICE("Created %s SNAT NAT entry with ip %s and it's translated ip %s",
+                        entry.entry_type.c_str(), ip_address.to_string().c_str(), entry.translated_ip.to_string().c_str());
 
-    updateNatCounters(ip_address, 0, 0);
-    m_natEntries[ip_address].addedToHw = true;
-    m_natEntries[ip_address].activeTime = time_now.tv_sec;
-    gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_SNAT_ENTRY);
+        updateNatCounters(ip_address, 0, 0);
+        m_natEntries[ip_address].addedToHw = true;
+        m_natEntries[ip_address].activeTime = time_now.tv_sec;
+        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_SNAT_ENTRY);
 
-    if (entry.entry_type == "static")
-    {
-        totalStaticNatEntries++;
-        updateStaticNatCounters(totalStaticNatEntries);
-    }
-    else
-    {
-        totalDynamicNatEntries++;
-        updateDynamicNatCounters(totalDynamicNatEntries);
-    }
-    totalEntries++;
+        if (entry.entry_type == "static")
+        {
+            totalStaticNatEntries++;
+            updateStaticNatCounters(totalStaticNatEntries);
+        }
+        else
+        {
+            totalDynamicNatEntries++;
+            updateDynamicNatCounters(totalDynamicNatEntries);
+        }
+        totalEntries++;
 
-    return true;
+        return true;
+    });
 }
 
 // Add the Twice NAT entry to the hardware
@@ -1433,7 +1596,6 @@ bool NatOrch::addHwSnaptEntry(const NaptEntryKey &keyEntry)
     sai_nat_entry_t snat_entry = {};
     sai_attribute_t nat_entry_attr[5] = {};
     uint8_t         ip_protocol = ((keyEntry.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
-    sai_status_t    status;
     struct timespec  time_now;
 
     SWSS_LOG_ENTER();
@@ -1470,43 +1632,55 @@ bool NatOrch::addHwSnaptEntry(const NaptEntryKey &keyEntry)
     snat_entry.data.key.proto = ip_protocol;
     snat_entry.data.mask.proto = 0xff;
 
-    status = sai_nat_api->create_nat_entry(&snat_entry, attr_count, nat_entry_attr);
-    if (status != SAI_STATUS_SUCCESS)
+    return createHwNatEntry(snat_entry, attr_count, nat_entry_attr, [this, keyEntry, entry, snat_entry, time_now](sai_status_t status)
     {
-        SWSS_LOG_ERROR("Failed to create %s SNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
-                       entry.entry_type.c_str(), keyEntry.ip_address.to_string().c_str(), keyEntry.l4_port, keyEntry.prototype.c_str(),
-                       entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
+        if (m_naptEntries.find(keyEntry) == m_naptEntries.end())
+        {
+            /* Removed from the cache while the create was queued */
+            if (status == SAI_STATUS_SUCCESS)
+            {
+                sai_nat_api->remove_nat_entry(&snat_entry);
+            }
+            return false;
+        }
 
-        task_process_status handle_status = handleSaiCreateStatus(SAI_API_NAT, status);
-        if (handle_status != task_success)
+        if (status != SAI_STATUS_SUCCESS)
         {
-            return parseHandleSaiStatusFailure(handle_status);
+            SWSS_LOG_ERROR("Failed to create %s SNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
+                           entry.entry_type.c_str(), keyEntry.ip_address.to_string().c_str(), keyEntry.l4_port, keyEntry.prototype.c_str(),
+                           entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
+
+            task_process_status handle_status = handleSaiCreateStatus(SAI_API_NAT, status);
+            if (handle_status != task_success)
+            {
+                return parseHandleSaiStatusFailure(handle_status);
+            }
         }
-     }
 
-     SWSS_LOG_NOTICE("Created %s SNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
-                     entry.entry_type.c_str(), keyEntry.ip_address.to_string().c_str(), keyEntry.l4_port, keyEntry.prototype.c_str(),
-                     entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
+        SWSS_LOG_NOTICE("Created %s SNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
+                        entry.entry_type.c_str(), keyEntry.ip_address.to_string().c_str(), keyEntry.l4_port, keyEntry.prototype.c_str(),
+                        entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
 
-     m_naptEntries[keyEntry].addedToHw = true;
-     m_naptEntries[keyEntry].activeTime = time_now.tv_sec;
+        m_naptEntries[keyEntry].addedToHw = true;
+        m_naptEntries[keyEntry].activeTime = time_now.tv_sec;
 
-     updateNaptCounters(keyEntry.prototype.c_str(), keyEntry.ip_address, keyEntry.l4_port, 0, 0);
-     gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_SNAT_ENTRY);
+        updateNaptCounters(keyEntry.prototype.c_str(), keyEntry.ip_address, keyEntry.l4_port, 0, 0);
+        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_SNAT_ENTRY);
 
-     if (entry.entry_type == "static")
-     {
-         totalStaticNaptEntries++;
-         updateStaticNaptCounters(totalStaticNaptEntries);
-     }
-     else
-     {
-         totalDynamicNaptEntries++;
-         updateDynamicNaptCounters(totalDynamicNaptEntries);
-     }
-     totalEntries++;
+        if (entry.entry_type == "static")
+        {
+            totalStaticNaptEntries++;
+            updateStaticNaptCounters(totalStaticNaptEntries);
+        }
+        else
+        {
+            totalDynamicNaptEntries++;
+            updateDynamicNaptCounters(totalDynamicNaptEntries);
+        }
+        totalEntries++;
 
-    return true;
+        return true;
+    });
 }
 
 // Add the Twice NAPT entry to the hardware
@@ -1617,11 +1791,16 @@ bool NatOrch::addHwTwiceNaptEntry(const TwiceNaptEntryKey &key)
 bool NatOrch::removeHwSnatEntry(const IpAddress &ip_address)
 {
     sai_nat_entry_t snat_entry = {};
-    sai_status_t    status;
 
     SWSS_LOG_ENTER();
     SWSS_LOG_INFO("Deleting SNAT entry ip %s from hardware", ip_address.to_string().c_str());
 
+    /* Complete the queued creates first, the entry may be one of them */
+    if (m_natBulking && m_natBulker.creating_entries_count())
+    {
+        flushNatBulker();
+    }
+
     NatEntryValue entry = m_natEntries[ip_address];
 
     snat_entry.vr_id = gVirtualRouterId;
@@ -1630,73 +1809,83 @@ bool NatOrch::removeHwSnatEntry(const IpAddress &ip_address)
     snat_entry.data.key.src_ip = ip_address.getV4Addr();
     snat_entry.data.mask.src_ip = 0xffffffff;
 
-    status = sai_nat_api->remove_nat_entry(&snat_entry);
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_INFO("Failed to removed %s SNAT NAT entry with ip %s and it's translated ip %s",
-                      entry.entry_type.c_str(), ip_address.to_string().c_str(), entry.translated_ip.to_string().c_str());
-    }
-    else
+    /* The cache and the counters are updated once the SAI call is complete,
+     * which is deferred to the bulk completion while bulking */
+    return removeHwNatEntry(snat_entry, [this, ip_address, entry](sai_status_t status)
     {
-        SWSS_LOG_NOTICE("Removed %s SNAT NAT entry with ip %s and it's translated ip %s",
-                        entry.entry_type.c_str(), ip_address.to_string().c_str(), entry.translated_ip.to_string().c_str());
-    }
-    deleteNatCounters(ip_address);
-    m_natEntries.erase(ip_address);
-    gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_SNAT_ENTRY);
-
-    if (entry.entry_type == "static")
-    {
-        if (totalStaticNatEntries)
+        if (status != SAI_STATUS_SUCCESS)
         {
-            totalStaticNatEntries--;
-            updateStaticNatCounters(totalStaticNatEntries);
+            SWSS_LOG_INFO("Failed to removed %s SNAT NAT entry with ip %s and it's translated ip %s",
+                          entry.entry_type.c_str(), ip_address.to_string().c_str(), entry.translated_ip.to_string().c_str());
         }
-    }
-    else
-    {
-        if (totalDynamicNatEntries)
+        else
         {
-            totalDynamicNatEntries--;
-            updateDynamicNatCounters(totalDynamicNatEntries);
+            SWSS_LOG_NOTICE("Removed %s SNAT NAT entry with ip %s and it's translated ip %s",
+                            entry.entry_type.c_str(), ip_address.to_string().c_str(), entry.translated_ip.to_string().c_str());
+        }
+
+        deleteNatCounters(ip_address);
+        m_natEntries.erase(ip_address);
+        gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_SNAT_ENTRY);
+
+        if (entry.entry_type == "static")
+        {
+            if (totalStaticNatEntries)
+            {
+                totalStaticNatEntries--;
+                updateStaticNatCounters(totalStaticNatEntries);
+            }
         }
         else
         {
-            SWSS_LOG_ERROR("Found the total number dynamic nat entries to be corrupt, when removing SNAT entry with ip %s, translated ip %s!!",
-                            ip_address.to_string().c_str(), entry.translated_ip.to_string().c_str());
+            if (totalDynamicNatEntries)
+            {
+                totalDynamicNatEntries--;
+                updateDynamicNatCounters(totalDynamicNatEntries);
+            }
+            else
+            {
+                SWSS_LOG_ERROR("Found the total number dynamic nat entries to be corrupt, when removing SNAT entry with ip %s, translated ip %s!!",
+                                ip_address.to_string().c_str(), entry.translated_ip.to_string().c_str());
+            }
         }
-    }
 
-    if (totalSnatEntries)
-    {
-        totalSnatEntries--;
-        updateSnatCounters(totalSnatEntries);
-    }
-    else
-    {
-        SWSS_LOG_ERROR("Found the total number dynamic snat entries to be corrupt, when removing SNAT entry with ip %s, translated ip %s!!",
-                       ip_address.to_string().c_str(), entry.translated_ip.to_string().c_str());
-    }
+        if (totalSnatEntries)
+        {
+            totalSnatEntries--;
+            updateSnatCounters(totalSnatEntries);
+        }
+        else
+        {
+            SWSS_LOG_ERROR("Found the total number dynamic snat entries to be corrupt, when removing SNAT entry with ip %s, translated ip %s!!",
+                           ip_address.to_string().c_str(), entry.translated_ip.to_string().c_str());
+        }
 
-    if (totalEntries)
-    {
-        totalEntries--;
-    }
+        if (totalEntries)
+        {
+            totalEntries--;
+        }
 
-    return true;
+        return true;
+    });
 }
 
 // Remove the SNAPT entry from the hardware
 bool NatOrch::removeHwSnaptEntry(const NaptEntryKey &keyEntry)
 {
     sai_nat_entry_t snat_entry = {};
-    sai_status_t    status;
     uint8_t         ip_protocol = ((keyEntry.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
 
     SWSS_LOG_ENTER();
     SWSS_LOG_INFO("Delete SNAPT entry for proto %s, src-ip %s, l4-port %d",
                    keyEntry.prototype.c_str(), keyEntry.ip_address.to_string().c_str(), keyEntry.l4_port);
 
+    /* Complete the queued creates first, the entry may be one of them */
+    if (m_natBulking && m_natBulker.creating_entries_count())
+    {
+        flushNatBulker();
+    }
+
     /* Check the entry is present in cache */
     if (m_naptEntries.find(keyEntry) == m_naptEntries.end())
     {
@@ -1717,62 +1906,67 @@ bool NatOrch::removeHwSnaptEntry(const NaptEntryKey &keyEntry)
     snat_entry.data.key.proto = ip_protocol;
     snat_entry.data.mask.proto = 0xff;
 
-    status = sai_nat_api->remove_nat_entry(&snat_entry);
-    if (status != SAI_STATUS_SUCCESS)
+    /* The cache and the counters are updated once the SAI call is complete,
+     * which is deferred to the bulk completion while bulking */
+    return removeHwNatEntry(snat_entry, [this, keyEntry, entry](sai_status_t status)
     {
-        SWSS_LOG_INFO("Failed to removed %s SNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
-                      entry.entry_type.c_str(), keyEntry.ip_address.to_string().c_str(), keyEntry.l4_port, keyEntry.prototype.c_str(),
-                      entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
-    }
-    else
-    {
-        SWSS_LOG_NOTICE("Removed %s SNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
-                      entry.entry_type.c_str(), keyEntry.ip_address.to_string().c_str(), keyEntry.l4_port, keyEntry.prototype.c_str(),
-                      entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
-    }
-    deleteNaptCounters(keyEntry.prototype.c_str(), keyEntry.ip_address, keyEntry.l4_port);
-    m_naptEntries.erase(keyEntry);
-    gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_SNAT_ENTRY);
-
-    if (entry.entry_type == "static")
-    {
-        if (totalStaticNaptEntries)
+        if (status != SAI_STATUS_SUCCESS)
         {
-            totalStaticNaptEntries--;
-            updateStaticNaptCounters(totalStaticNaptEntries);
+            SWSS_LOG_INFO("Failed to removed %s SNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
+                          entry.entry_type.c_str(), keyEntry.ip_address.to_string().c_str(), keyEntry.l4_port, keyEntry.prototype.c_str(),
+                          entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
         }
-    }
-    else
-    {
-        if (totalDynamicNaptEntries)
+        else
         {
-            totalDynamicNaptEntries--;
-            updateDynamicNaptCounters(totalDynamicNaptEntries);
+            SWSS_LOG_NOTICE("Removed %s SNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
+                            entry.entry_type.c_str(), keyEntry.ip_address.to_string().c_str(), keyEntry.l4_port, keyEntry.prototype.c_str(),
+                            entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
+        }
+
+        deleteNaptCounters(keyEntry.prototype.c_str(), keyEntry.ip_address, keyEntry.l4_port);
+        m_naptEntries.erase(keyEntry);
+        gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_SNAT_ENTRY);
+
+        if (entry.entry_type == "static")
+        {
+            if (totalStaticNaptEntries)
+            {
+                totalStaticNaptEntries--;
+                updateStaticNaptCounters(totalStaticNaptEntries);
+            }
         }
         else
         {
-            SWSS_LOG_ERROR("Found the total number dynamic napt entries to be corrupt, when removing SNAPT entry with proto %s, ip %s, port %d, translated ip %s, translated port %d!!",
-                            keyEntry.prototype.c_str(), keyEntry.ip_address.to_string().c_str(), keyEntry.l4_port,
-                            entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
+            if (totalDynamicNaptEntries)
+            {
+                totalDynamicNaptEntries--;
+                updateDynamicNaptCounters(totalDynamicNaptEntries);
+            }
+            else
+            {
+                SWSS_LOG_ERROR("Found the total number dynamic napt entries to be corrupt, when removing SNAPT entry with proto %s, ip %s, port %d, translated ip %s, translated port %d!!",
+                                keyEntry.prototype.c_str(), keyEntry.ip_address.to_string().c_str(), keyEntry.l4_port,
+                                entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
+            }
         }
-    }
 
-    if (totalSnatEntries)
-    {
-        totalSnatEntries--;
-        updateSnatCounters(totalSnatEntries);
-    }
-    else
-    {
-        SWSS_LOG_ERROR("Found the total number dynamic snat entries to be corrupt, when removing SNAPT entry with proto %s, ip %s, port %d, translated ip %s, translated port %d!!",
-                       keyEntry.prototype.c_str(), keyEntry.ip_address.to_string().c_str(), keyEntry.l4_port,
-                       entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
-    }
+        if (totalSnatEntries)
+        {
+            totalSnatEntries--;
+            updateSnatCounters(totalSnatEntries);
+        }
+        else
+        {
+            SWSS_LOG_ERROR("Found the total number dynamic snat entries to be corrupt, when removing SNAPT entry with proto %s, ip %s, port %d, translated ip %s, translated port %d!!",
+                           keyEntry.prototype.c_str(), keyEntry.ip_address.to_string().c_str(), keyEntry.l4_port,
+                           entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
+        }
 
-    if (totalEntries)
-        totalEntries--;
+        if (totalEntries)
+            totalEntries--;
 
-    return true;
+        return true;
+    });
 }
 
 // Add the DNAT Pool entry to the hardware
@@ -1866,6 +2060,12 @@ bool NatOrch::addNatEntry(const IpAddress &ip_address, const NatEntryValue &entr
 {
     SWSS_LOG_ENTER();
 
+    /* Complete the queued removes first, the entry may be one of them */
+    if (m_natBulking && m_natBulker.removing_entries_count())
+    {
+        flushNatBulker();
+    }
+
     /* Check the entry is present in cache */
     if (m_natEntries.find(ip_address) != m_natEntries.end())
     {
@@ -1962,8 +2162,7 @@ bool NatOrch::removeNatEntry(const IpAddress &ip_address)
         }
         else
         {
-            removeHwDnatEntry(ip_address);
-            m_natEntries.erase(ip_address);
+            removeHwDnatEntry(ip_address, true);
         }
     }
     else
@@ -2058,6 +2257,12 @@ bool NatOrch::addNaptEntry(const NaptEntryKey &keyEntry, const NaptEntryValue &e
 {
     SWSS_LOG_ENTER();
 
+    /* Complete the queued removes first, the entry may be one of them */
+    if (m_natBulking && m_natBulker.removing_entries_count())
+    {
+        flushNatBulker();
+    }
+
     /* Check the entry is present in cache */
     if (m_naptEntries.find(keyEntry) != m_naptEntries.end())
     {
@@ -2078,6 +2283,10 @@ bool NatOrch::addNaptEntry(const NaptEntryKey &keyEntry, const NaptEntryValue &e
                           keyEntry.prototype.c_str(), oldEntry.translated_ip.to_string().c_str(), oldEntry.translated_l4_port);
 
             removeNaptEntry(keyEntry);
+            if (m_natBulking)
+            {
+                flushNatBulker();
+            }
         }
         else if (entry.entry_type != oldEntry.entry_type)
         {
@@ -2199,8 +2408,7 @@ bool NatOrch::removeNaptEntry(const NaptEntryKey &keyEntry)
         }
         else
         {
-            removeHwDnaptEntry(keyEntry);
-            m_naptEntries.erase(keyEntry);
+            removeHwDnaptEntry(keyEntry, true);
         }
     }
     else
@@ -2379,8 +2587,7 @@ void NatOrch::clearAllDnatEntries(void)
                 }
                 else
                 {
-                    removeHwDnatEntry(dstIp);
-                    m_natEntries.erase(dstIp);
+                    removeHwDnatEntry(dstIp, true);
                 }
             }
         }
@@ -2403,8 +2610,7 @@ void NatOrch::clearAllDnatEntries(void)
                 }
                 else
                 {
-                    removeHwDnaptEntry(keyEntry);
-                    m_naptEntries.erase(keyEntry);
+                    removeHwDnaptEntry(keyEntry, true);
                 }
             }
         }
@@ -2599,6 +2805,7 @@ void NatOrch::disableNatFeature(void)
 
     SWSS_LOG_INFO("NAT Query timer stop ");
     m_natQueryTimer->stop();
+    resetQueryCursors();
 
     SWSS_LOG_INFO("NAT Timeout timer stop ");
     m_natTimeoutTimer->stop();
@@ -3040,12 +3247,18 @@ void NatOrch::doTask(Consumer& consumer)
     if (table_name == APP_NAT_TABLE_NAME)
     {
         SWSS_LOG_INFO("Received APP_NAT_TABLE_NAME update");
+        m_natBulking = true;
         doNatTableTask(consumer);
+        flushNatBulker();
+        m_natBulking = false;
     }
     else if (table_name == APP_NAPT_TABLE_NAME)
     {
         SWSS_LOG_INFO("Received APP_NAPT_TABLE_NAME update");
+        m_natBulking = true;
         doNaptTableTask(consumer);
+        flushNatBulker();
+        m_natBulking = false;
     }
     if (table_name == APP_NAT_TWICE_TABLE_NAME)
     {
@@ -3097,11 +3310,37 @@ void NatOrch::doTask(SelectableTimer &timer)
 
     if (timer.getFd() == m_natQueryTimer->getFd())
     {
-        if (((natTimerTickCntr++) % NAT_HITBIT_QUERY_MULTIPLE) == 0)
+        /* Ticks that resume an unfinished query don't start new ones */
+        if (!m_natQuerySliced)
+        {
+            if (((natTimerTickCntr++) % NAT_HITBIT_QUERY_MULTIPLE) == 0)
+            {
+                m_hitBitCursor.pending = true;
+            }
+            m_counterCursor.pending = true;
+        }
+
+        if (m_hitBitCursor.pending)
         {
             queryHitBits();
         }
-        queryCounters();
+        if (m_counterCursor.pending)
+        {
+            queryCounters();
+        }
+
+        /* Come back shortly to resume a query that ran out of its time budget */
+        bool sliced = m_hitBitCursor.pending || m_counterCursor.pending;
+        if (sliced != m_natQuerySliced)
+        {
+            m_natQuerySliced = sliced;
+
+            auto interval = sliced ?
+                timespec { .tv_sec = 0, .tv_nsec = NAT_QUERY_SLICE_INTERVAL_MSEC * 1000000L } :
+                timespec { .tv_sec = NAT_HITBIT_N_CNTRS_QUERY_PERIOD, .tv_nsec = 0 };
+            m_natQueryTimer->setInterval(interval);
+            m_natQueryTimer->reset();
+        }
     }
     else if (timer.getFd() == m_natTimeoutTimer->getFd())
     {
@@ -3114,51 +3353,103 @@ void NatOrch::doTask(SelectableTimer &timer)
     }
 }
 
-void NatOrch::queryCounters(void)
+/* Visit the entries of one table of a time-sliced walk, resuming after the
+ * cursor key. Returns false when the time budget ran out before the end of
+ * the table, the next call then continues from where this one stopped. */
+template <typename EntryMap, typename Visitor>
+static bool walkNatEntries(EntryMap &entries, typename EntryMap::key_type &lastKey, NatQueryCursor &cursor,
+                           int stage, const struct timespec &deadline, uint32_t &count, Visitor visit)
 {
-    SWSS_LOG_ENTER();
-
-    uint32_t         queried_entries = 0;
-    struct timespec  time_now, time_end, time_spent;
-
-    if (clock_gettime (CLOCK_MONOTONIC, &time_now) < 0)
+    if (cursor.stage > stage)
     {
-        return;
+        return true;
     }
 
-    NatEntry::iterator natIter = m_natEntries.begin();
-    while (natIter != m_natEntries.end())
+    auto iter = cursor.started ? entries.upper_bound(lastKey) : entries.begin();
+    while (iter != entries.end())
     {
-        getNatCounters(natIter);
+        if ((count % NAT_QUERY_TIME_CHECK_ENTRIES) == 0)
+        {
+            struct timespec time_now;
 
-        queried_entries++;
-        natIter++;
+            if ((clock_gettime(CLOCK_MONOTONIC, &time_now) == 0) &&
+                ((time_now.tv_sec > deadline.tv_sec) ||
+                 ((time_now.tv_sec == deadline.tv_sec) && (time_now.tv_nsec >= deadline.tv_nsec))))
+            {
+                return false;
+            }
+        }
+
+        lastKey = iter->first;
+        cursor.started = true;
+
+        visit(iter);
+
+        count++;
+        iter++;
     }
 
-    NaptEntry::iterator naptIter = m_naptEntries.begin();
-    while (naptIter != m_naptEntries.end())
-    {
-        getNaptCounters(naptIter);
+    cursor.stage = stage + 1;
+    cursor.started = false;
 
-        queried_entries++;
-        naptIter++;
+    return true;
+}
+
+static struct timespec getQueryDeadline(const struct timespec &start)
+{
+    struct timespec deadline = start;
+
+    deadline.tv_nsec += NAT_QUERY_TIME_BUDGET_MSEC * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_sec += deadline.tv_nsec / 1000000000L;
+        deadline.tv_nsec %= 1000000000L;
     }
-    TwiceNatEntry::iterator tnatIter = m_twiceNatEntries.begin();
-    while (tnatIter != m_twiceNatEntries.end())
+
+    return deadline;
+}
+
+void NatOrch::resetQueryCursors(void)
+{
+    m_counterCursor = NatQueryCursor();
+    m_hitBitCursor = NatQueryCursor();
+
+    if (m_natQuerySliced)
     {
-        getTwiceNatCounters(tnatIter);
+        m_natQuerySliced = false;
 
-        queried_entries++;
-        tnatIter++;
+        auto interval = timespec { .tv_sec = NAT_HITBIT_N_CNTRS_QUERY_PERIOD, .tv_nsec = 0 };
+        m_natQueryTimer->setInterval(interval);
     }
+}
 
-    TwiceNaptEntry::iterator tnaptIter = m_twiceNaptEntries.begin();
-    while (tnaptIter != m_twiceNaptEntries.end())
+void NatOrch::queryCounters(void)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t         queried_entries = 0;
+    struct timespec  time_now, time_end, time_spent, deadline;
+    NatQueryCursor  &cursor = m_counterCursor;
+
+    if (clock_gettime (CLOCK_MONOTONIC, &time_now) < 0)
     {
-        getTwiceNaptCounters(tnaptIter);
+        return;
+    }
+    deadline = getQueryDeadline(time_now);
 
-        queried_entries++;
-        tnaptIter++;
+    bool done =
+        walkNatEntries(m_natEntries, cursor.natKey, cursor, 0, deadline, queried_entries,
+                       [this](const NatEntry::iterator &iter) { getNatCounters(iter); }) &&
+        walkNatEntries(m_naptEntries, cursor.naptKey, cursor, 1, deadline, queried_entries,
+                       [this](const NaptEntry::iterator &iter) { getNaptCounters(iter); }) &&
+        walkNatEntries(m_twiceNatEntries, cursor.twiceNatKey, cursor, 2, deadline, queried_entries,
+                       [this](const TwiceNatEntry::iterator &iter) { getTwiceNatCounters(iter); }) &&
+        walkNatEntries(m_twiceNaptEntries, cursor.twiceNaptKey, cursor, 3, deadline, queried_entries,
+                       [this](const TwiceNaptEntry::iterator &iter) { getTwiceNaptCounters(iter); });
+
+    if (done)
+    {
+        cursor = NatQueryCursor();
     }
 
     if (clock_gettime (CLOCK_MONOTONIC, &time_end) < 0)
@@ -3169,8 +3460,9 @@ void NatOrch::queryCounters(void)
 
     if (queried_entries)
     {
-        SWSS_LOG_DEBUG("Time spent in querying counters for %u NAT/NAPT entries = %lu secs, %lu msecs",
-                       queried_entries, time_spent.tv_sec, (time_spent.tv_nsec / 1000000UL));
+        SWSS_LOG_DEBUG("Time spent in querying counters for %u NAT/NAPT entries = %lu secs, %lu msecs%s",
+                       queried_entries, time_spent.tv_sec, (time_spent.tv_nsec / 1000000UL),
+                       done ? "" : ", to be continued");
     }
 }
 
@@ -3305,18 +3597,19 @@ void NatOrch::queryHitBits(void)
     SWSS_LOG_ENTER();
 
     uint32_t         queried_entries = 0;
-    struct timespec  time_now, time_end, time_spent;
+    struct timespec  time_now, time_end, time_spent, deadline;
+    NatQueryCursor  &cursor = m_hitBitCursor;
 
     if (clock_gettime (CLOCK_MONOTONIC, &time_now) < 0)
     {
         return;
     }
+    deadline = getQueryDeadline(time_now);
 
     /* Remove the NAT entries that are aged out.
      * Query the NAT entries for their activity in the hardware
      * and update the active timeout. */
-    NatEntry::iterator natIter = m_natEntries.begin();
-    while (natIter != m_natEntries.end())
+    auto natAging = [&](const NatEntry::iterator &natIter)
     {
         if (checkIfNatEntryIsActive(natIter, time_now.tv_sec))
         {
@@ -3334,17 +3627,14 @@ void NatOrch::queryHitBits(void)
                     std::string key = natIter->first.to_string();
                     setTimeoutNotifier->send("AGEOUT-SINGLE-NAT", key, fvVector);
                 }
-            } 
+            }
         }
-        queried_entries++;
-        natIter++;
-    }
+    };
 
     /* Remove the NAPT entries that are aged out.
      * Query the NAPT entries for their activity in the hardware
      * and update the active timeout. */
-    NaptEntry::iterator naptIter = m_naptEntries.begin();
-    while (naptIter != m_naptEntries.end())
+    auto naptAging = [&](const NaptEntry::iterator &naptIter)
     {
         if (checkIfNaptEntryIsActive(naptIter, time_now.tv_sec))
         {
@@ -3365,15 +3655,12 @@ void NatOrch::queryHitBits(void)
                 }
             }
         }
-        queried_entries++;
-        naptIter++;
-    }
+    };
 
     /* Remove the Twice NAT entries that are aged out.
      * Query the Twice NAT entries for their activity in the hardware
      * and update the active timeout. */
-    TwiceNatEntry::iterator twiceNatIter = m_twiceNatEntries.begin();
-    while (twiceNatIter != m_twiceNatEntries.end())
+    auto twiceNatAging = [&](const TwiceNatEntry::iterator &twiceNatIter)
     {
         if (checkIfTwiceNatEntryIsActive(twiceNatIter, time_now.tv_sec))
         {
@@ -3393,15 +3680,12 @@ void NatOrch::queryHitBits(void)
                 }
             }
         }
-        queried_entries++;
-        twiceNatIter++;
-    }
+    };
 
     /* Remove the Twice NAPT entries that are aged out.
      * Query the Twice NAPT entries for their activity in the hardware
      * and update the active timeout. */
-    TwiceNaptEntry::iterator twiceNaptIter = m_twiceNaptEntries.begin();
-    while (twiceNaptIter != m_twiceNaptEntries.end())
+    auto twiceNaptAging = [&](const TwiceNaptEntry::iterator &twiceNaptIter)
     {
         if (checkIfTwiceNaptEntryIsActive(twiceNaptIter, time_now.tv_sec))
         {
@@ -3417,15 +3701,25 @@ void NatOrch::queryHitBits(void)
                 if (time_now.tv_sec - twiceNaptIter->second.activeTime >= timeout)
                 {
                     std::vector<FieldValueTuple> fvVector;
-                    std::string key = (twiceNaptIter->first.prototype + ":" + twiceNaptIter->first.src_ip.to_string() + ":" + to_string(twiceNaptIter->first.src_l4_port) + 
+                    std::string key = (twiceNaptIter->first.prototype + ":" + twiceNaptIter->first.src_ip.to_string() + ":" + to_string(twiceNaptIter->first.src_l4_port) +
                                        ":" + twiceNaptIter->first.dst_ip.to_string() + ":" + to_string(twiceNaptIter->first.dst_l4_port));
                     setTimeoutNotifier->send("AGEOUT-TWICE-NAPT", key, fvVector);
                 }
             }
         }
-        queried_entries++;
-        twiceNaptIter++;
+    };
+
+    bool done =
+        walkNatEntries(m_natEntries, cursor.natKey, cursor, 0, deadline, queried_entries, natAging) &&
+        walkNatEntries(m_naptEntries, cursor.naptKey, cursor, 1, deadline, queried_entries, naptAging) &&
+        walkNatEntries(m_twiceNatEntries, cursor.twiceNatKey, cursor, 2, deadline, queried_entries, twiceNatAging) &&
+        walkNatEntries(m_twiceNaptEntries, cursor.twiceNaptKey, cursor, 3, deadline, queried_entries, twiceNaptAging);
+
+    if (done)
+    {
+        cursor = NatQueryCursor();
     }
+
     if (clock_gettime (CLOCK_MONOTONIC, &time_end) < 0)
     {
         return;
@@ -3434,8 +3728,9 @@ void NatOrch::queryHitBits(void)
 
     if (queried_entries)
     {
-        SWSS_LOG_DEBUG("Time spent in querying hardware hit-bits for %u NAT/NAPT entries = %lu secs, %lu msecs",
-                       queried_entries, time_spent.tv_sec, (time_spent.tv_nsec / 1000000UL));
+        SWSS_LOG_DEBUG("Time spent in querying hardware hit-bits for %u NAT/NAPT entries = %lu secs, %lu msecs%s",
+                       queried_entries, time_spent.tv_sec, (time_spent.tv_nsec / 1000000UL),
+                       done ? "" : ", to be continued");
     }
 }
 
@@ -29,6 +29,9 @@
 #include "routeorch.h"
 #include "nexthopgroupkey.h"
 #include "notificationproducer.h"
+#include "bulker.h"
+#include <deque>
+#include <functional>
 #ifdef DEBUG_FRAMEWORK
 #include "debugdumporch.h"
 #endif
@@ -37,6 +40,9 @@
 #define NAT_HITBIT_N_CNTRS_QUERY_PERIOD   5        // 5 secs
 #define NAT_CONNTRACK_TIMEOUT_PERIOD      86400    // 1 day
 #define NAT_HITBIT_QUERY_MULTIPLE         6        // Hit bits are queried every 30 secs
+#define NAT_QUERY_TIME_BUDGET_MSEC        50       // Max time a counter/hit-bit query holds the event loop
+#define NAT_QUERY_SLICE_INTERVAL_MSEC     100      // Delay before an unfinished query is resumed
+#define NAT_QUERY_TIME_CHECK_ENTRIES      64       // Entries queried between two time budget checks
 
 struct NatEntryValue
 {
@@ -176,6 +182,29 @@ struct DnatEntries
 
 typedef std::map<IpAddress, DnatEntries> DnatNhResolvCache;
 
+/* Completion of a NAT entry create/remove, called with the SAI status once
+ * the request has been executed, which is deferred while bulking. */
+typedef std::function<bool(sai_status_t)> NatBulkCallback;
+
+struct NatBulkContext
+{
+    sai_status_t     status;
+    NatBulkCallback  done;
+};
+
+/* Position of a time-sliced walk over the NAT, NAPT, Twice NAT and Twice NAPT
+ * entries, the walk resumes after the last visited key of the current stage. */
+struct NatQueryCursor
+{
+    bool               pending = false;     /* A walk is requested or in progress */
+    int                stage = 0;           /* Entry table being walked */
+    bool               started = false;     /* A key of the current stage has been visited */
+    IpAddress          natKey;
+    NaptEntryKey       naptKey;
+    TwiceNatEntryKey   twiceNatKey;
+    TwiceNaptEntryKey  twiceNaptKey;
+};
+
 class NatOrch: public Orch, public Subject, public Observer
 {
 public:
@@ -242,6 +271,14 @@ private:
     int              maxAllowedSNatEntries;
     string           admin_mode;
 
+    EntityBulker<sai_nat_api_t>  m_natBulker;
+    std::deque<NatBulkContext>   m_natBulkContexts;
+    bool                         m_natBulking;
+
+    NatQueryCursor   m_counterCursor;
+    NatQueryCursor   m_hitBitCursor;
+    bool             m_natQuerySliced;
+
     void doTask(Consumer& consumer);
     void doTask(SelectableTimer &timer);
     void doTask(NotificationConsumer& consumer);
@@ -284,9 +321,13 @@ private:
     bool removeHwTwiceNaptEntry(const TwiceNaptEntryKey &key);
     bool addHwDnatEntry(const IpAddress &ip_address);
     bool addHwDnaptEntry(const NaptEntryKey &key);
-    bool removeHwDnatEntry(const IpAddress &dstIp);
-    bool removeHwDnaptEntry(const NaptEntryKey &key);
+    bool removeHwDnatEntry(const IpAddress &dstIp, bool eraseEntry = false);
+    bool removeHwDnaptEntry(const NaptEntryKey &key, bool eraseEntry = false);
     bool addHwDnatPoolEntry(const IpAddress &dstIp);
+    bool createHwNatEntry(const sai_nat_entry_t &nat_entry, uint32_t attr_count,
+                          const sai_attribute_t *attr_list, NatBulkCallback done);
+    bool removeHwNatEntry(const sai_nat_entry_t &nat_entry, NatBulkCallback done);
+    bool flushNatBulker(void);
     bool removeHwDnatPoolEntry(const IpAddress &dstIp);
 
     bool checkIfNatEntryIsActive(const NatEntry::iterator &iter, time_t now);
@@ -303,6 +344,7 @@ private:
     void clearCounters(void);
     void queryCounters(void);
     void queryHitBits(void);
+    void resetQueryCursors(void);
     bool isNatEnabled(void);
     bool getNatCounters(const NatEntry::iterator &iter);
     bool getTwiceNatCounters(const TwiceNatEntry::iterator &iter);
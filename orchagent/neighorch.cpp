@@ -122,13 +122,14 @@ void NeighOrch::processFDBFlushUpdate(const FdbFlushUpdate& update)
     for (auto entry : update.entries)
     {
         // Get Vlan object
-        Port vlan;
-        if (!m_portsOrch->getPort(entry.bv_id, vlan))
+        const Port *vlanPtr = m_portsOrch->getPortPtr(entry.bv_id);
+        if (vlanPtr == nullptr)
         {
             SWSS_LOG_NOTICE("FdbOrch notification: Failed to locate vlan port \
                              from bv_id 0x%" PRIx64 ".", entry.bv_id);
             continue;
         }
+        const Port &vlan = *vlanPtr;
         SWSS_LOG_INFO("Flushing ARP for port: %s, VLAN: %s",
                       vlan.m_alias.c_str(), update.port.m_alias.c_str());
 
@@ -173,6 +174,12 @@ void NeighOrch::update(SubjectType type, void *cntx)
     return;
 }
 
+/* Neighbors are added on router interfaces */
+vector<string> NeighOrch::getWarmStartDependencies() const
+{
+    return { APP_INTF_TABLE_NAME };
+}
+
 bool NeighOrch::hasNextHop(const NextHopKey &nexthop)
 {
     // First check if mux has NH
@@ -200,16 +207,16 @@ bool NeighOrch::addNextHop(const NextHopKey &nh)
 {
     SWSS_LOG_ENTER();
 
-    Port p;
-    if (!gPortsOrch->getPort(nh.alias, p))
+    const Port *p = gPortsOrch->getPortPtr(nh.alias);
+    if (p == nullptr)
     {
         SWSS_LOG_ERROR("Neighbor %s seen on port %s which doesn't exist",
                         nh.ip_address.to_string().c_str(), nh.alias.c_str());
         return false;
     }
-    if (p.m_type == Port::SUBPORT)
+    if (p->m_type == Port::SUBPORT)
     {
-        if (!gPortsOrch->getPort(p.m_parent_port_id, p))
+        if ((p = gPortsOrch->getPortPtr(p->m_parent_port_id)) == nullptr)
         {
             SWSS_LOG_ERROR("Neighbor %s seen on sub interface %s whose parent port doesn't exist",
                             nh.ip_address.to_string().c_str(), nh.alias.c_str());
@@ -324,7 +331,7 @@ bool NeighOrch::addNextHop(const NextHopKey &nh)
     // flag should be set on it.
     // This scenario may happen under race condition where buffered neighbor event
     // is processed after incoming port is down.
-    if (p.m_oper_status == SAI_PORT_OPER_STATUS_DOWN)
+    if (p->m_oper_status == SAI_PORT_OPER_STATUS_DOWN)
     {
         if (setNextHopFlag(nexthop, NHFLAGS_IFDOWN) == false)
         {
@@ -799,15 +806,15 @@ void NeighOrch::doTask(Consumer &consumer)
 
         if (op == SET_COMMAND)
         {
-            Port p;
-            if (!gPortsOrch->getPort(alias, p))
+            const Port *p = gPortsOrch->getPortPtr(alias);
+            if (p == nullptr)
             {
                 SWSS_LOG_INFO("Port %s doesn't exist", alias.c_str());
                 it++;
                 continue;
             }
 
-            if (!p.m_rif_id)
+            if (!p->m_rif_id)
             {
                 SWSS_LOG_INFO("Router interface doesn't exist on %s", alias.c_str());
                 it++;
@@ -961,20 +968,20 @@ bool NeighOrch::addNeighbor(NeighborContext& ctx)
         if (m_syncdNeighbors.find(temp_entry) != m_syncdNeighbors.end())
         {
             // Neighbor already exists on another VLAN. If they belong to the same VRF, delete the old neighbor
-            Port existing_vlan, new_vlan;
-            if (!gPortsOrch->getPort(vlan_port, new_vlan))
+            const Port *existing_vlan, *new_vlan;
+            if ((new_vlan = gPortsOrch->getPortPtr(vlan_port)) == nullptr)
             {
                 SWSS_LOG_ERROR("Failed to get port for %s", vlan_port.c_str());
                 return false;
             }
-            if (!gPortsOrch->getPort(alias, existing_vlan))
+            if ((existing_vlan = gPortsOrch->getPortPtr(alias)) == nullptr)
             {
                 SWSS_LOG_ERROR("Failed to get port for %s", alias.c_str());
                 return false;
             }
-            if (existing_vlan.m_vr_id == new_vlan.m_vr_id)
+            if (existing_vlan->m_vr_id == new_vlan->m_vr_id)
             {
-                std::string vrf_name = gDirectory.get<VRFOrch*>()->getVRFname(existing_vlan.m_vr_id);
+                std::string vrf_name = gDirectory.get<VRFOrch*>()->getVRFname(existing_vlan->m_vr_id);
                 if (vrf_name.empty())
                 {
                     SWSS_LOG_NOTICE("Neighbor %s already learned on %s, removing before adding new neighbor", ip_address.to_string().c_str(), vlan_port.c_str());
@@ -1714,15 +1721,15 @@ void NeighOrch::doVoqSystemNeighTask(Consumer &consumer)
 
         if (op == SET_COMMAND)
         {
-            Port p;
-            if (!gPortsOrch->getPort(alias, p))
+            const Port *p = gPortsOrch->getPortPtr(alias);
+            if (p == nullptr)
             {
                 SWSS_LOG_INFO("Port %s doesn't exist", alias.c_str());
                 it++;
                 continue;
             }
 
-            if (!p.m_rif_id)
+            if (!p->m_rif_id)
             {
                 SWSS_LOG_INFO("Router interface doesn't exist on %s", alias.c_str());
                 it++;
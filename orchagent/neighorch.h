@@ -71,6 +71,8 @@ public:
     NeighOrch(DBConnector *db, string tableName, IntfsOrch *intfsOrch, FdbOrch *fdbOrch, PortsOrch *portsOrch, DBConnector *chassisAppDb);
     ~NeighOrch();
 
+    std::vector<std::string> getWarmStartDependencies() const override;
+
     bool hasNextHop(const NextHopKey&);
     bool isNeighborResolved(const NextHopKey&);
     bool addNextHop(const NextHopKey&);
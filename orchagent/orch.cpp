@@ -1,5 +1,6 @@
 #include <inttypes.h>
 #include <stdexcept>
+#include <chrono>
 #include <sys/time.h>
 #include "timestamp.h"
 #include "orch.h"
@@ -16,6 +17,7 @@
 using namespace swss;
 
 int gBatchSize = 0;
+size_t gSnapshotWindowSize = DEFAULT_SNAPSHOT_WINDOW_SIZE;
 
 Orch::Orch(DBConnector *db, const string tableName, int pri)
 {
@@ -158,6 +160,8 @@ size_t ConsumerBase::addToSync(const std::deque<KeyOpFieldsValuesTuple> &entries
 // TODO: Table should be const
 size_t ConsumerBase::refillToSync(Table* table)
 {
+    clearPrefetchedData();
+
     std::deque<KeyOpFieldsValuesTuple> entries;
     vector<string> keys;
     table->getKeys(keys);
@@ -178,8 +182,82 @@ size_t ConsumerBase::refillToSync(Table* table)
     return addToSync(entries);
 }
 
+size_t ConsumerBase::readTableSnapshot(const DBConnector *db, const string &tableName, const string &separator,
+                                       const std::function<void(KeyOpFieldsValuesTuple &&)> &onEntry)
+{
+    return swss::readTableSnapshot(db, tableName, separator, gSnapshotWindowSize, onEntry);
+}
+
+void ConsumerBase::addSnapshotEntry(KeyOpFieldsValuesTuple &&entry)
+{
+    if (m_toSync.find(kfvKey(entry)) != m_toSync.end())
+    {
+        addToSync(entry);
+        return;
+    }
+
+    /* Record incoming tasks */
+    Recorder::Instance().swss.record(dumpTuple(entry));
+
+    string key = kfvKey(entry);
+    m_toSync.emplace(std::move(key), std::move(entry));
+}
+
+size_t ConsumerBase::refillToSync(const DBConnector *db, const string &tableName, const string &separator)
+{
+    clearPrefetchedData();
+
+    auto start = chrono::steady_clock::now();
+    size_t count;
+
+    try
+    {
+        count = readTableSnapshot(db, tableName, separator,
+                                  [this](KeyOpFieldsValuesTuple &&entry) { addSnapshotEntry(std::move(entry)); });
+    }
+    catch (const exception &e)
+    {
+        SWSS_LOG_WARN("Failed to read snapshot of %s: %s, reading it key by key", tableName.c_str(), e.what());
+
+        auto table = Table(db, tableName);
+        return refillToSync(&table);
+    }
+
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    addSnapshotStats(count, ms);
+    SWSS_LOG_NOTICE("Refilled %zu entries of %s in %.1f ms (%.0f entries/s)",
+                    count, tableName.c_str(), ms, ms > 0 ? count * 1000 / ms : 0.0);
+
+    return count;
+}
+
+void ConsumerBase::addSnapshotStats(size_t entries, double ms)
+{
+    m_snapshotEntries += entries;
+    m_snapshotMs += ms;
+}
+
+void ConsumerBase::setPrefetchedData(std::deque<KeyOpFieldsValuesTuple> &&entries)
+{
+    m_prefetchedData = std::move(entries);
+    m_hasPrefetchedData = true;
+}
+
+void ConsumerBase::clearPrefetchedData()
+{
+    m_prefetchedData.clear();
+    m_hasPrefetchedData = false;
+}
+
 size_t ConsumerBase::refillToSync()
 {
+    if (m_hasPrefetchedData)
+    {
+        size_t size = addToSync(m_prefetchedData);
+        clearPrefetchedData();
+        return size;
+    }
+
     auto subTable = dynamic_cast<SubscriberStateTable *>(getSelectable());
     if (subTable != NULL)
     {
@@ -199,16 +277,13 @@ size_t ConsumerBase::refillToSync()
     if (consumerTable != NULL)
     {
         // consumerTable is either ConsumerStateTable or ConsumerTable
-        auto db = consumerTable->getDbConnector();
-        auto table = Table(db, tableName);
-        return refillToSync(&table);
+        return refillToSync(consumerTable->getDbConnector(), tableName, getConsumerTable()->getTableNameSeparator());
     }
     auto zmqTable = dynamic_cast<ZmqConsumerStateTable *>(getSelectable());
     if (zmqTable != NULL)
     {
         auto db = zmqTable->getDbConnector();
-        auto table = Table(db, tableName);
-        return refillToSync(&table);
+        return refillToSync(db, tableName, getConsumerTable()->getTableNameSeparator());
     }
     return 0;
 }
@@ -307,6 +382,259 @@ bool Orch::bake()
     return true;
 }
 
+namespace
+{
+    struct ObjectNameRegistry
+    {
+        // Keys are node-based, the names pointed to by the entries are stable until erased
+        unordered_map<string, object_handle_t> handles;
+        struct Entry
+        {
+            const string *name;
+            size_t refs;
+        };
+        vector<Entry> entries;
+        vector<object_handle_t> freeHandles;
+    };
+
+    // Never destroyed, object_dependents of static objects release their handles at exit
+    ObjectNameRegistry &objectNames()
+    {
+        static auto *registry = new ObjectNameRegistry();
+        return *registry;
+    }
+
+    /*
+     * Calls func(table, object_name) for each "table:object_name" item of a reference list
+     * like "BUFFER_PROFILE_TABLE:profile0,BUFFER_PROFILE_TABLE:profile1".
+     */
+    template <typename Func>
+    void forEachReferencedObject(const string &referenced_objs, Func func)
+    {
+        size_t start = 0;
+        while (start < referenced_objs.size())
+        {
+            auto end = referenced_objs.find(list_item_delimiter, start);
+            if (end == string::npos)
+            {
+                end = referenced_objs.size();
+            }
+
+            auto pos = referenced_objs.find(delimiter, start);
+            if (pos != string::npos && pos < end)
+            {
+                func(referenced_objs.substr(start, pos - start), referenced_objs.substr(pos + 1, end - pos - 1));
+            }
+
+            start = end + 1;
+        }
+    }
+
+    referenced_object *findReferencedObject(type_map &type_maps, const string &table, const string &obj_name)
+    {
+        auto type_it = type_maps.find(table);
+        if (type_it == type_maps.end() || !type_it->second)
+        {
+            return nullptr;
+        }
+
+        auto obj_it = type_it->second->find(obj_name);
+        if (obj_it == type_it->second->end())
+        {
+            return nullptr;
+        }
+
+        return &obj_it->second;
+    }
+}
+
+object_handle_t ObjectNames::acquire(const string &name)
+{
+    auto &registry = objectNames();
+
+    auto it = registry.handles.find(name);
+    if (it != registry.handles.end())
+    {
+        registry.entries[it->second].refs++;
+        return it->second;
+    }
+
+    object_handle_t handle;
+    if (!registry.freeHandles.empty())
+    {
+        handle = registry.freeHandles.back();
+        registry.freeHandles.pop_back();
+    }
+    else
+    {
+        handle = static_cast<object_handle_t>(registry.entries.size());
+        registry.entries.push_back({ nullptr, 0 });
+    }
+
+    it = registry.handles.emplace(name, handle).first;
+    registry.entries[handle] = { &it->first, 1 };
+
+    return handle;
+}
+
+void ObjectNames::acquire(object_handle_t handle)
+{
+    objectNames().entries.at(handle).refs++;
+}
+
+void ObjectNames::release(object_handle_t handle)
+{
+    auto &registry = objectNames();
+    auto &entry = registry.entries.at(handle);
+
+    if (--entry.refs == 0)
+    {
+        registry.handles.erase(*entry.name);
+        entry.name = nullptr;
+        registry.freeHandles.push_back(handle);
+    }
+}
+
+bool ObjectNames::find(const string &name, object_handle_t &handle)
+{
+    auto &registry = objectNames();
+
+    auto it = registry.handles.find(name);
+    if (it == registry.handles.end())
+    {
+        return false;
+    }
+
+    handle = it->second;
+    return true;
+}
+
+const string &ObjectNames::name(object_handle_t handle)
+{
+    return *objectNames().entries.at(handle).name;
+}
+
+object_dependents::object_dependents(const object_dependents &other) :
+    m_handles(other.m_handles),
+    m_positions(other.m_positions)
+{
+    for (auto handle : m_handles)
+    {
+        ObjectNames::acquire(handle);
+    }
+}
+
+object_dependents::object_dependents(object_dependents &&other) :
+    m_handles(std::move(other.m_handles)),
+    m_positions(std::move(other.m_positions))
+{
+    other.m_handles.clear();
+    other.m_positions.clear();
+}
+
+object_dependents &object_dependents::operator=(const object_dependents &other)
+{
+    if (this != &other)
+    {
+        object_dependents copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+object_dependents &object_dependents::operator=(object_dependents &&other)
+{
+    if (this != &other)
+    {
+        clear();
+        m_handles.swap(other.m_handles);
+        m_positions.swap(other.m_positions);
+    }
+    return *this;
+}
+
+void object_dependents::clear()
+{
+    for (auto handle : m_handles)
+    {
+        ObjectNames::release(handle);
+    }
+    m_handles.clear();
+    m_positions.clear();
+}
+
+bool object_dependents::insert(object_handle_t handle)
+{
+    if (!m_positions.emplace(handle, m_handles.size()).second)
+    {
+        return false;
+    }
+
+    ObjectNames::acquire(handle);
+    m_handles.push_back(handle);
+    return true;
+}
+
+size_t object_dependents::erase(object_handle_t handle)
+{
+    auto it = m_positions.find(handle);
+    if (it == m_positions.end())
+    {
+        return 0;
+    }
+
+    // Move the last one into the hole
+    auto pos = it->second;
+    m_positions.erase(it);
+    if (pos != m_handles.size() - 1)
+    {
+        m_handles[pos] = m_handles.back();
+        m_positions[m_handles[pos]] = pos;
+    }
+    m_handles.pop_back();
+
+    ObjectNames::release(handle);
+
+    return 1;
+}
+
+bool object_dependents::insert(const string &name)
+{
+    auto handle = ObjectNames::acquire(name);
+    bool inserted = insert(handle);
+    ObjectNames::release(handle);
+    return inserted;
+}
+
+size_t object_dependents::erase(const string &name)
+{
+    object_handle_t handle;
+    return ObjectNames::find(name, handle) ? erase(handle) : 0;
+}
+
+size_t object_dependents::count(const string &name) const
+{
+    object_handle_t handle;
+    return ObjectNames::find(name, handle) && contains(handle) ? 1 : 0;
+}
+
+object_dependents::const_iterator object_dependents::find(const string &name) const
+{
+    object_handle_t handle;
+    if (!ObjectNames::find(name, handle))
+    {
+        return end();
+    }
+
+    auto it = m_positions.find(handle);
+    if (it == m_positions.end())
+    {
+        return end();
+    }
+
+    return const_iterator(m_handles.begin() + it->second);
+}
+
 /*
 - Validates reference has proper format which is object_name
 - validates table_name exists
@@ -345,7 +673,7 @@ bool Orch::parseReference(type_map &type_maps, string &ref_in, const string &typ
         SWSS_LOG_ERROR("not recognized type:%s\n", type_name.c_str());
         return false;
     }
-    auto obj_map = type_maps[type_name];
+    auto &obj_map = type_it->second;
     auto obj_it = obj_map->find(ref_in);
     if (obj_it == obj_map->end())
     {
@@ -392,7 +720,7 @@ ref_resolve_status Orch::resolveFieldRefValue(
             {
                 return ref_resolve_status::empty;
             }
-            sai_object = (*(type_maps[ref_type_name]))[object_name].m_saiObjectId;
+            sai_object = findReferencedObject(type_maps, ref_type_name, object_name)->m_saiObjectId;
             referenced_object_name = ref_type_name + delimiter + object_name;
             hit = true;
         }
@@ -413,25 +741,33 @@ void Orch::removeMeFromObjsReferencedByMe(
     const string &old_referenced_obj_name,
     bool remove_field)
 {
-    vector<string> objects = tokenize(old_referenced_obj_name, list_item_delimiter);
-    for (auto &obj : objects)
-    {
-        // obj_name references token
-        auto tokens = tokenize(obj, delimiter);
-        auto &referenced_table = tokens[0];
-        auto &ref_obj_name = tokens[1];
-        auto &old_referenced_obj = (*type_maps[referenced_table])[ref_obj_name];
-        old_referenced_obj.m_objsDependingOnMe.erase(obj_name);
-        SWSS_LOG_INFO("Obj %s.%s Field %s: Remove reference to %s %s (now %s)",
+    object_handle_t handle;
+    bool interned = ObjectNames::find(obj_name, handle);
+
+    forEachReferencedObject(old_referenced_obj_name, [&](const string &referenced_table, const string &ref_obj_name) {
+        auto old_referenced_obj = findReferencedObject(type_maps, referenced_table, ref_obj_name);
+        if (!old_referenced_obj)
+        {
+            return;
+        }
+
+        if (interned)
+        {
+            old_referenced_obj->m_objsDependingOnMe.erase(handle);
+        }
+        SWSS_LOG_INFO("Obj %s.%s Field %s: Remove reference to %s %s (now %zu)",
                       table.c_str(), obj_name.c_str(), field.c_str(),
                       referenced_table.c_str(), ref_obj_name.c_str(),
-                      to_string(old_referenced_obj.m_objsDependingOnMe.size()).c_str());
-    }
+                      old_referenced_obj->m_objsDependingOnMe.size());
+    });
 
     if (remove_field)
     {
-        auto &referencing_object = (*type_maps[table])[obj_name];
-        referencing_object.m_objsReferencingByMe.erase(field);
+        auto referencing_object = findReferencedObject(type_maps, table, obj_name);
+        if (referencing_object)
+        {
+            referencing_object->m_objsReferencingByMe.erase(field);
+        }
     }
 }
 
@@ -446,24 +782,26 @@ void Orch::setObjectReference(
     auto field_ref = obj.m_objsReferencingByMe.find(field);
 
     if (field_ref != obj.m_objsReferencingByMe.end())
+    {
         removeMeFromObjsReferencedByMe(type_maps, table, obj_name, field, field_ref->second, false);
-
-    obj.m_objsReferencingByMe[field] = referenced_obj;
+        field_ref->second = referenced_obj;
+    }
+    else
+    {
+        obj.m_objsReferencingByMe.emplace(field, referenced_obj);
+    }
 
     // Add the reference to the new object being referenced
-    vector<string> objs = tokenize(referenced_obj, list_item_delimiter);
-    for (auto &obj : objs)
-    {
-        auto tokens = tokenize(obj, delimiter);
-        auto &referenced_table = tokens[0];
-        auto &referenced_obj_name = tokens[1];
+    auto handle = ObjectNames::acquire(obj_name);
+    forEachReferencedObject(referenced_obj, [&](const string &referenced_table, const string &referenced_obj_name) {
         auto &new_obj_being_referenced = (*type_maps[referenced_table])[referenced_obj_name];
-        new_obj_being_referenced.m_objsDependingOnMe.insert(obj_name);
-        SWSS_LOG_INFO("Obj %s.%s Field %s: Add reference to %s %s (now %s)",
+        new_obj_being_referenced.m_objsDependingOnMe.insert(handle);
+        SWSS_LOG_INFO("Obj %s.%s Field %s: Add reference to %s %s (now %zu)",
                       table.c_str(), obj_name.c_str(), field.c_str(),
                       referenced_table.c_str(), referenced_obj_name.c_str(),
-                      to_string(new_obj_being_referenced.m_objsDependingOnMe.size()).c_str());
-    }
+                      new_obj_being_referenced.m_objsDependingOnMe.size());
+    });
+    ObjectNames::release(handle);
 }
 
 bool Orch::doesObjectExist(
@@ -473,12 +811,11 @@ bool Orch::doesObjectExist(
     const string &field,
     string &referenced_obj)
 {
-    auto &&searchRef = (*type_maps[table]).find(obj_name);
-    if (searchRef != (*type_maps[table]).end())
+    auto obj = findReferencedObject(type_maps, table, obj_name);
+    if (obj)
     {
-        auto &obj = searchRef->second;
-        auto &&searchReferencingObjectRef = obj.m_objsReferencingByMe.find(field);
-        if (searchReferencingObjectRef != obj.m_objsReferencingByMe.end())
+        auto &&searchReferencingObjectRef = obj->m_objsReferencingByMe.find(field);
+        if (searchReferencingObjectRef != obj->m_objsReferencingByMe.end())
         {
             referenced_obj = searchReferencingObjectRef->second;
             return true;
@@ -501,13 +838,13 @@ void Orch::removeObject(
 
     auto &obj = searchRef->second;
 
-    for (auto field_ref : obj.m_objsReferencingByMe)
+    for (auto &field_ref : obj.m_objsReferencingByMe)
     {
         removeMeFromObjsReferencedByMe(type_maps, table, obj_name, field_ref.first, field_ref.second, false);
     }
 
     // Update the field store
-    (*type_maps[table]).erase(obj_name);
+    (*type_maps[table]).erase(searchRef);
     SWSS_LOG_INFO("Obj %s:%s is removed from store", table.c_str(), obj_name.c_str());
 }
 
@@ -516,7 +853,8 @@ bool Orch::isObjectBeingReferenced(
     const string &table,
     const string &obj_name)
 {
-    return !(*type_maps[table])[obj_name].m_objsDependingOnMe.empty();
+    auto obj = findReferencedObject(type_maps, table, obj_name);
+    return obj && !obj->m_objsDependingOnMe.empty();
 }
 
 string Orch::objectReferenceInfo(
@@ -524,10 +862,11 @@ string Orch::objectReferenceInfo(
     const string &table,
     const string &obj_name)
 {
-    auto &objsDependingSet = (*type_maps[table])[obj_name].m_objsDependingOnMe;
-    for (auto &depObjName : objsDependingSet)
+    auto obj = findReferencedObject(type_maps, table, obj_name);
+    if (obj && !obj->m_objsDependingOnMe.empty())
     {
-        string hint = table + " " + obj_name + " one object: " + depObjName;
+        auto &objsDependingSet = obj->m_objsDependingOnMe;
+        string hint = table + " " + obj_name + " one object: " + *objsDependingSet.begin();
         hint += " reference count: " + to_string(objsDependingSet.size());
         return hint;
     }
@@ -601,7 +940,7 @@ ref_resolve_status Orch::resolveFieldRefArray(
                     SWSS_LOG_NOTICE("Failed to parse profile reference:%s\n", list_items[ind].c_str());
                     return ref_resolve_status::not_resolved;
                 }
-                sai_object_id_t sai_obj = (*(type_maps[ref_type_name]))[object_name].m_saiObjectId;
+                sai_object_id_t sai_obj = findReferencedObject(type_maps, ref_type_name, object_name)->m_saiObjectId;
                 SWSS_LOG_DEBUG("Resolved to sai_object:0x%" PRIx64 ", type:%s, name:%s", sai_obj, ref_type_name.c_str(), object_name.c_str());
                 sai_object_arr.push_back(sai_obj);
                 if (!object_name_list.empty())
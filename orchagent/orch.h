@@ -7,6 +7,9 @@
 #include <set>
 #include <memory>
 #include <utility>
+#include <functional>
+#include <iterator>
+#include <vector>
 
 extern "C" {
 #include <sai.h>
@@ -24,6 +27,7 @@ extern "C" {
 #include "macaddress.h"
 #include "response_publisher.h"
 #include "recorder.h"
+#include "tablesnapshot.h"
 
 const char delimiter           = ':';
 const char list_item_delimiter = ',';
@@ -34,6 +38,9 @@ const char range_specifier     = '-';
 const char config_db_key_delimiter = '|';
 const char state_db_key_delimiter  = '|';
 
+/* Window size of the table snapshots, set with -w */
+extern size_t gSnapshotWindowSize;
+
 #define INVM_PLATFORM_SUBSTRING "innovium"
 #define MLNX_PLATFORM_SUBSTRING "mellanox"
 #define BRCM_PLATFORM_SUBSTRING "broadcom"
@@ -61,10 +68,88 @@ typedef enum
     task_duplicated
 } task_process_status;
 
+/*
+ * Object names are interned into integer handles, so that the reference graph
+ * keeps and compares handles instead of strings.
+ * Handles are reference counted by the object_dependents holding them. A handle is
+ * freed, and may be reused for another name, once no object_dependents holds it.
+ */
+typedef uint32_t object_handle_t;
+
+class ObjectNames
+{
+public:
+    // Returns the handle of the name with a reference taken, to be dropped by release()
+    static object_handle_t acquire(const std::string &name);
+    static void acquire(object_handle_t handle);
+    static void release(object_handle_t handle);
+    // Returns false if the name has no handle, which means nothing refers to it
+    static bool find(const std::string &name, object_handle_t &handle);
+    static const std::string &name(object_handle_t handle);
+};
+
+/*
+ * Handles of the objects depending on an object.
+ * The position of each handle in the vector is indexed, so adding, removing and checking a dependent
+ * takes constant time and the reference count is the size of the vector.
+ * It provides the std::set<std::string> like interface by name used before it replaced the set.
+ */
+class object_dependents
+{
+public:
+    class const_iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef std::string value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const std::string *pointer;
+        typedef const std::string &reference;
+
+        explicit const_iterator(std::vector<object_handle_t>::const_iterator it) : m_it(it) {}
+
+        reference operator*() const { return ObjectNames::name(*m_it); }
+        pointer operator->() const { return &ObjectNames::name(*m_it); }
+        const_iterator &operator++() { ++m_it; return *this; }
+        const_iterator operator++(int) { auto tmp = *this; ++m_it; return tmp; }
+        bool operator==(const const_iterator &other) const { return m_it == other.m_it; }
+        bool operator!=(const const_iterator &other) const { return m_it != other.m_it; }
+
+    private:
+        std::vector<object_handle_t>::const_iterator m_it;
+    };
+
+    object_dependents() = default;
+    object_dependents(const object_dependents &other);
+    object_dependents(object_dependents &&other);
+    object_dependents &operator=(const object_dependents &other);
+    object_dependents &operator=(object_dependents &&other);
+    ~object_dependents() { clear(); }
+
+    bool insert(object_handle_t handle);
+    size_t erase(object_handle_t handle);
+    bool contains(object_handle_t handle) const { return m_positions.find(handle) != m_positions.end(); }
+
+    bool insert(const std::string &name);
+    size_t erase(const std::string &name);
+    size_t count(const std::string &name) const;
+    const_iterator find(const std::string &name) const;
+
+    size_t size() const { return m_handles.size(); }
+    bool empty() const { return m_handles.empty(); }
+    void clear();
+    const_iterator begin() const { return const_iterator(m_handles.begin()); }
+    const_iterator end() const { return const_iterator(m_handles.end()); }
+
+private:
+    std::vector<object_handle_t> m_handles;
+    std::unordered_map<object_handle_t, size_t> m_positions;
+};
+
 typedef struct
 {
     // m_objsDependingOnMe stores names (without table name) of all objects depending on the current obj
-    std::set<std::string> m_objsDependingOnMe;
+    object_dependents m_objsDependingOnMe;
     // m_objsReferencingByMe is a map from a field of the current object's to the object names it references
     // the object names are with table name
     // multiple objects being referenced are separated by ','
@@ -166,6 +251,34 @@ public:
 
     size_t refillToSync();
     size_t refillToSync(swss::Table* table);
+    size_t refillToSync(const swss::DBConnector *db, const std::string &tableName, const std::string &separator);
+
+    /* swss::readTableSnapshot() in windows of gSnapshotWindowSize keys */
+    static size_t readTableSnapshot(const swss::DBConnector *db, const std::string &tableName,
+                                    const std::string &separator,
+                                    const std::function<void(swss::KeyOpFieldsValuesTuple &&)> &onEntry);
+
+    /*
+     * Table content read ahead of bake(), e.g. by a warm start worker thread.
+     * Consumed by the next refillToSync() instead of reading the table again,
+     * dropped by the other refillToSync() overloads.
+     */
+    void setPrefetchedData(std::deque<swss::KeyOpFieldsValuesTuple> &&entries);
+    void clearPrefetchedData();
+
+    /* Entries read from table snapshots and the time spent reading them */
+    void addSnapshotStats(size_t entries, double ms);
+    size_t getSnapshotEntries() const { return m_snapshotEntries; }
+    double getSnapshotMs() const { return m_snapshotMs; }
+
+private:
+    std::deque<swss::KeyOpFieldsValuesTuple> m_prefetchedData;
+    bool m_hasPrefetchedData = false;
+
+    size_t m_snapshotEntries = 0;
+    double m_snapshotMs = 0;
+
+    void addSnapshotEntry(swss::KeyOpFieldsValuesTuple &&entry);
 };
 
 class Consumer : public ConsumerBase {
@@ -235,6 +348,13 @@ public:
     // otherwise fallback to cold start
     virtual bool bake();
 
+    // Tables whose consumers should settle before this orch processes its warm start data
+    virtual std::vector<std::string> getWarmStartDependencies() const { return {}; }
+
+    // Whether bake() reads the existing data of a consumer table with the no-argument
+    // refillToSync(), so that the data can be read ahead of bake()
+    virtual bool isWarmBakeRefilled(const std::string &tableName) const { return true; }
+
     /* Iterate all consumers in m_consumerMap and run doTask(Consumer) */
     virtual void doTask();
 
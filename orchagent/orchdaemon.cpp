@@ -1,9 +1,13 @@
 #include <unistd.h>
 #include <unordered_map>
 #include <chrono>
+#include <thread>
 #include <limits.h>
+#include <typeinfo>
+#include <cxxabi.h>
 #include "orchdaemon.h"
 #include "logger.h"
+#include "subscriberstatetable.h"
 #include <sairedis.h>
 #include "warm_restart.h"
 #include <iostream>
@@ -25,6 +29,12 @@ using namespace swss;
 /* orchagent heart beat message interval */
 #define HEART_BEAT_INTERVAL_MSECS 10 * 1000
 
+/* Warm start table read ahead worker threads */
+#define WARM_BAKE_MAX_WORKERS 8
+
+/* Maximum number of doTask rounds over the restored data at warm start */
+#define WARM_START_MAX_ROUNDS 8
+
 extern sai_switch_api_t*           sai_switch_api;
 extern sai_object_id_t             gSwitchId;
 extern string                      gMySwitchType;
@@ -921,46 +931,384 @@ void OrchDaemon::start()
  * Try to perform orchagent state restore and dynamic states sync up if
  * warm start request is detected.
  */
-bool OrchDaemon::warmRestoreAndSyncUp()
+namespace
 {
-    WarmStart::setWarmStartState("orchagent", WarmStart::INITIALIZED);
+    struct WarmBakeJob
+    {
+        Consumer *consumer;
+        deque<KeyOpFieldsValuesTuple> entries;
+        bool ok = false;
+        string error;
+        double readMs = 0;
+    };
 
-    for (Orch *o : m_orchList)
+    size_t pendingTasks(Orch *o)
     {
-        o->bake();
+        size_t pending = 0;
+        for (auto *selectable : o->getSelectables())
+        {
+            auto consumer = dynamic_cast<ConsumerBase *>(selectable);
+            if (consumer != nullptr)
+            {
+                pending += consumer->m_toSync.size();
+            }
+        }
+        return pending;
     }
 
     /*
-     * Three iterations are needed.
-     *
-     * First iteration: switchorch, Port init/hostif create part of portorch, buffers configuration
-     *
-     * Second iteration: port speed/mtu/fec_mode/pfc_asym/admin_status config,
-     * other orch(s) which wait for port to become ready.
-     *
-     * Third iteration: Drain remaining data that are out of order.
+     * Table, key and operation of the pending tasks of an orch. Comparing
+     * them tells whether a doTask() made progress even when it resolved as
+     * many tasks as it queued, which the number of pending tasks does not.
      */
+    vector<string> pendingKeys(Orch *o)
+    {
+        vector<string> keys;
+        for (auto *selectable : o->getSelectables())
+        {
+            auto consumer = dynamic_cast<ConsumerBase *>(selectable);
+            if (consumer == nullptr)
+            {
+                continue;
+            }
+
+            for (const auto &it : consumer->m_toSync)
+            {
+                keys.push_back(consumer->getTableName() + ":" + it.first + ":" + kfvOp(it.second));
+            }
+        }
+        return keys;
+    }
 
-    for (auto it = 0; it < 3; it++)
+    /* Entries read from table snapshots by the consumers of an orch, and the time spent */
+    pair<size_t, double> snapshotStats(Orch *o)
     {
-        SWSS_LOG_DEBUG("The current doTask iteration is %d", it);
+        pair<size_t, double> stats(0, 0);
+        for (auto *selectable : o->getSelectables())
+        {
+            auto consumer = dynamic_cast<ConsumerBase *>(selectable);
+            if (consumer != nullptr)
+            {
+                stats.first += consumer->getSnapshotEntries();
+                stats.second += consumer->getSnapshotMs();
+            }
+        }
+        return stats;
+    }
 
-        for (Orch *o : m_orchList)
+    string orchName(Orch *o)
+    {
+        int status;
+        const char *mangled = typeid(*o).name();
+        char *demangled = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+        string name = (status == 0) ? demangled : mangled;
+        free(demangled);
+        return name;
+    }
+}
+
+/*
+ * Order the orchs so that each one comes after the orchs consuming the tables
+ * it depends on, keeping the m_orchList order otherwise. Dependencies are
+ * returned in deps. A dependency cycle is broken in m_orchList order.
+ */
+vector<Orch *> OrchDaemon::getWarmStartOrder(const vector<Orch *> &orchs, map<Orch *, set<Orch *>> &deps)
+{
+    SWSS_LOG_ENTER();
+
+    map<string, vector<Orch *>> tableOwners;
+    for (Orch *o : orchs)
+    {
+        for (auto *selectable : o->getSelectables())
         {
-            if (o == gMirrorOrch) {
-                SWSS_LOG_DEBUG("Skipping mirror processing until the end");
+            auto consumer = dynamic_cast<ConsumerBase *>(selectable);
+            if (consumer != nullptr)
+            {
+                tableOwners[consumer->getTableName()].push_back(o);
+            }
+        }
+    }
+
+    for (Orch *o : orchs)
+    {
+        for (const auto &table : o->getWarmStartDependencies())
+        {
+            for (Orch *owner : tableOwners[table])
+            {
+                if (owner != o)
+                {
+                    deps[o].insert(owner);
+                }
+            }
+        }
+    }
+
+    vector<Orch *> order;
+    set<Orch *> placed;
+
+    while (order.size() < orchs.size())
+    {
+        Orch *next = nullptr;
+
+        for (Orch *o : orchs)
+        {
+            if (placed.count(o))
+            {
                 continue;
             }
 
+            bool ready = true;
+            for (Orch *d : deps[o])
+            {
+                if (!placed.count(d))
+                {
+                    ready = false;
+                    break;
+                }
+            }
+
+            if (ready)
+            {
+                next = o;
+                break;
+            }
+        }
+
+        if (next == nullptr)
+        {
+            for (Orch *o : orchs)
+            {
+                if (!placed.count(o))
+                {
+                    next = o;
+                    break;
+                }
+            }
+            SWSS_LOG_WARN("Warm start dependency cycle, placing %s first", orchName(next).c_str());
+        }
+
+        order.push_back(next);
+        placed.insert(next);
+    }
+
+    return order;
+}
+
+/*
+ * Read the existing data of the consumer tables ahead of bake(), from worker
+ * threads, each table on its own redis connection. Tables are independent
+ * from each other at this point, only reading them is parallelized: the
+ * content is handed to the consumers, and consumed by bake() in order on
+ * the main thread. Tables that fail to be read are left to bake().
+ *
+ * Only the tables that bake() reads with the no-argument refillToSync() are
+ * read ahead. SubscriberStateTable consumers get their initial data from
+ * their own subscription and are skipped.
+ */
+void OrchDaemon::prefetchWarmData(const vector<Orch *> &orchs)
+{
+    SWSS_LOG_ENTER();
+
+    vector<WarmBakeJob> jobs;
+
+    for (Orch *o : orchs)
+    {
+        for (auto *selectable : o->getSelectables())
+        {
+            auto consumer = dynamic_cast<Consumer *>(selectable);
+            if (consumer == nullptr ||
+                dynamic_cast<SubscriberStateTable *>(consumer->getConsumerTable()) != nullptr ||
+                !o->isWarmBakeRefilled(consumer->getTableName()))
+            {
+                continue;
+            }
+
+            WarmBakeJob job;
+            job.consumer = consumer;
+            jobs.push_back(std::move(job));
+        }
+    }
+
+    size_t workers = min<size_t>(jobs.size(), WARM_BAKE_MAX_WORKERS);
+    vector<thread> threads;
+
+    for (size_t w = 0; w < workers; w++)
+    {
+        threads.emplace_back([&jobs, w, workers]()
+        {
+            for (size_t i = w; i < jobs.size(); i += workers)
+            {
+                auto &job = jobs[i];
+                auto start = chrono::steady_clock::now();
+                try
+                {
+                    auto consumer = job.consumer;
+                    ConsumerBase::readTableSnapshot(consumer->getDbConnector(), consumer->getTableName(),
+                                                    consumer->getConsumerTable()->getTableNameSeparator(),
+                                                    [&job](KeyOpFieldsValuesTuple &&entry)
+                                                    {
+                                                        job.entries.push_back(std::move(entry));
+                                                    });
+                    job.ok = true;
+                }
+                catch (const exception &e)
+                {
+                    job.ok = false;
+                    job.error = e.what();
+                }
+                job.readMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+            }
+        });
+    }
+
+    for (auto &t : threads)
+    {
+        t.join();
+    }
+
+    for (auto &job : jobs)
+    {
+        if (!job.ok)
+        {
+            SWSS_LOG_WARN("Failed to read ahead %s, left to bake: %s",
+                          job.consumer->getTableName().c_str(), job.error.c_str());
+            continue;
+        }
+
+        SWSS_LOG_INFO("Read ahead %s: %zu entries in %.1f ms",
+                      job.consumer->getTableName().c_str(), job.entries.size(), job.readMs);
+        job.consumer->addSnapshotStats(job.entries.size(), job.readMs);
+        job.consumer->setPrefetchedData(std::move(job.entries));
+    }
+}
+
+/*
+ * Process the restored data in dependency order. The first round runs
+ * every orch with pending data, following rounds only retry the orchs
+ * still having pending data, until a round makes no progress. An orch
+ * makes progress when its set of pending tasks changes.
+ *
+ * An orch is held back while one of the orchs it depends on still has
+ * pending data and made progress in the current round, e.g. MirrorOrch
+ * waits for ports, neighbors and routes to settle, and AclOrch waits
+ * for MirrorOrch. Held back orchs run anyway in the last round.
+ *
+ * Returns the number of rounds run.
+ */
+int OrchDaemon::runWarmStartRounds(map<Orch *, double> &taskTimes, map<Orch *, int> &taskRounds)
+{
+    SWSS_LOG_ENTER();
+
+    map<Orch *, set<Orch *>> deps;
+    auto order = getWarmStartOrder(m_orchList, deps);
+
+    int round = 0;
+    while (round < WARM_START_MAX_ROUNDS)
+    {
+        set<Orch *> converging;
+
+        for (Orch *o : order)
+        {
+            auto before = pendingKeys(o);
+            if (before.empty())
+            {
+                continue;
+            }
+
+            bool wait = false;
+            for (Orch *d : deps[o])
+            {
+                if (converging.count(d) && pendingTasks(d) != 0)
+                {
+                    wait = true;
+                    break;
+                }
+            }
+
+            if (wait && round != WARM_START_MAX_ROUNDS - 1)
+            {
+                SWSS_LOG_DEBUG("Round %d: holding back %s", round, orchName(o).c_str());
+                continue;
+            }
+
+            auto start = chrono::steady_clock::now();
             o->doTask();
+            taskTimes[o] += chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+            taskRounds[o]++;
+
+            if (pendingKeys(o) != before)
+            {
+                converging.insert(o);
+            }
+        }
+
+        SWSS_LOG_NOTICE("Warm start round %d: %zu orchs made progress", round, converging.size());
+        round++;
+
+        if (converging.empty())
+        {
+            break;
         }
     }
 
-    // MirrorOrch depends on everything else being settled before it can run,
-    // and mirror ACL rules depend on MirrorOrch, so run these two at the end
-    // after the rest of the data has been processed.
-    gMirrorOrch->doTask();
-    gAclOrch->doTask();
+    return round;
+}
+
+bool OrchDaemon::warmRestoreAndSyncUp()
+{
+    WarmStart::setWarmStartState("orchagent", WarmStart::INITIALIZED);
+
+    auto start = chrono::steady_clock::now();
+    prefetchWarmData(m_orchList);
+    SWSS_LOG_NOTICE("Read ahead warm start data in %.1f ms",
+                    chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+
+    map<Orch *, double> bakeTimes;
+
+    for (Orch *o : m_orchList)
+    {
+        start = chrono::steady_clock::now();
+        o->bake();
+        bakeTimes[o] = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+        /* A bake() falling back to cold start leaves its read ahead data unused */
+        for (auto *selectable : o->getSelectables())
+        {
+            auto consumer = dynamic_cast<ConsumerBase *>(selectable);
+            if (consumer != nullptr)
+            {
+                consumer->clearPrefetchedData();
+            }
+        }
+    }
+
+    map<Orch *, double> taskTimes;
+    map<Orch *, int> taskRounds;
+
+    runWarmStartRounds(taskTimes, taskRounds);
+
+    /* Per orch time breakdown */
+    Table bakeTable(m_stateDb, STATE_WARM_RESTART_BAKE_TABLE_NAME);
+
+    for (Orch *o : m_orchList)
+    {
+        size_t pending = pendingTasks(o);
+        if (pending)
+        {
+            SWSS_LOG_NOTICE("%s has %zu pending tasks after warm start", orchName(o).c_str(), pending);
+        }
+
+        auto read = snapshotStats(o);
+        bakeTable.set(orchName(o), {
+            { "read_entries", to_string(read.first) },
+            { "read_ms", to_string(read.second) },
+            { "read_entries_per_sec", to_string(read.second > 0 ? read.first * 1000 / read.second : 0.0) },
+            { "bake_ms", to_string(bakeTimes[o]) },
+            { "task_ms", to_string(taskTimes[o]) },
+            { "task_rounds", to_string(taskRounds[o]) },
+            { "pending", to_string(pending) }
+        });
+    }
 
     /*
      * At this point, all the pre-existing data should have been processed properly, and
@@ -55,6 +55,11 @@
 
 using namespace swss;
 
+/* Per orch breakdown of the last warm start, defined here until swss-common's schema.h has it */
+#ifndef STATE_WARM_RESTART_BAKE_TABLE_NAME
+#define STATE_WARM_RESTART_BAKE_TABLE_NAME "WARM_RESTART_BAKE_TABLE"
+#endif
+
 class OrchDaemon
 {
 public:
@@ -83,6 +88,8 @@ public:
         m_fabricQueueStatEnabled = enabled;
     }
     void logRotate();
+
+    static void prefetchWarmData(const std::vector<Orch *> &orchs);
 private:
     DBConnector *m_applDb;
     DBConnector *m_configDb;
@@ -104,6 +111,10 @@ private:
     void heartBeat(std::chrono::time_point<std::chrono::high_resolution_clock> tcurrent);
 
     void freezeAndHeartBeat(unsigned int duration);
+
+    std::vector<Orch *> getWarmStartOrder(const std::vector<Orch *> &orchs,
+                                          std::map<Orch *, std::set<Orch *>> &deps);
+    int runWarmStartRounds(std::map<Orch *, double> &taskTimes, std::map<Orch *, int> &taskRounds);
 };
 
 class FabricOrchDaemon : public OrchDaemon
@@ -1,5 +1,6 @@
 #include "p4orch/acl_rule_manager.h"
 
+#include <chrono>
 #include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
@@ -340,27 +341,46 @@ ReturnCode AclRuleManager::cleanUpUserDefinedTraps()
     return ReturnCode();
 }
 
-void AclRuleManager::doAclCounterStatsTask()
+bool AclRuleManager::doAclCounterStatsTask()
 {
     SWSS_LOG_ENTER();
 
-    for (const auto &table_it : m_aclRuleTables)
+    if (m_counterStatsPending.empty())
     {
-        const auto &table_name = fvField(table_it);
-        for (const auto &rule_it : fvValue(table_it))
+        for (const auto &table_it : m_aclRuleTables)
         {
-            if (!fvValue(rule_it).counter.packets_enabled && !fvValue(rule_it).counter.bytes_enabled)
-                continue;
-            auto status = setAclRuleCounterStats(fvValue(rule_it));
-            if (!status.ok())
+            for (const auto &rule_it : fvValue(table_it))
             {
-                status.prepend("Failed to set counters stats for ACL rule " + QuotedVar(table_name) + ":" +
-                               QuotedVar(fvField(rule_it)) + " in COUNTERS_DB: ");
-                SWSS_LOG_ERROR("%s", status.message().c_str());
-                continue;
+                if (!fvValue(rule_it).counter.packets_enabled && !fvValue(rule_it).counter.bytes_enabled)
+                    continue;
+                m_counterStatsPending.emplace_back(fvField(table_it), fvField(rule_it));
             }
         }
     }
+
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(P4_COUNTERS_READ_BUDGET_MSEC);
+    while (!m_counterStatsPending.empty() && std::chrono::steady_clock::now() < deadline)
+    {
+        const auto table_name = std::move(m_counterStatsPending.front().first);
+        const auto rule_key = std::move(m_counterStatsPending.front().second);
+        m_counterStatsPending.pop_front();
+
+        // The rule may have been removed or updated since the pass started.
+        const auto *acl_rule = getAclRule(table_name, rule_key);
+        if (acl_rule == nullptr || (!acl_rule->counter.packets_enabled && !acl_rule->counter.bytes_enabled))
+            continue;
+        auto status = setAclRuleCounterStats(*acl_rule);
+        if (!status.ok())
+        {
+            status.prepend("Failed to set counters stats for ACL rule " + QuotedVar(table_name) + ":" +
+                           QuotedVar(rule_key) + " in COUNTERS_DB: ");
+            SWSS_LOG_ERROR("%s", status.message().c_str());
+            continue;
+        }
+    }
+
+    return m_counterStatsPending.empty();
 }
 
 ReturnCode AclRuleManager::createAclCounter(const std::string &acl_table_name, const std::string &counter_key,
@@ -48,8 +48,9 @@ class AclRuleManager : public ObjectManagerInterface
                             std::string &object_key) override;
 
     // Update counters stats for every rule in each ACL table in COUNTERS_DB, if
-    // counters are enabled in rules.
-    void doAclCounterStatsTask();
+    // counters are enabled in rules. A pass over all rules may be spread over
+    // several calls, returns true when the current pass is complete.
+    bool doAclCounterStatsTask();
 
   private:
     // Deserializes an entry in a dynamically created ACL table.
@@ -153,6 +154,8 @@ class AclRuleManager : public ObjectManagerInterface
     std::deque<swss::KeyOpFieldsValuesTuple> m_entries;
     std::unique_ptr<swss::DBConnector> m_countersDb;
     std::unique_ptr<swss::Table> m_countersTable;
+    // <table name, rule key> of the rules left in the ongoing counters pass.
+    std::deque<std::pair<std::string, std::string>> m_counterStatsPending;
     std::vector<P4UserDefinedTrapHostifTableEntry> m_userDefinedTraps;
 
     friend class AclTableManager;
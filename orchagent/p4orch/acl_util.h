@@ -409,6 +409,13 @@ using P4AclRuleTables = std::map<std::string, std::map<std::string, P4AclRule>>;
 // (in worst case update of 1265 counters takes almost 5 sec)
 #define P4_COUNTERS_READ_INTERVAL 10
 
+// Time a single counters poll may spend reading stats, in milliseconds.
+// Entries not read within it are polled on the following timer ticks, which
+// are then scheduled every P4_COUNTERS_READ_SLICE_INTERVAL_MSEC until the
+// pass is complete, so a large number of counters doesn't stall the main loop.
+#define P4_COUNTERS_READ_BUDGET_MSEC 50
+#define P4_COUNTERS_READ_SLICE_INTERVAL_MSEC 100
+
 #define P4_COUNTER_STATS_PACKETS "packets"
 #define P4_COUNTER_STATS_BYTES "bytes"
 #define P4_COUNTER_STATS_GREEN_PACKETS "green_packets"
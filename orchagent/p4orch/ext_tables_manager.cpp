@@ -1,6 +1,7 @@
 #include "p4orch/ext_tables_manager.h"
 
 #include <boost/algorithm/string.hpp>
+#include <chrono>
 #include <memory>
 #include <nlohmann/json.hpp>
 #include <sstream>
@@ -799,60 +800,82 @@ void ExtTablesManager::drain()
     }
 }
 
-void ExtTablesManager::doExtCounterStatsTask()
+bool ExtTablesManager::doExtCounterStatsTask()
 {
     SWSS_LOG_ENTER();
 
     if (!gP4Orch->tablesinfo)
     {
-        return;
+        m_counterStatsPending.clear();
+        return true;
+    }
+
+    if (m_counterStatsPending.empty())
+    {
+        for (auto table_it = gP4Orch->tablesinfo->m_tableInfoMap.begin();
+             table_it != gP4Orch->tablesinfo->m_tableInfoMap.end(); ++table_it)
+        {
+            if (!table_it->second.counter_bytes_enabled && !table_it->second.counter_packets_enabled)
+            {
+                continue;
+            }
+
+            auto table_name = table_it->second.name;
+            auto ext_table_it = m_extTables.find(table_name);
+            if (ext_table_it == m_extTables.end())
+            {
+                continue;
+            }
+
+            for (auto ext_table_entry_it = ext_table_it->second.begin();
+                 ext_table_entry_it != ext_table_it->second.end(); ++ext_table_entry_it)
+            {
+                if (ext_table_entry_it->second.sai_counter_oid == SAI_NULL_OBJECT_ID)
+                {
+                    continue;
+                }
+                m_counterStatsPending.emplace_back(table_name, ext_table_entry_it->first);
+            }
+        }
     }
 
     sai_stat_id_t stat_ids[] = {SAI_COUNTER_STAT_PACKETS, SAI_COUNTER_STAT_BYTES};
     uint64_t stats[2];
-    std::vector<swss::FieldValueTuple> counter_stats_values;
 
-    for (auto table_it = gP4Orch->tablesinfo->m_tableInfoMap.begin();
-         table_it != gP4Orch->tablesinfo->m_tableInfoMap.end(); ++table_it)
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(P4_COUNTERS_READ_BUDGET_MSEC);
+    while (!m_counterStatsPending.empty() && std::chrono::steady_clock::now() < deadline)
     {
-        if (!table_it->second.counter_bytes_enabled && !table_it->second.counter_packets_enabled)
+        const auto table_name = std::move(m_counterStatsPending.front().first);
+        const auto table_key = std::move(m_counterStatsPending.front().second);
+        m_counterStatsPending.pop_front();
+
+        // The entry may have been removed since the pass started.
+        auto *ext_table_entry = getP4ExtTableEntry(table_name, table_key);
+        if (ext_table_entry == nullptr || ext_table_entry->sai_counter_oid == SAI_NULL_OBJECT_ID)
         {
             continue;
         }
 
-        auto table_name = table_it->second.name;
-        auto ext_table_it = m_extTables.find(table_name);
-        if (ext_table_it == m_extTables.end())
+        sai_status_t sai_status =
+            sai_counter_api->get_counter_stats(ext_table_entry->sai_counter_oid, 2, stat_ids, stats);
+        if (sai_status != SAI_STATUS_SUCCESS)
         {
+            SWSS_LOG_WARN("Failed to set counters stats for extension entry %s:%s in "
+                          "COUNTERS_DB: ",
+                          table_name.c_str(), ext_table_entry->table_key.c_str());
             continue;
         }
 
-        for (auto ext_table_entry_it = ext_table_it->second.begin(); ext_table_entry_it != ext_table_it->second.end();
-             ++ext_table_entry_it)
-        {
-            auto *ext_table_entry = &ext_table_entry_it->second;
-            if (ext_table_entry->sai_counter_oid == SAI_NULL_OBJECT_ID)
-            {
-                continue;
-            }
+        std::vector<swss::FieldValueTuple> counter_stats_values;
+        counter_stats_values.push_back(swss::FieldValueTuple{P4_COUNTER_STATS_PACKETS, std::to_string(stats[0])});
+        counter_stats_values.push_back(swss::FieldValueTuple{P4_COUNTER_STATS_BYTES, std::to_string(stats[1])});
 
-            sai_status_t sai_status =
-                sai_counter_api->get_counter_stats(ext_table_entry->sai_counter_oid, 2, stat_ids, stats);
-            if (sai_status != SAI_STATUS_SUCCESS)
-            {
-                SWSS_LOG_WARN("Failed to set counters stats for extension entry %s:%s in "
-                              "COUNTERS_DB: ",
-                              table_name.c_str(), ext_table_entry->table_key.c_str());
-                continue;
-            }
-
-            counter_stats_values.push_back(swss::FieldValueTuple{P4_COUNTER_STATS_PACKETS, std::to_string(stats[0])});
-            counter_stats_values.push_back(swss::FieldValueTuple{P4_COUNTER_STATS_BYTES, std::to_string(stats[1])});
-
-            // Set field value tuples for counters stats in COUNTERS_DB
-            m_countersTable->set(ext_table_entry->db_key, counter_stats_values);
-        }
+        // Set field value tuples for counters stats in COUNTERS_DB
+        m_countersTable->set(ext_table_entry->db_key, counter_stats_values);
     }
+
+    return m_counterStatsPending.empty();
 }
 
 std::string ExtTablesManager::verifyState(const std::string &key, const std::vector<swss::FieldValueTuple> &tuple)
@@ -64,8 +64,9 @@ class ExtTablesManager : public ObjectManagerInterface
                             std::string &object_key) override;
 
     // For every extension entry, update counters stats in COUNTERS_DB, if
-    // counters are enabled for those entries
-    void doExtCounterStatsTask();
+    // counters are enabled for those entries. A pass over all entries may be
+    // spread over several calls, returns true when the current pass is complete.
+    bool doExtCounterStatsTask();
 
   private:
     ReturnCodeOr<P4ExtTableAppDbEntry> deserializeP4ExtTableEntry(const std::string &table_name, const std::string &key,
@@ -91,4 +92,6 @@ class ExtTablesManager : public ObjectManagerInterface
 
     std::unique_ptr<swss::DBConnector> m_countersDb;
     std::unique_ptr<swss::Table> m_countersTable;
+    // <table name, table key> of the entries left in the ongoing counters pass.
+    std::deque<std::pair<std::string, std::string>> m_counterStatsPending;
 };
@@ -169,11 +169,11 @@ void P4Orch::doTask(swss::SelectableTimer &timer)
 
     if (&timer == m_aclCounterStatsTimer)
     {
-        m_aclRuleManager->doAclCounterStatsTask();
+        rescheduleCounterStatsTimer(m_aclCounterStatsTimer, m_aclRuleManager->doAclCounterStatsTask());
     }
     else if (&timer == m_extCounterStatsTimer)
     {
-        m_extTablesManager->doExtCounterStatsTask();
+        rescheduleCounterStatsTimer(m_extCounterStatsTimer, m_extTablesManager->doExtCounterStatsTask());
     }
     else
     {
@@ -182,6 +182,16 @@ void P4Orch::doTask(swss::SelectableTimer &timer)
     }
 }
 
+void P4Orch::rescheduleCounterStatsTimer(swss::SelectableTimer *timer, bool pass_done)
+{
+    // Poll the rest of an unfinished pass shortly, otherwise wait for the
+    // next regular poll.
+    auto interval = pass_done ? timespec{.tv_sec = P4_COUNTERS_READ_INTERVAL, .tv_nsec = 0}
+                              : timespec{.tv_sec = 0, .tv_nsec = P4_COUNTERS_READ_SLICE_INTERVAL_MSEC * 1000000L};
+    timer->setInterval(interval);
+    timer->reset();
+}
+
 void P4Orch::handlePortStatusChangeNotification(const std::string &op, const std::string &data)
 {
     if (op == "port_state_change")
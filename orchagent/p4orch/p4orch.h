@@ -60,6 +60,9 @@ class P4Orch : public Orch
     void doTask(swss::SelectableTimer &timer);
     void doTask(swss::NotificationConsumer &consumer);
     void handlePortStatusChangeNotification(const std::string &op, const std::string &data);
+    // Sets the interval of a counters poll timer depending on whether the
+    // last poll completed a pass over all entries.
+    void rescheduleCounterStatsTimer(swss::SelectableTimer *timer, bool pass_done);
 
     // P4 object manager request processing order.
     std::vector<ObjectManagerInterface *> m_p4ManagerPrecedence;
@@ -1051,9 +1051,19 @@ class AclManagerTest : public ::testing::Test
         return acl_rule_manager_->processDeleteRuleRequest(acl_table_name, acl_rule_key);
     }
 
-    void DoAclCounterStatsTask()
+    bool DoAclCounterStatsTask()
     {
-        acl_rule_manager_->doAclCounterStatsTask();
+        return acl_rule_manager_->doAclCounterStatsTask();
+    }
+
+    size_t GetPendingCounterStatsCount()
+    {
+        return acl_rule_manager_->m_counterStatsPending.size();
+    }
+
+    void AddPendingCounterStats(const std::string &acl_table_name, const std::string &acl_rule_key)
+    {
+        acl_rule_manager_->m_counterStatsPending.emplace_back(acl_table_name, acl_rule_key);
     }
 
     ReturnCode CreateAclGroupMember(const P4AclTableDefinition &acl_table, sai_object_id_t *acl_grp_mem_oid)
@@ -4391,7 +4401,8 @@ TEST_F(AclManagerTest, DoAclCounterStatsTaskSucceeds)
                             counter_attr[1].value.u64 = 500; // bytes
                         }),
                         Return(SAI_STATUS_SUCCESS)));
-    DoAclCounterStatsTask();
+    EXPECT_TRUE(DoAclCounterStatsTask());
+    EXPECT_EQ(0u, GetPendingCounterStatsCount());
     // Only packets and bytes are populated in COUNTERS_DB
     EXPECT_TRUE(counters_table->hget(counter_stats_key, P4_COUNTER_STATS_PACKETS, stats));
     EXPECT_EQ("50", stats);
@@ -4541,6 +4552,42 @@ TEST_F(AclManagerTest, DoAclCounterStatsTaskFailsWhenSaiCallFails)
     EXPECT_EQ(nullptr, GetAclRule(kAclIngressTableName, acl_rule_key));
 }
 
+TEST_F(AclManagerTest, DoAclCounterStatsTaskSkipsRulesRemovedDuringPass)
+{
+    ASSERT_NO_FATAL_FAILURE(AddDefaultIngressTable());
+    auto counters_table = std::make_unique<swss::Table>(gCountersDb, std::string(COUNTERS_TABLE) +
+                                                                         DEFAULT_KEY_SEPARATOR + APP_P4RT_TABLE_NAME);
+
+    // Insert the ACL rule
+    auto app_db_entry = getDefaultAclRuleAppDbEntryWithoutAction();
+    const auto &acl_rule_key =
+        KeyGenerator::generateAclRuleKey(app_db_entry.match_fvs, std::to_string(app_db_entry.priority));
+    const auto &counter_stats_key = app_db_entry.db_key;
+    std::vector<swss::FieldValueTuple> values;
+    app_db_entry.action = "set_dst_ipv6";
+    app_db_entry.action_param_fvs["ip_address"] = "fdf8:f53b:82e4::53";
+    EXPECT_CALL(mock_sai_acl_, create_acl_entry(_, _, _, _))
+        .WillRepeatedly(DoAll(SetArgPointee<0>(kAclIngressRuleOid1), Return(SAI_STATUS_SUCCESS)));
+    EXPECT_CALL(mock_sai_acl_, create_acl_counter(_, _, _, _))
+        .WillRepeatedly(DoAll(SetArgPointee<0>(kAclCounterOid1), Return(SAI_STATUS_SUCCESS)));
+    EXPECT_CALL(mock_sai_policer_, create_policer(_, _, _, _))
+        .WillRepeatedly(DoAll(SetArgPointee<0>(kAclMeterOid1), Return(SAI_STATUS_SUCCESS)));
+    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessAddRuleRequest(acl_rule_key, app_db_entry));
+
+    // Rule is still part of an unfinished pass when it gets removed
+    AddPendingCounterStats(kAclIngressTableName, acl_rule_key);
+    EXPECT_CALL(mock_sai_acl_, remove_acl_entry(Eq(kAclIngressRuleOid1))).WillRepeatedly(Return(SAI_STATUS_SUCCESS));
+    EXPECT_CALL(mock_sai_acl_, remove_acl_counter(Eq(kAclCounterOid1))).WillRepeatedly(Return(SAI_STATUS_SUCCESS));
+    EXPECT_CALL(mock_sai_policer_, remove_policer(Eq(kAclMeterOid1))).WillRepeatedly(Return(SAI_STATUS_SUCCESS));
+    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessDeleteRuleRequest(kAclIngressTableName, acl_rule_key));
+
+    // The pass completes without reading counters of the removed rule
+    EXPECT_CALL(mock_sai_acl_, get_acl_counter_attribute(_, _, _)).Times(0);
+    EXPECT_TRUE(DoAclCounterStatsTask());
+    EXPECT_EQ(0u, GetPendingCounterStatsCount());
+    EXPECT_FALSE(counters_table->get(counter_stats_key, values));
+}
+
 TEST_F(AclManagerTest, DISABLED_InitCreateGroupFails)
 {
     // Failed to create ACL groups
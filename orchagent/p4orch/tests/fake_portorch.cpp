@@ -104,6 +104,40 @@ bool PortsOrch::getPortByBridgePortId(sai_object_id_t bridge_port_id, Port &port
     return true;
 }
 
+const Port *PortsOrch::getPortPtr(const string &alias) const
+{
+    auto itr = m_portList.find(alias);
+    if (itr == m_portList.end())
+    {
+        return nullptr;
+    }
+    return &itr->second;
+}
+
+const Port *PortsOrch::getPortPtr(sai_object_id_t id) const
+{
+    for (const auto &p : m_portList)
+    {
+        if (p.second.m_port_id == id)
+        {
+            return &p.second;
+        }
+    }
+    return nullptr;
+}
+
+const Port *PortsOrch::getPortPtrByBridgePortId(sai_object_id_t bridge_port_id) const
+{
+    for (const auto &p : m_portList)
+    {
+        if (p.second.m_bridge_port_id == bridge_port_id)
+        {
+            return &p.second;
+        }
+    }
+    return nullptr;
+}
+
 void PortsOrch::setPort(string alias, Port port)
 {
     m_portList[alias] = port;
@@ -284,7 +318,7 @@ bool PortsOrch::removeVlanMember(Port &vlan, Port &port, string end_point_ip)
     return true;
 }
 
-bool PortsOrch::isVlanMember(Port &vlan, Port &port, string end_point_ip)
+bool PortsOrch::isVlanMember(const Port &vlan, const Port &port, string end_point_ip)
 {
     return true;
 }
@@ -425,7 +459,7 @@ void PortsOrch::initializePriorityGroups(Port &port)
 {
 }
 
-void PortsOrch::initializePortBufferMaximumParameters(Port &port)
+void PortsOrch::initializePortsBufferMaximumParameters(std::vector<Port> &ports)
 {
 }
 
@@ -498,9 +532,8 @@ sai_status_t PortsOrch::removePort(sai_object_id_t port_id)
     return SAI_STATUS_SUCCESS;
 }
 
-bool PortsOrch::initPort(const PortConfig &port)
+void PortsOrch::initPorts(const std::vector<PortConfig> &portList, std::vector<bool> &statusList)
 {
-    return true;
 }
 
 void PortsOrch::deInitPort(string alias, sai_object_id_t port_id)
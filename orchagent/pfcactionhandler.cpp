@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <iterator>
 #include <unordered_map>
 #include "pfcactionhandler.h"
 #include "logger.h"
@@ -30,6 +32,222 @@ extern AclOrch * gAclOrch;
 extern sai_port_api_t *sai_port_api;
 extern sai_queue_api_t *sai_queue_api;
 extern sai_buffer_api_t *sai_buffer_api;
+extern size_t gMaxBulkSize;
+
+PfcWdActionBatch *PfcWdActionBatch::m_current = nullptr;
+bool PfcWdActionBatch::m_isBulkGetSupported = true;
+bool PfcWdActionBatch::m_isBulkSetSupported = true;
+
+PfcWdActionBatch::PfcWdActionBatch(void):
+    m_previous(m_current)
+{
+    SWSS_LOG_ENTER();
+
+    m_current = this;
+}
+
+PfcWdActionBatch::~PfcWdActionBatch(void)
+{
+    SWSS_LOG_ENTER();
+
+    flush();
+    m_current = m_previous;
+}
+
+void PfcWdActionBatch::getQueueAttribute(sai_object_id_t queue, sai_attr_id_t id, Callback done)
+{
+    sai_attribute_t attr;
+    attr.id = id;
+    m_gets.push_back({queue, attr, done});
+}
+
+void PfcWdActionBatch::setQueueAttribute(sai_object_id_t queue, const sai_attribute_t &attr, Callback done)
+{
+    m_sets.push_back({queue, attr, done});
+}
+
+void PfcWdActionBatch::disablePortPfc(sai_object_id_t port, uint8_t queueId)
+{
+    auto &update = m_portPfcUpdates[port];
+    update.disable = static_cast<uint8_t>(update.disable | (1 << queueId));
+    update.enable = static_cast<uint8_t>(update.enable & ~(1 << queueId));
+}
+
+void PfcWdActionBatch::enablePortPfc(sai_object_id_t port, uint8_t queueId)
+{
+    auto &update = m_portPfcUpdates[port];
+    update.enable = static_cast<uint8_t>(update.enable | (1 << queueId));
+    update.disable = static_cast<uint8_t>(update.disable & ~(1 << queueId));
+}
+
+void PfcWdActionBatch::flush(void)
+{
+    SWSS_LOG_ENTER();
+
+    // The callbacks of the gets queue the sets depending on them
+    while (!m_gets.empty() || !m_sets.empty())
+    {
+        vector<Operation> ops;
+
+        ops.swap(m_gets);
+        bulkQueueAttributes(ops, false);
+
+        ops.clear();
+        ops.swap(m_sets);
+        bulkQueueAttributes(ops, true);
+    }
+
+    for (const auto &it : m_portPfcUpdates)
+    {
+        uint8_t pfcMask = 0;
+
+        if (!gPortsOrch->getPortPfc(it.first, &pfcMask))
+        {
+            SWSS_LOG_ERROR("Failed to get PFC mask on port 0x%" PRIx64, it.first);
+        }
+
+        pfcMask = static_cast<uint8_t>((pfcMask & ~it.second.disable) | it.second.enable);
+
+        if (!gPortsOrch->setPortPfc(it.first, pfcMask))
+        {
+            SWSS_LOG_ERROR("Failed to set PFC mask on port 0x%" PRIx64, it.first);
+        }
+    }
+    m_portPfcUpdates.clear();
+}
+
+void PfcWdActionBatch::flushQueue(sai_object_id_t queue)
+{
+    SWSS_LOG_ENTER();
+
+    // From the outermost batch, in the order they would be flushed
+    vector<PfcWdActionBatch*> batches;
+    for (auto batch = m_current; batch != nullptr; batch = batch->m_previous)
+    {
+        batches.push_back(batch);
+    }
+
+    for (auto it = batches.rbegin(); it != batches.rend(); it++)
+    {
+        (*it)->flushOperations(queue);
+    }
+}
+
+void PfcWdActionBatch::flushOperations(sai_object_id_t queue)
+{
+    SWSS_LOG_ENTER();
+
+    // Same as flush(), restricted to the queue
+    while (true)
+    {
+        auto gets = takeOperations(m_gets, queue);
+        bulkQueueAttributes(gets, false);
+
+        // Along with the sets queued by the callbacks of the gets
+        auto sets = takeOperations(m_sets, queue);
+        if (gets.empty() && sets.empty())
+        {
+            break;
+        }
+        bulkQueueAttributes(sets, true);
+    }
+}
+
+vector<PfcWdActionBatch::Operation> PfcWdActionBatch::takeOperations(vector<Operation> &ops, sai_object_id_t queue)
+{
+    vector<Operation> taken;
+
+    auto it = stable_partition(ops.begin(), ops.end(),
+            [queue](const Operation &op) { return op.queue != queue; });
+    move(it, ops.end(), back_inserter(taken));
+    ops.erase(it, ops.end());
+
+    return taken;
+}
+
+void PfcWdActionBatch::bulkQueueAttributes(vector<Operation> &ops, bool set)
+{
+    SWSS_LOG_ENTER();
+
+    bool &isBulkSupported = set ? m_isBulkSetSupported : m_isBulkGetSupported;
+    size_t maxBulkSize = gMaxBulkSize ? gMaxBulkSize : ops.size();
+
+    for (size_t start = 0; start < ops.size(); start += maxBulkSize)
+    {
+        uint32_t count = static_cast<uint32_t>(min(maxBulkSize, ops.size() - start));
+        vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
+        sai_status_t status = SAI_STATUS_NOT_IMPLEMENTED;
+
+        // A single queue is not worth a bulk call
+        if (count > 1 && isBulkSupported)
+        {
+            vector<sai_object_key_t> keys(count);
+            for (uint32_t i = 0; i < count; i++)
+            {
+                keys[i].key.object_id = ops[start + i].queue;
+            }
+
+            if (set)
+            {
+                vector<sai_attribute_t> attrs(count);
+                for (uint32_t i = 0; i < count; i++)
+                {
+                    attrs[i] = ops[start + i].attr;
+                }
+
+                status = sai_bulk_object_set_attribute(SAI_OBJECT_TYPE_QUEUE, count, keys.data(), attrs.data(),
+                                                       SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+            }
+            else
+            {
+                vector<uint32_t> attrCounts(count, 1);
+                vector<sai_attribute_t*> attrLists(count);
+                for (uint32_t i = 0; i < count; i++)
+                {
+                    attrLists[i] = &ops[start + i].attr;
+                }
+
+                status = sai_bulk_object_get_attribute(gSwitchId, SAI_OBJECT_TYPE_QUEUE, count, keys.data(),
+                                                       attrCounts.data(), attrLists.data(),
+                                                       SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+            }
+
+            if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+            {
+                SWSS_LOG_NOTICE("Bulk %s is not supported for queues, falling back to per queue %s",
+                                set ? "set" : "get", set ? "set" : "get");
+                isBulkSupported = false;
+            }
+        }
+
+        if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+        {
+            for (uint32_t i = 0; i < count; i++)
+            {
+                auto &op = ops[start + i];
+                statuses[i] = set ?
+                              sai_queue_api->set_queue_attribute(op.queue, &op.attr) :
+                              sai_queue_api->get_queue_attribute(op.queue, 1, &op.attr);
+            }
+        }
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            auto &op = ops[start + i];
+            if (op.done)
+            {
+                op.done(statuses[i], op.attr);
+            }
+            else if (statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("Failed to %s attribute %d on queue 0x%" PRIx64 ": %d",
+                               set ? "set" : "get", op.attr.id, op.queue, statuses[i]);
+            }
+        }
+    }
+
+    SWSS_LOG_INFO("%s %zu queue attribute(s)", set ? "Set" : "Got", ops.size());
+}
 
 PfcWdActionHandler::PfcWdActionHandler(sai_object_id_t port, sai_object_id_t queue,
         uint8_t queueId, shared_ptr<Table> countersTable):
@@ -230,6 +448,13 @@ PfcWdSaiDlrInitHandler::PfcWdSaiDlrInitHandler(sai_object_id_t port, sai_object_
     attr.id = SAI_QUEUE_ATTR_PFC_DLR_INIT;
     attr.value.booldata = true;
 
+    auto batch = PfcWdActionBatch::getCurrent();
+    if (batch != nullptr)
+    {
+        batch->setQueueAttribute(queue, attr);
+        return;
+    }
+
     // Set DLR init to true to start PFC deadlock recovery
     sai_status_t status = sai_queue_api->set_queue_attribute(queue, &attr);
     if (status != SAI_STATUS_SUCCESS)
@@ -273,6 +498,13 @@ PfcWdDlrHandler::PfcWdDlrHandler(sai_object_id_t port, sai_object_id_t queue,
     attr.id = SAI_QUEUE_ATTR_PFC_DLR_INIT;
     attr.value.booldata = true;
 
+    auto batch = PfcWdActionBatch::getCurrent();
+    if (batch != nullptr)
+    {
+        batch->setQueueAttribute(queue, attr);
+        return;
+    }
+
     // Set DLR init to true to start PFC deadlock recovery
     sai_status_t status = sai_queue_api->set_queue_attribute(queue, &attr);
     if (status != SAI_STATUS_SUCCESS)
@@ -552,6 +784,13 @@ PfcWdLossyHandler::PfcWdLossyHandler(sai_object_id_t port, sai_object_id_t queue
         return;
     }
 
+    auto batch = PfcWdActionBatch::getCurrent();
+    if (batch != nullptr)
+    {
+        batch->disablePortPfc(port, queueId);
+        return;
+    }
+
     uint8_t pfcMask = 0;
 
     if (!gPortsOrch->getPortPfc(port, &pfcMask))
@@ -579,6 +818,13 @@ PfcWdLossyHandler::~PfcWdLossyHandler(void)
         return;
     }
 
+    auto batch = PfcWdActionBatch::getCurrent();
+    if (batch != nullptr)
+    {
+        batch->enablePortPfc(getPort(), getQueueId());
+        return;
+    }
+
     uint8_t pfcMask = 0;
 
     if (!gPortsOrch->getPortPfc(getPort(), &pfcMask))
@@ -670,7 +916,74 @@ PfcWdZeroBufferHandler::PfcWdZeroBufferHandler(sai_object_id_t port,
         return;
     }
 
-    setQueueLockFlag(portInstance, true);
+    setQueueLockFlag(portInstance, queue, true);
+
+    auto batch = PfcWdActionBatch::getCurrent();
+
+    auto &originalProfiles = ZeroBufferProfile::getOriginalQueueProfiles();
+    auto snapshot = originalProfiles.find(queue);
+    if (snapshot != originalProfiles.end())
+    {
+        // The original buffer profile is known since the watchdog started on the queue
+        sai_object_id_t oldQueueProfileId = snapshot->second;
+
+        sai_attribute_t attr;
+        attr.id = SAI_QUEUE_ATTR_BUFFER_PROFILE_ID;
+        attr.value.oid = ZeroBufferProfile::getZeroBufferProfile();
+
+        // Restoring it is harmless even if the zero buffer profile fails to be set
+        m_originalQueueBufferProfile->profile = oldQueueProfileId;
+        m_originalQueueBufferProfile->zeroBufferProfileSet = true;
+
+        if (batch != nullptr)
+        {
+            batch->setQueueAttribute(queue, attr);
+            return;
+        }
+
+        sai_status_t status = sai_queue_api->set_queue_attribute(queue, &attr);
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to set buffer profile ID on queue 0x%" PRIx64 ": %d", queue, status);
+        }
+        return;
+    }
+
+    if (batch != nullptr)
+    {
+        // The zero buffer profile is set once the original one is fetched along with the other queues of the batch
+        auto originalProfile = m_originalQueueBufferProfile;
+        batch->getQueueAttribute(queue, SAI_QUEUE_ATTR_BUFFER_PROFILE_ID,
+            [originalProfile, batch, queue](sai_status_t status, const sai_attribute_t &attr)
+            {
+                if (status != SAI_STATUS_SUCCESS)
+                {
+                    SWSS_LOG_ERROR("Failed to get buffer profile ID on queue 0x%" PRIx64 ": %d", queue, status);
+                    return;
+                }
+
+                sai_object_id_t oldQueueProfileId = attr.value.oid;
+
+                sai_attribute_t zeroAttr;
+                zeroAttr.id = SAI_QUEUE_ATTR_BUFFER_PROFILE_ID;
+                zeroAttr.value.oid = ZeroBufferProfile::getZeroBufferProfile();
+
+                batch->setQueueAttribute(queue, zeroAttr,
+                    [originalProfile, queue, oldQueueProfileId](sai_status_t status, const sai_attribute_t &)
+                    {
+                        if (status != SAI_STATUS_SUCCESS)
+                        {
+                            SWSS_LOG_ERROR("Failed to set buffer profile ID on queue 0x%" PRIx64 ": %d", queue, status);
+                            return;
+                        }
+
+                        // Save original buffer profile
+                        originalProfile->profile = oldQueueProfileId;
+                        originalProfile->zeroBufferProfileSet = true;
+                    });
+            });
+        return;
+    }
 
     sai_attribute_t attr;
     attr.id = SAI_QUEUE_ATTR_BUFFER_PROFILE_ID;
@@ -697,41 +1010,118 @@ PfcWdZeroBufferHandler::PfcWdZeroBufferHandler(sai_object_id_t port,
     }
 
     // Save original buffer profile
-    m_originalQueueBufferProfile = oldQueueProfileId;
+    m_originalQueueBufferProfile->profile = oldQueueProfileId;
+    m_originalQueueBufferProfile->zeroBufferProfileSet = true;
 }
 
 PfcWdZeroBufferHandler::~PfcWdZeroBufferHandler(void)
 {
     SWSS_LOG_ENTER();
 
+    sai_object_id_t port = getPort();
+    sai_object_id_t queue = getQueue();
+
+    // The zero buffer profile may still be pending in a batch, settle it first
+    PfcWdActionBatch::flushQueue(queue);
+
+    // The queue is released once its original buffer profile is back
+    auto unlock = [port, queue](sai_status_t status, const sai_attribute_t &)
+    {
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to set buffer profile ID on queue 0x%" PRIx64 ": %d", queue, status);
+            return;
+        }
+
+        Port portInstance;
+        if (!gPortsOrch->getPort(port, portInstance))
+        {
+            SWSS_LOG_ERROR("Cannot get port by ID 0x%" PRIx64, port);
+            return;
+        }
+
+        setQueueLockFlag(portInstance, queue, false);
+    };
+
     sai_attribute_t attr;
     attr.id = SAI_QUEUE_ATTR_BUFFER_PROFILE_ID;
-    attr.value.oid = m_originalQueueBufferProfile;
+    attr.value.oid = m_originalQueueBufferProfile->profile;
 
-    // Set our zero buffer profile on a queue
-    sai_status_t status = sai_queue_api->set_queue_attribute(getQueue(), &attr);
-    if (status != SAI_STATUS_SUCCESS)
+    // The zero buffer profile was never set, the queue still has its own
+    if (!m_originalQueueBufferProfile->zeroBufferProfileSet)
     {
-        SWSS_LOG_ERROR("Failed to set buffer profile ID on queue 0x%" PRIx64 ": %d", getQueue(), status);
+        unlock(SAI_STATUS_SUCCESS, attr);
         return;
     }
 
-    Port portInstance;
-    if (!gPortsOrch->getPort(getPort(), portInstance))
+    auto batch = PfcWdActionBatch::getCurrent();
+    if (batch != nullptr)
     {
-        SWSS_LOG_ERROR("Cannot get port by ID 0x%" PRIx64, getPort());
+        batch->setQueueAttribute(queue, attr, unlock);
         return;
     }
 
-    setQueueLockFlag(portInstance, false);
+    // Set our zero buffer profile on a queue
+    unlock(sai_queue_api->set_queue_attribute(queue, &attr), attr);
+}
+
+void PfcWdZeroBufferHandler::snapshotQueueBufferProfiles(const vector<sai_object_id_t> &queues)
+{
+    SWSS_LOG_ENTER();
+
+    PfcWdActionBatch batch;
+
+    for (auto queue : queues)
+    {
+        batch.getQueueAttribute(queue, SAI_QUEUE_ATTR_BUFFER_PROFILE_ID,
+            [queue](sai_status_t status, const sai_attribute_t &attr)
+            {
+                if (status != SAI_STATUS_SUCCESS)
+                {
+                    // The profile is read on storm then
+                    SWSS_LOG_WARN("Failed to get buffer profile ID on queue 0x%" PRIx64 ": %d", queue, status);
+                    return;
+                }
+
+                // A zero buffer profile left over by a storm is not the original one
+                if (ZeroBufferProfile::isZeroBufferProfile(attr.value.oid))
+                {
+                    return;
+                }
+
+                ZeroBufferProfile::getOriginalQueueProfiles()[queue] = attr.value.oid;
+            });
+    }
+}
+
+void PfcWdZeroBufferHandler::updateQueueBufferProfile(sai_object_id_t queue, sai_object_id_t profile)
+{
+    SWSS_LOG_ENTER();
+
+    auto &originalProfiles = ZeroBufferProfile::getOriginalQueueProfiles();
+    auto it = originalProfiles.find(queue);
+    if (it != originalProfiles.end())
+    {
+        it->second = profile;
+    }
 }
 
-void PfcWdZeroBufferHandler::setQueueLockFlag(Port& port, bool isLocked) const
+void PfcWdZeroBufferHandler::clearQueueBufferProfiles(const vector<sai_object_id_t> &queues)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto queue : queues)
+    {
+        ZeroBufferProfile::getOriginalQueueProfiles().erase(queue);
+    }
+}
+
+void PfcWdZeroBufferHandler::setQueueLockFlag(Port& port, sai_object_id_t queue, bool isLocked)
 {
     // set lock bits on queue
     for (size_t i = 0; i < port.m_queue_ids.size(); ++i)
     {
-        if (port.m_queue_ids[i] == getQueue())
+        if (port.m_queue_ids[i] == queue)
         {
             port.m_queue_lock[i] = isLocked;
         }
@@ -773,6 +1163,11 @@ sai_object_id_t PfcWdZeroBufferHandler::ZeroBufferProfile::getZeroBufferProfile(
     return getInstance().getProfile();
 }
 
+bool PfcWdZeroBufferHandler::ZeroBufferProfile::isZeroBufferProfile(sai_object_id_t profile)
+{
+    return profile != SAI_NULL_OBJECT_ID && profile == getInstance().getProfile();
+}
+
 void PfcWdZeroBufferHandler::ZeroBufferProfile::createZeroBufferProfile()
 {
     SWSS_LOG_ENTER();
@@ -3,6 +3,9 @@
 
 #include <vector>
 #include <memory>
+#include <map>
+#include <functional>
+#include <unordered_map>
 #include "aclorch.h"
 #include "table.h"
 
@@ -21,6 +24,67 @@ struct PfcWdHwStats
     uint64_t rxDropPkt;
 };
 
+// SAI operations of the action handlers created in one detection cycle
+// While a batch is the current one, the handlers queue their queue attributes and port PFC masks
+// into it instead of programming them one by one. flush() gets the queue attributes with one bulk call,
+// which may queue more sets from the callbacks, sets the queue attributes with another bulk call,
+// then sets the PFC mask of each port once for all of its queues. Restored handlers queue theirs the same way.
+class PfcWdActionBatch
+{
+    public:
+        typedef function<void(sai_status_t, const sai_attribute_t&)> Callback;
+
+        PfcWdActionBatch(void);
+        ~PfcWdActionBatch(void);
+
+        PfcWdActionBatch(const PfcWdActionBatch&) = delete;
+        PfcWdActionBatch& operator=(const PfcWdActionBatch&) = delete;
+
+        static inline PfcWdActionBatch *getCurrent(void)
+        {
+            return m_current;
+        }
+
+        void getQueueAttribute(sai_object_id_t queue, sai_attr_id_t id, Callback done);
+        void setQueueAttribute(sai_object_id_t queue, const sai_attribute_t &attr, Callback done = nullptr);
+        // Disables or enables PFC on the priority of the queue, the last call on a priority wins
+        void disablePortPfc(sai_object_id_t port, uint8_t queueId);
+        void enablePortPfc(sai_object_id_t port, uint8_t queueId);
+
+        void flush(void);
+        // Programs the pending operations of the queue in the current batches, before its handler goes away
+        static void flushQueue(sai_object_id_t queue);
+
+    private:
+        struct Operation
+        {
+            sai_object_id_t queue;
+            sai_attribute_t attr;
+            Callback done;
+        };
+
+        struct PfcMaskUpdate
+        {
+            uint8_t disable = 0;
+            uint8_t enable = 0;
+        };
+
+        void bulkQueueAttributes(vector<Operation> &ops, bool set);
+        void flushOperations(sai_object_id_t queue);
+        static vector<Operation> takeOperations(vector<Operation> &ops, sai_object_id_t queue);
+
+        vector<Operation> m_gets;
+        vector<Operation> m_sets;
+        // port => priorities to disable and enable PFC on
+        map<sai_object_id_t, PfcMaskUpdate> m_portPfcUpdates;
+
+        PfcWdActionBatch *m_previous = nullptr;
+
+        static PfcWdActionBatch *m_current;
+        static bool m_isBulkGetSupported;
+        static bool m_isBulkSetSupported;
+};
+
 // PFC queue interface class
 // It resembles RAII behavior - pause storm is mitigated (queue is locked) on creation,
 // and is restored (queue released) on removal
@@ -134,12 +198,22 @@ class PfcWdZeroBufferHandler: public PfcWdLossyHandler
                 uint8_t queueId, shared_ptr<Table> countersTable);
         virtual ~PfcWdZeroBufferHandler(void);
 
+        /*
+         * Takes the buffer profiles of the queues when the watchdog starts on them,
+         * so that a storm only sets the zero buffer profile and restores the taken one.
+         * The profiles are read with one bulk call.
+        */
+        static void snapshotQueueBufferProfiles(const vector<sai_object_id_t> &queues);
+        // Follows the buffer profile BufferOrch applies to a queue being watched
+        static void updateQueueBufferProfile(sai_object_id_t queue, sai_object_id_t profile);
+        static void clearQueueBufferProfiles(const vector<sai_object_id_t> &queues);
+
     private:
         /*
          * Sets lock bits on port's queue
          * to protect it from being changed by other Orch's
         */
-        void setQueueLockFlag(Port& port, bool isLocked) const;
+        static void setQueueLockFlag(Port& port, sai_object_id_t queue, bool isLocked);
 
         // Singletone class for keeping shared data - zero buffer profiles
         class ZeroBufferProfile
@@ -147,6 +221,13 @@ class PfcWdZeroBufferHandler: public PfcWdLossyHandler
             public:
                 ~ZeroBufferProfile(void);
                 static sai_object_id_t getZeroBufferProfile();
+                static bool isZeroBufferProfile(sai_object_id_t profile);
+
+                // queue => buffer profile of the queue out of storm
+                static unordered_map<sai_object_id_t, sai_object_id_t> &getOriginalQueueProfiles(void)
+                {
+                    return getInstance().m_originalQueueProfiles;
+                }
 
             private:
                 ZeroBufferProfile(void);
@@ -166,9 +247,17 @@ class PfcWdZeroBufferHandler: public PfcWdLossyHandler
 
                 sai_object_id_t m_zeroEgressBufferPool = SAI_NULL_OBJECT_ID;
                 sai_object_id_t m_zeroEgressBufferProfile = SAI_NULL_OBJECT_ID;
+                unordered_map<sai_object_id_t, sai_object_id_t> m_originalQueueProfiles;
         };
 
-        sai_object_id_t m_originalQueueBufferProfile = SAI_NULL_OBJECT_ID;
+        // Buffer profile to restore once the zero buffer profile is set, it can be null.
+        // Shared with the callbacks of the batch, which don't refer to the handler.
+        struct OriginalQueueBufferProfile
+        {
+            bool zeroBufferProfileSet = false;
+            sai_object_id_t profile = SAI_NULL_OBJECT_ID;
+        };
+        shared_ptr<OriginalQueueBufferProfile> m_originalQueueBufferProfile = make_shared<OriginalQueueBufferProfile>();
 };
 
 // PFC queue that implements drop action by draining queue via SAI
@@ -0,0 +1,252 @@
+#include "pfcwddetector.h"
+#include "logger.h"
+
+using namespace std;
+
+shared_ptr<PfcWdDetector> PfcWdDetector::create(const string &platform)
+{
+    if (platform == "mellanox")
+    {
+        return make_shared<MellanoxPfcWdDetector>();
+    }
+    else if (platform == "vs")
+    {
+        return make_shared<VsPfcWdDetector>();
+    }
+
+    return nullptr;
+}
+
+void PfcWdDetector::addQueue(sai_object_id_t queueId, sai_object_id_t portId, uint8_t index,
+        uint32_t detectionTime, uint32_t restorationTime, bool alert)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_queueIndexes.find(queueId);
+    if (it != m_queueIndexes.end())
+    {
+        // The time left is reset only when it is consumed, as the plugins do
+        auto &queue = m_queues[it->second];
+        queue.detectionTime = detectionTime;
+        queue.restorationTime = restorationTime;
+        queue.alert = alert;
+        return;
+    }
+
+    Queue queue = {};
+    queue.queueId = queueId;
+    queue.portId = portId;
+    queue.index = index;
+    queue.detectionTime = detectionTime;
+    queue.restorationTime = restorationTime;
+    queue.alert = alert;
+    queue.operational = true;
+    queue.detectionTimeLeft = detectionTime;
+    queue.restorationTimeLeft = restorationTime;
+
+    m_queueIndexes[queueId] = m_queues.size();
+    m_queues.push_back(queue);
+}
+
+void PfcWdDetector::removeQueue(sai_object_id_t queueId)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_queueIndexes.find(queueId);
+    if (it == m_queueIndexes.end())
+    {
+        return;
+    }
+
+    // Move the last queue to the slot to keep the array contiguous
+    size_t pos = it->second;
+    m_queueIndexes.erase(it);
+    if (pos != m_queues.size() - 1)
+    {
+        m_queues[pos] = m_queues.back();
+        m_queueIndexes[m_queues[pos].queueId] = pos;
+    }
+    m_queues.pop_back();
+}
+
+void PfcWdDetector::setOperational(sai_object_id_t queueId, bool operational)
+{
+    auto it = m_queueIndexes.find(queueId);
+    if (it != m_queueIndexes.end())
+    {
+        m_queues[it->second].operational = operational;
+    }
+}
+
+void PfcWdDetector::poll(uint64_t now, const vector<PfcWdCounterSample> &samples, vector<PfcWdDetectorResult> &results)
+{
+    for (size_t i = 0; i < m_queues.size() && i < samples.size(); i++)
+    {
+        auto &queue = m_queues[i];
+        const auto &sample = samples[i];
+
+        // The queue is inserted to FLEX_COUNTER_DB but the counters haven't been polled yet
+        if (!sample.valid)
+        {
+            continue;
+        }
+
+        if (queue.operational || queue.alert)
+        {
+            detect(queue, sample, now, results);
+        }
+        else if (queue.restorationTime != 0)
+        {
+            restore(queue, sample, now, results);
+        }
+    }
+}
+
+uint64_t PfcWdDetector::getPollTime(const Queue &queue, uint64_t now) const
+{
+    if (!queue.polled)
+    {
+        return 0;
+    }
+
+    uint64_t elapsed = now - queue.lastPollTime;
+    if (m_pollInterval == 0)
+    {
+        return elapsed;
+    }
+
+    uint64_t polls = (elapsed + m_pollInterval / 2) / m_pollInterval;
+    return (polls ? polls : 1) * m_pollInterval;
+}
+
+void PfcWdDetector::detect(Queue &queue, const PfcWdCounterSample &sample, uint64_t now, vector<PfcWdDetectorResult> &results)
+{
+    bool hasLast = queue.packetsLastValid && queue.pfcRxPacketsLastValid && queue.pfcDurationLastValid;
+
+    if (hasLast && !sample.debugStorm && !queue.staleSkipped
+        && sample.occupancyBytes == queue.occupancyBytesLast
+        && sample.packets == queue.packetsLast
+        && sample.pfcRxPackets == queue.pfcRxPacketsLast
+        && sample.pfcDuration == queue.pfcDurationLast)
+    {
+        queue.staleSkipped = true;
+        return;
+    }
+    queue.staleSkipped = false;
+
+    uint64_t pollTime = getPollTime(queue, now);
+    bool deadlock = false;
+
+    if (hasLast)
+    {
+        if (isStorm(queue, sample, pollTime))
+        {
+            if (queue.detectionTimeLeft <= pollTime)
+            {
+                results.push_back({queue.queueId, PfcWdDetectorEvent::PFC_WD_DETECTOR_STORM, stormInfo(queue, sample, pollTime)});
+                deadlock = true;
+                queue.pfcRxPacketsLastValid = false;
+                queue.pfcDurationLastValid = false;
+                queue.detectionTimeLeft = queue.detectionTime;
+            }
+            else
+            {
+                queue.detectionTimeLeft -= pollTime;
+            }
+        }
+        else
+        {
+            if (queue.alert && !queue.operational)
+            {
+                results.push_back({queue.queueId, PfcWdDetectorEvent::PFC_WD_DETECTOR_RESTORE, ""});
+            }
+            queue.detectionTimeLeft = queue.detectionTime;
+        }
+    }
+
+    queue.occupancyBytesLast = sample.occupancyBytes;
+    queue.packetsLast = sample.packets;
+    queue.packetsLastValid = true;
+    if (!deadlock)
+    {
+        queue.pfcRxPacketsLast = sample.pfcRxPackets;
+        queue.pfcRxPacketsLastValid = true;
+        queue.pfcDurationLast = sample.pfcDuration;
+        queue.pfcDurationLastValid = true;
+    }
+
+    queue.polled = true;
+    queue.lastPollTime = now;
+}
+
+void PfcWdDetector::restore(Queue &queue, const PfcWdCounterSample &sample, uint64_t now, vector<PfcWdDetectorResult> &results)
+{
+    uint64_t pollTime = getPollTime(queue, now);
+
+    if (queue.pfcRxPacketsLastValid)
+    {
+        // Check actual condition of queue being restored from PFC storm
+        if (sample.pfcRxPackets == queue.pfcRxPacketsLast && !sample.debugStorm)
+        {
+            if (queue.restorationTimeLeft <= pollTime)
+            {
+                results.push_back({queue.queueId, PfcWdDetectorEvent::PFC_WD_DETECTOR_RESTORE, ""});
+                queue.restorationTimeLeft = queue.restorationTime;
+            }
+            else
+            {
+                queue.restorationTimeLeft -= pollTime;
+            }
+        }
+        else
+        {
+            queue.restorationTimeLeft = queue.restorationTime;
+        }
+    }
+
+    queue.pfcRxPacketsLast = sample.pfcRxPackets;
+    queue.pfcRxPacketsLastValid = true;
+    queue.staleSkipped = false;
+
+    queue.polled = true;
+    queue.lastPollTime = now;
+}
+
+string PfcWdDetector::stormInfo(const Queue &queue, const PfcWdCounterSample &sample, uint64_t pollTime)
+{
+    return "occupancy:" + to_string(sample.occupancyBytes) +
+           "|packets:" + to_string(sample.packets) +
+           "|packets_last:" + to_string(queue.packetsLast) +
+           "|pfc_rx_packets:" + to_string(sample.pfcRxPackets) +
+           "|pfc_rx_packets_last:" + to_string(queue.pfcRxPacketsLast) +
+           "|pfc_duration:" + to_string(sample.pfcDuration) +
+           "|pfc_duration_last:" + to_string(queue.pfcDurationLast) +
+           "|effective_poll_time:" + to_string(pollTime);
+}
+
+bool MellanoxPfcWdDetector::isStorm(const Queue &queue, const PfcWdCounterSample &sample, uint64_t pollTime) const
+{
+    if (sample.debugStorm)
+    {
+        return true;
+    }
+
+    return sample.occupancyBytes > 0
+        && sample.packets == queue.packetsLast
+        && (double)sample.pfcDuration - (double)queue.pfcDurationLast > (double)pollTime * 0.99;
+}
+
+bool VsPfcWdDetector::isStorm(const Queue &queue, const PfcWdCounterSample &sample, uint64_t pollTime) const
+{
+    if (sample.debugStorm || sample.packets != queue.packetsLast)
+    {
+        return sample.debugStorm;
+    }
+
+    if (sample.occupancyBytes > 0)
+    {
+        return sample.pfcRxPackets > queue.pfcRxPacketsLast;
+    }
+
+    return (double)sample.pfcDuration - (double)queue.pfcDurationLast > (double)pollTime * 0.8;
+}
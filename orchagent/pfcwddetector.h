@@ -0,0 +1,147 @@
+#ifndef PFC_WATCHDOG_DETECTOR_H
+#define PFC_WATCHDOG_DETECTOR_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+extern "C" {
+#include "sai.h"
+}
+
+// Counters of a queue and of the corresponding PFC priority of its port, read in one poll
+struct PfcWdCounterSample
+{
+    // False if any of the counters is not in COUNTERS_DB yet
+    bool valid = false;
+    uint64_t occupancyBytes = 0;
+    uint64_t packets = 0;
+    uint64_t pfcRxPackets = 0;
+    uint64_t pfcDuration = 0;
+    bool debugStorm = false;
+};
+
+enum class PfcWdDetectorEvent
+{
+    PFC_WD_DETECTOR_STORM,
+    PFC_WD_DETECTOR_RESTORE,
+};
+
+struct PfcWdDetectorResult
+{
+    sai_object_id_t queueId;
+    PfcWdDetectorEvent event;
+    // Counters the decision is based on, in the format of the additional info of the notification
+    std::string info;
+};
+
+/*
+ * PfcWdDetector
+ *
+ * In-process replacement of the PFC storm detection and restoration plugins
+ * (pfc_detect_<vendor>.lua and pfc_restore.lua) run by syncd on each poll of the PFC_WD counter group.
+ *
+ * The state of all the watched queues, which the plugins keep in the *_last and *_LEFT fields of COUNTERS_DB,
+ * is held in one contiguous array. On each poll the orch reads the counters of the queues, in the order of
+ * getQueues(), and the detector steps the state machine of each queue and returns the storm and restore events.
+ *
+ * The counters are polled by syncd independently of the detector, every poll interval. The poll time between
+ * two samples of a queue is therefore the measured time rounded to whole poll intervals, which is the time
+ * the counters have advanced by. For the same reason a sample identical to the last one does not necessarily
+ * mean the counters have not moved. One such sample in a row is skipped by the detection instead of resetting
+ * its timer, which only matters to a queue in storm, whose pause duration keeps increasing.
+ *
+ * The state is not persisted across warm restart. bake() clears the *_last and *_LEFT fields so that the plugins
+ * start over as on cold boot, and the detector starts over likewise, from the first sample of each queue. Only the
+ * queues in storm are carried over: the orch restores their actions from APPL_DB and marks them not operational,
+ * so that they wait for restoration instead of a new detection.
+ */
+class PfcWdDetector
+{
+public:
+    struct Queue
+    {
+        sai_object_id_t queueId;
+        sai_object_id_t portId;
+        uint8_t index;
+        // In the unit of microsecond, restoration time is 0 if it is not configured
+        uint64_t detectionTime;
+        uint64_t restorationTime;
+        bool alert;
+        // No storm action is in effect on the queue
+        bool operational;
+
+        uint64_t detectionTimeLeft;
+        uint64_t restorationTimeLeft;
+
+        // Values of the last sample, the validity follows that of the *_last fields of the lua plugins
+        bool packetsLastValid;
+        bool pfcRxPacketsLastValid;
+        bool pfcDurationLastValid;
+        uint64_t occupancyBytesLast;
+        uint64_t packetsLast;
+        uint64_t pfcRxPacketsLast;
+        uint64_t pfcDurationLast;
+
+        bool polled;
+        bool staleSkipped;
+        uint64_t lastPollTime;
+    };
+
+    // Returns the model of the vendor, nullptr if there is no native model for it
+    static std::shared_ptr<PfcWdDetector> create(const std::string &platform);
+
+    virtual ~PfcWdDetector() = default;
+
+    // Poll interval of the counters in microseconds, 0 to take the measured time as it is
+    void setPollInterval(uint64_t pollInterval)
+    {
+        m_pollInterval = pollInterval;
+    }
+
+    // Starts watching the queue, or updates the configuration of a queue being watched
+    void addQueue(sai_object_id_t queueId, sai_object_id_t portId, uint8_t index,
+            uint32_t detectionTime, uint32_t restorationTime, bool alert);
+    void removeQueue(sai_object_id_t queueId);
+    void setOperational(sai_object_id_t queueId, bool operational);
+
+    const std::vector<Queue> &getQueues() const
+    {
+        return m_queues;
+    }
+
+    // samples[i] is the sample of getQueues()[i], now is the time of sampling in microseconds
+    void poll(uint64_t now, const std::vector<PfcWdCounterSample> &samples, std::vector<PfcWdDetectorResult> &results);
+
+protected:
+    // Vendor specific condition of the queue being in storm, against the last sample
+    virtual bool isStorm(const Queue &queue, const PfcWdCounterSample &sample, uint64_t pollTime) const = 0;
+
+private:
+    std::vector<Queue> m_queues;
+    std::unordered_map<sai_object_id_t, size_t> m_queueIndexes;
+    uint64_t m_pollInterval = 0;
+
+    uint64_t getPollTime(const Queue &queue, uint64_t now) const;
+
+    void detect(Queue &queue, const PfcWdCounterSample &sample, uint64_t now, std::vector<PfcWdDetectorResult> &results);
+    void restore(Queue &queue, const PfcWdCounterSample &sample, uint64_t now, std::vector<PfcWdDetectorResult> &results);
+    static std::string stormInfo(const Queue &queue, const PfcWdCounterSample &sample, uint64_t pollTime);
+};
+
+// Native model of pfc_detect_mellanox.lua
+class MellanoxPfcWdDetector : public PfcWdDetector
+{
+protected:
+    bool isStorm(const Queue &queue, const PfcWdCounterSample &sample, uint64_t pollTime) const override;
+};
+
+// Native model of pfc_detect_vs.lua
+class VsPfcWdDetector : public PfcWdDetector
+{
+protected:
+    bool isStorm(const Queue &queue, const PfcWdCounterSample &sample, uint64_t pollTime) const override;
+};
+
+#endif
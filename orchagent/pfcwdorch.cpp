@@ -1,6 +1,9 @@
 #include <limits.h>
 #include <inttypes.h>
 #include <unordered_map>
+#include <unordered_set>
+#include <chrono>
+#include <type_traits>
 #include "pfcwdorch.h"
 #include "sai_serialize.h"
 #include "portsorch.h"
@@ -10,6 +13,7 @@
 #include "notifier.h"
 #include "schema.h"
 #include "subscriberstatetable.h"
+#include "tablesnapshot.h"
 
 #define PFC_WD_GLOBAL                   "GLOBAL"
 #define PFC_WD_ACTION                   "action"
@@ -17,6 +21,7 @@
 #define PFC_WD_RESTORATION_TIME         "restoration_time"
 #define BIG_RED_SWITCH_FIELD            "BIG_RED_SWITCH"
 #define PFC_WD_IN_STORM                 "storm"
+#define PFC_WD_STATS_TABLE              "PFC_WD_STATS"
 
 #define PFC_WD_DETECTION_TIME_MAX       (5 * 1000)
 #define PFC_WD_DETECTION_TIME_MIN       100
@@ -346,6 +351,24 @@ task_process_status PfcWdSwOrch<DropHandler, ForwardHandler>::createEntry(const
             if (field == POLL_INTERVAL_FIELD)
             {
                 setFlexCounterGroupPollInterval(PFC_WD_FLEX_COUNTER_GROUP, value);
+
+                if (m_detectorTimer != nullptr)
+                {
+                    try
+                    {
+                        m_pollInterval = to_uint<uint32_t>(value, 1, UINT32_MAX);
+                    }
+                    catch (const exception& e)
+                    {
+                        SWSS_LOG_ERROR("Invalid PFC watchdog poll interval %s: %s", value.c_str(), e.what());
+                        continue;
+                    }
+
+                    auto interv = timespec { .tv_sec = m_pollInterval / 1000, .tv_nsec = (m_pollInterval % 1000) * 1000000 };
+                    m_detector->setPollInterval(m_pollInterval * 1000);
+                    m_detectorTimer->setInterval(interv);
+                    m_detectorTimer->reset();
+                }
             }
             else if (field == BIG_RED_SWITCH_FIELD)
             {
@@ -463,6 +486,10 @@ void PfcWdSwOrch<DropHandler, ForwardHandler>::enableBigRedSwitchMode()
         {
             entry.second.handler->commitCounters();
             entry.second.handler = nullptr;
+            if (m_detector)
+            {
+                m_detector->setOperational(entry.first, true);
+            }
         }
     }
 
@@ -555,10 +582,12 @@ bool PfcWdSwOrch<DropHandler, ForwardHandler>::registerInWdDb(const Port& port,
         startFlexCounterPolling(gSwitchId, key, filteredStr, PORT_COUNTER_ID_LIST);
     }
 
+    vector<sai_object_id_t> queueIds;
     for (auto i : losslessTc)
     {
         sai_object_id_t queueId = port.m_queue_ids[i];
         string queueIdStr = sai_serialize_object_id(queueId);
+        queueIds.push_back(queueId);
 
         // Store detection and restoration time for plugins
         vector<FieldValueTuple> countersFieldValues;
@@ -590,12 +619,24 @@ bool PfcWdSwOrch<DropHandler, ForwardHandler>::registerInWdDb(const Port& port,
         // Create internal entry
         m_entryMap.emplace(queueId, PfcWdQueueEntry(action, port.m_port_id, i, port.m_alias));
 
+        if (m_detector)
+        {
+            m_detector->addQueue(queueId, port.m_port_id, i,
+                    detectionTime * 1000, restorationTime * 1000,
+                    action == PfcWdAction::PFC_WD_ACTION_ALERT);
+        }
+
         // Initialize PFC WD related counters
         PfcWdActionHandler::initWdCounters(
                 this->getCountersTable(),
                 sai_serialize_object_id(queueId));
     }
 
+    if (usesZeroBuffer())
+    {
+        PfcWdZeroBufferHandler::snapshotQueueBufferProfiles(queueIds);
+    }
+
     // We do NOT need to create ACL table group here. It will be
     // done when ACL tables are bound to ports
     return true;
@@ -668,11 +709,28 @@ void PfcWdSwOrch<DropHandler, ForwardHandler>::unregisterFromWdDb(const Port& po
 
         m_entryMap.erase(queueId);
 
+        if (m_detector)
+        {
+            m_detector->removeQueue(queueId);
+        }
+
         // Clean up
         string countersKey = this->getCountersTable()->getTableName() + this->getCountersTable()->getTableNameSeparator() + sai_serialize_object_id(queueId);
         this->getCountersDb()->hdel(countersKey, {"PFC_WD_DETECTION_TIME", "PFC_WD_RESTORATION_TIME", "PFC_WD_ACTION", "PFC_WD_STATUS"});
     }
 
+    if (usesZeroBuffer())
+    {
+        vector<sai_object_id_t> queueIds(port.m_queue_ids.begin(), port.m_queue_ids.begin() + PFC_WD_TC_MAX);
+        PfcWdZeroBufferHandler::clearQueueBufferProfiles(queueIds);
+    }
+}
+
+template <typename DropHandler, typename ForwardHandler>
+bool PfcWdSwOrch<DropHandler, ForwardHandler>::usesZeroBuffer(void) const
+{
+    return is_base_of<PfcWdZeroBufferHandler, DropHandler>::value ||
+           is_base_of<PfcWdZeroBufferHandler, ForwardHandler>::value;
 }
 
 template <typename DropHandler, typename ForwardHandler>
@@ -689,7 +747,8 @@ PfcWdSwOrch<DropHandler, ForwardHandler>::PfcWdSwOrch(
     c_queueAttrIds(queueAttrIds),
     m_pollInterval(pollInterval),
     m_applDb(make_shared<DBConnector>("APPL_DB", 0)),
-    m_applTable(make_shared<Table>(m_applDb.get(), APP_PFC_WD_TABLE_NAME "_INSTORM"))
+    m_applTable(make_shared<Table>(m_applDb.get(), APP_PFC_WD_TABLE_NAME "_INSTORM")),
+    m_statsTable(make_shared<Table>(this->getCountersDb().get(), PFC_WD_STATS_TABLE))
 {
     SWSS_LOG_ENTER();
 
@@ -704,22 +763,32 @@ PfcWdSwOrch<DropHandler, ForwardHandler>::PfcWdSwOrch(
         restorePluginName = "pfc_restore.lua";
     }
 
-    try
+    // The counters are still polled by syncd, but no plugin is run on them if the storm is detected natively
+    m_detector = PfcWdDetector::create(this->m_platform);
+    if (m_detector)
     {
-        string detectLuaScript = swss::loadLuaScript(detectPluginName);
-        detectSha = swss::loadRedisScript(
-                this->getCountersDb().get(),
-                detectLuaScript);
-
-        string restoreLuaScript = swss::loadLuaScript(restorePluginName);
-        restoreSha = swss::loadRedisScript(
-                this->getCountersDb().get(),
-                restoreLuaScript);
-        plugins = detectSha + "," + restoreSha;
+        SWSS_LOG_NOTICE("Use native PFC watchdog storm detection on platform %s", this->m_platform.c_str());
+        m_detector->setPollInterval(m_pollInterval * 1000);
     }
-    catch (...)
+    else
     {
-        SWSS_LOG_WARN("Lua scripts and polling interval for PFC watchdog were not set successfully");
+        try
+        {
+            string detectLuaScript = swss::loadLuaScript(detectPluginName);
+            detectSha = swss::loadRedisScript(
+                    this->getCountersDb().get(),
+                    detectLuaScript);
+
+            string restoreLuaScript = swss::loadLuaScript(restorePluginName);
+            restoreSha = swss::loadRedisScript(
+                    this->getCountersDb().get(),
+                    restoreLuaScript);
+            plugins = detectSha + "," + restoreSha;
+        }
+        catch (...)
+        {
+            SWSS_LOG_WARN("Lua scripts and polling interval for PFC watchdog were not set successfully");
+        }
     }
 
     setFlexCounterGroupParameter(PFC_WD_FLEX_COUNTER_GROUP,
@@ -740,6 +809,15 @@ PfcWdSwOrch<DropHandler, ForwardHandler>::PfcWdSwOrch(
     Orch::addExecutor(executor);
     timer->start();
 
+    if (m_detector)
+    {
+        auto detectInterv = timespec { .tv_sec = m_pollInterval / 1000, .tv_nsec = (m_pollInterval % 1000) * 1000000 };
+        m_detectorTimer = new SelectableTimer(detectInterv);
+        auto detectExecutor = new ExecutableTimer(m_detectorTimer, this, "PFC_WD_DETECT_POLL");
+        Orch::addExecutor(detectExecutor);
+        m_detectorTimer->start();
+    }
+
     auto ssTable = new swss::SubscriberStateTable(
             m_applDb.get(), APP_PFC_WD_TABLE_NAME, TableConsumable::DEFAULT_POP_BATCH_SIZE, default_orch_pri);
     auto ssConsumer = new Consumer(ssTable, this, APP_PFC_WD_TABLE_NAME);
@@ -795,6 +873,9 @@ void PfcWdSwOrch<DropHandler, ForwardHandler>::doTask(Consumer& consumer)
 
     if ((consumer.getDbName() == "APPL_DB") && (consumer.getTableName() == APP_PFC_WD_TABLE_NAME))
     {
+        // Storms ongoing before warm reboot are all mitigated in one batch
+        PfcWdActionBatch batch;
+
         auto it = consumer.m_toSync.begin();
         while (it != consumer.m_toSync.end())
         {
@@ -899,36 +980,100 @@ void PfcWdSwOrch<DropHandler, ForwardHandler>::doTask(swss::NotificationConsumer
 {
     SWSS_LOG_ENTER();
 
-    string queueIdStr;
-    string event;
-    vector<swss::FieldValueTuple> values;
+    // The plugin reports all the queues of a detection cycle together, so take all of them at once
+    std::deque<KeyOpFieldsValuesTuple> notifications;
+    wdNotification.pops(notifications);
 
-    wdNotification.pop(queueIdStr, event, values);
-
-    string info;
-    for (auto &fv : values)
+    vector<PfcWdQueueEvent> events;
+    for (const auto &notification : notifications)
     {
-        info += fvField(fv) + ":" + fvValue(fv) + "|";
+        const string &queueIdStr = kfvKey(notification);
+
+        string info;
+        for (auto &fv : kfvFieldsValues(notification))
+        {
+            info += fvField(fv) + ":" + fvValue(fv) + "|";
+        }
+        if (!info.empty())
+        {
+            info.pop_back();
+        }
+
+        sai_object_id_t queueId = SAI_NULL_OBJECT_ID;
+        sai_deserialize_object_id(queueIdStr, queueId);
+
+        events.push_back({kfvOp(notification), queueId, info});
     }
-    if (!info.empty())
+
+    startWdActionOnQueues(events);
+}
+
+template <typename DropHandler, typename ForwardHandler>
+void PfcWdSwOrch<DropHandler, ForwardHandler>::startWdActionOnQueues(const vector<PfcWdQueueEvent> &events)
+{
+    SWSS_LOG_ENTER();
+
+    auto start = chrono::steady_clock::now();
+    size_t stormCount = 0;
+
     {
-        info.pop_back();
-    }
+        PfcWdActionBatch batch;
 
-    sai_object_id_t queueId = SAI_NULL_OBJECT_ID;
-    sai_deserialize_object_id(queueIdStr, queueId);
+        for (const auto &event : events)
+        {
+            if (event.event == PFC_WD_IN_STORM)
+            {
+                stormCount++;
+            }
+            else
+            {
+                // The handlers created in the batch must be programmed before any of them is removed
+                batch.flush();
+            }
+
+            if (!startWdActionOnQueue(event.event, event.queueId, event.info))
+            {
+                SWSS_LOG_ERROR("Failed to start PFC watchdog %s event action on queue 0x%" PRIx64, event.event.c_str(), event.queueId);
+            }
+        }
+    }
 
-    if (!startWdActionOnQueue(event, queueId, info))
+    if (stormCount != 0)
     {
-        SWSS_LOG_ERROR("Failed to start PFC watchdog %s event action on queue %s", event.c_str(), queueIdStr.c_str());
+        uint64_t latency = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+        updateMitigationStats(stormCount, latency);
     }
 }
 
+template <typename DropHandler, typename ForwardHandler>
+void PfcWdSwOrch<DropHandler, ForwardHandler>::updateMitigationStats(size_t queueCount, uint64_t latency)
+{
+    SWSS_LOG_ENTER();
+
+    m_mitigationCycles++;
+    m_maxMitigationLatency = max(m_maxMitigationLatency, latency);
+
+    vector<FieldValueTuple> fvs;
+    fvs.emplace_back("MITIGATION_CYCLES", to_string(m_mitigationCycles));
+    fvs.emplace_back("LAST_MITIGATION_QUEUES", to_string(queueCount));
+    fvs.emplace_back("LAST_MITIGATION_LATENCY_US", to_string(latency));
+    fvs.emplace_back("MAX_MITIGATION_LATENCY_US", to_string(m_maxMitigationLatency));
+    m_statsTable->set(PFC_WD_GLOBAL, fvs);
+
+    SWSS_LOG_INFO("Mitigated PFC storm on %zu queue(s) in %" PRIu64 "us", queueCount, latency);
+}
+
 template <typename DropHandler, typename ForwardHandler>
 void PfcWdSwOrch<DropHandler, ForwardHandler>::doTask(SelectableTimer &timer)
 {
     SWSS_LOG_ENTER();
 
+    if (&timer == m_detectorTimer)
+    {
+        pollDetector();
+        return;
+    }
+
     for (auto& handlerPair : m_entryMap)
     {
         if (handlerPair.second.handler != nullptr)
@@ -939,6 +1084,137 @@ void PfcWdSwOrch<DropHandler, ForwardHandler>::doTask(SelectableTimer &timer)
 
 }
 
+template <typename DropHandler, typename ForwardHandler>
+void PfcWdSwOrch<DropHandler, ForwardHandler>::pollDetector(void)
+{
+    SWSS_LOG_ENTER();
+
+    const auto &queues = m_detector->getQueues();
+    if (queues.empty() || m_bigRedSwitchFlag)
+    {
+        return;
+    }
+
+    // Dedicated connection, so that the pipeline is not mixed with other requests to COUNTERS_DB
+    if (m_detectorCountersDb == nullptr)
+    {
+        m_detectorCountersDb.reset(this->getCountersDb()->newConnector(0));
+    }
+
+    // The counters of all the queues, and once of each of their ports, are read in one pipeline
+    vector<string> keys;
+    unordered_set<sai_object_id_t> ports;
+    for (const auto &queue : queues)
+    {
+        keys.push_back(sai_serialize_object_id(queue.queueId));
+    }
+    for (const auto &queue : queues)
+    {
+        if (ports.insert(queue.portId).second)
+        {
+            keys.push_back(sai_serialize_object_id(queue.portId));
+        }
+    }
+
+    unordered_map<string, vector<FieldValueTuple>> counters;
+    try
+    {
+        readTableEntries(m_detectorCountersDb.get(), this->getCountersTable()->getTableName(),
+                this->getCountersTable()->getTableNameSeparator(), keys, gSnapshotWindowSize,
+                [&counters](KeyOpFieldsValuesTuple &&entry)
+                {
+                    counters.emplace(std::move(kfvKey(entry)), std::move(kfvFieldsValues(entry)));
+                });
+    }
+    catch (const exception& e)
+    {
+        // The replies of the pipeline can't be told apart any more
+        SWSS_LOG_ERROR("Failed to read PFC watchdog counters: %s", e.what());
+        m_detectorCountersDb.reset();
+        return;
+    }
+
+    m_detectorSamples.assign(queues.size(), PfcWdCounterSample());
+    for (size_t i = 0; i < queues.size(); i++)
+    {
+        const auto &queue = queues[i];
+        auto &sample = m_detectorSamples[i];
+
+        auto queueCounters = counters.find(keys[i]);
+        if (queueCounters == counters.end())
+        {
+            continue;
+        }
+
+        try
+        {
+            bool hasOccupancy = false, hasPackets = false, hasPfcRxPackets = false, hasPfcDuration = false;
+            for (const auto &fv : queueCounters->second)
+            {
+                if (fvField(fv) == "SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES")
+                {
+                    sample.occupancyBytes = stoull(fvValue(fv));
+                    hasOccupancy = true;
+                }
+                else if (fvField(fv) == "SAI_QUEUE_STAT_PACKETS")
+                {
+                    sample.packets = stoull(fvValue(fv));
+                    hasPackets = true;
+                }
+                else if (fvField(fv) == "DEBUG_STORM")
+                {
+                    sample.debugStorm = (fvValue(fv) == "enabled");
+                }
+            }
+
+            auto portCounters = counters.find(sai_serialize_object_id(queue.portId));
+            if (portCounters != counters.end())
+            {
+                string pfcRxPacketsKey = SAI_PORT_STAT_PFC_PREFIX + to_string(queue.index) + "_RX_PKTS";
+                string pfcDurationKey = SAI_PORT_STAT_PFC_PREFIX + to_string(queue.index) + "_RX_PAUSE_DURATION_US";
+                for (const auto &fv : portCounters->second)
+                {
+                    if (fvField(fv) == pfcRxPacketsKey)
+                    {
+                        sample.pfcRxPackets = stoull(fvValue(fv));
+                        hasPfcRxPackets = true;
+                    }
+                    else if (fvField(fv) == pfcDurationKey)
+                    {
+                        sample.pfcDuration = stoull(fvValue(fv));
+                        hasPfcDuration = true;
+                    }
+                }
+            }
+
+            sample.valid = hasOccupancy && hasPackets && hasPfcRxPackets && hasPfcDuration;
+        }
+        catch (const exception& e)
+        {
+            SWSS_LOG_ERROR("Failed to parse PFC watchdog counters of queue 0x%" PRIx64 ": %s", queue.queueId, e.what());
+            sample.valid = false;
+        }
+    }
+
+    uint64_t now = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+
+    m_detectorResults.clear();
+    m_detector->poll(now, m_detectorSamples, m_detectorResults);
+    if (m_detectorResults.empty())
+    {
+        return;
+    }
+
+    vector<PfcWdQueueEvent> events;
+    for (const auto &result : m_detectorResults)
+    {
+        string event = (result.event == PfcWdDetectorEvent::PFC_WD_DETECTOR_STORM) ? PFC_WD_IN_STORM : "restore";
+        events.push_back({event, result.queueId, result.info});
+    }
+
+    startWdActionOnQueues(events);
+}
+
 template <typename DropHandler, typename ForwardHandler>
 void PfcWdSwOrch<DropHandler, ForwardHandler>::report_pfc_storm(
         sai_object_id_t id, const PfcWdQueueEntry *entry, const string &info)
@@ -975,6 +1251,23 @@ void PfcWdSwOrch<DropHandler, ForwardHandler>::report_pfc_storm(
 
 template <typename DropHandler, typename ForwardHandler>
 bool PfcWdSwOrch<DropHandler, ForwardHandler>::startWdActionOnQueue(const string &event, sai_object_id_t queueId, const string &info)
+{
+    bool ret = handleWdActionOnQueue(event, queueId, info);
+
+    if (m_detector)
+    {
+        auto entry = m_entryMap.find(queueId);
+        if (entry != m_entryMap.end())
+        {
+            m_detector->setOperational(queueId, entry->second.handler == nullptr);
+        }
+    }
+
+    return ret;
+}
+
+template <typename DropHandler, typename ForwardHandler>
+bool PfcWdSwOrch<DropHandler, ForwardHandler>::handleWdActionOnQueue(const string &event, sai_object_id_t queueId, const string &info)
 {
     auto entry = m_entryMap.find(queueId);
     if (entry == m_entryMap.end())
@@ -1080,6 +1373,7 @@ bool PfcWdSwOrch<DropHandler, ForwardHandler>::bake()
 {
     // clean all *_last and *_LEFT fields in COUNTERS_TABLE
     // to allow warm-reboot pfc detect & restore state machine to enter the same init state as cold-reboot
+    // The native detector, if any, starts from the init state too as its state is not persisted
     vector<string> cKeys;
     this->getCountersTable()->getKeys(cKeys);
     for (const auto &key : cKeys)
@@ -4,6 +4,7 @@
 #include "orch.h"
 #include "port.h"
 #include "pfcactionhandler.h"
+#include "pfcwddetector.h"
 #include "producertable.h"
 #include "notificationconsumer.h"
 #include "timer.h"
@@ -116,6 +117,13 @@ private:
         shared_ptr<PfcWdActionHandler> handler = { nullptr };
     };
 
+    struct PfcWdQueueEvent
+    {
+        string event;
+        sai_object_id_t queueId;
+        string info;
+    };
+
     template <typename T>
     static string counterIdsToStr(const vector<T> ids, string (*convert)(T));
     bool registerInWdDb(const Port& port,
@@ -132,6 +140,15 @@ private:
 
     void report_pfc_storm(sai_object_id_t id, const PfcWdQueueEntry *, const string&);
 
+    // The action handlers set the zero buffer profile on the queues in storm
+    bool usesZeroBuffer(void) const;
+
+    void pollDetector(void);
+    bool handleWdActionOnQueue(const string &event, sai_object_id_t queueId, const string &info);
+    // Mitigates the storms reported in one detection cycle in a batch
+    void startWdActionOnQueues(const vector<PfcWdQueueEvent> &events);
+    void updateMitigationStats(size_t queueCount, uint64_t latency);
+
     map<sai_object_id_t, PfcWdQueueEntry> m_entryMap;
     map<sai_object_id_t, PfcWdQueueEntry> m_brsEntryMap;
 
@@ -142,9 +159,21 @@ private:
     bool m_bigRedSwitchFlag = false;
     int m_pollInterval;
 
+    // Native storm detection, which replaces the lua plugins if the platform has a model for it
+    shared_ptr<PfcWdDetector> m_detector = nullptr;
+    SelectableTimer *m_detectorTimer = nullptr;
+    unique_ptr<DBConnector> m_detectorCountersDb;
+    vector<PfcWdCounterSample> m_detectorSamples;
+    vector<PfcWdDetectorResult> m_detectorResults;
+
     shared_ptr<DBConnector> m_applDb = nullptr;
     // Track queues in storm
     shared_ptr<Table> m_applTable = nullptr;
+
+    // Latency of mitigating the storms of a detection cycle
+    shared_ptr<Table> m_statsTable = nullptr;
+    uint64_t m_mitigationCycles = 0;
+    uint64_t m_maxMitigationLatency = 0;
 };
 
 #endif
@@ -17,6 +17,7 @@
 #include <tuple>
 #include <sstream>
 #include <unordered_set>
+#include <chrono>
 
 #include <netinet/if_ether.h>
 #include "net/if.h"
@@ -548,7 +549,8 @@ PortsOrch::PortsOrch(DBConnector *db, DBConnector *stateDb, vector<table_name_wi
     m_pgIndexTable = unique_ptr<Table>(new Table(m_counter_db.get(), COUNTERS_PG_INDEX_MAP));
 
     m_state_db = shared_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
-    m_stateBufferMaximumValueTable = unique_ptr<Table>(new Table(m_state_db.get(), STATE_BUFFER_MAXIMUM_VALUE_TABLE));
+    m_statePipeline = unique_ptr<RedisPipeline>(new RedisPipeline(m_state_db.get()));
+    m_stateBufferMaximumValueTable = unique_ptr<Table>(new Table(m_statePipeline.get(), STATE_BUFFER_MAXIMUM_VALUE_TABLE, true));
 
     initGearbox();
 
@@ -1354,36 +1356,67 @@ bool PortsOrch::getPort(string alias, Port &p)
 {
     SWSS_LOG_ENTER();
 
-    if (m_portList.find(alias) == m_portList.end())
+    auto port = getPortPtr(alias);
+    if (port == nullptr)
     {
         return false;
     }
-    else
-    {
-        p = m_portList[alias];
-        return true;
-    }
+
+    p = *port;
+    return true;
 }
 
 bool PortsOrch::getPort(sai_object_id_t id, Port &port)
 {
     SWSS_LOG_ENTER();
 
+    auto p = getPortPtr(id);
+    if (p == nullptr)
+    {
+        return false;
+    }
+
+    port = *p;
+    return true;
+}
+
+const Port *PortsOrch::getPortPtr(const string &alias) const
+{
+    auto itr = m_portList.find(alias);
+    if (itr == m_portList.end())
+    {
+        return nullptr;
+    }
+
+    return &itr->second;
+}
+
+const Port *PortsOrch::getPortPtr(sai_object_id_t id) const
+{
     auto itr = saiOidToAlias.find(id);
     if (itr == saiOidToAlias.end())
     {
-        return false;
+        return nullptr;
     }
-    else
+
+    auto port = getPortPtr(itr->second);
+    if (port == nullptr)
     {
-        if (!getPort(itr->second, port))
-        {
-            SWSS_LOG_THROW("Inconsistent saiOidToAlias map and m_portList map: oid=%" PRIx64, id);
-        }
-        return true;
+        SWSS_LOG_THROW("Inconsistent saiOidToAlias map and m_portList map: oid=%" PRIx64, id);
     }
 
-    return false;
+    return port;
+}
+
+const Port *PortsOrch::getPortPtrByBridgePortId(sai_object_id_t bridge_port_id) const
+{
+    auto itr = saiOidToAlias.find(bridge_port_id);
+    if (itr == saiOidToAlias.end())
+    {
+        return nullptr;
+    }
+
+    return getPortPtr(itr->second);
 }
 
 void PortsOrch::increasePortRefCount(const string &alias)
@@ -1420,18 +1453,14 @@ bool PortsOrch::getPortByBridgePortId(sai_object_id_t bridge_port_id, Port &port
 {
     SWSS_LOG_ENTER();
 
-    auto itr = saiOidToAlias.find(bridge_port_id);
-    if (itr == saiOidToAlias.end())
+    auto p = getPortPtrByBridgePortId(bridge_port_id);
+    if (p == nullptr)
     {
         return false;
     }
-    else
-    {
-        getPort(itr->second, port);
-        return true;
-    }
 
-    return false;
+    port = *p;
+    return true;
 }
 
 bool PortsOrch::addSubPort(Port &port, const string &alias, const string &vlan, const bool &adminUp, const uint32_t &mtu)
@@ -1660,6 +1689,15 @@ bool PortsOrch::setPortAdminStatus(Port &port, bool state)
     attr.id = SAI_PORT_ATTR_ADMIN_STATE;
     attr.value.booldata = state;
 
+    preSetPortAdminStatus(port, state);
+
+    sai_status_t status = sai_port_api->set_port_attribute(port.m_port_id, &attr);
+
+    return postSetPortAdminStatus(port, state, status);
+}
+
+void PortsOrch::preSetPortAdminStatus(Port &port, bool state)
+{
     // if sync between cmis module configuration and asic is supported,
     // do not change host_tx_ready value in STATE DB when admin status is changed.
 
@@ -1670,8 +1708,14 @@ bool PortsOrch::setPortAdminStatus(Port &port, bool state)
         SWSS_LOG_NOTICE("Set admin status DOWN host_tx_ready to false for port %s",
                 port.m_alias.c_str());
     }
+}
 
-    sai_status_t status = sai_port_api->set_port_attribute(port.m_port_id, &attr);
+/*
+ * Handle the status of an admin status set, done alone or in bulk.
+ * Returns false when the set needs to be retried.
+ */
+bool PortsOrch::postSetPortAdminStatus(Port &port, bool state, sai_status_t status)
+{
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to set admin status %s for port %s."
@@ -1789,20 +1833,36 @@ bool PortsOrch::setPortMtu(const Port& port, sai_uint32_t mtu)
 
     sai_attribute_t attr;
     attr.id = SAI_PORT_ATTR_MTU;
+    attr.value.u32 = getPortSaiMtu(port, mtu);
+
+    sai_status_t status = sai_port_api->set_port_attribute(port.m_port_id, &attr);
+
+    return postSetPortMtu(port, mtu, status);
+}
+
+sai_uint32_t PortsOrch::getPortSaiMtu(const Port& port, sai_uint32_t mtu)
+{
     /* mtu + 14 + 4 + 4 = 22 bytes */
     mtu += (uint32_t)(sizeof(struct ether_header) + FCS_LEN + VLAN_TAG_LEN);
-    attr.value.u32 = mtu;
 
     if (isMACsecPort(port.m_port_id))
     {
-        attr.value.u32 += MAX_MACSEC_SECTAG_SIZE;
+        mtu += MAX_MACSEC_SECTAG_SIZE;
     }
 
-    sai_status_t status = sai_port_api->set_port_attribute(port.m_port_id, &attr);
+    return mtu;
+}
+
+/*
+ * Handle the status of an MTU set, done alone or in bulk.
+ * Returns false when the set needs to be retried.
+ */
+bool PortsOrch::postSetPortMtu(const Port& port, sai_uint32_t mtu, sai_status_t status)
+{
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to set MTU %u to port pid:%" PRIx64 ", rv:%d",
-                attr.value.u32, port.m_port_id, status);
+                getPortSaiMtu(port, mtu), port.m_port_id, status);
         task_process_status handle_status = handleSaiSetStatus(SAI_API_PORT, status);
         if (handle_status != task_success)
         {
@@ -1812,13 +1872,188 @@ bool PortsOrch::setPortMtu(const Port& port, sai_uint32_t mtu)
 
     if (m_gearboxEnabled)
     {
-        setGearboxPortsAttr(port, SAI_PORT_ATTR_MTU, &mtu);
+        sai_uint32_t gbMtu = mtu + (uint32_t)(sizeof(struct ether_header) + FCS_LEN + VLAN_TAG_LEN);
+        setGearboxPortsAttr(port, SAI_PORT_ATTR_MTU, &gbMtu);
     }
-    SWSS_LOG_INFO("Set MTU %u to port pid:%" PRIx64, attr.value.u32, port.m_port_id);
+    SWSS_LOG_INFO("Set MTU %u to port pid:%" PRIx64, getPortSaiMtu(port, mtu), port.m_port_id);
     return true;
 }
 
 
+void PortsOrch::setPortsAttributeBulk(const std::vector<sai_object_id_t> &oidList,
+                                      const std::vector<sai_attribute_t> &attrList,
+                                      std::vector<sai_status_t> &statusList)
+{
+    SWSS_LOG_ENTER();
+
+    auto portCount = static_cast<std::uint32_t>(oidList.size());
+
+    statusList.assign(portCount, SAI_STATUS_FAILURE);
+
+    if (portCount == 0)
+    {
+        return;
+    }
+
+    sai_status_t status = SAI_STATUS_NOT_IMPLEMENTED;
+    if (sai_port_api->set_ports_attribute != nullptr)
+    {
+        status = sai_port_api->set_ports_attribute(
+            portCount, oidList.data(), attrList.data(),
+            SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statusList.data()
+        );
+    }
+
+    if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+    {
+        SWSS_LOG_INFO("Bulk port set is not supported, setting %u ports one by one", portCount);
+
+        for (std::uint32_t i = 0; i < portCount; i++)
+        {
+            statusList.at(i) = sai_port_api->set_port_attribute(oidList.at(i), &attrList.at(i));
+        }
+    }
+}
+
+void PortsOrch::setPortsMtu(const std::vector<std::pair<std::string, sai_uint32_t>> &mtuList,
+                            std::map<std::string, std::vector<FieldValueTuple>> &retryList)
+{
+    SWSS_LOG_ENTER();
+
+    if (mtuList.empty())
+    {
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<Port> ports;
+    std::vector<sai_uint32_t> mtus;
+    std::vector<sai_object_id_t> oidList;
+    std::vector<sai_attribute_t> attrList;
+    std::vector<sai_status_t> statusList;
+
+    for (const auto &cit : mtuList)
+    {
+        Port p;
+        if (!getPort(cit.first, p))
+        {
+            SWSS_LOG_ERROR("Failed to get port id by alias: %s", cit.first.c_str());
+            continue;
+        }
+
+        sai_attribute_t attr;
+        attr.id = SAI_PORT_ATTR_MTU;
+        attr.value.u32 = getPortSaiMtu(p, cit.second);
+
+        ports.push_back(p);
+        mtus.push_back(cit.second);
+        oidList.push_back(p.m_port_id);
+        attrList.push_back(attr);
+    }
+
+    setPortsAttributeBulk(oidList, attrList, statusList);
+
+    for (std::size_t i = 0; i < ports.size(); i++)
+    {
+        auto &p = ports.at(i);
+
+        if (!postSetPortMtu(p, mtus.at(i), statusList.at(i)))
+        {
+            SWSS_LOG_ERROR("Failed to set port %s MTU to %u", p.m_alias.c_str(), mtus.at(i));
+            retryList[p.m_alias].emplace_back("mtu", to_string(mtus.at(i)));
+            continue;
+        }
+
+        p.m_mtu = mtus.at(i);
+        m_portList[p.m_alias].m_mtu = p.m_mtu;
+
+        if (p.m_rif_id)
+        {
+            gIntfsOrch->setRouterIntfsMtu(p);
+        }
+
+        // Sub interfaces inherit parent physical port mtu
+        updateChildPortsMtu(p, p.m_mtu);
+
+        SWSS_LOG_NOTICE("Set port %s MTU to %u", p.m_alias.c_str(), p.m_mtu);
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    SWSS_LOG_NOTICE("Set MTU of %zu ports in %" PRId64 " ms", ports.size(), static_cast<int64_t>(elapsed.count()));
+}
+
+void PortsOrch::setPortsAdminStatus(const std::vector<std::pair<std::string, bool>> &adminStatusList,
+                                    std::map<std::string, std::vector<FieldValueTuple>> &retryList)
+{
+    SWSS_LOG_ENTER();
+
+    if (adminStatusList.empty())
+    {
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<Port> ports;
+    std::vector<sai_object_id_t> oidList;
+    std::vector<sai_attribute_t> attrList;
+    std::vector<sai_status_t> statusList;
+
+    for (const auto &cit : adminStatusList)
+    {
+        Port p;
+        if (!getPort(cit.first, p))
+        {
+            SWSS_LOG_ERROR("Failed to get port id by alias: %s", cit.first.c_str());
+            continue;
+        }
+
+        /* Admin up stays the last step, a port is not brought up before its MTU is set */
+        if (cit.second && retryList.find(p.m_alias) != retryList.end())
+        {
+            retryList[p.m_alias].emplace_back("admin_status", "up");
+            continue;
+        }
+
+        sai_attribute_t attr;
+        attr.id = SAI_PORT_ATTR_ADMIN_STATE;
+        attr.value.booldata = cit.second;
+
+        preSetPortAdminStatus(p, cit.second);
+
+        ports.push_back(p);
+        oidList.push_back(p.m_port_id);
+        attrList.push_back(attr);
+    }
+
+    setPortsAttributeBulk(oidList, attrList, statusList);
+
+    std::size_t upCount = 0;
+
+    for (std::size_t i = 0; i < ports.size(); i++)
+    {
+        auto &p = ports.at(i);
+        bool state = attrList.at(i).value.booldata;
+
+        if (!postSetPortAdminStatus(p, state, statusList.at(i)))
+        {
+            SWSS_LOG_ERROR("Failed to set port %s admin status to %s", p.m_alias.c_str(), state ? "up" : "down");
+            retryList[p.m_alias].emplace_back("admin_status", state ? "up" : "down");
+            continue;
+        }
+
+        m_portList[p.m_alias].m_admin_state_up = state;
+        upCount += state ? 1 : 0;
+
+        SWSS_LOG_NOTICE("Set port %s admin status to %s", p.m_alias.c_str(), state ? "up" : "down");
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    SWSS_LOG_NOTICE("Set admin status of %zu ports (%zu up) in %" PRId64 " ms",
+                    ports.size(), upCount, static_cast<int64_t>(elapsed.count()));
+}
+
 bool PortsOrch::setPortTpid(Port &port, sai_uint16_t tpid)
 {
     SWSS_LOG_ENTER();
@@ -3431,99 +3666,143 @@ string PortsOrch::getPriorityGroupDropPacketsFlexCounterTableKey(string key)
     return string(PG_DROP_STAT_COUNTER_FLEX_COUNTER_GROUP) + ":" + key;
 }
 
-bool PortsOrch::initPort(const PortConfig &port)
+void PortsOrch::initPorts(const std::vector<PortConfig> &portList, std::vector<bool> &statusList)
 {
     SWSS_LOG_ENTER();
 
-    const auto &alias = port.key;
-    const auto &role = port.role.value;
-    const auto &index = port.index.value;
-    const auto &lane_set = port.lanes.value;
+    std::vector<Port> ports;
+    std::vector<std::size_t> portIdxList;
 
-    /* Determine if the lane combination exists in switch */
-    if (m_portListLaneMap.find(lane_set) != m_portListLaneMap.end())
+    statusList.assign(portList.size(), false);
+
+    for (std::size_t i = 0; i < portList.size(); i++)
     {
-        sai_object_id_t id = m_portListLaneMap[lane_set];
+        const auto &alias = portList.at(i).key;
+        const auto &index = portList.at(i).index.value;
+        const auto &lane_set = portList.at(i).lanes.value;
+
+        /* Determine if the lane combination exists in switch */
+        auto lit = m_portListLaneMap.find(lane_set);
+        if (lit == m_portListLaneMap.end())
+        {
+            SWSS_LOG_ERROR("Failed to locate port lane combination alias:%s", alias.c_str());
+            continue;
+        }
+
+        sai_object_id_t id = lit->second;
 
         /* Determine if the port has already been initialized before */
-        if (m_portList.find(alias) != m_portList.end() && m_portList[alias].m_port_id == id)
+        auto pit = m_portList.find(alias);
+        if (pit != m_portList.end() && pit->second.m_port_id == id)
         {
             SWSS_LOG_DEBUG("Port has already been initialized before alias:%s", alias.c_str());
+            statusList.at(i) = true;
+            continue;
         }
-        else
-        {
-            Port p(alias, Port::PHY);
 
-            p.m_index = index;
-            p.m_port_id = id;
+        Port p(alias, Port::PHY);
 
-            /* Initialize the port and create corresponding host interface */
-            if (initializePort(p))
-            {
-                /* Create associated Gearbox lane mapping */
-                initGearboxPort(p);
+        p.m_index = index;
+        p.m_port_id = id;
 
-                /* Add port to port list */
-                m_portList[alias] = p;
-                saiOidToAlias[id] = alias;
-                m_port_ref_count[alias] = 0;
-                m_portOidToIndex[id] = index;
+        ports.push_back(p);
+        portIdxList.push_back(i);
+    }
 
-                /* Add port name map to counter table */
-                FieldValueTuple tuple(p.m_alias, sai_serialize_object_id(p.m_port_id));
-                vector<FieldValueTuple> fields;
-                fields.push_back(tuple);
-                m_counterTable->set("", fields);
+    if (ports.empty())
+    {
+        return;
+    }
 
-                // Install a flex counter for this port to track stats
-                auto flex_counters_orch = gDirectory.get<FlexCounterOrch*>();
-                /* Delay installing the counters if they are yet enabled
-                If they are enabled, install the counters immediately */
-                if (flex_counters_orch->getPortCountersState())
-                {
-                    auto port_counter_stats = generateCounterStats(PORT_STAT_COUNTER_FLEX_COUNTER_GROUP);
-                    port_stat_manager.setCounterIdList(p.m_port_id,
-                            CounterType::PORT, port_counter_stats);
-                    auto gbport_counter_stats = generateCounterStats(PORT_STAT_COUNTER_FLEX_COUNTER_GROUP, true);
-                    if (p.m_system_side_id)
-                        gb_port_stat_manager.setCounterIdList(p.m_system_side_id,
-                                CounterType::PORT, gbport_counter_stats, p.m_switch_id);
-                    if (p.m_line_side_id)
-                        gb_port_stat_manager.setCounterIdList(p.m_line_side_id,
-                                CounterType::PORT, gbport_counter_stats, p.m_switch_id);
-                }
-                if (flex_counters_orch->getPortBufferDropCountersState())
-                {
-                    auto port_buffer_drop_stats = generateCounterStats(PORT_BUFFER_DROP_STAT_FLEX_COUNTER_GROUP);
-                    port_buffer_drop_stat_manager.setCounterIdList(p.m_port_id, CounterType::PORT, port_buffer_drop_stats);
-                }
+    SWSS_LOG_NOTICE("Initializing %zu ports", ports.size());
 
-                PortUpdate update = { p, true };
-                notify(SUBJECT_TYPE_PORT_CHANGE, static_cast<void *>(&update));
+    /*
+     * Fetch the QoS objects of all the ports with a few bulk calls rather
+     * than a couple of round trips per port and object type
+     */
+    if (gMySwitchType != "dpu")
+    {
+        initializePortsQos(ports);
+        initializePortsBufferMaximumParameters(ports);
+    }
 
-                m_portList[alias].m_init = true;
+    /* Create the corresponding host interfaces */
+    std::vector<bool> hostIfStatusList;
+    addHostIntfsBulk(ports, hostIfStatusList);
 
-                if (role == Port::Role::Rec || role == Port::Role::Inb)
-                {
-                    m_recircPortRole[alias] = role;
-                }
+    for (std::size_t i = 0; i < ports.size(); i++)
+    {
+        auto &p = ports.at(i);
+        const auto &alias = p.m_alias;
+        const auto &role = portList.at(portIdxList.at(i)).role.value;
+        const auto &index = p.m_index;
+        const auto &id = p.m_port_id;
 
-                SWSS_LOG_NOTICE("Initialized port %s", alias.c_str());
-            }
-            else
-            {
-                SWSS_LOG_ERROR("Failed to initialize port %s", alias.c_str());
-                return false;
-            }
+        if (!hostIfStatusList.at(i))
+        {
+            SWSS_LOG_ERROR("Failed to create host interface for port %s", alias.c_str());
+            SWSS_LOG_ERROR("Failed to initialize port %s", alias.c_str());
+            continue;
         }
-    }
-    else
-    {
-        SWSS_LOG_ERROR("Failed to locate port lane combination alias:%s", alias.c_str());
-        return false;
-    }
 
-    return true;
+        if (!initializePort(p))
+        {
+            SWSS_LOG_ERROR("Failed to initialize port %s", alias.c_str());
+            continue;
+        }
+
+        /* Create associated Gearbox lane mapping */
+        initGearboxPort(p);
+
+        /* Add port to port list */
+        m_portList[alias] = p;
+        saiOidToAlias[id] = alias;
+        m_port_ref_count[alias] = 0;
+        m_portOidToIndex[id] = index;
+
+        /* Add port name map to counter table */
+        FieldValueTuple tuple(p.m_alias, sai_serialize_object_id(p.m_port_id));
+        vector<FieldValueTuple> fields;
+        fields.push_back(tuple);
+        m_counterTable->set("", fields);
+
+        // Install a flex counter for this port to track stats
+        auto flex_counters_orch = gDirectory.get<FlexCounterOrch*>();
+        /* Delay installing the counters if they are yet enabled
+        If they are enabled, install the counters immediately */
+        if (flex_counters_orch->getPortCountersState())
+        {
+            auto port_counter_stats = generateCounterStats(PORT_STAT_COUNTER_FLEX_COUNTER_GROUP);
+            port_stat_manager.setCounterIdList(p.m_port_id,
+                    CounterType::PORT, port_counter_stats);
+            auto gbport_counter_stats = generateCounterStats(PORT_STAT_COUNTER_FLEX_COUNTER_GROUP, true);
+            if (p.m_system_side_id)
+                gb_port_stat_manager.setCounterIdList(p.m_system_side_id,
+                        CounterType::PORT, gbport_counter_stats, p.m_switch_id);
+            if (p.m_line_side_id)
+                gb_port_stat_manager.setCounterIdList(p.m_line_side_id,
+                        CounterType::PORT, gbport_counter_stats, p.m_switch_id);
+        }
+        if (flex_counters_orch->getPortBufferDropCountersState())
+        {
+            auto port_buffer_drop_stats = generateCounterStats(PORT_BUFFER_DROP_STAT_FLEX_COUNTER_GROUP);
+            port_buffer_drop_stat_manager.setCounterIdList(p.m_port_id, CounterType::PORT, port_buffer_drop_stats);
+        }
+
+        PortUpdate update = { p, true };
+        notify(SUBJECT_TYPE_PORT_CHANGE, static_cast<void *>(&update));
+
+        m_portList[alias].m_init = true;
+
+        if (role == Port::Role::Rec || role == Port::Role::Inb)
+        {
+            m_recircPortRole[alias] = role;
+        }
+
+        statusList.at(portIdxList.at(i)) = true;
+
+        SWSS_LOG_NOTICE("Initialized port %s", alias.c_str());
+    }
 }
 
 void PortsOrch::deInitPort(string alias, sai_object_id_t port_id)
@@ -3558,6 +3837,7 @@ void PortsOrch::deInitPort(string alias, sai_object_id_t port_id)
 
     /* Remove the entry from buffer maximum parameter table*/
     m_stateBufferMaximumValueTable->del(alias);
+    m_stateBufferMaximumValueTable->flush();
 
     m_portList[alias].m_init = false;
     SWSS_LOG_NOTICE("De-Initialized port %s", alias.c_str());
@@ -3623,6 +3903,16 @@ bool PortsOrch::bake()
     return true;
 }
 
+/* The port table is refilled from m_portTable, the other tables by name */
+bool PortsOrch::isWarmBakeRefilled(const string &tableName) const
+{
+    return tableName == APP_LAG_TABLE_NAME ||
+           tableName == APP_LAG_MEMBER_TABLE_NAME ||
+           tableName == APP_VLAN_TABLE_NAME ||
+           tableName == APP_VLAN_MEMBER_TABLE_NAME ||
+           (tableName == STATE_TRANSCEIVER_INFO_TABLE_NAME && saiHwTxSignalSupported && saiTxReadyNotifySupported);
+}
+
 // Clean up port table
 void PortsOrch::cleanPortTable(const vector<string>& keys)
 {
@@ -3729,6 +4019,15 @@ void PortsOrch::doPortTask(Consumer &consumer)
     auto &taskMap = consumer.m_toSync;
     auto it = taskMap.begin();
 
+    /*
+     * MTU and admin status are set on every port on boot and on config reload,
+     * they are applied in bulk at the end of the batch. Speed, FEC, autoneg and
+     * serdes stay on the per port path: they need the port to be brought down
+     * first, and mostly keep their SAI defaults.
+     */
+    std::vector<std::pair<std::string, sai_uint32_t>> portsMtuList;
+    std::vector<std::pair<std::string, bool>> portsAdminStatusList;
+
     while (it != taskMap.end())
     {
         auto keyOpFieldsValues = it->second;
@@ -3857,7 +4156,7 @@ void PortsOrch::doPortTask(Consumer &consumer)
             // TODO:
             // Fix the issue below
             // After PortConfigDone, while waiting for "PortInitDone" and the first gBufferOrch->isPortReady(alias),
-            // the complete m_lanesAliasSpeedMap may be populated again, so initPort() will be called more than once
+            // the complete m_lanesAliasSpeedMap may be populated again, so initPorts() will be called more than once
             // for the same port.
 
             /* Once all ports received, go through the each port and perform appropriate actions:
@@ -3868,6 +4167,7 @@ void PortsOrch::doPortTask(Consumer &consumer)
             if (getPortConfigState() != PORT_CONFIG_MISSING)
             {
                 std::vector<PortConfig> portsToAddList;
+                std::vector<PortConfig> portsToInitList;
                 std::vector<sai_object_id_t> portsToRemoveList;
 
                 // Port remove comparison logic
@@ -3902,16 +4202,7 @@ void PortsOrch::doPortTask(Consumer &consumer)
                         continue;
                     }
 
-                    if (!initPort(it->second))
-                    {
-                        // Failure has been recorded in initPort
-                        it++;
-                        continue;
-                    }
-
-                    initPortSupportedSpeeds(it->second.key, m_portListLaneMap[it->first]);
-                    initPortSupportedFecModes(it->second.key, m_portListLaneMap[it->first]);
-
+                    portsToInitList.push_back(it->second);
                     it++;
                 }
 
@@ -3923,17 +4214,24 @@ void PortsOrch::doPortTask(Consumer &consumer)
                         SWSS_LOG_THROW("PortsOrch initialization failure");
                     }
 
-                    for (const auto &cit : portsToAddList)
-                    {
-                        if (!initPort(cit))
-                        {
-                            // Failure has been recorded in initPort
-                            continue;
-                        }
+                    portsToInitList.insert(portsToInitList.end(), portsToAddList.begin(), portsToAddList.end());
+                }
+
+                // Bulk port init
+                std::vector<bool> portsInitStatusList;
+                initPorts(portsToInitList, portsInitStatusList);
 
-                        initPortSupportedSpeeds(cit.key, m_portListLaneMap[cit.lanes.value]);
-                        initPortSupportedFecModes(cit.key, m_portListLaneMap[cit.lanes.value]);
+                for (std::size_t i = 0; i < portsToInitList.size(); i++)
+                {
+                    if (!portsInitStatusList.at(i))
+                    {
+                        // Failure has been recorded in initPorts
+                        continue;
                     }
+
+                    const auto &cit = portsToInitList.at(i);
+                    initPortSupportedSpeeds(cit.key, m_portListLaneMap[cit.lanes.value]);
+                    initPortSupportedFecModes(cit.key, m_portListLaneMap[cit.lanes.value]);
                 }
 
                 setPortConfigState(PORT_CONFIG_DONE);
@@ -4391,31 +4689,8 @@ void PortsOrch::doPortTask(Consumer &consumer)
                 {
                     if (p.m_mtu != pCfg.mtu.value)
                     {
-                        if (!setPortMtu(p, pCfg.mtu.value))
-                        {
-                            SWSS_LOG_ERROR(
-                                "Failed to set port %s MTU to %u",
-                                p.m_alias.c_str(), pCfg.mtu.value
-                            );
-                            it++;
-                            continue;
-                        }
-
-                        p.m_mtu = pCfg.mtu.value;
-                        m_portList[p.m_alias] = p;
-
-                        if (p.m_rif_id)
-                        {
-                            gIntfsOrch->setRouterIntfsMtu(p);
-                        }
-
-                        // Sub interfaces inherit parent physical port mtu
-                        updateChildPortsMtu(p, pCfg.mtu.value);
-
-                        SWSS_LOG_NOTICE(
-                            "Set port %s MTU to %u",
-                            p.m_alias.c_str(), pCfg.mtu.value
-                        );
+                        // Applied to all the ports of the batch at once, see setPortsMtu()
+                        portsMtuList.emplace_back(p.m_alias, pCfg.mtu.value);
                     }
                 }
 
@@ -4618,28 +4893,15 @@ void PortsOrch::doPortTask(Consumer &consumer)
                     pCfg.admin_status.value = admin_status;
                 }
 
-                /* Last step set port admin status */
+                /*
+                 * Last step set port admin status.
+                 * Applied to all the ports of the batch at once, see setPortsAdminStatus()
+                 */
                 if (pCfg.admin_status.is_set)
                 {
                     if (p.m_admin_state_up != pCfg.admin_status.value)
                     {
-                        if (!setPortAdminStatus(p, pCfg.admin_status.value))
-                        {
-                            SWSS_LOG_ERROR(
-                                "Failed to set port %s admin status to %s",
-                                p.m_alias.c_str(), m_portHlpr.getAdminStatusStr(pCfg).c_str()
-                            );
-                            it++;
-                            continue;
-                        }
-
-                        p.m_admin_state_up = pCfg.admin_status.value;
-                        m_portList[p.m_alias] = p;
-
-                        SWSS_LOG_NOTICE(
-                            "Set port %s admin status to %s",
-                            p.m_alias.c_str(), m_portHlpr.getAdminStatusStr(pCfg).c_str()
-                        );
+                        portsAdminStatusList.emplace_back(p.m_alias, pCfg.admin_status.value);
                     }
                 }
 
@@ -4842,6 +5104,17 @@ void PortsOrch::doPortTask(Consumer &consumer)
 
         it = consumer.m_toSync.erase(it);
     }
+
+    /* MTU goes first as admin up is the last step of the port configuration */
+    std::map<std::string, std::vector<FieldValueTuple>> portsRetryList;
+    setPortsMtu(portsMtuList, portsRetryList);
+    setPortsAdminStatus(portsAdminStatusList, portsRetryList);
+
+    /* Only the attributes that failed are retried, the rest of the entry was applied */
+    for (const auto &cit : portsRetryList)
+    {
+        consumer.addToSync(KeyOpFieldsValuesTuple(cit.first, SET_COMMAND, cit.second));
+    }
 }
 
 void PortsOrch::doVlanTask(Consumer &consumer)
@@ -5761,51 +6034,215 @@ void PortsOrch::initializePriorityGroups(Port &port)
     SWSS_LOG_INFO("Get priority groups for port %s", port.m_alias.c_str());
 }
 
-void PortsOrch::initializePortBufferMaximumParameters(Port &port)
+void PortsOrch::getPortsAttributeBulk(const std::vector<sai_object_id_t> &oidList,
+                                      std::vector<std::vector<sai_attribute_t>> &attrDataList,
+                                      std::vector<sai_status_t> &statusList)
 {
-    sai_attribute_t attr;
-    vector<FieldValueTuple> fvVector;
+    SWSS_LOG_ENTER();
 
-    attr.id = SAI_PORT_ATTR_QOS_MAXIMUM_HEADROOM_SIZE;
+    auto portCount = static_cast<std::uint32_t>(oidList.size());
 
-    sai_status_t status = sai_port_api->get_port_attribute(port.m_port_id, 1, &attr);
-    if (status != SAI_STATUS_SUCCESS)
+    std::vector<std::uint32_t> attrCountList;
+    std::vector<sai_attribute_t*> attrPtrList;
+
+    for (auto &attrList : attrDataList)
     {
-        SWSS_LOG_NOTICE("Unable to get the maximum headroom for port %s rv:%d, ignored", port.m_alias.c_str(), status);
+        attrCountList.push_back(static_cast<std::uint32_t>(attrList.size()));
+        attrPtrList.push_back(attrList.data());
     }
-    else
+
+    statusList.assign(portCount, SAI_STATUS_FAILURE);
+
+    if (portCount == 0)
     {
-        port.m_maximum_headroom = attr.value.u32;
-        fvVector.emplace_back("max_headroom_size", to_string(port.m_maximum_headroom));
+        return;
     }
 
-    fvVector.emplace_back("max_priority_groups", to_string(port.m_priority_group_ids.size()));
-    fvVector.emplace_back("max_queues", to_string(port.m_queue_ids.size()));
+    sai_status_t status = SAI_STATUS_NOT_IMPLEMENTED;
+    if (sai_port_api->get_ports_attribute != nullptr)
+    {
+        status = sai_port_api->get_ports_attribute(
+            portCount, oidList.data(), attrCountList.data(), attrPtrList.data(),
+            SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statusList.data()
+        );
+    }
+
+    if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+    {
+        SWSS_LOG_INFO("Bulk port get is not supported, fetching %u ports one by one", portCount);
 
-    m_stateBufferMaximumValueTable->set(port.m_alias, fvVector);
+        for (std::uint32_t i = 0; i < portCount; i++)
+        {
+            statusList.at(i) = sai_port_api->get_port_attribute(oidList.at(i), attrCountList.at(i), attrPtrList.at(i));
+        }
+    }
 }
 
-bool PortsOrch::initializePort(Port &port)
+void PortsOrch::initializePortsQos(std::vector<Port> &ports)
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_NOTICE("Initializing port alias:%s pid:%" PRIx64, port.m_alias.c_str(), port.m_port_id);
+    std::vector<sai_object_id_t> oidList;
+    std::vector<std::vector<sai_attribute_t>> attrDataList;
+    std::vector<sai_status_t> statusList;
 
-    if (gMySwitchType != "dpu")
+    /* Get the number of priority groups, queues and scheduler groups */
+    for (auto &port : ports)
     {
-        initializePriorityGroups(port);
-        initializeQueues(port);
-        initializeSchedulerGroups(port);
-        initializePortBufferMaximumParameters(port);
+        std::vector<sai_attribute_t> attrList(3);
+
+        attrList[0].id = SAI_PORT_ATTR_NUMBER_OF_INGRESS_PRIORITY_GROUPS;
+        attrList[1].id = SAI_PORT_ATTR_QOS_NUMBER_OF_QUEUES;
+        attrList[2].id = SAI_PORT_ATTR_QOS_NUMBER_OF_SCHEDULER_GROUPS;
+
+        oidList.push_back(port.m_port_id);
+        attrDataList.push_back(attrList);
     }
 
-    /* Create host interface */
-    if (!addHostIntfs(port, port.m_alias, port.m_hif_id))
+    getPortsAttributeBulk(oidList, attrDataList, statusList);
+
+    /* Get the object lists, sized by the counts fetched above */
+    std::vector<std::vector<sai_object_id_t>> schedulerGroupIdList(ports.size());
+    std::vector<sai_object_id_t> listOidList;
+    std::vector<std::vector<sai_attribute_t>> listAttrDataList;
+    std::vector<sai_status_t> listStatusList;
+    std::vector<Port*> portPtrList;
+
+    for (std::size_t i = 0; i < ports.size(); i++)
     {
-        SWSS_LOG_ERROR("Failed to create host interface for port %s", port.m_alias.c_str());
-        return false;
+        auto &port = ports.at(i);
+
+        if (statusList.at(i) != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_NOTICE("Failed to get QoS object numbers in bulk for port %s rv:%d, retrying one by one",
+                            port.m_alias.c_str(), statusList.at(i));
+
+            initializePriorityGroups(port);
+            initializeQueues(port);
+            initializeSchedulerGroups(port);
+            continue;
+        }
+
+        const auto &attrList = attrDataList.at(i);
+
+        SWSS_LOG_INFO("Get %d priority groups, %d queues and %d scheduler groups for port %s",
+                      attrList[0].value.u32, attrList[1].value.u32, attrList[2].value.u32, port.m_alias.c_str());
+
+        port.m_priority_group_ids.resize(attrList[0].value.u32);
+        port.m_queue_ids.resize(attrList[1].value.u32);
+        port.m_queue_lock.resize(attrList[1].value.u32);
+        schedulerGroupIdList.at(i).resize(attrList[2].value.u32);
+
+        std::vector<sai_attribute_t> listAttrList;
+        sai_attribute_t attr;
+
+        if (!port.m_priority_group_ids.empty())
+        {
+            attr.id = SAI_PORT_ATTR_INGRESS_PRIORITY_GROUP_LIST;
+            attr.value.objlist.count = static_cast<std::uint32_t>(port.m_priority_group_ids.size());
+            attr.value.objlist.list = port.m_priority_group_ids.data();
+            listAttrList.push_back(attr);
+        }
+
+        if (!port.m_queue_ids.empty())
+        {
+            attr.id = SAI_PORT_ATTR_QOS_QUEUE_LIST;
+            attr.value.objlist.count = static_cast<std::uint32_t>(port.m_queue_ids.size());
+            attr.value.objlist.list = port.m_queue_ids.data();
+            listAttrList.push_back(attr);
+        }
+
+        if (!schedulerGroupIdList.at(i).empty())
+        {
+            attr.id = SAI_PORT_ATTR_QOS_SCHEDULER_GROUP_LIST;
+            attr.value.objlist.count = static_cast<std::uint32_t>(schedulerGroupIdList.at(i).size());
+            attr.value.objlist.list = schedulerGroupIdList.at(i).data();
+            listAttrList.push_back(attr);
+        }
+
+        if (listAttrList.empty())
+        {
+            continue;
+        }
+
+        listOidList.push_back(port.m_port_id);
+        listAttrDataList.push_back(listAttrList);
+        portPtrList.push_back(&port);
     }
 
+    getPortsAttributeBulk(listOidList, listAttrDataList, listStatusList);
+
+    for (std::size_t i = 0; i < portPtrList.size(); i++)
+    {
+        auto &port = *portPtrList.at(i);
+
+        if (listStatusList.at(i) != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_NOTICE("Failed to get QoS object lists in bulk for port %s rv:%d, retrying one by one",
+                            port.m_alias.c_str(), listStatusList.at(i));
+
+            initializePriorityGroups(port);
+            initializeQueues(port);
+            initializeSchedulerGroups(port);
+            continue;
+        }
+
+        SWSS_LOG_INFO("Get priority groups, queues and scheduler groups for port %s", port.m_alias.c_str());
+    }
+}
+
+void PortsOrch::initializePortsBufferMaximumParameters(std::vector<Port> &ports)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_object_id_t> oidList;
+    std::vector<std::vector<sai_attribute_t>> attrDataList;
+    std::vector<sai_status_t> statusList;
+
+    for (const auto &port : ports)
+    {
+        std::vector<sai_attribute_t> attrList(1);
+        attrList[0].id = SAI_PORT_ATTR_QOS_MAXIMUM_HEADROOM_SIZE;
+
+        oidList.push_back(port.m_port_id);
+        attrDataList.push_back(attrList);
+    }
+
+    getPortsAttributeBulk(oidList, attrDataList, statusList);
+
+    for (std::size_t i = 0; i < ports.size(); i++)
+    {
+        auto &port = ports.at(i);
+        vector<FieldValueTuple> fvVector;
+
+        if (statusList.at(i) != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_NOTICE("Unable to get the maximum headroom for port %s rv:%d, ignored", port.m_alias.c_str(), statusList.at(i));
+        }
+        else
+        {
+            port.m_maximum_headroom = attrDataList.at(i)[0].value.u32;
+            fvVector.emplace_back("max_headroom_size", to_string(port.m_maximum_headroom));
+        }
+
+        fvVector.emplace_back("max_priority_groups", to_string(port.m_priority_group_ids.size()));
+        fvVector.emplace_back("max_queues", to_string(port.m_queue_ids.size()));
+
+        m_stateBufferMaximumValueTable->set(port.m_alias, fvVector);
+    }
+
+    /* Write the whole batch to STATE_DB in a single pipeline flush */
+    m_stateBufferMaximumValueTable->flush();
+}
+
+bool PortsOrch::initializePort(Port &port)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("Initializing port alias:%s pid:%" PRIx64, port.m_alias.c_str(), port.m_port_id);
+
+    /* QoS objects and the host interface are set up in bulk by initPorts() */
+
     /* Check warm start states */
     vector<FieldValueTuple> tuples;
     bool exist = m_portTable->get(port.m_alias, tuples);
@@ -5910,12 +6347,11 @@ bool PortsOrch::initializePort(Port &port)
     return true;
 }
 
-bool PortsOrch::addHostIntfs(Port &port, string alias, sai_object_id_t &host_intfs_id)
+void PortsOrch::getHostIntfsAttrs(const Port &port, const string &alias, std::vector<sai_attribute_t> &attrs)
 {
     SWSS_LOG_ENTER();
 
     sai_attribute_t attr;
-    vector<sai_attribute_t> attrs;
 
     attr.id = SAI_HOSTIF_ATTR_TYPE;
     attr.value.s32 = SAI_HOSTIF_TYPE_NETDEV;
@@ -5950,6 +6386,14 @@ bool PortsOrch::addHostIntfs(Port &port, string alias, sai_object_id_t &host_int
         attr.value.u32 = DEFAULT_HOSTIF_TX_QUEUE;
         attrs.push_back(attr);
     }
+}
+
+bool PortsOrch::addHostIntfs(Port &port, string alias, sai_object_id_t &host_intfs_id)
+{
+    SWSS_LOG_ENTER();
+
+    vector<sai_attribute_t> attrs;
+    getHostIntfsAttrs(port, alias, attrs);
 
     sai_status_t status = sai_hostif_api->create_hostif(&host_intfs_id, gSwitchId, (uint32_t)attrs.size(), attrs.data());
     if (status != SAI_STATUS_SUCCESS)
@@ -5967,6 +6411,81 @@ bool PortsOrch::addHostIntfs(Port &port, string alias, sai_object_id_t &host_int
     return true;
 }
 
+void PortsOrch::addHostIntfsBulk(std::vector<Port> &ports, std::vector<bool> &statusList)
+{
+    SWSS_LOG_ENTER();
+
+    auto portCount = static_cast<std::uint32_t>(ports.size());
+
+    std::vector<std::vector<sai_attribute_t>> attrDataList;
+    std::vector<std::uint32_t> attrCountList;
+    std::vector<const sai_attribute_t*> attrPtrList;
+    std::vector<sai_object_id_t> oidList(portCount, SAI_NULL_OBJECT_ID);
+    std::vector<sai_status_t> saiStatusList(portCount, SAI_STATUS_FAILURE);
+
+    statusList.assign(portCount, false);
+
+    if (portCount == 0)
+    {
+        return;
+    }
+
+    for (const auto &port : ports)
+    {
+        std::vector<sai_attribute_t> attrList;
+        getHostIntfsAttrs(port, port.m_alias, attrList);
+        attrDataList.push_back(attrList);
+    }
+
+    for (auto &attrList : attrDataList)
+    {
+        attrCountList.push_back(static_cast<std::uint32_t>(attrList.size()));
+        attrPtrList.push_back(attrList.data());
+    }
+
+    auto status = sai_bulk_object_create(
+        gSwitchId, SAI_OBJECT_TYPE_HOSTIF, portCount, attrCountList.data(), attrPtrList.data(),
+        SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+        oidList.data(), saiStatusList.data()
+    );
+    if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+    {
+        SWSS_LOG_INFO("Bulk host interface create is not supported, creating %u host interfaces one by one", portCount);
+
+        for (std::uint32_t i = 0; i < portCount; i++)
+        {
+            statusList.at(i) = addHostIntfs(ports.at(i), ports.at(i).m_alias, ports.at(i).m_hif_id);
+        }
+
+        return;
+    }
+
+    for (std::uint32_t i = 0; i < portCount; i++)
+    {
+        auto &port = ports.at(i);
+
+        if (saiStatusList.at(i) != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR(
+                "Failed to create host interface for port %s with bulk operation, rv:%d",
+                port.m_alias.c_str(), saiStatusList.at(i)
+            );
+
+            task_process_status handle_status = handleSaiCreateStatus(SAI_API_HOSTIF, saiStatusList.at(i));
+            if (handle_status != task_success)
+            {
+                statusList.at(i) = parseHandleSaiStatusFailure(handle_status);
+                continue;
+            }
+        }
+
+        port.m_hif_id = oidList.at(i);
+        statusList.at(i) = true;
+
+        SWSS_LOG_NOTICE("Create host interface for port %s", port.m_alias.c_str());
+    }
+}
+
 ReturnCode PortsOrch::addSendToIngressHostIf(const std::string &send_to_ingress_name)
 {
     SWSS_LOG_ENTER();
@@ -6771,7 +7290,7 @@ bool PortsOrch::removeVlanMember(Port &vlan, Port &port, string end_point_ip)
     return true;
 }
 
-bool PortsOrch::isVlanMember(Port &vlan, Port &port, string end_point_ip)
+bool PortsOrch::isVlanMember(const Port &vlan, const Port &port, string end_point_ip)
 {
     if (!end_point_ip.empty())
     {
@@ -9417,6 +9936,20 @@ void PortsOrch::updateGearboxPortOperStatus(const Port& port)
     }
 }
 
+bool PortsOrch::incrFdbCount(const std::string& alias, int count)
+{
+    auto itr = m_portList.find(alias);
+    if (itr == m_portList.end())
+    {
+        return false;
+    }
+    else
+    {
+        itr->second.m_fdb_count += count;
+    }
+    return true;
+}
+
 bool PortsOrch::decrFdbCount(const std::string& alias, int count)
 {
     auto itr = m_portList.find(alias);
@@ -135,6 +135,7 @@ public:
 
     map<string, Port>& getAllPorts();
     bool bake() override;
+    bool isWarmBakeRefilled(const string &tableName) const override;
     void cleanPortTable(const vector<string>& keys);
     bool getBridgePort(sai_object_id_t id, Port &port);
     bool setBridgePortLearningFDB(Port &port, sai_bridge_port_fdb_learning_mode_t mode);
@@ -143,6 +144,12 @@ public:
     void increasePortRefCount(const string &alias);
     void decreasePortRefCount(const string &alias);
     bool getPortByBridgePortId(sai_object_id_t bridge_port_id, Port &port);
+    /* Lookups without copying the Port. The returned entry reflects later
+     * updates and stays valid until the port is removed, so it must not be
+     * kept across calls that may remove ports. Return nullptr if not found. */
+    const Port *getPortPtr(const string &alias) const;
+    const Port *getPortPtr(sai_object_id_t id) const;
+    const Port *getPortPtrByBridgePortId(sai_object_id_t bridge_port_id) const;
     void setPort(string alias, Port port);
     void getCpuPort(Port &port);
     void initHostTxReadyState(Port &port);
@@ -214,7 +221,7 @@ public:
     bool removeBridgePort(Port &port);
     bool addVlanMember(Port &vlan, Port &port, string& tagging_mode, string end_point_ip = "");
     bool removeVlanMember(Port &vlan, Port &port, string end_point_ip = "");
-    bool isVlanMember(Port &vlan, Port &port, string end_point_ip = "");
+    bool isVlanMember(const Port &vlan, const Port &port, string end_point_ip = "");
     bool addVlanFloodGroups(Port &vlan, Port &port, string end_point_ip);
     bool removeVlanEndPointIp(Port &vlan, Port &port, string end_point_ip);
     void increaseBridgePortRefCount(Port &port);
@@ -237,6 +244,7 @@ public:
 
     void updateGearboxPortOperStatus(const Port& port);
 
+    bool incrFdbCount(const string& alias, int count);
     bool decrFdbCount(const string& alias, int count);
 
     void setMACsecEnabledState(sai_object_id_t port_id, bool enabled);
@@ -261,6 +269,7 @@ private:
     unique_ptr<Table> m_pgTable;
     unique_ptr<Table> m_pgPortTable;
     unique_ptr<Table> m_pgIndexTable;
+    unique_ptr<RedisPipeline> m_statePipeline;
     unique_ptr<Table> m_stateBufferMaximumValueTable;
     Table m_portStateTable;
 
@@ -368,12 +377,18 @@ private:
 
     bool initializePort(Port &port);
     void initializePriorityGroups(Port &port);
-    void initializePortBufferMaximumParameters(Port &port);
     void initializeQueues(Port &port);
     void initializeSchedulerGroups(Port &port);
     void initializeVoqs(Port &port);
+    void initializePortsQos(std::vector<Port> &ports);
+    void initializePortsBufferMaximumParameters(std::vector<Port> &ports);
+    void getPortsAttributeBulk(const std::vector<sai_object_id_t> &oidList,
+                               std::vector<std::vector<sai_attribute_t>> &attrDataList,
+                               std::vector<sai_status_t> &statusList);
 
     bool addHostIntfs(Port &port, string alias, sai_object_id_t &host_intfs_id);
+    void addHostIntfsBulk(std::vector<Port> &ports, std::vector<bool> &statusList);
+    void getHostIntfsAttrs(const Port &port, const string &alias, std::vector<sai_attribute_t> &attrs);
     bool setHostIntfsStripTag(Port &port, sai_hostif_vlan_tag_t strip);
 
     bool setBridgePortLearnMode(Port &port, sai_bridge_port_fdb_learning_mode_t learn_mode);
@@ -390,17 +405,28 @@ private:
     bool setDistributionOnLagMember(Port &lagMember, bool enableDistribution);
 
     sai_status_t removePort(sai_object_id_t port_id);
-    bool initPort(const PortConfig &port);
+    void initPorts(const std::vector<PortConfig> &portList, std::vector<bool> &statusList);
     void deInitPort(string alias, sai_object_id_t port_id);
 
     void initPortCapAutoNeg(Port &port);
     void initPortCapLinkTraining(Port &port);
 
     bool setPortAdminStatus(Port &port, bool up);
+    void preSetPortAdminStatus(Port &port, bool up);
+    bool postSetPortAdminStatus(Port &port, bool up, sai_status_t status);
     bool getPortAdminStatus(sai_object_id_t id, bool& up);
     bool getPortMtu(const Port& port, sai_uint32_t &mtu);
     bool getPortHostTxReady(const Port& port, bool &hostTxReadyVal);
     bool setPortMtu(const Port& port, sai_uint32_t mtu);
+    sai_uint32_t getPortSaiMtu(const Port& port, sai_uint32_t mtu);
+    bool postSetPortMtu(const Port& port, sai_uint32_t mtu, sai_status_t status);
+    void setPortsMtu(const std::vector<std::pair<std::string, sai_uint32_t>> &mtuList,
+                     std::map<std::string, std::vector<FieldValueTuple>> &retryList);
+    void setPortsAdminStatus(const std::vector<std::pair<std::string, bool>> &adminStatusList,
+                             std::map<std::string, std::vector<FieldValueTuple>> &retryList);
+    void setPortsAttributeBulk(const std::vector<sai_object_id_t> &oidList,
+                               const std::vector<sai_attribute_t> &attrList,
+                               std::vector<sai_status_t> &statusList);
     bool setPortTpid(Port &port, sai_uint16_t tpid);
     bool setPortPvid (Port &port, sai_uint32_t pvid);
     bool getPortPvid(Port &port, sai_uint32_t &pvid);
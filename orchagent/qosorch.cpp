@@ -28,6 +28,7 @@ extern PortsOrch *gPortsOrch;
 extern QosOrch *gQosOrch;
 extern sai_object_id_t gSwitchId;
 extern CrmOrch *gCrmOrch;
+extern size_t gMaxBulkSize;
 extern string gMySwitchType;
 extern string gMyHostName;
 extern string gMyAsicName;
@@ -1626,7 +1627,213 @@ sai_object_id_t QosOrch::getSchedulerGroup(const Port &port, const sai_object_id
     return SAI_NULL_OBJECT_ID;
 }
 
-bool QosOrch::applySchedulerToQueueSchedulerGroup(Port &port, size_t queue_ind, sai_object_id_t scheduler_profile_id)
+void QosOrch::getObjectsAttributeBulk(sai_object_type_t type, const std::vector<sai_object_id_t> &oids,
+                                      std::vector<sai_attribute_t> &attrs, std::vector<sai_status_t> &statuses)
+{
+    SWSS_LOG_ENTER();
+
+    auto count = static_cast<uint32_t>(oids.size());
+
+    statuses.assign(count, SAI_STATUS_NOT_EXECUTED);
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    sai_status_t status = SAI_STATUS_NOT_IMPLEMENTED;
+
+    /* A single object is not worth a bulk call */
+    if (count > 1 && m_isBulkGetSupported)
+    {
+        std::vector<sai_object_key_t> keys(count);
+        std::vector<uint32_t> attr_counts(count, 1);
+        std::vector<sai_attribute_t*> attr_lists(count);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            keys[i].key.object_id = oids[i];
+            attr_lists[i] = &attrs[i];
+        }
+
+        status = sai_bulk_object_get_attribute(gSwitchId, type, count, keys.data(), attr_counts.data(), attr_lists.data(),
+                                               SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+        {
+            SWSS_LOG_NOTICE("Bulk get is not supported for ports and scheduler groups, falling back to per object get");
+            m_isBulkGetSupported = false;
+        }
+    }
+
+    if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            statuses[i] = (type == SAI_OBJECT_TYPE_PORT) ?
+                          sai_port_api->get_port_attribute(oids[i], 1, &attrs[i]) :
+                          sai_scheduler_group_api->get_scheduler_group_attribute(oids[i], 1, &attrs[i]);
+        }
+    }
+}
+
+/*
+ * Fetch the scheduler groups and their children of all the ports with a few bulk calls
+ * rather than a couple of calls per port and group as getSchedulerGroup() does on the first queue of a port.
+ * A port or group failing to be fetched here is left to getSchedulerGroup().
+ */
+void QosOrch::preloadSchedulerGroups()
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_object_id_t> port_oids;
+    for (const auto &it : gPortsOrch->getAllPorts())
+    {
+        const auto &port = it.second;
+        if (port.m_type != Port::PHY || port.m_port_id == SAI_NULL_OBJECT_ID ||
+            m_scheduler_group_port_info.find(port.m_port_id) != m_scheduler_group_port_info.end())
+        {
+            continue;
+        }
+        port_oids.push_back(port.m_port_id);
+    }
+
+    if (port_oids.empty())
+    {
+        return;
+    }
+
+    std::vector<sai_status_t> statuses;
+
+    /* Get the number of scheduler groups of the ports */
+    std::vector<sai_attribute_t> attrs(port_oids.size());
+    for (auto &attr : attrs)
+    {
+        attr.id = SAI_PORT_ATTR_QOS_NUMBER_OF_SCHEDULER_GROUPS;
+    }
+    getObjectsAttributeBulk(SAI_OBJECT_TYPE_PORT, port_oids, attrs, statuses);
+
+    /* Get the group lists, sized by the numbers fetched above */
+    std::vector<sai_object_id_t> list_port_oids;
+    std::vector<SchedulerGroupPortInfo_t> infos;
+    for (size_t i = 0; i < port_oids.size(); i++)
+    {
+        if (statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            continue;
+        }
+
+        uint32_t groups_count = attrs[i].value.u32;
+        list_port_oids.push_back(port_oids[i]);
+        infos.push_back({
+            .groups = std::vector<sai_object_id_t>(groups_count),
+            .child_groups = std::vector<std::vector<sai_object_id_t>>(groups_count),
+            .group_has_been_initialized = std::vector<bool>(groups_count)
+        });
+    }
+
+    attrs.assign(list_port_oids.size(), sai_attribute_t());
+    for (size_t i = 0; i < list_port_oids.size(); i++)
+    {
+        attrs[i].id = SAI_PORT_ATTR_QOS_SCHEDULER_GROUP_LIST;
+        attrs[i].value.objlist.list = infos[i].groups.data();
+        attrs[i].value.objlist.count = static_cast<uint32_t>(infos[i].groups.size());
+    }
+    getObjectsAttributeBulk(SAI_OBJECT_TYPE_PORT, list_port_oids, attrs, statuses);
+
+    /* Get the number of children of all the groups */
+    std::vector<bool> port_valid(list_port_oids.size());
+    std::vector<sai_object_id_t> group_oids;
+    std::vector<std::pair<size_t, size_t>> group_positions;
+    for (size_t i = 0; i < list_port_oids.size(); i++)
+    {
+        port_valid[i] = (statuses[i] == SAI_STATUS_SUCCESS);
+        if (!port_valid[i])
+        {
+            continue;
+        }
+
+        for (size_t j = 0; j < infos[i].groups.size(); j++)
+        {
+            group_oids.push_back(infos[i].groups[j]);
+            group_positions.push_back(std::make_pair(i, j));
+        }
+    }
+
+    attrs.assign(group_oids.size(), sai_attribute_t());
+    for (auto &attr : attrs)
+    {
+        attr.id = SAI_SCHEDULER_GROUP_ATTR_CHILD_COUNT;
+    }
+    getObjectsAttributeBulk(SAI_OBJECT_TYPE_SCHEDULER_GROUP, group_oids, attrs, statuses);
+
+    /* Get the children of the groups having any */
+    std::vector<sai_object_id_t> parent_oids;
+    std::vector<std::pair<size_t, size_t>> parent_positions;
+    for (size_t k = 0; k < group_oids.size(); k++)
+    {
+        if (statuses[k] != SAI_STATUS_SUCCESS)
+        {
+            continue;
+        }
+
+        auto &info = infos[group_positions[k].first];
+        auto j = group_positions[k].second;
+        uint32_t child_count = attrs[k].value.u32;
+
+        if (child_count == 0)
+        {
+            info.group_has_been_initialized[j] = true;
+            continue;
+        }
+
+        info.child_groups[j].resize(child_count);
+        parent_oids.push_back(group_oids[k]);
+        parent_positions.push_back(group_positions[k]);
+    }
+
+    attrs.assign(parent_oids.size(), sai_attribute_t());
+    for (size_t k = 0; k < parent_oids.size(); k++)
+    {
+        auto &children = infos[parent_positions[k].first].child_groups[parent_positions[k].second];
+        attrs[k].id = SAI_SCHEDULER_GROUP_ATTR_CHILD_LIST;
+        attrs[k].value.objlist.list = children.data();
+        attrs[k].value.objlist.count = static_cast<uint32_t>(children.size());
+    }
+    getObjectsAttributeBulk(SAI_OBJECT_TYPE_SCHEDULER_GROUP, parent_oids, attrs, statuses);
+
+    for (size_t k = 0; k < parent_oids.size(); k++)
+    {
+        auto &info = infos[parent_positions[k].first];
+        auto j = parent_positions[k].second;
+
+        if (statuses[k] == SAI_STATUS_SUCCESS)
+        {
+            info.group_has_been_initialized[j] = true;
+        }
+        else
+        {
+            /* Fetched again by getSchedulerGroup() */
+            info.child_groups[j].clear();
+        }
+    }
+
+    size_t port_count = 0;
+    for (size_t i = 0; i < list_port_oids.size(); i++)
+    {
+        if (port_valid[i])
+        {
+            m_scheduler_group_port_info[list_port_oids[i]] = std::move(infos[i]);
+            port_count++;
+        }
+    }
+
+    SWSS_LOG_NOTICE("Preloaded scheduler groups of %zu port(s), %zu group(s)", port_count, group_oids.size());
+}
+
+/*
+ * The scheduler profile is set to the scheduler group of the queue when the batch is flushed
+ */
+bool QosOrch::applySchedulerToQueueSchedulerGroup(Port &port, size_t queue_ind, sai_object_id_t scheduler_profile_id, QosBulkTask &bulk_task)
 {
     SWSS_LOG_ENTER();
     sai_object_id_t queue_id;
@@ -1683,32 +1890,24 @@ bool QosOrch::applySchedulerToQueueSchedulerGroup(Port &port, size_t queue_ind,
     
     /* Apply scheduler profile to all port groups  */
     sai_attribute_t attr;
-    sai_status_t    sai_status;
 
     attr.id = SAI_SCHEDULER_GROUP_ATTR_SCHEDULER_PROFILE_ID;
     attr.value.oid = scheduler_profile_id;
 
-    sai_status = sai_scheduler_group_api->set_scheduler_group_attribute(group_id, &attr);
-    if (SAI_STATUS_SUCCESS != sai_status)
-    {
-        SWSS_LOG_ERROR("Failed applying scheduler profile:0x%" PRIx64 " to scheduler group:0x%" PRIx64 ", port:%s", scheduler_profile_id, group_id, port.m_alias.c_str());
-        task_process_status handle_status = handleSaiSetStatus(SAI_API_SCHEDULER_GROUP, sai_status);
-        if (handle_status != task_success)
-        {
-            return parseHandleSaiStatusFailure(handle_status);
-        }
-    }
+    bulk_task.entries.push_back({ SAI_OBJECT_TYPE_SCHEDULER_GROUP, group_id, attr, SAI_STATUS_NOT_EXECUTED });
 
-    SWSS_LOG_DEBUG("port:%s, scheduler_profile_id:0x%" PRIx64 " applied to scheduler group:0x%" PRIx64, port.m_alias.c_str(), scheduler_profile_id, group_id);
+    SWSS_LOG_DEBUG("port:%s, scheduler_profile_id:0x%" PRIx64 " to be applied to scheduler group:0x%" PRIx64, port.m_alias.c_str(), scheduler_profile_id, group_id);
 
     return true;
 }
 
-bool QosOrch::applyWredProfileToQueue(Port &port, size_t queue_ind, sai_object_id_t sai_wred_profile)
+/*
+ * The WRED profile is set to the queue when the batch is flushed
+ */
+bool QosOrch::applyWredProfileToQueue(Port &port, size_t queue_ind, sai_object_id_t sai_wred_profile, QosBulkTask &bulk_task)
 {
     SWSS_LOG_ENTER();
     sai_attribute_t attr;
-    sai_status_t    sai_status;
     sai_object_id_t queue_id;
 
     if (gMySwitchType == "voq") 
@@ -1733,16 +1932,9 @@ bool QosOrch::applyWredProfileToQueue(Port &port, size_t queue_ind, sai_object_i
 
     attr.id = SAI_QUEUE_ATTR_WRED_PROFILE_ID;
     attr.value.oid = sai_wred_profile;
-    sai_status = sai_queue_api->set_queue_attribute(queue_id, &attr);
-    if (sai_status != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_ERROR("Failed to set queue attribute:%d", sai_status);
-        task_process_status handle_status = handleSaiSetStatus(SAI_API_QUEUE, sai_status);
-        if (handle_status != task_success)
-        {
-            return parseHandleSaiStatusFailure(handle_status);
-        }
-    }
+
+    bulk_task.entries.push_back({ SAI_OBJECT_TYPE_QUEUE, queue_id, attr, SAI_STATUS_NOT_EXECUTED });
+
     return true;
 }
 
@@ -1892,6 +2084,9 @@ task_process_status QosOrch::handleQueueTable(Consumer& consumer, KeyOpFieldsVal
         return task_process_status::task_invalid_entry;
     }
 
+    QosBulkTask bulk_task;
+    bulk_task.key = key;
+
     for (string port_name : port_names)
     {
         Port port;
@@ -1915,30 +2110,62 @@ task_process_status QosOrch::handleQueueTable(Consumer& consumer, KeyOpFieldsVal
 
             if (!donotChangeScheduler)
             {
-                result = applySchedulerToQueueSchedulerGroup(port, queue_ind, sai_scheduler_profile);
+                result = applySchedulerToQueueSchedulerGroup(port, queue_ind, sai_scheduler_profile, bulk_task);
 
                 if (!result)
                 {
                     SWSS_LOG_ERROR("Failed setting field:%s to port:%s, queue:%zd, line:%d", scheduler_field_name.c_str(), port.m_alias.c_str(), queue_ind, __LINE__);
                     return task_process_status::task_failed;
                 }
-                SWSS_LOG_DEBUG("Applied scheduler to port:%s", port_name.c_str());
+                SWSS_LOG_DEBUG("Scheduler to be applied to port:%s", port_name.c_str());
             }
 
             if (!donotChangeWredProfile)
             {
-                result = applyWredProfileToQueue(port, queue_ind, sai_wred_profile);
+                result = applyWredProfileToQueue(port, queue_ind, sai_wred_profile, bulk_task);
 
                 if (!result)
                 {
                     SWSS_LOG_ERROR("Failed setting field:%s to port:%s, queue:%zd, line:%d", wred_profile_field_name.c_str(), port.m_alias.c_str(), queue_ind, __LINE__);
                     return task_process_status::task_failed;
                 }
-                SWSS_LOG_DEBUG("Applied wred profile to port:%s", port_name.c_str());
+                SWSS_LOG_DEBUG("Wred profile to be applied to port:%s", port_name.c_str());
             }
         }
     }
-    SWSS_LOG_DEBUG("finished");
+
+    if (bulk_task.entries.empty())
+    {
+        SWSS_LOG_DEBUG("finished");
+        return task_process_status::task_success;
+    }
+
+    bulk_task.complete = [](QosBulkTask &task) {
+        for (const auto &entry : task.entries)
+        {
+            if (entry.status == SAI_STATUS_SUCCESS)
+            {
+                continue;
+            }
+
+            bool is_queue = (entry.type == SAI_OBJECT_TYPE_QUEUE);
+            SWSS_LOG_ERROR("Failed applying %s:0x%" PRIx64 " to %s:0x%" PRIx64 " of QUEUE|%s, rv:%d",
+                           is_queue ? wred_profile_field_name.c_str() : scheduler_field_name.c_str(), entry.attr.value.oid,
+                           is_queue ? "queue" : "scheduler group", entry.oid, task.key.c_str(), entry.status);
+            task_process_status handle_status = handleSaiSetStatus(is_queue ? SAI_API_QUEUE : SAI_API_SCHEDULER_GROUP, entry.status);
+            if (handle_status != task_success && !parseHandleSaiStatusFailure(handle_status))
+            {
+                return task_process_status::task_failed;
+            }
+        }
+
+        SWSS_LOG_DEBUG("QUEUE|%s finished", task.key.c_str());
+        return task_process_status::task_success;
+    };
+
+    /* SAI is updated and the task completed by flushQosBulkTasks() */
+    m_qosBulkTasks.push_back(std::move(bulk_task));
+
     return task_process_status::task_success;
 }
 
@@ -2051,9 +2278,23 @@ task_process_status QosOrch::handlePortQosMapTable(Consumer& consumer, KeyOpFiel
 
     vector<string> port_names = tokenize(key, list_item_delimiter);
 
+    QosBulkTask bulk_task;
+    bulk_task.key = key;
+
     if (op == DEL_COMMAND)
     {
         /* Handle DEL command. Just set all the maps to oid:0x0 */
+        vector<pair<sai_port_attr_t, string>> remove_list;
+        for (auto &mapRef : qos_to_attr_map)
+        {
+            string referenced_obj;
+            if (doesObjectExist(m_qos_maps, CFG_PORT_QOS_MAP_TABLE_NAME, key, mapRef.first, referenced_obj))
+            {
+                remove_list.push_back(make_pair(mapRef.second, mapRef.first));
+            }
+        }
+
+        vector<pair<sai_object_id_t, string>> ports;
         for (string port_name : port_names)
         {
             Port port;
@@ -2065,41 +2306,52 @@ task_process_status QosOrch::handlePortQosMapTable(Consumer& consumer, KeyOpFiel
                 continue;
             }
 
-            for (auto &mapRef : qos_to_attr_map)
+            for (auto &mapRef : remove_list)
             {
-                string referenced_obj;
-                if (!doesObjectExist(m_qos_maps, CFG_PORT_QOS_MAP_TABLE_NAME, key, mapRef.first, referenced_obj))
-                {
-                    continue;
-                }
-
                 sai_attribute_t attr;
-                attr.id = mapRef.second;
+                attr.id = mapRef.first;
                 attr.value.oid = SAI_NULL_OBJECT_ID;
 
-                sai_status_t status = sai_port_api->set_port_attribute(port.m_port_id, &attr);
-                if (status != SAI_STATUS_SUCCESS)
+                bulk_task.entries.push_back({ SAI_OBJECT_TYPE_PORT, port.m_port_id, attr, SAI_STATUS_NOT_EXECUTED });
+            }
+            ports.push_back(make_pair(port.m_port_id, port_name));
+        }
+
+        bulk_task.complete = [this, key, ports, remove_list](QosBulkTask &task) {
+            size_t ind = 0;
+            for (const auto &port : ports)
+            {
+                for (const auto &mapRef : remove_list)
                 {
-                    SWSS_LOG_ERROR("Failed to remove %s on port %s, rv:%d",
-                                   mapRef.first.c_str(), port_name.c_str(), status);
-                    task_process_status handle_status = handleSaiSetStatus(SAI_API_PORT, status);
-                    if (handle_status != task_process_status::task_success)
+                    const auto &entry = task.entries[ind++];
+                    if (entry.status != SAI_STATUS_SUCCESS)
                     {
-                        return task_process_status::task_invalid_entry;
+                        SWSS_LOG_ERROR("Failed to remove %s on port %s, rv:%d",
+                                       mapRef.second.c_str(), port.second.c_str(), entry.status);
+                        task_process_status handle_status = handleSaiSetStatus(SAI_API_PORT, entry.status);
+                        if (handle_status != task_process_status::task_success)
+                        {
+                            return task_process_status::task_invalid_entry;
+                        }
                     }
+                    SWSS_LOG_INFO("Removed %s on port %s", mapRef.second.c_str(), port.second.c_str());
                 }
-                SWSS_LOG_INFO("Removed %s on port %s", mapRef.first.c_str(), port_name.c_str());
-            }
 
-            if (!gPortsOrch->setPortPfc(port.m_port_id, 0))
-            {
-                SWSS_LOG_ERROR("Failed to disable PFC on port %s", port_name.c_str());
+                if (!gPortsOrch->setPortPfc(port.first, 0))
+                {
+                    SWSS_LOG_ERROR("Failed to disable PFC on port %s", port.second.c_str());
+                }
+
+                SWSS_LOG_INFO("Disabled PFC on port %s", port.second.c_str());
             }
 
-            SWSS_LOG_INFO("Disabled PFC on port %s", port_name.c_str());
-        }
+            removeObject(m_qos_maps, CFG_PORT_QOS_MAP_TABLE_NAME, key);
 
-        removeObject(m_qos_maps, CFG_PORT_QOS_MAP_TABLE_NAME, key);
+            return task_process_status::task_success;
+        };
+
+        /* SAI is updated and the task completed by flushQosBulkTasks() */
+        m_qosBulkTasks.push_back(std::move(bulk_task));
 
         return task_process_status::task_success;
     }
@@ -2166,6 +2418,7 @@ task_process_status QosOrch::handlePortQosMapTable(Consumer& consumer, KeyOpFiel
         }
     }
 
+    vector<pair<sai_object_id_t, string>> ports;
     for (string port_name : port_names)
     {
         Port port;
@@ -2184,42 +2437,187 @@ task_process_status QosOrch::handlePortQosMapTable(Consumer& consumer, KeyOpFiel
             attr.id = it->first;
             attr.value.oid = it->second.second;
 
-            sai_status_t status = sai_port_api->set_port_attribute(port.m_port_id, &attr);
-            if (status != SAI_STATUS_SUCCESS)
+            bulk_task.entries.push_back({ SAI_OBJECT_TYPE_PORT, port.m_port_id, attr, SAI_STATUS_NOT_EXECUTED });
+        }
+        ports.push_back(make_pair(port.m_port_id, port_name));
+    }
+
+    /* The PFC bits are applied to a port after its QoS maps */
+    bulk_task.complete = [ports, update_list, pfc_enable, pfcwd_sw_enable](QosBulkTask &task) {
+        size_t ind = 0;
+        for (const auto &port : ports)
+        {
+            const auto &port_name = port.second;
+
+            for (auto it = update_list.begin(); it != update_list.end(); it++)
             {
-                SWSS_LOG_ERROR("Failed to apply %s to port %s, rv:%d",
-                               it->second.first.c_str(), port_name.c_str(), status);
-                task_process_status handle_status = handleSaiSetStatus(SAI_API_PORT, status);
-                if (handle_status != task_process_status::task_success)
+                const auto &entry = task.entries[ind++];
+                if (entry.status != SAI_STATUS_SUCCESS)
                 {
-                    return task_process_status::task_invalid_entry;
+                    SWSS_LOG_ERROR("Failed to apply %s to port %s, rv:%d",
+                                   it->second.first.c_str(), port_name.c_str(), entry.status);
+                    task_process_status handle_status = handleSaiSetStatus(SAI_API_PORT, entry.status);
+                    if (handle_status != task_process_status::task_success)
+                    {
+                        return task_process_status::task_invalid_entry;
+                    }
                 }
+                SWSS_LOG_INFO("Applied %s to port %s", it->second.first.c_str(), port_name.c_str());
+            }
+
+            sai_uint8_t old_pfc_enable = 0;
+            if (!gPortsOrch->getPortPfc(port.first, &old_pfc_enable))
+            {
+                SWSS_LOG_ERROR("Failed to retrieve PFC bits on port %s", port_name.c_str());
             }
-            SWSS_LOG_INFO("Applied %s to port %s", it->second.first.c_str(), port_name.c_str());
+
+            if (pfc_enable || old_pfc_enable)
+            {
+                if (!gPortsOrch->setPortPfc(port.first, pfc_enable))
+                {
+                    SWSS_LOG_ERROR("Failed to apply PFC bits 0x%x to port %s", pfc_enable, port_name.c_str());
+                }
+
+                SWSS_LOG_INFO("Applied PFC bits 0x%x to port %s", pfc_enable, port_name.c_str());
+            }
+
+            // Save pfd_wd bitmask unconditionally
+            gPortsOrch->setPortPfcWatchdogStatus(port.first, pfcwd_sw_enable);
+        }
+
+        SWSS_LOG_NOTICE("Applied QoS maps to ports");
+        return task_process_status::task_success;
+    };
+
+    /* SAI is updated and the task completed by flushQosBulkTasks() */
+    m_qosBulkTasks.push_back(std::move(bulk_task));
+
+    return task_process_status::task_success;
+}
+
+void QosOrch::setObjectsAttributeBulk(sai_object_type_t type, std::vector<QosBulkEntry*> &entries)
+{
+    SWSS_LOG_ENTER();
+
+    if (entries.empty())
+    {
+        return;
+    }
+
+    std::vector<sai_object_key_t> keys(entries.size());
+    std::vector<sai_attribute_t> attrs(entries.size());
+    std::vector<sai_status_t> statuses(entries.size(), SAI_STATUS_NOT_EXECUTED);
+
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        keys[i].key.object_id = entries[i]->oid;
+        attrs[i] = entries[i]->attr;
+    }
+
+    sai_status_t status = SAI_STATUS_NOT_IMPLEMENTED;
+
+    /* A single object is not worth a bulk call */
+    if (entries.size() > 1 && m_isBulkSetSupported)
+    {
+        status = sai_bulk_object_set_attribute(type, (uint32_t)entries.size(), keys.data(), attrs.data(),
+                                               SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+        {
+            SWSS_LOG_NOTICE("Bulk set is not supported for ports, queues and scheduler groups, falling back to per object set");
+            m_isBulkSetSupported = false;
         }
+    }
 
-        sai_uint8_t old_pfc_enable = 0;
-        if (!gPortsOrch->getPortPfc(port.m_port_id, &old_pfc_enable))
+    if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+    {
+        for (size_t i = 0; i < entries.size(); i++)
         {
-            SWSS_LOG_ERROR("Failed to retrieve PFC bits on port %s", port_name.c_str());
+            switch (type)
+            {
+                case SAI_OBJECT_TYPE_PORT:
+                    statuses[i] = sai_port_api->set_port_attribute(entries[i]->oid, &attrs[i]);
+                    break;
+                case SAI_OBJECT_TYPE_QUEUE:
+                    statuses[i] = sai_queue_api->set_queue_attribute(entries[i]->oid, &attrs[i]);
+                    break;
+                default:
+                    statuses[i] = sai_scheduler_group_api->set_scheduler_group_attribute(entries[i]->oid, &attrs[i]);
+                    break;
+            }
         }
+    }
+
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        entries[i]->status = statuses[i];
+    }
+
+    SWSS_LOG_INFO("Applied %zu attribute(s) of object type %d", entries.size(), type);
+
+    entries.clear();
+}
+
+void QosOrch::flushQosBulkTasks(Consumer &consumer)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_qosBulkTasks.empty())
+    {
+        return;
+    }
+
+    /*
+     * Set the attributes of all the tasks of the batch with one bulk call per object type
+     * as long as possible. An attribute of an object set twice in the batch, e.g. by two keys
+     * sharing a port, flushes the pending ones of the object type first so the order is preserved.
+     */
+    std::map<sai_object_type_t, std::vector<QosBulkEntry*>> pending;
+    std::map<sai_object_type_t, std::set<std::pair<sai_object_id_t, sai_attr_id_t>>> pending_attrs;
 
-        if (pfc_enable || old_pfc_enable)
+    for (auto &task : m_qosBulkTasks)
+    {
+        for (auto &entry : task.entries)
         {
-            if (!gPortsOrch->setPortPfc(port.m_port_id, pfc_enable))
+            auto &entries = pending[entry.type];
+            auto &attrs = pending_attrs[entry.type];
+            auto attr_key = std::make_pair(entry.oid, entry.attr.id);
+
+            if (attrs.find(attr_key) != attrs.end() || entries.size() >= gMaxBulkSize)
             {
-                SWSS_LOG_ERROR("Failed to apply PFC bits 0x%x to port %s", pfc_enable, port_name.c_str());
+                setObjectsAttributeBulk(entry.type, entries);
+                attrs.clear();
             }
 
-            SWSS_LOG_INFO("Applied PFC bits 0x%x to port %s", pfc_enable, port_name.c_str());
+            entries.push_back(&entry);
+            attrs.insert(attr_key);
         }
+    }
 
-        // Save pfd_wd bitmask unconditionally
-        gPortsOrch->setPortPfcWatchdogStatus(port.m_port_id, pfcwd_sw_enable);
+    for (auto &it : pending)
+    {
+        setObjectsAttributeBulk(it.first, it.second);
     }
 
-    SWSS_LOG_NOTICE("Applied QoS maps to ports");
-    return task_process_status::task_success;
+    for (auto &task : m_qosBulkTasks)
+    {
+        auto task_status = task.complete(task);
+        switch (task_status)
+        {
+            case task_process_status::task_success :
+                consumer.m_toSync.erase(task.task);
+                break;
+            case task_process_status::task_need_retry :
+                SWSS_LOG_INFO("Failed to process QOS task %s, retry it", task.key.c_str());
+                break;
+            default:
+                SWSS_LOG_ERROR("Failed to process QOS task %s, drop it", task.key.c_str());
+                consumer.m_toSync.erase(task.task);
+                break;
+        }
+    }
+
+    m_qosBulkTasks.clear();
+    m_qosBulkTaskKeys.clear();
 }
 
 void QosOrch::doTask()
@@ -2254,6 +2652,12 @@ void QosOrch::doTask(Consumer &consumer)
         return;
     }
 
+    if (!m_schedulerGroupsPreloaded && consumer.getTableName() == CFG_QUEUE_TABLE_NAME && !consumer.m_toSync.empty())
+    {
+        preloadSchedulerGroups();
+        m_schedulerGroupsPreloaded = true;
+    }
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -2266,7 +2670,22 @@ void QosOrch::doTask(Consumer &consumer)
             continue;
         }
 
+        /* A key handled again in the batch, e.g. DEL then SET, sees its previous task completed */
+        if (m_qosBulkTaskKeys.find(kfvKey(it->second)) != m_qosBulkTaskKeys.end())
+        {
+            flushQosBulkTasks(consumer);
+        }
+
+        auto bulk_task_count = m_qosBulkTasks.size();
         auto task_status = (this->*(m_qos_handler_map[qos_map_type_name]))(consumer, it->second);
+        if (task_status == task_process_status::task_success && m_qosBulkTasks.size() > bulk_task_count)
+        {
+            /* Completed once the whole batch is flushed */
+            m_qosBulkTasks.back().task = it++;
+            m_qosBulkTaskKeys.insert(m_qosBulkTasks.back().key);
+            continue;
+        }
+
         switch(task_status)
         {
             case task_process_status::task_success :
@@ -2279,6 +2698,7 @@ void QosOrch::doTask(Consumer &consumer)
             case task_process_status::task_failed :
                 SWSS_LOG_ERROR("Failed to process QOS task, drop it");
                 it = consumer.m_toSync.erase(it);
+                flushQosBulkTasks(consumer);
                 return;
             case task_process_status::task_need_retry :
                 SWSS_LOG_INFO("Failed to process QOS task, retry it");
@@ -2290,6 +2710,8 @@ void QosOrch::doTask(Consumer &consumer)
                 break;
         }
     }
+
+    flushQosBulkTasks(consumer);
 }
 
 /**
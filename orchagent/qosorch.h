@@ -1,7 +1,9 @@
 #ifndef SWSS_QOSORCH_H
 #define SWSS_QOSORCH_H
 
+#include <functional>
 #include <map>
+#include <set>
 #include <unordered_map>
 #include <unordered_set>
 #include "orch.h"
@@ -198,6 +200,25 @@ private:
     void doTask() override;
     virtual void doTask(Consumer& consumer);
 
+    /* A port, queue or scheduler group attribute set when the batch is flushed */
+    struct QosBulkEntry
+    {
+        sai_object_type_t type;
+        sai_object_id_t oid;
+        sai_attribute_t attr;
+        sai_status_t status;
+    };
+
+    /* A PORT_QOS_MAP or QUEUE task waiting for its SAI attributes to be set */
+    struct QosBulkTask
+    {
+        SyncMap::iterator task;
+        std::string key;
+        std::vector<QosBulkEntry> entries;
+        /* Checks the statuses of the entries and finishes the task once they have been set */
+        std::function<task_process_status(QosBulkTask &)> complete;
+    };
+
     typedef task_process_status (QosOrch::*qos_table_handler)(Consumer& consumer, KeyOpFieldsValuesTuple &tuple);
     typedef map<string, qos_table_handler> qos_table_handler_map;
     typedef pair<string, qos_table_handler> qos_handler_pair;
@@ -223,9 +244,14 @@ private:
     task_process_status handleGlobalQosMap(const string &op, KeyOpFieldsValuesTuple &tuple);
 
     sai_object_id_t getSchedulerGroup(const Port &port, const sai_object_id_t queue_id);
-
-    bool applySchedulerToQueueSchedulerGroup(Port &port, size_t queue_ind, sai_object_id_t scheduler_profile_id);
-    bool applyWredProfileToQueue(Port &port, size_t queue_ind, sai_object_id_t sai_wred_profile);
+    void preloadSchedulerGroups();
+    void getObjectsAttributeBulk(sai_object_type_t type, const std::vector<sai_object_id_t> &oids,
+                                 std::vector<sai_attribute_t> &attrs, std::vector<sai_status_t> &statuses);
+
+    bool applySchedulerToQueueSchedulerGroup(Port &port, size_t queue_ind, sai_object_id_t scheduler_profile_id, QosBulkTask &bulk_task);
+    bool applyWredProfileToQueue(Port &port, size_t queue_ind, sai_object_id_t sai_wred_profile, QosBulkTask &bulk_task);
+    void setObjectsAttributeBulk(sai_object_type_t type, std::vector<QosBulkEntry*> &entries);
+    void flushQosBulkTasks(Consumer &consumer);
     bool applyDscpToTcMapToSwitch(sai_attr_id_t attr_id, sai_object_id_t sai_dscp_to_tc_map);
 private:
     qos_table_handler_map m_qos_handler_map;
@@ -238,6 +264,12 @@ private:
     };
 
     std::unordered_map<sai_object_id_t, SchedulerGroupPortInfo_t> m_scheduler_group_port_info;
+    bool m_schedulerGroupsPreloaded = false;
+
+    std::vector<QosBulkTask> m_qosBulkTasks;
+    std::set<std::string> m_qosBulkTaskKeys;
+    bool m_isBulkSetSupported = true;
+    bool m_isBulkGetSupported = true;
 
     friend QosMapHandler;
     friend DscpToTcMapHandler;
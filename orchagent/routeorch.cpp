@@ -47,6 +47,7 @@ RouteOrch::RouteOrch(DBConnector *db, vector<table_name_with_pri_t> &tableNames,
         m_nextHopGroupCount(0),
         m_srv6Orch(srv6Orch),
         m_resync(false),
+        m_resyncGeneration(0),
         m_appTunnelDecapTermProducer(db, APP_TUNNEL_DECAP_TERM_TABLE_NAME)
 {
     SWSS_LOG_ENTER();
@@ -257,6 +258,12 @@ void RouteOrch::updateDefRouteState(string ip, bool add)
     m_stateDefaultRouteTb->set(ip, tuples);
 }
 
+/* Routes point to next hops over router interfaces */
+std::vector<std::string> RouteOrch::getWarmStartDependencies() const
+{
+    return { APP_INTF_TABLE_NAME, APP_NEIGH_TABLE_NAME };
+}
+
 bool RouteOrch::hasNextHopGroup(const NextHopGroupKey& nexthops) const
 {
     return m_syncdNextHopGroups.find(nexthops) != m_syncdNextHopGroups.end();
@@ -516,41 +523,25 @@ void RouteOrch::doTask(Consumer& consumer)
 
             /* Get notification from application */
             /* resync application:
-             * When routeorch receives 'resync' message, it marks all current
-             * routes as dirty and waits for 'resync complete' message. For all
-             * newly received routes, if they match current dirty routes, it unmarks
-             * them dirty. After receiving 'resync complete' message, it creates all
-             * newly added routes and removes all dirty routes.
+             * When routeorch receives 'resync' message, it starts a new route
+             * generation and holds all route updates until the 'resync complete'
+             * message. On completion, the routes re-announced meanwhile are
+             * stamped with the new generation, and only the routes left in an
+             * older generation are queued for removal.
              */
             if (key == "resync")
             {
                 if (op == "SET")
                 {
-                    /* Mark all current routes as dirty (DEL) in consumer.m_toSync map */
                     SWSS_LOG_NOTICE("Start resync routes\n");
-                    for (auto j : m_syncdRoutes)
-                    {
-                        string vrf;
-
-                        if (j.first != gVirtualRouterId)
-                        {
-                            vrf = m_vrfOrch->getVRFname(j.first) + ":";
-                        }
-
-                        for (auto i : j.second)
-                        {
-                            vector<FieldValueTuple> v;
-                            key = vrf + i.first.to_string();
-                            auto x = KeyOpFieldsValuesTuple(key, DEL_COMMAND, v);
-                            consumer.addToSync(x);
-                        }
-                    }
+                    m_resyncGeneration++;
                     m_resync = true;
                 }
                 else
                 {
                     SWSS_LOG_NOTICE("Complete resync routes\n");
                     m_resync = false;
+                    removeStaleRoutes(consumer);
                 }
 
                 it = consumer.m_toSync.erase(it);
@@ -1704,6 +1695,86 @@ void RouteOrch::addTempRoute(RouteBulkContext& ctx, const NextHopGroupKey &nextH
     addRoute(ctx, tmp_next_hop);
 }
 
+void RouteOrch::removeStaleRoutes(Consumer& consumer)
+{
+    SWSS_LOG_ENTER();
+
+    /* Stamp the routes re-announced during resync with the current generation */
+    for (const auto& entry : consumer.m_toSync)
+    {
+        const auto& t = entry.second;
+        const string& key = kfvKey(t);
+
+        if (kfvOp(t) != SET_COMMAND)
+        {
+            continue;
+        }
+
+        sai_object_id_t vrf_id = gVirtualRouterId;
+        string prefix = key;
+
+        if (!key.compare(0, strlen(VRF_PREFIX), VRF_PREFIX))
+        {
+            size_t found = key.find(':');
+            string vrf_name = key.substr(0, found);
+
+            if (found == string::npos || !m_vrfOrch->isVRFexists(vrf_name))
+            {
+                continue;
+            }
+            vrf_id = m_vrfOrch->getVRFid(vrf_name);
+            prefix = key.substr(found+1);
+        }
+
+        auto it_vrf = m_syncdRoutes.find(vrf_id);
+        if (it_vrf == m_syncdRoutes.end())
+        {
+            continue;
+        }
+
+        try
+        {
+            auto it_route = it_vrf->second.find(IpPrefix(prefix));
+            if (it_route != it_vrf->second.end())
+            {
+                it_route->second.generation = m_resyncGeneration;
+            }
+        }
+        catch (const exception& e)
+        {
+            /* Left for the route handler to report */
+            continue;
+        }
+    }
+
+    /* Remove the routes that were not re-announced */
+    size_t count = 0;
+    for (const auto& vrf_routes : m_syncdRoutes)
+    {
+        string vrf;
+
+        if (vrf_routes.first != gVirtualRouterId)
+        {
+            vrf = m_vrfOrch->getVRFname(vrf_routes.first) + ":";
+        }
+
+        for (const auto& route : vrf_routes.second)
+        {
+            if (route.second.generation == m_resyncGeneration)
+            {
+                continue;
+            }
+
+            vector<FieldValueTuple> v;
+            auto x = KeyOpFieldsValuesTuple(vrf + route.first.to_string(), DEL_COMMAND, v);
+            consumer.addToSync(x);
+            count++;
+        }
+    }
+
+    SWSS_LOG_NOTICE("Removing %zu stale routes after resync", count);
+}
+
 bool RouteOrch::addRoute(RouteBulkContext& ctx, const NextHopGroupKey &nextHops)
 {
     SWSS_LOG_ENTER();
@@ -2338,7 +2409,9 @@ bool RouteOrch::addRoutePost(const RouteBulkContext& ctx, const NextHopGroupKey
         gFlowCounterRouteOrch->handleRouteAdd(vrf_id, ipPrefix);
     }
 
-    m_syncdRoutes[vrf_id][ipPrefix] = RouteNhg(nextHops, ctx.nhg_index);
+    auto& route_nhg = m_syncdRoutes[vrf_id][ipPrefix];
+    route_nhg = RouteNhg(nextHops, ctx.nhg_index);
+    route_nhg.generation = m_resyncGeneration;
 
     /* add subnet decap term for VIP route */
     const SubnetDecapConfig &config = gTunneldecapOrch->getSubnetDecapConfig();
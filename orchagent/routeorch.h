@@ -65,6 +65,12 @@ struct RouteNhg
      */
     std::string nhg_index;
 
+    /*
+     * Resync generation the route was last confirmed in.  Not part of the
+     * route identity, so ignored by the comparison operators.
+     */
+    uint32_t generation = 0;
+
     RouteNhg() = default;
     RouteNhg(const NextHopGroupKey& key, const std::string& index) :
         nhg_key(key), nhg_index(index) {}
@@ -186,6 +192,8 @@ class RouteOrch : public Orch, public Subject
 public:
     RouteOrch(DBConnector *db, vector<table_name_with_pri_t> &tableNames, SwitchOrch *switchOrch, NeighOrch *neighOrch, IntfsOrch *intfsOrch, VRFOrch *vrfOrch, FgNhgOrch *fgNhgOrch, Srv6Orch *srv6Orch);
 
+    std::vector<std::string> getWarmStartDependencies() const override;
+
     bool hasNextHopGroup(const NextHopGroupKey&) const;
     sai_object_id_t getNextHopGroupId(const NextHopGroupKey&);
 
@@ -239,6 +247,7 @@ private:
     unsigned int m_nextHopGroupCount;
     unsigned int m_maxNextHopGroupCount;
     bool m_resync;
+    uint32_t m_resyncGeneration;
 
     shared_ptr<DBConnector> m_stateDb;
     unique_ptr<swss::Table> m_stateDefaultRouteTb;
@@ -265,6 +274,7 @@ private:
     bool removeRoute(RouteBulkContext& ctx);
     bool addRoutePost(const RouteBulkContext& ctx, const NextHopGroupKey &nextHops);
     bool removeRoutePost(const RouteBulkContext& ctx);
+    void removeStaleRoutes(Consumer& consumer);
 
     void addTempLabelRoute(LabelRouteBulkContext& ctx, const NextHopGroupKey&);
     bool addLabelRoute(LabelRouteBulkContext& ctx, const NextHopGroupKey&);
@@ -1,3 +1,5 @@
+#include <chrono>
+
 #include "ut_helper.h"
 #include "flowcounterrouteorch.h"
 
@@ -1379,6 +1381,314 @@ namespace aclorch_test
         ASSERT_EQ(tableIt, orch->getAclTables().end());
     }
 
+    // Fail the bulk creation of the ACL entries with priority 20, create the rest
+    sai_status_t failPriority20AclEntries(
+        sai_object_id_t switch_id, uint32_t object_count, const uint32_t *attr_count,
+        const sai_attribute_t **attr_list, sai_bulk_op_error_mode_t mode,
+        sai_object_id_t *object_id, sai_status_t *object_statuses)
+    {
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_id[i] = SAI_NULL_OBJECT_ID;
+            object_statuses[i] = SAI_STATUS_SUCCESS;
+            for (uint32_t j = 0; j < attr_count[i]; j++)
+            {
+                if (attr_list[i][j].id == SAI_ACL_ENTRY_ATTR_PRIORITY && attr_list[i][j].value.u32 == 20)
+                {
+                    object_statuses[i] = SAI_STATUS_INSUFFICIENT_RESOURCES;
+                }
+            }
+            if (object_statuses[i] == SAI_STATUS_SUCCESS)
+            {
+                object_statuses[i] = sai_acl_api->create_acl_entry(&object_id[i], switch_id, attr_count[i], attr_list[i]);
+            }
+            if (object_statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                status = SAI_STATUS_FAILURE;
+            }
+        }
+        return status;
+    }
+
+    TEST_F(AclOrchTest, AclRule_BulkCreatePartialFailure)
+    {
+        string tableId = "acl_table_1";
+
+        auto orch = createAclOrch();
+
+        auto kvfAclTable = deque<KeyOpFieldsValuesTuple>({{
+            tableId,
+            SET_COMMAND,
+            {
+                { ACL_TABLE_DESCRIPTION, "L3 table" },
+                { ACL_TABLE_TYPE, TABLE_TYPE_L3 },
+                { ACL_TABLE_STAGE, STAGE_INGRESS },
+                { ACL_TABLE_PORTS, "1,2" }
+            }
+        }});
+
+        orch->doAclTableTask(kvfAclTable);
+
+        auto tableOid = orch->getTableById(tableId);
+        ASSERT_NE(tableOid, SAI_NULL_OBJECT_ID);
+        auto &tableObj = orch->getAclTables().at(tableOid);
+
+        auto &entryBulker = Portal::AclOrchInternal::getAclEntryBulker(orch->m_aclOrch);
+        auto old_create_entries = entryBulker.create_entries;
+        entryBulker.create_entries = failPriority20AclEntries;
+
+        auto kvfAclRule = deque<KeyOpFieldsValuesTuple>();
+        for (auto priority : { "10", "20", "30" })
+        {
+            kvfAclRule.push_back({
+                tableId + "|acl_rule_" + priority,
+                SET_COMMAND,
+                {
+                    { RULE_PRIORITY, priority },
+                    { ACTION_PACKET_ACTION, PACKET_ACTION_FORWARD },
+                    { MATCH_SRC_IP, string("10.0.0.") + priority }
+                }
+            });
+        }
+
+        orch->doAclRuleTask(kvfAclRule);
+
+        entryBulker.create_entries = old_create_entries;
+
+        // The failed rule is not installed, the other rules of the batch are
+        ASSERT_EQ(tableObj.rules.size(), 2);
+        ASSERT_NE(tableObj.rules.find("acl_rule_10"), tableObj.rules.end());
+        ASSERT_EQ(tableObj.rules.find("acl_rule_20"), tableObj.rules.end());
+        ASSERT_NE(tableObj.rules.find("acl_rule_30"), tableObj.rules.end());
+        ASSERT_TRUE(validateAclRuleCounter(*tableObj.rules.at("acl_rule_10"), true));
+        ASSERT_TRUE(validateAclRuleCounter(*tableObj.rules.at("acl_rule_30"), true));
+
+        // The counter of the failed rule is rolled back
+        ASSERT_TRUE(validateResourceCountWithCrm(orch->m_aclOrch, gCrmOrch));
+
+        Table ruleStateTable(m_state_db.get(), STATE_ACL_RULE_TABLE_NAME);
+        string status;
+        ASSERT_TRUE(ruleStateTable.hget(tableId + "|acl_rule_20", "status", status));
+        ASSERT_EQ(status, "Pending creation");
+        ASSERT_TRUE(ruleStateTable.hget(tableId + "|acl_rule_10", "status", status));
+        ASSERT_EQ(status, "Active");
+
+        // The next attempt creates it
+        kvfAclRule.erase(kvfAclRule.begin());
+        kvfAclRule.pop_back();
+        orch->doAclRuleTask(kvfAclRule);
+
+        ASSERT_NE(tableObj.rules.find("acl_rule_20"), tableObj.rules.end());
+        ASSERT_TRUE(validateAclRuleCounter(*tableObj.rules.at("acl_rule_20"), true));
+        ASSERT_TRUE(validateResourceCountWithCrm(orch->m_aclOrch, gCrmOrch));
+        ASSERT_TRUE(ruleStateTable.hget(tableId + "|acl_rule_20", "status", status));
+        ASSERT_EQ(status, "Active");
+
+        for (auto &kfv : kvfAclRule)
+        {
+            kfvOp(kfv) = DEL_COMMAND;
+            kfvFieldsValues(kfv).clear();
+        }
+        kvfAclRule.push_back({ tableId + "|acl_rule_10", DEL_COMMAND, {} });
+        kvfAclRule.push_back({ tableId + "|acl_rule_30", DEL_COMMAND, {} });
+        orch->doAclRuleTask(kvfAclRule);
+        ASSERT_TRUE(tableObj.rules.empty());
+
+        kvfAclTable = deque<KeyOpFieldsValuesTuple>({{ tableId, DEL_COMMAND, {} }});
+        orch->doAclTableTask(kvfAclTable);
+        ASSERT_EQ(orch->getTableById(tableId), SAI_NULL_OBJECT_ID);
+    }
+
+    // Report the ACL entries with priority 20 as already existing, create the rest
+    sai_status_t existPriority20AclEntries(
+        sai_object_id_t switch_id, uint32_t object_count, const uint32_t *attr_count,
+        const sai_attribute_t **attr_list, sai_bulk_op_error_mode_t mode,
+        sai_object_id_t *object_id, sai_status_t *object_statuses)
+    {
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_id[i] = SAI_NULL_OBJECT_ID;
+            object_statuses[i] = SAI_STATUS_SUCCESS;
+            for (uint32_t j = 0; j < attr_count[i]; j++)
+            {
+                if (attr_list[i][j].id == SAI_ACL_ENTRY_ATTR_PRIORITY && attr_list[i][j].value.u32 == 20)
+                {
+                    object_statuses[i] = SAI_STATUS_ITEM_ALREADY_EXISTS;
+                }
+            }
+            if (object_statuses[i] == SAI_STATUS_SUCCESS)
+            {
+                object_statuses[i] = sai_acl_api->create_acl_entry(&object_id[i], switch_id, attr_count[i], attr_list[i]);
+            }
+            if (object_statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                status = SAI_STATUS_FAILURE;
+            }
+        }
+        return status;
+    }
+
+    // An entry which already exists is taken as created, as the single rule creation does
+    TEST_F(AclOrchTest, AclRule_BulkCreateItemAlreadyExists)
+    {
+        string tableId = "acl_table_1";
+
+        auto orch = createAclOrch();
+
+        auto kvfAclTable = deque<KeyOpFieldsValuesTuple>({{
+            tableId,
+            SET_COMMAND,
+            {
+                { ACL_TABLE_DESCRIPTION, "L3 table" },
+                { ACL_TABLE_TYPE, TABLE_TYPE_L3 },
+                { ACL_TABLE_STAGE, STAGE_INGRESS },
+                { ACL_TABLE_PORTS, "1,2" }
+            }
+        }});
+
+        orch->doAclTableTask(kvfAclTable);
+
+        auto tableOid = orch->getTableById(tableId);
+        ASSERT_NE(tableOid, SAI_NULL_OBJECT_ID);
+        auto &tableObj = orch->getAclTables().at(tableOid);
+
+        auto &entryBulker = Portal::AclOrchInternal::getAclEntryBulker(orch->m_aclOrch);
+        auto old_create_entries = entryBulker.create_entries;
+        entryBulker.create_entries = existPriority20AclEntries;
+
+        auto kvfAclRule = deque<KeyOpFieldsValuesTuple>();
+        for (auto priority : { "10", "20", "30" })
+        {
+            kvfAclRule.push_back({
+                tableId + "|acl_rule_" + priority,
+                SET_COMMAND,
+                {
+                    { RULE_PRIORITY, priority },
+                    { ACTION_PACKET_ACTION, PACKET_ACTION_FORWARD },
+                    { MATCH_SRC_IP, string("10.0.0.") + priority }
+                }
+            });
+        }
+
+        orch->doAclRuleTask(kvfAclRule);
+
+        entryBulker.create_entries = old_create_entries;
+
+        ASSERT_EQ(tableObj.rules.size(), 3);
+        ASSERT_NE(tableObj.rules.find("acl_rule_20"), tableObj.rules.end());
+
+        Table ruleStateTable(m_state_db.get(), STATE_ACL_RULE_TABLE_NAME);
+        string status;
+        ASSERT_TRUE(ruleStateTable.hget(tableId + "|acl_rule_20", "status", status));
+        ASSERT_EQ(status, "Active");
+    }
+
+    // Install a burst of rules spread over many tables and compare the table
+    // name lookup done for every rule against the former linear scan over all
+    // tables. Timings are only reported, not asserted.
+    TEST_F(AclOrchTest, AclRule_InstallRateWithManyTables)
+    {
+        const size_t tableCount = 128;
+        const size_t rulesPerTable = 32;
+
+        auto orch = createAclOrch();
+        auto initialTableCount = orch->getAclTables().size();
+
+        auto kvfAclTable = deque<KeyOpFieldsValuesTuple>();
+        for (size_t i = 0; i < tableCount; i++)
+        {
+            kvfAclTable.push_back({
+                "acl_table_" + to_string(i),
+                SET_COMMAND,
+                {
+                    { ACL_TABLE_DESCRIPTION, "L3 table" },
+                    { ACL_TABLE_TYPE, TABLE_TYPE_L3 },
+                    { ACL_TABLE_STAGE, STAGE_INGRESS },
+                    { ACL_TABLE_PORTS, "1,2" }
+                }
+            });
+        }
+        orch->doAclTableTask(kvfAclTable);
+        ASSERT_EQ(orch->getAclTables().size(), initialTableCount + tableCount);
+
+        auto kvfAclRule = deque<KeyOpFieldsValuesTuple>();
+        for (size_t r = 0; r < rulesPerTable; r++)
+        {
+            for (size_t i = 0; i < tableCount; i++)
+            {
+                kvfAclRule.push_back({
+                    "acl_table_" + to_string(i) + "|acl_rule_" + to_string(r),
+                    SET_COMMAND,
+                    {
+                        { ACTION_PACKET_ACTION, PACKET_ACTION_FORWARD },
+                        { MATCH_SRC_IP, "10.0." + to_string(r) + ".1" }
+                    }
+                });
+            }
+        }
+
+        auto start = chrono::steady_clock::now();
+        orch->doAclRuleTask(kvfAclRule);
+        auto installTime = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
+
+        for (size_t i = 0; i < tableCount; i++)
+        {
+            auto table = orch->getAclTable("acl_table_" + to_string(i));
+            ASSERT_NE(table, nullptr);
+            ASSERT_EQ(table->rules.size(), rulesPerTable);
+        }
+
+        // Resolve every rule's table with the index and with a copying scan
+        size_t found = 0;
+        start = chrono::steady_clock::now();
+        for (const auto &kfv : kvfAclRule)
+        {
+            auto tableName = kfvKey(kfv).substr(0, kfvKey(kfv).find('|'));
+            found += orch->getTableById(tableName) != SAI_NULL_OBJECT_ID;
+        }
+        auto indexTime = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
+        ASSERT_EQ(found, kvfAclRule.size());
+
+        found = 0;
+        start = chrono::steady_clock::now();
+        for (const auto &kfv : kvfAclRule)
+        {
+            auto tableName = kfvKey(kfv).substr(0, kfvKey(kfv).find('|'));
+            for (auto it : orch->getAclTables())
+            {
+                if (it.second.id == tableName)
+                {
+                    found++;
+                    break;
+                }
+            }
+        }
+        auto scanTime = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
+        ASSERT_EQ(found, kvfAclRule.size());
+
+        cout << "Installed " << kvfAclRule.size() << " rules in " << tableCount << " tables in "
+             << installTime.count() << "us, table lookup: index " << indexTime.count()
+             << "us, linear scan " << scanTime.count() << "us" << endl;
+
+        kvfAclTable.clear();
+        for (size_t i = 0; i < tableCount; i++)
+        {
+            kvfAclTable.push_back({ "acl_table_" + to_string(i), DEL_COMMAND, {} });
+        }
+        for (auto &kfv : kvfAclRule)
+        {
+            kfvOp(kfv) = DEL_COMMAND;
+            kfvFieldsValues(kfv).clear();
+        }
+        orch->doAclRuleTask(kvfAclRule);
+        orch->doAclTableTask(kvfAclTable);
+
+        ASSERT_EQ(orch->getAclTables().size(), initialTableCount);
+        ASSERT_EQ(orch->getTableById("acl_table_0"), SAI_NULL_OBJECT_ID);
+    }
+
     TEST_F(AclOrchTest, AclTableType_Configuration)
     {
         const string aclTableTypeName = "TEST_TYPE";
@@ -1776,6 +2086,131 @@ namespace aclorch_test
         ASSERT_TRUE(orch->m_aclOrch->removeAclRule(rule->getTableId(), rule->getId()));
     }
 
+    // A CONFIG_DB update of an installed rule is applied in place with one
+    // set per changed attribute, keeping the SAI entry and its counter.
+    TEST_F(AclOrchTest, AclRuleUpdateInPlace)
+    {
+        string acl_table_id = "acl_table_1";
+        string acl_rule_id = "acl_rule_1";
+        string acl_rule_key = acl_table_id + "|" + acl_rule_id;
+
+        auto orch = createAclOrch();
+
+        orch->doAclTableTask({ { acl_table_id,
+                                 SET_COMMAND,
+                                 { { ACL_TABLE_DESCRIPTION, "TEST" },
+                                   { ACL_TABLE_TYPE, TABLE_TYPE_L3 },
+                                   { ACL_TABLE_STAGE, STAGE_INGRESS },
+                                   { ACL_TABLE_PORTS, "1,2" } } } });
+
+        orch->doAclRuleTask({ { acl_rule_key,
+                                SET_COMMAND,
+                                { { RULE_PRIORITY, "800" },
+                                  { MATCH_SRC_IP, "1.1.1.1/32" },
+                                  { ACTION_PACKET_ACTION, PACKET_ACTION_FORWARD } } } });
+
+        auto rule = orch->getAclRule(acl_table_id, acl_rule_id);
+        ASSERT_NE(rule, nullptr);
+        auto ruleOid = rule->getOid();
+        auto counterOid = rule->getCounterOid();
+        ASSERT_NE(ruleOid, SAI_NULL_OBJECT_ID);
+        ASSERT_NE(counterOid, SAI_NULL_OBJECT_ID);
+
+        // Record the ACL entry and counter calls
+        static sai_acl_api_t *orig_sai_acl_api;
+        static vector<sai_attr_id_t> setAttrIds;
+        static size_t createCount;
+        static size_t removeCount;
+        setAttrIds.clear();
+        createCount = 0;
+        removeCount = 0;
+
+        // Puts the original sai_acl_api back, also when an assertion fails
+        struct AclApiRestorer
+        {
+            ~AclApiRestorer() { restore(); }
+            void restore() { sai_acl_api = orig_sai_acl_api; }
+        };
+
+        orig_sai_acl_api = sai_acl_api;
+        sai_acl_api_t spy_sai_acl_api = *sai_acl_api;
+        sai_acl_api = &spy_sai_acl_api;
+        AclApiRestorer aclApiRestorer;
+
+        spy_sai_acl_api.set_acl_entry_attribute = [](sai_object_id_t oid, const sai_attribute_t *attr) {
+            setAttrIds.push_back(attr->id);
+            return orig_sai_acl_api->set_acl_entry_attribute(oid, attr);
+        };
+        spy_sai_acl_api.create_acl_entry = [](sai_object_id_t *oid, sai_object_id_t switch_id, uint32_t count, const sai_attribute_t *attrs) {
+            createCount++;
+            return orig_sai_acl_api->create_acl_entry(oid, switch_id, count, attrs);
+        };
+        spy_sai_acl_api.remove_acl_entry = [](sai_object_id_t oid) {
+            removeCount++;
+            return orig_sai_acl_api->remove_acl_entry(oid);
+        };
+        spy_sai_acl_api.create_acl_counter = [](sai_object_id_t *oid, sai_object_id_t switch_id, uint32_t count, const sai_attribute_t *attrs) {
+            createCount++;
+            return orig_sai_acl_api->create_acl_counter(oid, switch_id, count, attrs);
+        };
+        spy_sai_acl_api.remove_acl_counter = [](sai_object_id_t oid) {
+            removeCount++;
+            return orig_sai_acl_api->remove_acl_counter(oid);
+        };
+
+        // Change priority and source IP, add destination IP
+        orch->doAclRuleTask({ { acl_rule_key,
+                                SET_COMMAND,
+                                { { RULE_PRIORITY, "900" },
+                                  { MATCH_SRC_IP, "2.2.2.2/24" },
+                                  { MATCH_DST_IP, "3.3.3.3/24" },
+                                  { ACTION_PACKET_ACTION, PACKET_ACTION_FORWARD } } } });
+
+        ASSERT_EQ(setAttrIds, vector<sai_attr_id_t>({ SAI_ACL_ENTRY_ATTR_PRIORITY,
+                                                      SAI_ACL_ENTRY_ATTR_FIELD_SRC_IP,
+                                                      SAI_ACL_ENTRY_ATTR_FIELD_DST_IP }));
+        ASSERT_EQ(createCount, 0u);
+        ASSERT_EQ(removeCount, 0u);
+        ASSERT_EQ(orch->getAclRule(acl_table_id, acl_rule_id), rule);
+        ASSERT_EQ(rule->getOid(), ruleOid);
+        ASSERT_EQ(rule->getCounterOid(), counterOid);
+        ASSERT_EQ(getAclRuleSaiAttribute(*rule, SAI_ACL_ENTRY_ATTR_PRIORITY), "900");
+        ASSERT_EQ(getAclRuleSaiAttribute(*rule, SAI_ACL_ENTRY_ATTR_FIELD_SRC_IP), "2.2.2.2&mask:255.255.255.0");
+        ASSERT_EQ(getAclRuleSaiAttribute(*rule, SAI_ACL_ENTRY_ATTR_FIELD_DST_IP), "3.3.3.3&mask:255.255.255.0");
+
+        // Drop the destination IP match and change the action
+        setAttrIds.clear();
+        orch->doAclRuleTask({ { acl_rule_key,
+                                SET_COMMAND,
+                                { { RULE_PRIORITY, "900" },
+                                  { MATCH_SRC_IP, "2.2.2.2/24" },
+                                  { ACTION_PACKET_ACTION, PACKET_ACTION_DROP } } } });
+
+        ASSERT_EQ(setAttrIds, vector<sai_attr_id_t>({ SAI_ACL_ENTRY_ATTR_FIELD_DST_IP,
+                                                      SAI_ACL_ENTRY_ATTR_ACTION_PACKET_ACTION }));
+        ASSERT_EQ(createCount, 0u);
+        ASSERT_EQ(removeCount, 0u);
+        ASSERT_EQ(getAclRuleSaiAttribute(*rule, SAI_ACL_ENTRY_ATTR_FIELD_DST_IP), "disabled");
+        ASSERT_EQ(getAclRuleSaiAttribute(*rule, SAI_ACL_ENTRY_ATTR_ACTION_PACKET_ACTION), "SAI_PACKET_ACTION_DROP");
+
+        // Applying the same configuration again does not touch the entry
+        setAttrIds.clear();
+        orch->doAclRuleTask({ { acl_rule_key,
+                                SET_COMMAND,
+                                { { RULE_PRIORITY, "900" },
+                                  { MATCH_SRC_IP, "2.2.2.2/24" },
+                                  { ACTION_PACKET_ACTION, PACKET_ACTION_DROP } } } });
+
+        ASSERT_TRUE(setAttrIds.empty());
+        ASSERT_EQ(createCount, 0u);
+        ASSERT_EQ(removeCount, 0u);
+
+        aclApiRestorer.restore();
+
+        orch->doAclRuleTask({ { acl_rule_key, DEL_COMMAND, {} } });
+        ASSERT_EQ(orch->getAclRule(acl_table_id, acl_rule_id), nullptr);
+    }
+
     TEST_F(AclOrchTest, deleteNonExistingRule)
     {
         string tableId = "acl_table";
@@ -10,7 +10,9 @@
 #define private public
 #include "buffermgrdyn.h"
 #undef private
+#include "buffercalculator.h"
 #include "warm_restart.h"
+#include "tokenize.h"
 
 extern string gMySwitchType;
 
@@ -1471,4 +1473,351 @@ namespace buffermgrdyn_test
         HandleTable(cableLengthTable);
         ASSERT_EQ(m_dynamicBuffer->m_portInfoLookup["Ethernet12"].state, PORT_READY);
     }
+
+    /*
+     * Verify the shared buffer pool size updates requested while handling a batch of table updates
+     * are coalesced into one calculation at the end of the batch
+     */
+    TEST_F(BufferMgrDynTest, BufferMgrTestCoalescePoolUpdates)
+    {
+        InitDefaultLosslessParameter();
+        InitMmuSize();
+
+        StartBufferManager();
+
+        InitPort("Ethernet0");
+        InitPort("Ethernet2");
+        InitPort("Ethernet4");
+        SetPortInitDone();
+        m_dynamicBuffer->doTask(m_selectableTable);
+
+        InitBufferPool();
+        InitDefaultBufferProfile();
+
+        cableLengthTable.set("AZURE",
+                             {
+                                 {"Ethernet0", "5m"},
+                                 {"Ethernet2", "5m"},
+                                 {"Ethernet4", "5m"}
+                             });
+        HandleTable(cableLengthTable);
+        ASSERT_EQ(m_dynamicBuffer->m_portInfoLookup["Ethernet4"].state, PORT_READY);
+        ASSERT_FALSE(m_dynamicBuffer->m_sharedBufferPoolUpdatePending);
+
+        auto recalculations = m_dynamicBuffer->m_sharedBufferPoolRecalculations;
+        auto coalesced = m_dynamicBuffer->m_sharedBufferPoolUpdatesCoalesced;
+
+        // Lossless PGs on 3 ports in a batch
+        bufferPgTable.set("Ethernet0|3-4", {{"profile", "NULL"}});
+        bufferPgTable.set("Ethernet2|3-4", {{"profile", "NULL"}});
+        bufferPgTable.set("Ethernet4|3-4", {{"profile", "NULL"}});
+        HandleTable(bufferPgTable);
+        CheckPg("Ethernet0", "Ethernet0:3-4", "pg_lossless_100000_5m_profile");
+        CheckPg("Ethernet4", "Ethernet4:3-4", "pg_lossless_100000_5m_profile");
+
+        ASSERT_FALSE(m_dynamicBuffer->m_sharedBufferPoolUpdatePending);
+        ASSERT_EQ(m_dynamicBuffer->m_sharedBufferPoolRecalculations, recalculations + 1);
+        ASSERT_EQ(m_dynamicBuffer->m_sharedBufferPoolUpdatesCoalesced, coalesced + 2);
+
+        // A request pending is served by the timer
+        m_dynamicBuffer->checkSharedBufferPoolSize(false);
+        ASSERT_TRUE(m_dynamicBuffer->m_sharedBufferPoolUpdatePending);
+        m_dynamicBuffer->doTask(m_selectableTable);
+        ASSERT_FALSE(m_dynamicBuffer->m_sharedBufferPoolUpdatePending);
+        ASSERT_EQ(m_dynamicBuffer->m_sharedBufferPoolRecalculations, recalculations + 2);
+
+        // Nothing to do without any request
+        m_dynamicBuffer->flushSharedBufferPoolUpdate();
+        ASSERT_EQ(m_dynamicBuffer->m_sharedBufferPoolRecalculations, recalculations + 2);
+    }
+
+    /*
+     * Native calculation model
+     * 1. Headroom calculated from the ASIC parameters and lossless traffic pattern
+     * 2. Shared buffer pool sizes updated incrementally as ports and buffer items change
+     * 3. Accumulative headroom checking
+     */
+    TEST_F(BufferMgrDynTest, BufferMgrTestNativeCalculator)
+    {
+        Table asicTable(m_state_db.get(), "ASIC_TABLE");
+        Table losslessTrafficPatternTable(m_config_db.get(), "LOSSLESS_TRAFFIC_PATTERN");
+
+        ASSERT_TRUE(BufferCalculator::create("mock_test", m_config_db.get(), m_state_db.get()) == nullptr);
+        auto calculator = BufferCalculator::create("mellanox", m_config_db.get(), m_state_db.get());
+        ASSERT_TRUE(calculator != nullptr);
+
+        buffer_profile_t headroom;
+        headroom.speed = "100000";
+        headroom.cable_length = "5m";
+        headroom.port_mtu = "9100";
+        headroom.lane_count = 4;
+
+        // Parameters are not available, the lua plugin should be taken
+        ASSERT_TRUE(calculator->calculateHeadroom(headroom, "", false).empty());
+
+        asicTable.set("MELLANOX-SPECTRUM-3",
+                      {
+                          {"cell_size", "144"},
+                          {"pipeline_latency", "19"},
+                          {"mac_phy_delay", "0.8"},
+                          {"peer_response_time", "3.8"}
+                      });
+        losslessTrafficPatternTable.set("AZURE",
+                                        {
+                                            {"mtu", "1024"},
+                                            {"small_packet_percentage", "100"}
+                                        });
+
+        vector<string> expected = {"xon:19456", "xoff:81920", "size:101376"};
+        ASSERT_EQ(calculator->calculateHeadroom(headroom, "", false), expected);
+        expected = {"xon:19456", "xoff:81920", "size:19456"};
+        ASSERT_EQ(calculator->calculateHeadroom(headroom, "", true), expected);
+
+        buffer_pool_lookup_t pools;
+        pools["ingress_lossless_pool"].direction = BUFFER_INGRESS;
+        pools["ingress_lossless_pool"].dynamic_size = true;
+        pools["egress_lossy_pool"].direction = BUFFER_EGRESS;
+        pools["egress_lossy_pool"].dynamic_size = true;
+        pools["egress_lossless_pool"].direction = BUFFER_EGRESS;
+        pools["egress_lossless_pool"].dynamic_size = false;
+        pools["egress_lossless_pool"].configured_size = "10240000";
+
+        calculator->setProfile("pg_lossless_100000_5m_profile",
+                               {
+                                   {"xon", "19456"},
+                                   {"xoff", "81920"},
+                                   {"size", "101376"},
+                                   {"pool", "ingress_lossless_pool"},
+                                   {"dynamic_th", "0"}
+                               });
+        calculator->setProfile("ingress_lossy_profile",
+                               {
+                                   {"size", "0"},
+                                   {"pool", "ingress_lossless_pool"},
+                                   {"dynamic_th", "3"}
+                               });
+        calculator->setPort("Ethernet0", 4, true);
+        calculator->setObject(BUFFER_PG, "Ethernet0:3-4", "pg_lossless_100000_5m_profile");
+        calculator->setObject(BUFFER_PG, "Ethernet0:0", "ingress_lossy_profile");
+
+        auto getPoolSize = [&](const string &pool) {
+            auto ret = calculator->calculateSharedBufferPool(pools, 10240000, "", "");
+            for (auto &item : ret)
+            {
+                auto tokens = tokenize(item, ':');
+                if (tokens[0] == pool)
+                    return tokens[1];
+            }
+            return string();
+        };
+
+        // mmu - mgmt pool - lossless PGs - lossy PG - mgmt PG and egress mirror
+        ASSERT_EQ(getPoolSize("ingress_lossless_pool"), to_string(10240000 - 262144 - 2 * 101376 - 19456 - (19456 + 10240)));
+        ASSERT_EQ(getPoolSize("egress_lossy_pool"), to_string(10240000 - 262144 - 2 * 101376 - 19456 - (19456 + 10240)));
+        ASSERT_EQ(getPoolSize("egress_lossless_pool"), "");
+
+        // Only the delta of the updated port is applied
+        calculator->setPort("Ethernet4", 4, true);
+        calculator->setObject(BUFFER_PG, "Ethernet4:3-4", "pg_lossless_100000_5m_profile");
+        ASSERT_EQ(getPoolSize("ingress_lossless_pool"), "9493504");
+        calculator->setPort("Ethernet4", 4, false);
+        ASSERT_EQ(getPoolSize("ingress_lossless_pool"), "9523200");
+
+        // A referenced profile is not ready
+        calculator->setObject(BUFFER_QUEUE, "Ethernet4:0-2", "egress_lossy_profile");
+        ASSERT_TRUE(calculator->calculateSharedBufferPool(pools, 10240000, "", "").empty());
+        calculator->setProfile("egress_lossy_profile",
+                               {
+                                   {"size", "1024"},
+                                   {"pool", "egress_lossy_pool"},
+                                   {"dynamic_th", "3"}
+                               });
+        ASSERT_EQ(getPoolSize("ingress_lossless_pool"), to_string(9523200 - 3 * 1024));
+
+        calculator->removeObject(BUFFER_QUEUE, "Ethernet4:0-2");
+        calculator->removeObject(BUFFER_PG, "Ethernet4:3-4");
+        calculator->removePort("Ethernet4");
+        ASSERT_EQ(getPoolSize("ingress_lossless_pool"), "9725952");
+
+        // Headroom checking: overhead + lossless PGs + lossy PG
+        ASSERT_EQ(calculator->checkHeadroom("Ethernet0", "", "pg_lossless_100000_5m_profile", "101376", "")[0], "result:true");
+        ASSERT_EQ(calculator->checkHeadroom("Ethernet0", "300000", "pg_lossless_100000_5m_profile", "101376", "")[0], "result:true");
+        ASSERT_EQ(calculator->checkHeadroom("Ethernet0", "266240", "pg_lossless_100000_5m_profile", "101376", "")[0], "result:false");
+        ASSERT_EQ(calculator->checkHeadroom("Ethernet0", "300000", "pg_lossless_100000_5m_profile", "101376", "Ethernet0:6")[0], "result:false");
+
+        // The ASIC parameters are read on each calculation, the cached usage follows them:
+        // the lossy PG and the management PG take the new pipeline latency
+        asicTable.set("MELLANOX-SPECTRUM-3", {{"pipeline_latency", "22"}});
+        ASSERT_EQ(getPoolSize("ingress_lossless_pool"), to_string(9725952 - 2 * (22528 - 19456)));
+    }
+
+    /*
+     * Native calculation model driven by the buffer manager
+     * The headroom is the one buffer_headroom_mellanox.lua calculates with the same parameters,
+     * including after the lossless traffic pattern and the ASIC parameters change at runtime
+     */
+    TEST_F(BufferMgrDynTest, BufferMgrTestNativeCalculatorMatchesLua)
+    {
+        vector<FieldValueTuple> fieldValues;
+        Table asicTable(m_state_db.get(), "ASIC_TABLE");
+        Table losslessTrafficPatternTable(m_config_db.get(), "LOSSLESS_TRAFFIC_PATTERN");
+
+        // The virtual switch takes the Mellanox model
+        setenv("ASIC_VENDOR", "vs", 1);
+
+        asicTable.set("MELLANOX-SPECTRUM-3",
+                      {
+                          {"cell_size", "144"},
+                          {"pipeline_latency", "19"},
+                          {"mac_phy_delay", "0.8"},
+                          {"peer_response_time", "3.8"}
+                      });
+        losslessTrafficPatternTable.set("AZURE",
+                                        {
+                                            {"mtu", "1024"},
+                                            {"small_packet_percentage", "100"}
+                                        });
+
+        InitDefaultLosslessParameter();
+        InitMmuSize();
+
+        StartBufferManager();
+        ASSERT_TRUE(m_dynamicBuffer->m_bufferCalculator != nullptr);
+
+        InitPort();
+        SetPortInitDone();
+        m_dynamicBuffer->doTask(m_selectableTable);
+
+        InitBufferPool();
+        InitDefaultBufferProfile();
+        InitCableLength("Ethernet0", "5m");
+        InitBufferPg("Ethernet0|3-4");
+
+        CheckPg("Ethernet0", "Ethernet0:3-4", "pg_lossless_100000_5m_profile");
+        ASSERT_TRUE(appBufferProfileTable.get("pg_lossless_100000_5m_profile", fieldValues));
+        CheckIfVectorsMatch(fieldValues,
+                            {
+                                {"xon", "19456"},
+                                {"xoff", "81920"},
+                                {"size", "101376"},
+                                {"pool", "ingress_lossless_pool"},
+                                {"dynamic_th", "0"}
+                            });
+
+        // Lossless traffic pattern changed
+        losslessTrafficPatternTable.set("AZURE",
+                                        {
+                                            {"mtu", "1500"},
+                                            {"small_packet_percentage", "50"}
+                                        });
+        InitCableLength("Ethernet0", "40m");
+
+        CheckPg("Ethernet0", "Ethernet0:3-4", "pg_lossless_100000_40m_profile");
+        fieldValues.clear();
+        ASSERT_TRUE(appBufferProfileTable.get("pg_lossless_100000_40m_profile", fieldValues));
+        CheckIfVectorsMatch(fieldValues,
+                            {
+                                {"xon", "19456"},
+                                {"xoff", "67584"},
+                                {"size", "87040"},
+                                {"pool", "ingress_lossless_pool"},
+                                {"dynamic_th", "0"}
+                            });
+
+        // ASIC parameters changed
+        asicTable.set("MELLANOX-SPECTRUM-3", {{"pipeline_latency", "22"}});
+        InitCableLength("Ethernet0", "10m");
+
+        CheckPg("Ethernet0", "Ethernet0:3-4", "pg_lossless_100000_10m_profile");
+        fieldValues.clear();
+        ASSERT_TRUE(appBufferProfileTable.get("pg_lossless_100000_10m_profile", fieldValues));
+        CheckIfVectorsMatch(fieldValues,
+                            {
+                                {"xon", "22528"},
+                                {"xoff", "61440"},
+                                {"size", "83968"},
+                                {"pool", "ingress_lossless_pool"},
+                                {"dynamic_th", "0"}
+                            });
+    }
+
+    /*
+     * Removing a lossy PG or a queue from a port which is admin up
+     * The native model stops accounting them so that the shared buffer pools grow back
+     */
+    TEST_F(BufferMgrDynTest, BufferMgrTestNativeCalculatorRemoveLossyObjects)
+    {
+        vector<FieldValueTuple> fieldValues;
+        Table asicTable(m_state_db.get(), "ASIC_TABLE");
+        Table losslessTrafficPatternTable(m_config_db.get(), "LOSSLESS_TRAFFIC_PATTERN");
+
+        setenv("ASIC_VENDOR", "vs", 1);
+
+        asicTable.set("MELLANOX-SPECTRUM-3",
+                      {
+                          {"cell_size", "144"},
+                          {"pipeline_latency", "19"},
+                          {"mac_phy_delay", "0.8"},
+                          {"peer_response_time", "3.8"}
+                      });
+        losslessTrafficPatternTable.set("AZURE",
+                                        {
+                                            {"mtu", "1024"},
+                                            {"small_packet_percentage", "100"}
+                                        });
+
+        InitDefaultLosslessParameter();
+        InitMmuSize();
+
+        StartBufferManager();
+        ASSERT_TRUE(m_dynamicBuffer->m_bufferCalculator != nullptr);
+
+        InitPort();
+        SetPortInitDone();
+        m_dynamicBuffer->doTask(m_selectableTable);
+
+        InitBufferPool();
+        InitDefaultBufferProfile();
+        bufferProfileTable.set("test_queue_profile",
+                               {
+                                   {"dynamic_th", "3"},
+                                   {"pool", "egress_lossy_pool"},
+                                   {"size", "1024"}
+                               });
+        HandleTable(bufferProfileTable);
+        InitCableLength("Ethernet0", "5m");
+        ASSERT_EQ(m_dynamicBuffer->m_portInfoLookup["Ethernet0"].state, PORT_READY);
+
+        auto &ingressPool = m_dynamicBuffer->m_bufferPoolLookup["ingress_lossless_pool"];
+        m_dynamicBuffer->doTask(m_selectableTable);
+        auto originalSize = ingressPool.total_size;
+        ASSERT_FALSE(originalSize.empty());
+
+        // Lossy PG with the reserved buffer of the pipeline latency and 3 queues
+        InitBufferPg("Ethernet0|0", "ingress_lossy_profile");
+        InitBufferQueue("Ethernet0|0-2", "test_queue_profile");
+        m_dynamicBuffer->doTask(m_selectableTable);
+        ASSERT_EQ(ingressPool.total_size, to_string(stoul(originalSize) - 19456 - 3 * 1024));
+
+        ClearBufferObject("Ethernet0|0", CFG_BUFFER_PG_TABLE_NAME);
+        ASSERT_FALSE(appBufferPgTable.get("Ethernet0:0", fieldValues));
+        m_dynamicBuffer->doTask(m_selectableTable);
+        ASSERT_EQ(ingressPool.total_size, to_string(stoul(originalSize) - 3 * 1024));
+
+        ClearBufferObject("Ethernet0|0-2", CFG_BUFFER_QUEUE_TABLE_NAME);
+        ASSERT_FALSE(appBufferQueueTable.get("Ethernet0:0-2", fieldValues));
+        m_dynamicBuffer->doTask(m_selectableTable);
+        ASSERT_EQ(ingressPool.total_size, originalSize);
+
+        // The sizes are kept while orchagent hasn't taken all the buffer items
+        Table pgKeySet(m_app_db.get(), APP_BUFFER_PG_TABLE_NAME "_KEY_SET");
+        pgKeySet.set("Ethernet0:0", {{"NULL", "NULL"}});
+        InitBufferPg("Ethernet0|0", "ingress_lossy_profile");
+        m_dynamicBuffer->doTask(m_selectableTable);
+        ASSERT_EQ(ingressPool.total_size, originalSize);
+
+        pgKeySet.del("Ethernet0:0");
+        m_dynamicBuffer->doTask(m_selectableTable);
+        ASSERT_EQ(ingressPool.total_size, to_string(stoul(originalSize) - 19456));
+    }
 }
@@ -1,3 +1,4 @@
+#include <chrono>
 #define private public // make Directory::m_values available to clean it.
 #include "directory.h"
 #undef private
@@ -8,6 +9,7 @@
 #include "mock_orchagent_main.h"
 #include "mock_table.h"
 #include "mock_response_publisher.h"
+#include "mock_sai_bulk.h"
 
 extern string gMySwitchType;
 
@@ -726,6 +728,164 @@ namespace bufferorch_test
         _unhook_sai_apis();
     }
 
+    /*
+     * Queue and PG profiles of a batch are applied together when the batch
+     * is flushed, and an object updated twice in a batch ends up with the last profile
+     */
+    TEST_F(BufferOrchTest, BufferOrchTestBulkQueueAndPg)
+    {
+        vector<string> ts;
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        Table bufferPoolTable = Table(m_app_db.get(), APP_BUFFER_POOL_TABLE_NAME);
+        Table bufferProfileTable = Table(m_app_db.get(), APP_BUFFER_PROFILE_TABLE_NAME);
+
+        bufferPoolTable.set("egress_lossless_pool",
+                            {
+                                {"size", "1024000"},
+                                {"mode", "dynamic"},
+                                {"type", "egress"}
+                            });
+        bufferPoolTable.set("ingress_lossless_pool",
+                            {
+                                {"size", "1024000"},
+                                {"mode", "dynamic"},
+                                {"type", "ingress"}
+                            });
+        bufferProfileTable.set("egress_lossless_profile",
+                               {
+                                   {"pool", "egress_lossless_pool"},
+                                   {"size", "0"},
+                                   {"dynamic_th", "0"}
+                               });
+        bufferProfileTable.set("egress_lossy_profile",
+                               {
+                                   {"pool", "egress_lossless_pool"},
+                                   {"size", "0"},
+                                   {"dynamic_th", "1"}
+                               });
+        bufferProfileTable.set("ingress_lossless_profile",
+                               {
+                                   {"pool", "ingress_lossless_pool"},
+                                   {"size", "0"},
+                                   {"dynamic_th", "0"}
+                               });
+
+        gBufferOrch->addExistingData(&bufferPoolTable);
+        gBufferOrch->addExistingData(&bufferProfileTable);
+        static_cast<Orch *>(gBufferOrch)->doTask();
+
+        auto &profiles = (*BufferOrch::m_buffer_type_maps[APP_BUFFER_PROFILE_TABLE_NAME]);
+        auto lossless_profile = profiles["egress_lossless_profile"].m_saiObjectId;
+        auto lossy_profile = profiles["egress_lossy_profile"].m_saiObjectId;
+        auto pg_profile = profiles["ingress_lossless_profile"].m_saiObjectId;
+        ASSERT_NE(lossless_profile, SAI_NULL_OBJECT_ID);
+        ASSERT_NE(lossy_profile, SAI_NULL_OBJECT_ID);
+
+        auto queueConsumer = dynamic_cast<Consumer *>(gBufferOrch->getExecutor(APP_BUFFER_QUEUE_TABLE_NAME));
+        auto pgConsumer = dynamic_cast<Consumer *>(gBufferOrch->getExecutor(APP_BUFFER_PG_TABLE_NAME));
+
+        entries.push_back({"Ethernet0,Ethernet4:0-2", "SET", {{"profile", "egress_lossless_profile"}}});
+        entries.push_back({"Ethernet8:3", "SET", {{"profile", "egress_lossless_profile"}}});
+        queueConsumer->addToSync(entries);
+        entries.clear();
+        entries.push_back({"Ethernet0,Ethernet4:3-4", "SET", {{"profile", "ingress_lossless_profile"}}});
+        pgConsumer->addToSync(entries);
+        entries.clear();
+        _sai_bulk_object_set_attribute_count = 0;
+        static_cast<Orch *>(gBufferOrch)->doTask();
+
+        // One call for the queues and one for the PGs
+        ASSERT_EQ(_sai_bulk_object_set_attribute_count, 2);
+
+        static_cast<Orch *>(gBufferOrch)->dumpPendingTasks(ts);
+        ASSERT_TRUE(ts.empty());
+
+        auto checkQueueProfile = [](const string &alias, size_t index, sai_object_id_t profile)
+        {
+            Port port;
+            ASSERT_TRUE(gPortsOrch->getPort(alias, port));
+            sai_attribute_t attr;
+            attr.id = SAI_QUEUE_ATTR_BUFFER_PROFILE_ID;
+            ASSERT_EQ(sai_queue_api->get_queue_attribute(port.m_queue_ids[index], 1, &attr), SAI_STATUS_SUCCESS);
+            ASSERT_EQ(attr.value.oid, profile);
+        };
+
+        for (const auto &alias : { "Ethernet0", "Ethernet4" })
+        {
+            Port port;
+            ASSERT_TRUE(gPortsOrch->getPort(alias, port));
+
+            for (size_t index = 0; index <= 2; index++)
+            {
+                checkQueueProfile(alias, index, lossless_profile);
+            }
+
+            for (size_t index = 3; index <= 4; index++)
+            {
+                sai_attribute_t attr;
+                attr.id = SAI_INGRESS_PRIORITY_GROUP_ATTR_BUFFER_PROFILE;
+                ASSERT_EQ(sai_buffer_api->get_ingress_priority_group_attribute(port.m_priority_group_ids[index], 1, &attr), SAI_STATUS_SUCCESS);
+                ASSERT_EQ(attr.value.oid, pg_profile);
+            }
+        }
+        checkQueueProfile("Ethernet8", 3, lossless_profile);
+
+        // DEL followed by SET of the same queues in one batch, the DEL is set first
+        entries.push_back({"Ethernet0,Ethernet4:0-2", "DEL", {}});
+        entries.push_back({"Ethernet0,Ethernet4:0-2", "SET", {{"profile", "egress_lossy_profile"}}});
+        queueConsumer->addToSync(entries);
+        entries.clear();
+        _sai_bulk_object_set_attribute_count = 0;
+        static_cast<Orch *>(gBufferOrch)->doTask();
+        ASSERT_EQ(_sai_bulk_object_set_attribute_count, 2);
+
+        static_cast<Orch *>(gBufferOrch)->dumpPendingTasks(ts);
+        ASSERT_TRUE(ts.empty());
+
+        for (const auto &alias : { "Ethernet0", "Ethernet4" })
+        {
+            for (size_t index = 0; index <= 2; index++)
+            {
+                checkQueueProfile(alias, index, lossy_profile);
+            }
+        }
+        CheckDependency(APP_BUFFER_QUEUE_TABLE_NAME, "Ethernet0,Ethernet4:0-2", "profile",
+                        APP_BUFFER_PROFILE_TABLE_NAME, "egress_lossy_profile");
+
+        // Bulk set is not supported, the profiles are set one by one from now on
+        _sai_bulk_object_set_attribute_status = SAI_STATUS_NOT_IMPLEMENTED;
+        _sai_bulk_object_set_attribute_count = 0;
+        entries.push_back({"Ethernet0,Ethernet4:0-2", "SET", {{"profile", "egress_lossless_profile"}}});
+        queueConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gBufferOrch)->doTask();
+        ASSERT_EQ(_sai_bulk_object_set_attribute_count, 1);
+        ASSERT_FALSE(gBufferOrch->m_isBulkSetSupported);
+
+        entries.push_back({"Ethernet8:0-2", "SET", {{"profile", "egress_lossy_profile"}}});
+        queueConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gBufferOrch)->doTask();
+        ASSERT_EQ(_sai_bulk_object_set_attribute_count, 1);
+
+        _sai_bulk_object_set_attribute_status = SAI_STATUS_SUCCESS;
+        gBufferOrch->m_isBulkSetSupported = true;
+
+        static_cast<Orch *>(gBufferOrch)->dumpPendingTasks(ts);
+        ASSERT_TRUE(ts.empty());
+        for (const auto &alias : { "Ethernet0", "Ethernet4" })
+        {
+            for (size_t index = 0; index <= 2; index++)
+            {
+                checkQueueProfile(alias, index, lossless_profile);
+            }
+        }
+        for (size_t index = 0; index <= 2; index++)
+        {
+            checkQueueProfile("Ethernet8", index, lossy_profile);
+        }
+    }
+
     TEST_F(BufferOrchTest, BufferOrchTestSetBufferProfile)
     {
         _hook_sai_apis();
@@ -795,4 +955,168 @@ namespace bufferorch_test
         _ut_stub_buffer_profile_sanity_check = false;
         _unhook_sai_apis();
     }
+
+    /*
+     * Reference tracking of queues moved between a few buffer profiles and removed.
+     * The handles of the queue names are freed once nothing refers to them.
+     */
+    TEST_F(BufferOrchTest, BufferOrchTestReferenceTracking)
+    {
+        const size_t portCount = 64;
+        const size_t queuesPerPort = 8;
+        const size_t profileCount = 4;
+        const string field = "profile";
+
+        type_map maps = {
+            {APP_BUFFER_PROFILE_TABLE_NAME, make_shared<object_reference_map>()},
+            {APP_BUFFER_QUEUE_TABLE_NAME, make_shared<object_reference_map>()}
+        };
+        for (size_t i = 0; i < profileCount; i++)
+        {
+            auto &profile = (*maps[APP_BUFFER_PROFILE_TABLE_NAME])["profile" + to_string(i)];
+            profile.m_saiObjectId = i + 1;
+            profile.m_pendingRemove = false;
+        }
+
+        vector<string> queues;
+        for (size_t p = 0; p < portCount; p++)
+        {
+            for (size_t q = 0; q < queuesPerPort; q++)
+            {
+                queues.push_back("RefTracking" + to_string(p) + ":" + to_string(q));
+            }
+        }
+        auto referenceOf = [&](size_t i, size_t shift) {
+            return string(APP_BUFFER_PROFILE_TABLE_NAME) + ":profile" + to_string((i + shift) % profileCount);
+        };
+
+        for (size_t i = 0; i < queues.size(); i++)
+        {
+            gBufferOrch->setObjectReference(maps, APP_BUFFER_QUEUE_TABLE_NAME, queues[i], field, referenceOf(i, 0));
+        }
+
+        // Every queue is moved to another profile
+        for (size_t i = 0; i < queues.size(); i++)
+        {
+            gBufferOrch->setObjectReference(maps, APP_BUFFER_QUEUE_TABLE_NAME, queues[i], field, referenceOf(i, 1));
+        }
+
+        for (size_t i = 0; i < profileCount; i++)
+        {
+            auto name = "profile" + to_string(i);
+            ASSERT_TRUE(gBufferOrch->isObjectBeingReferenced(maps, APP_BUFFER_PROFILE_TABLE_NAME, name));
+            ASSERT_EQ((*maps[APP_BUFFER_PROFILE_TABLE_NAME])[name].m_objsDependingOnMe.size(), queues.size() / profileCount);
+        }
+        ASSERT_EQ((*maps[APP_BUFFER_PROFILE_TABLE_NAME])["profile1"].m_objsDependingOnMe.count(queues[0]), 1);
+        ASSERT_EQ((*maps[APP_BUFFER_PROFILE_TABLE_NAME])["profile0"].m_objsDependingOnMe.count(queues[0]), 0);
+
+        string referenced;
+        ASSERT_TRUE(gBufferOrch->doesObjectExist(maps, APP_BUFFER_QUEUE_TABLE_NAME, queues[5], field, referenced));
+        ASSERT_EQ(referenced, referenceOf(5, 1));
+
+        // A copy of the dependents holds the handles as well
+        auto dependents = (*maps[APP_BUFFER_PROFILE_TABLE_NAME])["profile1"].m_objsDependingOnMe;
+
+        for (auto &queue : queues)
+        {
+            gBufferOrch->removeObject(maps, APP_BUFFER_QUEUE_TABLE_NAME, queue);
+        }
+
+        ASSERT_TRUE(maps[APP_BUFFER_QUEUE_TABLE_NAME]->empty());
+        for (size_t i = 0; i < profileCount; i++)
+        {
+            ASSERT_FALSE(gBufferOrch->isObjectBeingReferenced(maps, APP_BUFFER_PROFILE_TABLE_NAME, "profile" + to_string(i)));
+        }
+        ASSERT_EQ(gBufferOrch->objectReferenceInfo(maps, APP_BUFFER_PROFILE_TABLE_NAME, "profile0"), "reference count: 0");
+
+        object_handle_t handle;
+        ASSERT_EQ(dependents.count(queues[0]), 1);
+        ASSERT_TRUE(ObjectNames::find(queues[0], handle));
+        ASSERT_FALSE(ObjectNames::find(queues[1], handle));
+
+        dependents.clear();
+        ASSERT_FALSE(ObjectNames::find(queues[0], handle));
+
+        // The name interface takes and drops the handle as well
+        object_dependents byName;
+        ASSERT_TRUE(byName.insert(queues[0]));
+        ASSERT_EQ(byName.count(queues[0]), 1);
+        ASSERT_EQ(*byName.begin(), queues[0]);
+        ASSERT_EQ(byName.erase(queues[0]), 1);
+        ASSERT_FALSE(ObjectNames::find(queues[0], handle));
+    }
+
+    /*
+     * Microbenchmark of the reference tracking on a configuration of 64K queues,
+     * each of which references one of a few buffer profiles.
+     * Run with --gtest_also_run_disabled_tests, the timings are recorded as test properties.
+     */
+    TEST_F(BufferOrchTest, DISABLED_BufferOrchTestReferenceTrackingScale)
+    {
+        const size_t portCount = 8192;
+        const size_t queuesPerPort = 8;
+        const size_t profileCount = 4;
+        const string field = "profile";
+
+        type_map maps = {
+            {APP_BUFFER_PROFILE_TABLE_NAME, make_shared<object_reference_map>()},
+            {APP_BUFFER_QUEUE_TABLE_NAME, make_shared<object_reference_map>()}
+        };
+        for (size_t i = 0; i < profileCount; i++)
+        {
+            auto &profile = (*maps[APP_BUFFER_PROFILE_TABLE_NAME])["profile" + to_string(i)];
+            profile.m_saiObjectId = i + 1;
+            profile.m_pendingRemove = false;
+        }
+
+        vector<string> queues;
+        for (size_t p = 0; p < portCount; p++)
+        {
+            for (size_t q = 0; q < queuesPerPort; q++)
+            {
+                queues.push_back("RefTrackingScale" + to_string(p) + ":" + to_string(q));
+            }
+        }
+        auto referenceOf = [&](size_t i, size_t shift) {
+            return string(APP_BUFFER_PROFILE_TABLE_NAME) + ":profile" + to_string((i + shift) % profileCount);
+        };
+        auto elapsedUs = [](chrono::steady_clock::time_point start) {
+            return static_cast<int>(chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count());
+        };
+
+        auto start = chrono::steady_clock::now();
+        for (size_t i = 0; i < queues.size(); i++)
+        {
+            gBufferOrch->setObjectReference(maps, APP_BUFFER_QUEUE_TABLE_NAME, queues[i], field, referenceOf(i, 0));
+        }
+        RecordProperty("set_us", elapsedUs(start));
+
+        // Every queue is moved to another profile
+        start = chrono::steady_clock::now();
+        for (size_t i = 0; i < queues.size(); i++)
+        {
+            gBufferOrch->setObjectReference(maps, APP_BUFFER_QUEUE_TABLE_NAME, queues[i], field, referenceOf(i, 1));
+        }
+        RecordProperty("update_us", elapsedUs(start));
+
+        // Reference count check on each queue update, as done before removing a profile
+        size_t referencedCount = 0;
+        start = chrono::steady_clock::now();
+        for (size_t i = 0; i < queues.size(); i++)
+        {
+            referencedCount += gBufferOrch->isObjectBeingReferenced(maps, APP_BUFFER_PROFILE_TABLE_NAME, "profile" + to_string(i % profileCount));
+        }
+        RecordProperty("check_us", elapsedUs(start));
+        ASSERT_EQ(referencedCount, queues.size());
+
+        start = chrono::steady_clock::now();
+        for (auto &queue : queues)
+        {
+            gBufferOrch->removeObject(maps, APP_BUFFER_QUEUE_TABLE_NAME, queue);
+        }
+        RecordProperty("remove_us", elapsedUs(start));
+
+        ASSERT_TRUE(maps[APP_BUFFER_QUEUE_TABLE_NAME]->empty());
+        ASSERT_EQ(gBufferOrch->objectReferenceInfo(maps, APP_BUFFER_PROFILE_TABLE_NAME, "profile0"), "reference count: 0");
+    }
 }
@@ -3,6 +3,8 @@
 
 extern sai_route_api_t *sai_route_api;
 extern sai_neighbor_api_t *sai_neighbor_api;
+extern sai_nat_api_t *sai_nat_api;
+extern sai_acl_api_t *sai_acl_api;
 
 namespace bulker_test
 {
@@ -21,6 +23,9 @@ namespace bulker_test
 
             ASSERT_EQ(sai_neighbor_api, nullptr);
             sai_neighbor_api = new sai_neighbor_api_t();
+
+            ASSERT_EQ(sai_nat_api, nullptr);
+            sai_nat_api = new sai_nat_api_t();
         }
 
         void TearDown() override
@@ -30,6 +35,9 @@ namespace bulker_test
 
             delete sai_neighbor_api;
             sai_neighbor_api = nullptr;
+
+            delete sai_nat_api;
+            sai_nat_api = nullptr;
         }
     };
 
@@ -173,4 +181,168 @@ namespace bulker_test
         // Confirm neighbor entry is pending removal
         ASSERT_TRUE(gNeighBulker.bulk_entry_pending_removal(neighbor_entry_remove));
     }
+
+    TEST_F(BulkerTest, NatBulker)
+    {
+        // Create bulker
+        EntityBulker<sai_nat_api_t> gNatBulker(sai_nat_api, 1000);
+        deque<sai_status_t> object_statuses;
+
+        // Check max bulk size
+        ASSERT_EQ(gNatBulker.max_bulk_size, 1000);
+
+        // Create a dummy SNAPT entry
+        sai_nat_entry_t snat_entry = {};
+        snat_entry.nat_type = SAI_NAT_TYPE_SOURCE_NAT;
+        snat_entry.data.key.src_ip = 0x0a000001;
+        snat_entry.data.mask.src_ip = 0xffffffff;
+        snat_entry.data.key.l4_src_port = 1024;
+        snat_entry.data.mask.l4_src_port = 0xffff;
+        snat_entry.data.key.proto = IPPROTO_TCP;
+        snat_entry.data.mask.proto = 0xff;
+
+        sai_attribute_t attr;
+        attr.id = SAI_NAT_ENTRY_ATTR_SRC_IP;
+        attr.value.u32 = 0x41372d01;
+
+        // Put SNAPT entry into create
+        object_statuses.emplace_back();
+        gNatBulker.create_entry(&object_statuses.back(), &snat_entry, 1, &attr);
+        ASSERT_EQ(gNatBulker.creating_entries_count(snat_entry), 1);
+
+        // The same flow for another protocol is a different entry
+        sai_nat_entry_t udp_entry = snat_entry;
+        udp_entry.data.key.proto = IPPROTO_UDP;
+        ASSERT_EQ(gNatBulker.creating_entries_count(udp_entry), 0);
+
+        // Entries are matched by their fields, whatever is in the padding
+        sai_nat_entry_t padded_entry;
+        memset(&padded_entry, 0xff, sizeof(padded_entry));
+        padded_entry.switch_id = snat_entry.switch_id;
+        padded_entry.vr_id = snat_entry.vr_id;
+        padded_entry.nat_type = snat_entry.nat_type;
+        padded_entry.data.key.src_ip = snat_entry.data.key.src_ip;
+        padded_entry.data.key.dst_ip = snat_entry.data.key.dst_ip;
+        padded_entry.data.key.proto = snat_entry.data.key.proto;
+        padded_entry.data.key.l4_src_port = snat_entry.data.key.l4_src_port;
+        padded_entry.data.key.l4_dst_port = snat_entry.data.key.l4_dst_port;
+        padded_entry.data.mask.src_ip = snat_entry.data.mask.src_ip;
+        padded_entry.data.mask.dst_ip = snat_entry.data.mask.dst_ip;
+        padded_entry.data.mask.proto = snat_entry.data.mask.proto;
+        padded_entry.data.mask.l4_src_port = snat_entry.data.mask.l4_src_port;
+        padded_entry.data.mask.l4_dst_port = snat_entry.data.mask.l4_dst_port;
+        ASSERT_EQ(gNatBulker.creating_entries_count(padded_entry), 1);
+
+        // Removing a pending entry drops it from the bulk
+        object_statuses.emplace_back();
+        gNatBulker.remove_entry(&object_statuses.back(), &snat_entry);
+        ASSERT_EQ(gNatBulker.creating_entries_count(snat_entry), 0);
+        ASSERT_FALSE(gNatBulker.bulk_entry_pending_removal(snat_entry));
+        ASSERT_EQ(object_statuses.back(), SAI_STATUS_SUCCESS);
+    }
+
+    TEST_F(BulkerTest, AclEntryBulker)
+    {
+        sai_acl_api_t fake_sai_acl_api = {};
+
+        // Fail the entries with priority 2, create the rest
+        static sai_object_id_t next_oid;
+        next_oid = 0x1000;
+        fake_sai_acl_api.create_acl_entry = [](sai_object_id_t *oid, sai_object_id_t, uint32_t attr_count, const sai_attribute_t *attr_list) {
+            if (attr_count && attr_list[0].value.u32 == 2)
+            {
+                return (sai_status_t)SAI_STATUS_INSUFFICIENT_RESOURCES;
+            }
+            *oid = next_oid++;
+            return (sai_status_t)SAI_STATUS_SUCCESS;
+        };
+
+        auto bulk_create_not_supported = [](sai_object_id_t, sai_object_type_t, uint32_t, const uint32_t *,
+                                            const sai_attribute_t **, sai_bulk_op_error_mode_t, sai_object_id_t *, sai_status_t *) {
+            return (sai_status_t)SAI_STATUS_NOT_SUPPORTED;
+        };
+        auto bulk_create_supported = [](sai_object_id_t, sai_object_type_t, uint32_t object_count, const uint32_t *,
+                                        const sai_attribute_t **, sai_bulk_op_error_mode_t, sai_object_id_t *object_id, sai_status_t *object_statuses) {
+            for (uint32_t i = 0; i < object_count; i++)
+            {
+                object_id[i] = 0x2000 + i;
+                object_statuses[i] = SAI_STATUS_SUCCESS;
+            }
+            return (sai_status_t)SAI_STATUS_SUCCESS;
+        };
+
+        vector<sai_attribute_t> attrs(4);
+        vector<const sai_attribute_t *> attr_list;
+        vector<uint32_t> attr_count(attrs.size(), 1);
+        for (uint32_t i = 0; i < attrs.size(); i++)
+        {
+            attrs[i].id = SAI_ACL_ENTRY_ATTR_PRIORITY;
+            attrs[i].value.u32 = i + 1;
+            attr_list.push_back(&attrs[i]);
+        }
+
+        // Without bulk support the entries are created one by one
+        vector<sai_object_id_t> oids(attrs.size());
+        vector<sai_status_t> statuses(attrs.size());
+        auto status = sai_bulk_create_acl_objects(bulk_create_not_supported, SAI_OBJECT_TYPE_ACL_ENTRY,
+                                                  fake_sai_acl_api.create_acl_entry, 0x0, (uint32_t)attrs.size(),
+                                                  attr_count.data(), attr_list.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+                                                  oids.data(), statuses.data());
+        ASSERT_EQ(status, SAI_STATUS_FAILURE);
+
+        // A failed entry does not prevent the following ones from being created
+        ASSERT_EQ(oids[0], 0x1000);
+        ASSERT_EQ(oids[1], SAI_NULL_OBJECT_ID);
+        ASSERT_EQ(oids[2], 0x1001);
+        ASSERT_EQ(oids[3], 0x1002);
+        ASSERT_EQ(statuses[1], SAI_STATUS_INSUFFICIENT_RESOURCES);
+
+        // With bulk support the per-object calls are not used
+        status = sai_bulk_create_acl_objects(bulk_create_supported, SAI_OBJECT_TYPE_ACL_ENTRY,
+                                             fake_sai_acl_api.create_acl_entry, 0x0, (uint32_t)attrs.size(),
+                                             attr_count.data(), attr_list.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+                                             oids.data(), statuses.data());
+        ASSERT_EQ(status, SAI_STATUS_SUCCESS);
+        ASSERT_EQ(oids[1], 0x2001);
+        ASSERT_EQ(next_oid, 0x1003);
+    }
+
+    TEST_F(BulkerTest, ObjectBulkerCreateStatus)
+    {
+        sai_next_hop_group_api_t fake_sai_next_hop_group_api = {};
+
+        // Fail the second member, create the rest
+        fake_sai_next_hop_group_api.create_next_hop_group_members = [](sai_object_id_t, uint32_t object_count, const uint32_t *,
+                                                                       const sai_attribute_t **, sai_bulk_op_error_mode_t,
+                                                                       sai_object_id_t *object_id, sai_status_t *object_statuses) {
+            for (uint32_t i = 0; i < object_count; i++)
+            {
+                object_id[i] = 0x3000 + i;
+                object_statuses[i] = (i == 1) ? SAI_STATUS_TABLE_FULL : SAI_STATUS_SUCCESS;
+            }
+            return (sai_status_t)SAI_STATUS_FAILURE;
+        };
+
+        ObjectBulker<sai_next_hop_group_api_t> gNhgMemberBulker(&fake_sai_next_hop_group_api, 0x0, 1000);
+
+        sai_attribute_t attr;
+        attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_WEIGHT;
+        attr.value.u32 = 1;
+
+        vector<sai_object_id_t> oids(3);
+        vector<sai_status_t> statuses(2);
+        gNhgMemberBulker.create_entry(&oids[0], 1, &attr, &statuses[0]);
+        gNhgMemberBulker.create_entry(&oids[1], 1, &attr, &statuses[1]);
+        // The status is optional
+        gNhgMemberBulker.create_entry(&oids[2], 1, &attr);
+        ASSERT_EQ(statuses[0], SAI_STATUS_NOT_EXECUTED);
+
+        gNhgMemberBulker.flush();
+
+        ASSERT_EQ(statuses[0], SAI_STATUS_SUCCESS);
+        ASSERT_EQ(oids[0], 0x3000);
+        ASSERT_EQ(statuses[1], SAI_STATUS_TABLE_FULL);
+        ASSERT_EQ(oids[1], SAI_NULL_OBJECT_ID);
+        ASSERT_EQ(oids[2], 0x3002);
+    }
 }
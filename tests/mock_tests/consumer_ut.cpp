@@ -322,4 +322,79 @@ namespace consumer_test
         validate_syncmap(consumer->m_toSync, 1, key, exp_kofv);
 
     }
+
+    TEST_F(ConsumerTest, ConsumerRefillToSync_Prefetched)
+    {
+        Table table(m_config_db.get(), "CFG_TEST_TABLE");
+        table.set("table_key", { { f1, v1a } });
+
+        // Prefetched data is used once instead of the table content
+        deque<KeyOpFieldsValuesTuple> entries;
+        entries.push_back(KeyOpFieldsValuesTuple({ key, SET_COMMAND, { { f1, v1b } } }));
+        consumer->setPrefetchedData(std::move(entries));
+
+        ASSERT_EQ(consumer->refillToSync(), 1);
+        validate_syncmap(consumer->m_toSync, 1, key, KeyOpFieldsValuesTuple({ key, SET_COMMAND, { { f1, v1b } } }));
+
+        // Following refills read the table again
+        ASSERT_EQ(consumer->refillToSync(), 1);
+        validate_syncmap(consumer->m_toSync, 1, "table_key",
+                         KeyOpFieldsValuesTuple({ "table_key", SET_COMMAND, { { f1, v1a } } }));
+    }
+
+    TEST_F(ConsumerTest, ConsumerRefillToSync_Snapshot)
+    {
+        Table table(m_config_db.get(), "CFG_TEST_TABLE");
+        for (int i = 0; i < 5; i++)
+        {
+            table.set("key" + to_string(i), { { f1, "value" + to_string(i) }, { f2, v2a } });
+        }
+
+        // A pending SET of a key is merged with the table content
+        consumer->addToSync(KeyOpFieldsValuesTuple({ "key0", SET_COMMAND, { { f3, v3a } } }));
+
+        auto oldWindowSize = gSnapshotWindowSize;
+        gSnapshotWindowSize = 2;
+
+        ASSERT_EQ(consumer->refillToSync(), 5);
+
+        gSnapshotWindowSize = oldWindowSize;
+
+        // Read in windows of 2 keys
+        ASSERT_EQ(testing_db::getScanCount(), 3);
+        ASSERT_EQ(consumer->getSnapshotEntries(), 5);
+
+        ASSERT_EQ(consumer->m_toSync.size(), 5);
+        validate_syncmap(consumer->m_toSync, 5, "key0",
+                         KeyOpFieldsValuesTuple({ "key0", SET_COMMAND, { { f3, v3a }, { f1, "value0" }, { f2, v2a } } }));
+        validate_syncmap(consumer->m_toSync, 4, "key4",
+                         KeyOpFieldsValuesTuple({ "key4", SET_COMMAND, { { f1, "value4" }, { f2, v2a } } }));
+
+        // The whole table in one window
+        consumer->m_toSync.clear();
+        ASSERT_EQ(consumer->refillToSync(), 5);
+        ASSERT_EQ(testing_db::getScanCount(), 4);
+        ASSERT_EQ(consumer->getSnapshotEntries(), 10);
+        ASSERT_EQ(consumer->m_toSync.size(), 5);
+    }
+
+    TEST_F(ConsumerTest, ConsumerReadTableSnapshot_SkipsEmptyKeys)
+    {
+        Table table(m_config_db.get(), "CFG_TEST_TABLE");
+        table.set("key", { { f1, v1a } });
+        table.set("empty", {});
+        Table otherTable(m_config_db.get(), "CFG_TEST_TABLE_OTHER");
+        otherTable.set("key", { { f1, v1b } });
+
+        deque<KeyOpFieldsValuesTuple> entries;
+        auto count = ConsumerBase::readTableSnapshot(m_config_db.get(), "CFG_TEST_TABLE", "|",
+                                                     [&entries](KeyOpFieldsValuesTuple &&entry)
+                                                     {
+                                                         entries.push_back(std::move(entry));
+                                                     });
+
+        ASSERT_EQ(count, 1);
+        ASSERT_EQ(entries.size(), 1);
+        ASSERT_EQ(entries[0], KeyOpFieldsValuesTuple({ key, SET_COMMAND, { { f1, v1a } } }));
+    }
 }
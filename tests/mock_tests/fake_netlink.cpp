@@ -1,5 +1,14 @@
+#include <dlfcn.h>
+#include <errno.h>
+#include <net/if.h>
+#include <linux/rtnetlink.h>
+#include <netlink/msg.h>
+#include <netlink/attr.h>
+#include <deque>
+#include <map>
 #include <swss/linkcache.h>
 #include <swss/logger.h>
+#include "fake_netlink.h"
 
 static rtnl_link* g_fakeLink = [](){
     auto fakeLink = rtnl_link_alloc();
@@ -7,6 +16,84 @@ static rtnl_link* g_fakeLink = [](){
     return fakeLink;
 }();
 
+/* Override this pointer to fail selected kernel configuration requests */
+int (*fakeNetlinkCallback)(const FakeNetlinkRequest &req) = nullptr;
+std::vector<FakeNetlinkRequest> fakeNetlinkRequests;
+
+/* Links known to the fake kernel, created by the tests or by successful link requests */
+static std::map<std::string, unsigned int> g_fakeIfIndex;
+static unsigned int g_fakeNextIfIndex = 100;
+static std::deque<int> g_fakeAcks;
+static int g_fakeDumps = 0;
+
+void fakeNetlinkAddLink(const std::string &ifname)
+{
+    if (g_fakeIfIndex.find(ifname) == g_fakeIfIndex.end())
+    {
+        g_fakeIfIndex[ifname] = g_fakeNextIfIndex++;
+    }
+}
+
+void fakeNetlinkReset()
+{
+    fakeNetlinkRequests.clear();
+    fakeNetlinkCallback = nullptr;
+    g_fakeIfIndex.clear();
+}
+
+static std::string fakeIfName(int ifindex)
+{
+    for (const auto &it : g_fakeIfIndex)
+    {
+        if (it.second == static_cast<unsigned int>(ifindex))
+        {
+            return it.first;
+        }
+    }
+    return "";
+}
+
+/*
+ * Kernel configuration requests (link, bridge vlan and address changes) are
+ * recorded and acked locally; anything else, e.g. the link cache dumps used
+ * by fpmsyncd, still reaches the kernel.
+ */
+static bool decodeFakeRequest(struct nl_msg *msg, FakeNetlinkRequest &req)
+{
+    struct nlmsghdr *hdr = nlmsg_hdr(msg);
+
+    req.type = hdr->nlmsg_type;
+    req.flags = hdr->nlmsg_flags;
+    switch (hdr->nlmsg_type)
+    {
+        case RTM_NEWLINK:
+        case RTM_DELLINK:
+        case RTM_SETLINK:
+        case RTM_GETLINK:
+        {
+            auto ifi = static_cast<struct ifinfomsg *>(nlmsg_data(hdr));
+            req.family = ifi->ifi_family;
+            if (hdr->nlmsg_type == RTM_GETLINK && req.family != AF_BRIDGE)
+            {
+                return false;
+            }
+            struct nlattr *name = nlmsg_find_attr(hdr, sizeof(struct ifinfomsg), IFLA_IFNAME);
+            req.ifname = name ? nla_get_string(name) : fakeIfName(ifi->ifi_index);
+            return true;
+        }
+        case RTM_NEWADDR:
+        case RTM_DELADDR:
+        {
+            auto ifa = static_cast<struct ifaddrmsg *>(nlmsg_data(hdr));
+            req.family = ifa->ifa_family;
+            req.ifname = fakeIfName(static_cast<int>(ifa->ifa_index));
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
 extern "C"
 {
 
@@ -15,4 +102,72 @@ struct rtnl_link* rtnl_link_get_by_name(struct nl_cache *cache, const char *name
     return g_fakeLink;
 }
 
+unsigned int if_nametoindex(const char *ifname) __THROW
+{
+    auto it = g_fakeIfIndex.find(ifname);
+    if (it == g_fakeIfIndex.end())
+    {
+        errno = ENODEV;
+        return 0;
+    }
+    return it->second;
+}
+
+int nl_send_auto(struct nl_sock *sk, struct nl_msg *msg)
+{
+    FakeNetlinkRequest req;
+    if (!decodeFakeRequest(msg, req))
+    {
+        static auto real = reinterpret_cast<int (*)(struct nl_sock *, struct nl_msg *)>(dlsym(RTLD_NEXT, "nl_send_auto"));
+        return real(sk, msg);
+    }
+
+    fakeNetlinkRequests.push_back(req);
+    if (req.type == RTM_GETLINK)
+    {
+        g_fakeDumps++;
+    }
+    else
+    {
+        int ack = fakeNetlinkCallback ? fakeNetlinkCallback(req) : 0;
+        /* AF_BRIDGE link requests change the bridge vlans of the link, not the link */
+        if (ack == 0 && req.type == RTM_NEWLINK && (req.flags & NLM_F_CREATE))
+        {
+            fakeNetlinkAddLink(req.ifname);
+        }
+        else if (ack == 0 && req.type == RTM_DELLINK && req.family != AF_BRIDGE)
+        {
+            g_fakeIfIndex.erase(req.ifname);
+        }
+        g_fakeAcks.push_back(ack);
+    }
+    return static_cast<int>(nlmsg_hdr(msg)->nlmsg_len);
+}
+
+int nl_wait_for_ack(struct nl_sock *sk)
+{
+    if (g_fakeAcks.empty())
+    {
+        static auto real = reinterpret_cast<int (*)(struct nl_sock *)>(dlsym(RTLD_NEXT, "nl_wait_for_ack"));
+        return real(sk);
+    }
+
+    int err = g_fakeAcks.front();
+    g_fakeAcks.pop_front();
+    return err;
+}
+
+int nl_recvmsgs(struct nl_sock *sk, struct nl_cb *cb)
+{
+    if (!g_fakeDumps)
+    {
+        static auto real = reinterpret_cast<int (*)(struct nl_sock *, struct nl_cb *)>(dlsym(RTLD_NEXT, "nl_recvmsgs"));
+        return real(sk, cb);
+    }
+
+    /* Fake bridge dumps carry no vlan entries */
+    g_fakeDumps--;
+    return 0;
+}
+
 }
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+struct FakeNetlinkRequest
+{
+    uint16_t type;
+    uint16_t flags;
+    uint8_t family;
+    std::string ifname;
+};
+
+extern int (*fakeNetlinkCallback)(const FakeNetlinkRequest &req);
+extern std::vector<FakeNetlinkRequest> fakeNetlinkRequests;
+
+/* if_nametoindex() fails for links that are not added here or created through netlink */
+void fakeNetlinkAddLink(const std::string &ifname);
+/* Forgets the requests, the links and the callback */
+void fakeNetlinkReset();
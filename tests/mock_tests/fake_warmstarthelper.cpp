@@ -65,15 +65,9 @@ const std::string WarmStartHelper::printKFV(const std::string &key,
     return "";
 }
 
-bool WarmStartHelper::compareAllFV(const std::vector<FieldValueTuple> &left,
-                                   const std::vector<FieldValueTuple> &right)
+uint64_t WarmStartHelper::getFingerprint(const std::vector<FieldValueTuple> &fv)
 {
-    return false;
-}
-
-bool WarmStartHelper::compareOneFV(const std::string &v1, const std::string &v2)
-{
-    return false;
+    return 0;
 }
 
 }
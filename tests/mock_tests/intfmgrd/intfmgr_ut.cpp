@@ -5,6 +5,9 @@
 #include <sys/stat.h>
 #include "../mock_table.h"
 #include "warm_restart.h"
+#include "../fake_netlink.h"
+#include <netlink/errno.h>
+#include <linux/rtnetlink.h>
 #define private public
 #include "intfmgr.h"
 #undef private
@@ -17,18 +20,29 @@ bool Ethernet0IPv6Set = false;
 int cb(const std::string &cmd, std::string &stdout){
     mockCallArgs.push_back(cmd);
     if (cmd == "sysctl -w net.ipv6.conf.\"Ethernet0\".disable_ipv6=0") Ethernet0IPv6Set = true;
-    else if (cmd.find("/sbin/ip -6 address \"add\"") == 0) {
-        return Ethernet0IPv6Set ? 0 : 2;
-    }
-    else if (cmd == "/sbin/ip link set \"Ethernet64.10\" \"up\""){
-        return 1;
+    return 0;
+}
+
+int nl_cb(const FakeNetlinkRequest &req){
+    if (req.type == RTM_NEWADDR && req.family == AF_INET6) {
+        return Ethernet0IPv6Set ? 0 : -NLE_PERM;
     }
-    else {
-        return 0;
+    else if (req.type == RTM_NEWLINK && req.ifname == "Ethernet64.10"){
+        return -NLE_NODEV;
     }
     return 0;
 }
 
+int countNetlinkRequests(uint16_t type, uint8_t family, const std::string &ifname){
+    int count = 0;
+    for (auto &req : fakeNetlinkRequests){
+        if (req.type == type && req.family == family && req.ifname == ifname){
+            count++;
+        }
+    }
+    return count;
+}
+
 // Test Fixture
 namespace intfmgr_ut
 {
@@ -59,6 +73,9 @@ namespace intfmgr_ut
             cfg_intf_tables = tables;
             mockCallArgs.clear();
             callback = cb;
+            fakeNetlinkReset();
+            fakeNetlinkCallback = nl_cb;
+            fakeNetlinkAddLink("Ethernet0");
         }
     };
 
@@ -77,12 +94,7 @@ namespace intfmgr_ut
         const std::vector<std::string>& keys = {"Ethernet0", "2001::8/64"};
         const std::vector<swss::FieldValueTuple> data;
         intfmgr.doIntfAddrTask(keys, data, "SET");
-        int ip_cmd_called = 0;
-        for (auto cmd : mockCallArgs){
-            if (cmd.find("/sbin/ip -6 address \"add\"") == 0){
-                ip_cmd_called++;
-            }
-        }
+        int ip_cmd_called = countNetlinkRequests(RTM_NEWADDR, AF_INET6, "Ethernet0");
         ASSERT_EQ(ip_cmd_called, 2);
     }
 
@@ -101,15 +113,19 @@ namespace intfmgr_ut
         const std::vector<std::string>& keys = {"Ethernet0", "2001::8/64"};
         const std::vector<swss::FieldValueTuple> data;
         intfmgr.doIntfAddrTask(keys, data, "SET");
-        int ip_cmd_called = 0;
-        for (auto cmd : mockCallArgs){
-            if (cmd.find("/sbin/ip -6 address \"add\"") == 0){
-                ip_cmd_called++;
-            }
-        }
+        int ip_cmd_called = countNetlinkRequests(RTM_NEWADDR, AF_INET6, "Ethernet0");
         ASSERT_EQ(ip_cmd_called, 1);
     }
 
+    //This test expects no address request to be sent for an interface the kernel doesn't know
+    TEST_F(IntfMgrTest, testSettingIpOnUnknownIntf){
+        swss::IntfMgr intfmgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_intf_tables);
+        fakeNetlinkRequests.clear();
+        intfmgr.setIntfIp("Ethernet8", "add", swss::IpPrefix("10.0.0.1/31"));
+        ASSERT_EQ(countNetlinkRequests(RTM_NEWADDR, AF_INET, "Ethernet8"), 0);
+        ASSERT_TRUE(fakeNetlinkRequests.empty());
+    }
+
     //This test except no runtime error when the set admin status command failed
     //and the subinterface has not ok status (for example not existing subinterface)
     TEST_F(IntfMgrTest, testSetAdminStatusFailToNotOkSubInt){
@@ -127,4 +143,17 @@ namespace intfmgr_ut
         intfmgr.m_statePortTable.set("Ethernet64.10", values, "SET", "");
         EXPECT_THROW(intfmgr.setHostSubIntfAdminStatus("Ethernet64.10", "up", "up"), std::runtime_error);
     }
+
+    //This test expects the loopback device to be created and removed over netlink
+    //without forking /sbin/ip
+    TEST_F(IntfMgrTest, testLoopbackIntfNetlink){
+        swss::IntfMgr intfmgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_intf_tables);
+        mockCallArgs.clear();
+        fakeNetlinkRequests.clear();
+        intfmgr.addLoopbackIntf("Loopback1");
+        intfmgr.delLoopbackIntf("Loopback1");
+        ASSERT_EQ(countNetlinkRequests(RTM_NEWLINK, AF_UNSPEC, "Loopback1"), 1);
+        ASSERT_EQ(countNetlinkRequests(RTM_DELLINK, AF_UNSPEC, "Loopback1"), 1);
+        ASSERT_TRUE(mockCallArgs.empty());
+    }
 }
@@ -8,6 +8,7 @@
 #include <map>
 
 #include "dbconnector.h"
+#include "mock_table.h"
 
 namespace swss
 {
@@ -20,6 +21,7 @@ namespace swss
         conn->tcp.port = port;
         conn->fd = socket(AF_UNIX, SOCK_DGRAM, 0);
         setContext(conn);
+        testing_db::setConnectionDb(conn, m_dbId);
     }
 
     DBConnector::DBConnector(int dbId, const std::string &unixPath, unsigned int timeout) :
@@ -30,6 +32,7 @@ namespace swss
         conn->unix_sock.path = strdup(unixPath.c_str());
         conn->fd = socket(AF_UNIX, SOCK_DGRAM, 0);
         setContext(conn);
+        testing_db::setConnectionDb(conn, m_dbId);
     }
 
     DBConnector::DBConnector(const std::string& dbName, unsigned int timeout, bool isTcpConn)
@@ -46,6 +49,7 @@ namespace swss
             conn->tcp.port = swss::SonicDBConfig::getDbPort(dbName);
             conn->fd = socket(AF_UNIX, SOCK_DGRAM, 0);
             setContext(conn);
+            testing_db::setConnectionDb(conn, m_dbId);
         }
         else
         {
@@ -54,6 +58,7 @@ namespace swss
             conn->unix_sock.path = strdup(swss::SonicDBConfig::getDbSock(dbName).c_str());
             conn->fd = socket(AF_UNIX, SOCK_DGRAM, 0);
             setContext(conn);
+            testing_db::setConnectionDb(conn, m_dbId);
         }
     }
 
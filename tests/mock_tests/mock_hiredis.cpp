@@ -1,13 +1,47 @@
 #include <stdlib.h>
 #include <hiredis/hiredis.h>
 #include <iostream>
+#include <deque>
+#include <map>
+#include <mutex>
 
 // Add a global redisReply for user to mock
 redisReply *mockReply = nullptr;
 
+// Optional handler of the pipelined commands, returns the reply to queue or nullptr
+redisReply *(*mockAppendCommand)(redisContext *c, const char *format, va_list ap) = nullptr;
+
+// Replies of the pipelined commands of each connection, in order
+static std::map<redisContext *, std::deque<redisReply *>> mockPipelinedReplies;
+static std::mutex mockPipelinedRepliesMutex;
+
+static redisReply *popPipelinedReply(redisContext *c)
+{
+    std::lock_guard<std::mutex> lock(mockPipelinedRepliesMutex);
+
+    auto it = mockPipelinedReplies.find(c);
+    if (it == mockPipelinedReplies.end())
+    {
+        return nullptr;
+    }
+
+    redisReply *reply = it->second.front();
+    it->second.pop_front();
+    if (it->second.empty())
+    {
+        mockPipelinedReplies.erase(it);
+    }
+    return reply;
+}
+
 int redisGetReply(redisContext *c, void **reply)
 {
-    if (mockReply == nullptr)
+    redisReply *pipelined = popPipelinedReply(c);
+    if (pipelined != nullptr)
+    {
+        *reply = pipelined;
+    }
+    else if (mockReply == nullptr)
     {
         *reply = calloc(sizeof(redisReply), 1);
         ((redisReply *)*reply)->type = 3;
@@ -26,12 +60,25 @@ int redisAppendFormattedCommand(redisContext *c, const char *cmd, size_t len)
 
 int redisvAppendCommand(redisContext *c, const char *format, va_list ap)
 {
+    if (mockAppendCommand != nullptr)
+    {
+        redisReply *reply = mockAppendCommand(c, format, ap);
+        if (reply != nullptr)
+        {
+            std::lock_guard<std::mutex> lock(mockPipelinedRepliesMutex);
+            mockPipelinedReplies[c].push_back(reply);
+        }
+    }
     return 0;
 }
 
 int redisAppendCommand(redisContext *c, const char *format, ...)
 {
-    return 0;
+    va_list ap;
+    va_start(ap, format);
+    int ret = redisvAppendCommand(c, format, ap);
+    va_end(ap);
+    return ret;
 }
 
 int redisGetReplyFromReader(redisContext *c, void **reply)
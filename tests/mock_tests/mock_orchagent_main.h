@@ -90,3 +90,4 @@ extern sai_samplepacket_api_t *sai_samplepacket_api;
 extern sai_fdb_api_t* sai_fdb_api;
 extern sai_twamp_api_t* sai_twamp_api;
 extern sai_tam_api_t* sai_tam_api;
+extern sai_nat_api_t* sai_nat_api;
@@ -0,0 +1,55 @@
+#include <dlfcn.h>
+#include "mock_sai_bulk.h"
+
+extern sai_port_api_t *sai_port_api;
+extern sai_queue_api_t *sai_queue_api;
+extern sai_buffer_api_t *sai_buffer_api;
+extern sai_scheduler_group_api_t *sai_scheduler_group_api;
+
+uint32_t _sai_bulk_object_set_attribute_count = 0;
+sai_status_t _sai_bulk_object_set_attribute_status = SAI_STATUS_SUCCESS;
+
+sai_status_t sai_bulk_object_set_attribute(
+    sai_object_type_t object_type, uint32_t object_count, const sai_object_key_t *object_key,
+    const sai_attribute_t *attr_list, sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses)
+{
+    _sai_bulk_object_set_attribute_count++;
+
+    if (_sai_bulk_object_set_attribute_status != SAI_STATUS_SUCCESS)
+    {
+        return _sai_bulk_object_set_attribute_status;
+    }
+
+    sai_status_t status = SAI_STATUS_SUCCESS;
+    for (uint32_t i = 0; i < object_count; i++)
+    {
+        auto oid = object_key[i].key.object_id;
+        switch (object_type)
+        {
+            case SAI_OBJECT_TYPE_PORT:
+                object_statuses[i] = sai_port_api->set_port_attribute(oid, &attr_list[i]);
+                break;
+            case SAI_OBJECT_TYPE_QUEUE:
+                object_statuses[i] = sai_queue_api->set_queue_attribute(oid, &attr_list[i]);
+                break;
+            case SAI_OBJECT_TYPE_INGRESS_PRIORITY_GROUP:
+                object_statuses[i] = sai_buffer_api->set_ingress_priority_group_attribute(oid, &attr_list[i]);
+                break;
+            case SAI_OBJECT_TYPE_SCHEDULER_GROUP:
+                object_statuses[i] = sai_scheduler_group_api->set_scheduler_group_attribute(oid, &attr_list[i]);
+                break;
+            default:
+            {
+                static auto real = reinterpret_cast<decltype(&sai_bulk_object_set_attribute)>(dlsym(RTLD_NEXT, "sai_bulk_object_set_attribute"));
+                return real(object_type, object_count, object_key, attr_list, mode, object_statuses);
+            }
+        }
+
+        if (object_statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            status = SAI_STATUS_FAILURE;
+        }
+    }
+
+    return status;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <stdint.h>
+
+extern "C"
+{
+#include "sai.h"
+}
+
+/*
+ * sai_bulk_object_set_attribute() is not part of an API table, so it is overridden for all the tests.
+ * The attributes of ports, queues, priority groups and scheduler groups are set one by one
+ * through the API tables, which can be hooked by the tests. Other object types go to the SAI.
+ */
+extern uint32_t _sai_bulk_object_set_attribute_count;
+/* Returned without setting anything when it is not SAI_STATUS_SUCCESS, e.g. SAI_STATUS_NOT_IMPLEMENTED */
+extern sai_status_t _sai_bulk_object_set_attribute_status;
@@ -1,6 +1,10 @@
 #include "table.h"
 #include "producerstatetable.h"
 #include "producertable.h"
+#include <hiredis/hiredis.h>
+#include <algorithm>
+#include <cstring>
+#include <mutex>
 #include <set>
 #include <memory>
 
@@ -14,12 +18,108 @@ namespace testing_db
     TablesT gTables;
     std::map<int, TablesT> gDB;
 
+    // Number of SCAN calls, and the db of each connection.
+    // Table snapshots may be read from worker threads.
+    size_t gScanCount = 0;
+    std::map<const redisContext *, int> gConnectionDbs;
+    std::mutex gScanMutex;
+
     void reset()
     {
+        std::lock_guard<std::mutex> lock(gScanMutex);
+
         gDB.clear();
+        gScanCount = 0;
+    }
+
+    void setConnectionDb(const redisContext *ctx, int dbId)
+    {
+        std::lock_guard<std::mutex> lock(gScanMutex);
+
+        gConnectionDbs[ctx] = dbId;
+    }
+
+    size_t getScanCount()
+    {
+        return gScanCount;
+    }
+
+    redisReply *newStringReply(const std::string &str)
+    {
+        auto reply = (redisReply *)calloc(1, sizeof(redisReply));
+        reply->type = REDIS_REPLY_STRING;
+        reply->len = str.size();
+        reply->str = (char *)malloc(str.size() + 1);
+        memcpy(reply->str, str.c_str(), str.size() + 1);
+        return reply;
+    }
+
+    // Find the table and key of a "<table><separator><key>" redis key
+    const std::vector<swss::FieldValueTuple> *findEntry(int dbId, const std::string &redisKey)
+    {
+        for (const auto &table : gDB[dbId])
+        {
+            const auto &name = table.first;
+            if (redisKey.size() <= name.size() || redisKey.compare(0, name.size(), name) != 0 ||
+                (redisKey[name.size()] != ':' && redisKey[name.size()] != '|'))
+            {
+                continue;
+            }
+
+            auto it = table.second.find(redisKey.substr(name.size() + 1));
+            if (it != table.second.end())
+            {
+                return &it->second;
+            }
+        }
+        return nullptr;
+    }
+
+    // Answer the pipelined HGETALL of the connections
+    redisReply *appendCommand(redisContext *c, const char *format, va_list ap)
+    {
+        std::lock_guard<std::mutex> lock(gScanMutex);
+
+        auto db = gConnectionDbs.find(c);
+        if (strcmp(format, "HGETALL %b") != 0 || db == gConnectionDbs.end())
+        {
+            return nullptr;
+        }
+
+        const char *data = va_arg(ap, const char *);
+        size_t len = va_arg(ap, size_t);
+
+        auto reply = (redisReply *)calloc(1, sizeof(redisReply));
+        reply->type = REDIS_REPLY_ARRAY;
+
+        auto fvs = findEntry(db->second, std::string(data, len));
+        if (fvs != nullptr && !fvs->empty())
+        {
+            reply->elements = fvs->size() * 2;
+            reply->element = (redisReply **)calloc(reply->elements, sizeof(redisReply *));
+            for (size_t i = 0; i < fvs->size(); i++)
+            {
+                reply->element[2 * i] = newStringReply(fvField((*fvs)[i]));
+                reply->element[2 * i + 1] = newStringReply(fvValue((*fvs)[i]));
+            }
+        }
+        return reply;
     }
 }
 
+extern redisReply *(*mockAppendCommand)(redisContext *c, const char *format, va_list ap);
+
+namespace
+{
+    struct MockAppendCommandSetter
+    {
+        MockAppendCommandSetter()
+        {
+            mockAppendCommand = testing_db::appendCommand;
+        }
+    } mockAppendCommandSetter;
+}
+
 namespace swss
 {
 
@@ -142,6 +242,40 @@ namespace swss
         table.erase(key);
     }
 
+    /* Keys yet to be taken by the consumer, tests put them in the "<table>_KEY_SET" table */
+    int64_t ProducerStateTable::count()
+    {
+        return static_cast<int64_t>(gDB[m_pipe->getDbId()][getKeySetName()].size());
+    }
+
+    /* Keys of the table matching a "<table><separator>*" pattern, count keys per call */
+    std::pair<int, std::vector<std::string>> DBConnector::scan(int cursor, const char *match, uint32_t count)
+    {
+        std::lock_guard<std::mutex> lock(gScanMutex);
+
+        gScanCount++;
+
+        std::string prefix(match);
+        if (prefix.size() < 2 || prefix.back() != '*')
+        {
+            return std::make_pair(0, std::vector<std::string>());
+        }
+        prefix.pop_back();
+
+        const auto &table = gDB[getDbId()][prefix.substr(0, prefix.size() - 1)];
+        auto it = table.begin();
+        std::advance(it, std::min<size_t>(cursor, table.size()));
+
+        std::vector<std::string> keys;
+        for (; it != table.end() && keys.size() < count; it++)
+        {
+            keys.push_back(prefix + it->first);
+        }
+
+        int next = (it == table.end()) ? 0 : cursor + static_cast<int>(keys.size());
+        return std::make_pair(next, keys);
+    }
+
     std::shared_ptr<std::string> DBConnector::hget(const std::string &key, const std::string &field)
     {
         std::string value;
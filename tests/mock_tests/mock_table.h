@@ -5,4 +5,10 @@
 namespace testing_db
 {
     void reset();
+
+    // Number of DBConnector::scan() calls since the last reset()
+    size_t getScanCount();
+
+    // Db of a connection, which its pipelined commands are answered from
+    void setConnectionDb(const redisContext *ctx, int dbId);
 }
@@ -0,0 +1,429 @@
+#include "gtest/gtest.h"
+#include "../mock_table.h"
+#include <algorithm>
+#include <dlfcn.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <linux/netlink.h>
+#include <netlink/netlink.h>
+#include <netlink/errno.h>
+#include <netlink/cache.h>
+#include <netlink/addr.h>
+#include <netlink/netfilter/ct.h>
+#include "shellcmd.h"
+#define private public
+#include "natmgr.h"
+#undef private
+
+extern int (*callback)(const std::string &cmd, std::string &stdout);
+extern std::vector<std::string> mockCallArgs;
+
+/*
+ * Fake ctnetlink: the conntrack table is g_fakeCtEntries, a dump returns all
+ * of them and the updates and deletes are applied to them locally.
+ */
+static std::vector<struct nfnl_ct *> g_fakeCtEntries;
+static int g_fakeCtDumps = 0;
+static int g_fakeCtDeletes = 0;
+
+static struct nfnl_ct *addFakeCtEntry(uint8_t proto, const std::string &src, uint16_t sport,
+                                      const std::string &dst, uint16_t dport, const std::string &replyDst)
+{
+    struct nfnl_ct *ct = nfnl_ct_alloc();
+    struct nl_addr *addr;
+
+    nfnl_ct_set_family(ct, AF_INET);
+    nfnl_ct_set_proto(ct, proto);
+    nl_addr_parse(src.c_str(), AF_INET, &addr);
+    nfnl_ct_set_src(ct, 0, addr);
+    nl_addr_put(addr);
+    nl_addr_parse(dst.c_str(), AF_INET, &addr);
+    nfnl_ct_set_dst(ct, 0, addr);
+    nl_addr_put(addr);
+    nl_addr_parse(replyDst.c_str(), AF_INET, &addr);
+    nfnl_ct_set_dst(ct, 1, addr);
+    nl_addr_put(addr);
+    nfnl_ct_set_src_port(ct, 0, sport);
+    nfnl_ct_set_dst_port(ct, 0, dport);
+    nfnl_ct_set_timeout(ct, 100);
+
+    g_fakeCtEntries.push_back(ct);
+    return ct;
+}
+
+static void resetFakeCt()
+{
+    for (auto ct : g_fakeCtEntries)
+    {
+        nfnl_ct_put(ct);
+    }
+    g_fakeCtEntries.clear();
+    g_fakeCtDumps = 0;
+    g_fakeCtDeletes = 0;
+}
+
+/* The dumped entry itself, else the entry of the same original tuple */
+static std::vector<struct nfnl_ct *>::iterator findFakeCtEntry(const struct nfnl_ct *ct)
+{
+    auto it = std::find(g_fakeCtEntries.begin(), g_fakeCtEntries.end(), ct);
+    if (it != g_fakeCtEntries.end())
+    {
+        return it;
+    }
+
+    auto request = const_cast<struct nfnl_ct *>(ct);
+    return std::find_if(g_fakeCtEntries.begin(), g_fakeCtEntries.end(), [&](struct nfnl_ct *entry) {
+        return nfnl_ct_get_proto(entry) == nfnl_ct_get_proto(request) &&
+               !nl_addr_cmp(nfnl_ct_get_src(entry, 0), nfnl_ct_get_src(request, 0)) &&
+               !nl_addr_cmp(nfnl_ct_get_dst(entry, 0), nfnl_ct_get_dst(request, 0)) &&
+               nfnl_ct_get_src_port(entry, 0) == nfnl_ct_get_src_port(request, 0) &&
+               nfnl_ct_get_dst_port(entry, 0) == nfnl_ct_get_dst_port(request, 0);
+    });
+}
+
+extern "C"
+{
+    int nl_connect(struct nl_sock *sk, int protocol)
+    {
+        if (protocol == NETLINK_NETFILTER)
+        {
+            return 0;
+        }
+
+        auto real = reinterpret_cast<int (*)(struct nl_sock *, int)>(dlsym(RTLD_NEXT, "nl_connect"));
+        return real(sk, protocol);
+    }
+
+    int nfnl_ct_alloc_cache(struct nl_sock *, struct nl_cache **result)
+    {
+        int err = nl_cache_alloc_name("netfilter/ct", result);
+        if (err < 0)
+        {
+            return err;
+        }
+
+        for (auto ct : g_fakeCtEntries)
+        {
+            nl_cache_add(*result, reinterpret_cast<struct nl_object *>(ct));
+        }
+        g_fakeCtDumps++;
+        return 0;
+    }
+
+    int nfnl_ct_add(struct nl_sock *, const struct nfnl_ct *ct, int)
+    {
+        // A dumped entry has its timeout set already, a request by tuple updates the matching one
+        auto it = findFakeCtEntry(ct);
+        if (it == g_fakeCtEntries.end())
+        {
+            return -NLE_OBJ_NOTFOUND;
+        }
+
+        if (*it != ct)
+        {
+            nfnl_ct_set_timeout(*it, nfnl_ct_get_timeout(ct));
+        }
+        return 0;
+    }
+
+    int nfnl_ct_del(struct nl_sock *, const struct nfnl_ct *ct, int)
+    {
+        auto it = findFakeCtEntry(ct);
+        if (it == g_fakeCtEntries.end())
+        {
+            return -NLE_OBJ_NOTFOUND;
+        }
+
+        nfnl_ct_put(*it);
+        g_fakeCtEntries.erase(it);
+        g_fakeCtDeletes++;
+        return 0;
+    }
+}
+
+static int g_restoreReturn = 0;
+static std::string g_failingCmd;
+
+int natmgrShellCb(const std::string &cmd, std::string &stdout)
+{
+    mockCallArgs.push_back(cmd);
+    if (cmd.find(IPTABLES_RESTORE_CMD) == 0)
+    {
+        return g_restoreReturn;
+    }
+    return (!g_failingCmd.empty() && cmd.find(g_failingCmd) != std::string::npos) ? 1 : 0;
+}
+
+namespace natmgr_ut
+{
+    struct NatMgrTest : public ::testing::Test
+    {
+        std::shared_ptr<swss::DBConnector> m_config_db;
+        std::shared_ptr<swss::DBConnector> m_app_db;
+        std::shared_ptr<swss::DBConnector> m_state_db;
+        std::shared_ptr<swss::NatMgr> m_natMgr;
+
+        virtual void SetUp() override
+        {
+            testing_db::reset();
+            m_config_db = std::make_shared<swss::DBConnector>("CONFIG_DB", 0);
+            m_app_db = std::make_shared<swss::DBConnector>("APPL_DB", 0);
+            m_state_db = std::make_shared<swss::DBConnector>("STATE_DB", 0);
+
+            std::vector<std::string> cfg_nat_tables = {
+                CFG_STATIC_NAT_TABLE_NAME,
+                CFG_STATIC_NAPT_TABLE_NAME,
+                CFG_NAT_POOL_TABLE_NAME,
+                CFG_NAT_BINDINGS_TABLE_NAME,
+                CFG_NAT_GLOBAL_TABLE_NAME,
+            };
+
+            mockCallArgs.clear();
+            callback = natmgrShellCb;
+            g_restoreReturn = 0;
+            g_failingCmd.clear();
+            resetFakeCt();
+
+            m_natMgr = std::make_shared<swss::NatMgr>(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_nat_tables);
+            m_natMgr->m_natZoneInterfaceInfo["Ethernet0"] = "1";
+        }
+
+        virtual void TearDown() override
+        {
+            m_natMgr.reset();
+            callback = nullptr;
+            resetFakeCt();
+        }
+
+        size_t countCalls(const std::string &prefix)
+        {
+            return std::count_if(mockCallArgs.begin(), mockCallArgs.end(),
+                                 [&](const std::string &cmd) { return cmd.find(prefix) == 0; });
+        }
+    };
+
+    TEST_F(NatMgrTest, StagedStaticRulesAppliedInOneTransaction)
+    {
+        m_natMgr->beginIptablesBatch();
+
+        ASSERT_TRUE(m_natMgr->setStaticNatIptablesRules(INSERT, "Ethernet0", "65.55.45.5", "10.0.0.1", SNAT_NAT_TYPE));
+        ASSERT_TRUE(m_natMgr->setStaticNatIptablesRules(INSERT, "Ethernet0", "65.55.45.6", "10.0.0.2", SNAT_NAT_TYPE));
+        ASSERT_TRUE(mockCallArgs.empty());
+
+        ASSERT_EQ(m_natMgr->commitIptablesBatch(), 0);
+        ASSERT_EQ(mockCallArgs.size(), 1);
+
+        // One nat table block with the rules in the order they were issued
+        const std::string &restore = mockCallArgs[0];
+        ASSERT_EQ(restore.find(IPTABLES_RESTORE_CMD), 0);
+        ASSERT_EQ(restore.find("*nat"), restore.rfind("*nat"));
+        size_t first = restore.find("-d 10.0.0.1");
+        size_t second = restore.find("-d 10.0.0.2");
+        ASSERT_NE(first, std::string::npos);
+        ASSERT_NE(second, std::string::npos);
+        ASSERT_LT(first, second);
+    }
+
+    TEST_F(NatMgrTest, TableChangeCommitsStagedRules)
+    {
+        m_natMgr->beginIptablesBatch();
+
+        ASSERT_TRUE(m_natMgr->setStaticNatIptablesRules(INSERT, "Ethernet0", "65.55.45.5", "10.0.0.1", SNAT_NAT_TYPE));
+        ASSERT_TRUE(m_natMgr->setMangleIptablesRules(ADD, "Ethernet4", "2"));
+
+        // The nat rules went first, in their own transaction
+        ASSERT_EQ(mockCallArgs.size(), 1);
+        ASSERT_NE(mockCallArgs[0].find("*nat"), std::string::npos);
+        ASSERT_EQ(mockCallArgs[0].find("*mangle"), std::string::npos);
+
+        ASSERT_EQ(m_natMgr->commitIptablesBatch(), 0);
+        ASSERT_EQ(mockCallArgs.size(), 2);
+        ASSERT_NE(mockCallArgs[1].find("*mangle"), std::string::npos);
+        ASSERT_EQ(mockCallArgs[1].find("*nat"), std::string::npos);
+    }
+
+    TEST_F(NatMgrTest, CommitFailureReplaysCommands)
+    {
+        g_restoreReturn = 1;
+        g_failingCmd = "--to-destination 10.0.0.2";
+
+        m_natMgr->beginIptablesBatch();
+        ASSERT_TRUE(m_natMgr->setStaticNatIptablesRules(INSERT, "Ethernet0", "65.55.45.5", "10.0.0.1", DNAT_NAT_TYPE));
+        ASSERT_TRUE(m_natMgr->setStaticNatIptablesRules(INSERT, "Ethernet0", "65.55.45.6", "10.0.0.2", DNAT_NAT_TYPE));
+
+        // The rejected transaction is replayed command by command and the failure reported
+        ASSERT_EQ(m_natMgr->commitIptablesBatch(), 1);
+        ASSERT_EQ(countCalls(IPTABLES_RESTORE_CMD), 1);
+        ASSERT_EQ(countCalls(IPTABLES_CMD " -t nat"), 2);
+        ASSERT_NE(mockCallArgs.back().find("--to-destination 10.0.0.2"), std::string::npos);
+    }
+
+    TEST_F(NatMgrTest, DynamicRulesReportRealStatus)
+    {
+        g_failingCmd = "-j SNAT";
+
+        m_natMgr->beginIptablesBatch();
+        ASSERT_TRUE(m_natMgr->setStaticNatIptablesRules(INSERT, "Ethernet0", "65.55.45.5", "10.0.0.1", DNAT_NAT_TYPE));
+
+        // The binding state depends on the result, so the rules are not staged
+        ASSERT_FALSE(m_natMgr->setDynamicNatIptablesRulesWithoutAcl(ADD, "Ethernet0", "65.55.45.10", "", ""));
+
+        // The staged static rules were applied first to keep the ordering
+        ASSERT_EQ(mockCallArgs.size(), 2);
+        ASSERT_EQ(mockCallArgs[0].find(IPTABLES_RESTORE_CMD), 0);
+        ASSERT_EQ(mockCallArgs[1].find(IPTABLES_CMD), 0);
+
+        ASSERT_EQ(m_natMgr->commitIptablesBatch(), 0);
+        ASSERT_EQ(mockCallArgs.size(), 2);
+    }
+
+    TEST_F(NatMgrTest, HostIpRejectsInvalidAddresses)
+    {
+        uint32_t ip = 0;
+
+        ASSERT_TRUE(swss::NlConntrack::toHostIp("10.0.0.1", ip));
+        ASSERT_EQ(ip, 0x0a000001);
+        ASSERT_FALSE(swss::NlConntrack::toHostIp("", ip));
+        ASSERT_FALSE(swss::NlConntrack::toHostIp("10.0.0", ip));
+        ASSERT_FALSE(swss::NlConntrack::toHostIp("fc00::1", ip));
+        ASSERT_FALSE(swss::NlConntrack::toHostIp("0.0.0.0", ip));
+    }
+
+    TEST_F(NatMgrTest, InvalidAddressSkipsConntrackDelete)
+    {
+        addFakeCtEntry(IPPROTO_UDP, "10.0.0.1", 1000, "20.0.0.1", 2000, "65.55.45.5");
+        addFakeCtEntry(IPPROTO_UDP, "10.0.0.2", 1000, "20.0.0.1", 2000, "65.55.45.6");
+
+        m_natMgr->m_staticNatEntry["10.0.0.300"].nat_type = SNAT_NAT_TYPE;
+        m_natMgr->deleteConntrackStaticSingleNatEntry("10.0.0.300");
+        m_natMgr->deleteConntrackDynamicEntries("65.55.45.5-bad");
+
+        // Nothing is looked up, let alone flushed
+        ASSERT_EQ(g_fakeCtDumps, 0);
+        ASSERT_EQ(g_fakeCtEntries.size(), 2);
+
+        m_natMgr->m_staticNatEntry["10.0.0.1"].nat_type = SNAT_NAT_TYPE;
+        m_natMgr->deleteConntrackStaticSingleNatEntry("10.0.0.1");
+
+        ASSERT_EQ(g_fakeCtDeletes, 1);
+        ASSERT_EQ(g_fakeCtEntries.size(), 1);
+    }
+
+    TEST_F(NatMgrTest, PoolDeleteMatchesTranslatedRange)
+    {
+        addFakeCtEntry(IPPROTO_TCP, "10.0.0.1", 1000, "20.0.0.1", 80, "65.55.45.5");
+        addFakeCtEntry(IPPROTO_TCP, "10.0.0.2", 1000, "20.0.0.1", 80, "65.55.45.7");
+        addFakeCtEntry(IPPROTO_TCP, "10.0.0.3", 1000, "20.0.0.1", 80, "65.55.45.9");
+
+        m_natMgr->deleteConntrackDynamicEntries("65.55.45.5-65.55.45.7");
+
+        ASSERT_EQ(g_fakeCtDumps, 1);
+        ASSERT_EQ(g_fakeCtDeletes, 2);
+        ASSERT_EQ(g_fakeCtEntries.size(), 1);
+    }
+
+    TEST_F(NatMgrTest, TimeoutNotificationsShareOneDump)
+    {
+        auto first = addFakeCtEntry(IPPROTO_UDP, "10.0.0.1", 1000, "20.0.0.1", 2000, "65.55.45.5");
+        auto second = addFakeCtEntry(IPPROTO_TCP, "10.0.0.2", 3000, "20.0.0.1", 80, "65.55.45.5");
+        auto other = addFakeCtEntry(IPPROTO_TCP, "10.0.0.3", 3000, "20.0.0.1", 80, "65.55.45.5");
+
+        std::deque<swss::KeyOpFieldsValuesTuple> entries = {
+            { "10.0.0.1", "SET-SINGLE-NAT", {} },
+            { "TCP:10.0.0.2:3000", "AGEOUT-SINGLE-NAPT", {} },
+        };
+        m_natMgr->timeoutNotifications(entries);
+
+        ASSERT_EQ(g_fakeCtDumps, 1);
+        ASSERT_EQ(nfnl_ct_get_timeout(first), static_cast<uint32_t>(NAT_TIMEOUT_MAX));
+        ASSERT_EQ(nfnl_ct_get_timeout(second), static_cast<uint32_t>(NAT_TIMEOUT_LOW));
+        ASSERT_EQ(nfnl_ct_get_timeout(other), 100u);
+    }
+
+    TEST_F(NatMgrTest, ExactTupleSkipsDumpOutsideBatch)
+    {
+        auto entry = addFakeCtEntry(IPPROTO_TCP, "10.0.0.1", 1000, "20.0.0.1", 80, "65.55.45.5");
+        addFakeCtEntry(IPPROTO_TCP, "10.0.0.1", 1001, "20.0.0.1", 80, "65.55.45.5");
+
+        swss::NlConntrack::Filter filter;
+        filter.protocol = IPPROTO_TCP;
+        ASSERT_TRUE(swss::NlConntrack::toHostIp("10.0.0.1", filter.srcIp));
+        ASSERT_TRUE(swss::NlConntrack::toHostIp("20.0.0.1", filter.dstIp));
+        filter.srcPort = 1000;
+        filter.dstPort = 80;
+
+        size_t count = 0;
+        ASSERT_EQ(m_natMgr->m_conntrack.updateTimeout(filter, NAT_TIMEOUT_MAX, &count), 0);
+        ASSERT_EQ(count, 1);
+        ASSERT_EQ(nfnl_ct_get_timeout(entry), static_cast<uint32_t>(NAT_TIMEOUT_MAX));
+
+        m_natMgr->deleteConntrackStaticTwiceNaptEntry("10.0.0.1|TCP|1000", "20.0.0.1|TCP|80");
+
+        // Both went to the kernel as requests for the entry, without any dump
+        ASSERT_EQ(g_fakeCtDumps, 0);
+        ASSERT_EQ(g_fakeCtDeletes, 1);
+        ASSERT_EQ(g_fakeCtEntries.size(), 1);
+    }
+
+    TEST_F(NatMgrTest, BatchedDeletesShareOneDump)
+    {
+        addFakeCtEntry(IPPROTO_UDP, "10.0.0.1", 1, "127.0.0.1", 127, "65.55.45.5");
+        addFakeCtEntry(IPPROTO_UDP, "10.0.0.2", 1, "127.0.0.1", 127, "65.55.45.6");
+        addFakeCtEntry(IPPROTO_UDP, "10.0.0.3", 1, "127.0.0.1", 127, "65.55.45.7");
+
+        m_natMgr->m_staticNatEntry["10.0.0.1"].nat_type = SNAT_NAT_TYPE;
+        m_natMgr->m_staticNatEntry["10.0.0.2"].nat_type = SNAT_NAT_TYPE;
+
+        {
+            swss::NatMgr::BatchGuard batch(*m_natMgr);
+
+            m_natMgr->deleteConntrackStaticSingleNatEntry("10.0.0.1");
+            m_natMgr->deleteConntrackStaticSingleNatEntry("10.0.0.2");
+
+            // Staged until the batch is committed
+            ASSERT_EQ(g_fakeCtDumps, 0);
+            ASSERT_EQ(g_fakeCtEntries.size(), 3);
+        }
+
+        ASSERT_EQ(g_fakeCtDumps, 1);
+        ASSERT_EQ(g_fakeCtDeletes, 2);
+        ASSERT_EQ(g_fakeCtEntries.size(), 1);
+    }
+
+    TEST_F(NatMgrTest, BatchCommittedWhenHandlerThrows)
+    {
+        try
+        {
+            swss::NatMgr::BatchGuard batch(*m_natMgr);
+
+            ASSERT_TRUE(m_natMgr->setStaticNatIptablesRules(INSERT, "Ethernet0", "65.55.45.5", "10.0.0.1", SNAT_NAT_TYPE));
+            throw std::runtime_error("handler failure");
+        }
+        catch (const std::runtime_error &)
+        {
+        }
+
+        // The staged rule was applied and later commands run right away again
+        ASSERT_FALSE(m_natMgr->m_iptablesBatching);
+        ASSERT_EQ(countCalls(IPTABLES_RESTORE_CMD), 1);
+
+        ASSERT_TRUE(m_natMgr->setStaticNatIptablesRules(INSERT, "Ethernet0", "65.55.45.6", "10.0.0.2", SNAT_NAT_TYPE));
+        ASSERT_EQ(countCalls(IPTABLES_CMD " -t nat"), 1);
+    }
+
+    TEST_F(NatMgrTest, IptablesRatesWrittenToStateDb)
+    {
+        m_natMgr->beginIptablesBatch();
+        ASSERT_TRUE(m_natMgr->setStaticNatIptablesRules(INSERT, "Ethernet0", "65.55.45.5", "10.0.0.1", SNAT_NAT_TYPE));
+        ASSERT_EQ(m_natMgr->commitIptablesBatch(), 0);
+
+        swss::Table stats(m_state_db.get(), STATE_NATMGR_STATS_TABLE_NAME);
+        std::string value;
+
+        ASSERT_TRUE(stats.hget(NATMGR_STATS_IPTABLES_KEY, "last_batch_rules", value));
+        ASSERT_NE(value, "0");
+        ASSERT_TRUE(stats.hget(NATMGR_STATS_IPTABLES_KEY, "rules_applied", value));
+        ASSERT_NE(value, "0");
+        ASSERT_TRUE(stats.hget(NATMGR_STATS_IPTABLES_KEY, "rules_per_sec", value));
+    }
+}
@@ -0,0 +1,136 @@
+#define private public
+#include "directory.h"
+#undef private
+#define protected public
+#include "orch.h"
+#undef protected
+#include "ut_helper.h"
+#define private public
+#include "natorch.h"
+#undef private
+#include "mock_orchagent_main.h"
+#include "mock_sai_api.h"
+#include "mock_orch_test.h"
+#include "gtest/gtest.h"
+#include <string>
+
+EXTERN_MOCK_FNS
+
+namespace natorch_test
+{
+    DEFINE_SAI_API_MOCK(nat);
+    using namespace std;
+    using namespace mock_orch_test;
+    using ::testing::_;
+    using ::testing::DoAll;
+    using ::testing::Return;
+    using ::testing::SetArrayArgument;
+
+    static const IpAddress NAT_IP("65.55.45.1");
+    static const IpAddress TRANSLATED_IP("10.0.0.1");
+
+    class NatOrchTest : public MockOrchTest
+    {
+    protected:
+        NatOrch *m_natOrch;
+
+        void PostSetUp() override
+        {
+            INIT_SAI_API_MOCK(nat);
+            MockSaiApis();
+
+            const int natorch_base_pri = 50;
+            vector<table_name_with_pri_t> nat_tables = {
+                { APP_NAT_DNAT_POOL_TABLE_NAME,  natorch_base_pri + 5 },
+                { APP_NAT_TABLE_NAME,            natorch_base_pri + 4 },
+                { APP_NAPT_TABLE_NAME,           natorch_base_pri + 3 },
+                { APP_NAT_TWICE_TABLE_NAME,      natorch_base_pri + 2 },
+                { APP_NAPT_TWICE_TABLE_NAME,     natorch_base_pri + 1 },
+                { APP_NAT_GLOBAL_TABLE_NAME,     natorch_base_pri     }
+            };
+
+            /* Created after the mock is applied, so that the bulker uses the mocked bulk API */
+            m_natOrch = new NatOrch(m_app_db.get(), m_state_db.get(), nat_tables, gRouteOrch, gNeighOrch);
+        }
+
+        void PreTearDown() override
+        {
+            delete m_natOrch;
+            m_natOrch = nullptr;
+
+            RestoreSaiApis();
+        }
+
+        void addCachedNatEntry(const string &natType)
+        {
+            NatEntryValue entry;
+            entry.translated_ip = TRANSLATED_IP;
+            entry.nat_type = natType;
+            entry.entry_type = "static";
+            entry.activeTime = 0;
+            entry.ageOutTime = 0;
+            entry.addedToHw = true;
+
+            m_natOrch->m_natEntries[NAT_IP] = entry;
+            m_natOrch->totalEntries = 1;
+            m_natOrch->totalStaticNatEntries = 1;
+            if (natType == "snat")
+            {
+                m_natOrch->totalSnatEntries = 1;
+            }
+            else
+            {
+                m_natOrch->totalDnatEntries = 1;
+            }
+        }
+    };
+
+    TEST_F(NatOrchTest, BulkRemoveFailureErasesSnatEntryOnCompletion)
+    {
+        addCachedNatEntry("snat");
+
+        m_natOrch->m_natBulking = true;
+
+        /* The removal is only queued, the entry stays until the SAI call is complete */
+        ASSERT_TRUE(m_natOrch->removeHwSnatEntry(NAT_IP));
+        ASSERT_NE(m_natOrch->m_natEntries.find(NAT_IP), m_natOrch->m_natEntries.end());
+        ASSERT_EQ(m_natOrch->totalSnatEntries, 1);
+
+        std::vector<sai_status_t> exp_status{SAI_STATUS_FAILURE};
+        EXPECT_CALL(*mock_sai_nat_api, remove_nat_entries(1, _, _, _))
+            .WillOnce(DoAll(SetArrayArgument<3>(exp_status.begin(), exp_status.end()), Return(SAI_STATUS_FAILURE)));
+
+        ASSERT_TRUE(m_natOrch->flushNatBulker());
+        m_natOrch->m_natBulking = false;
+
+        /* Same as the removal without bulking, the entry is dropped regardless of the SAI result */
+        ASSERT_EQ(m_natOrch->m_natEntries.find(NAT_IP), m_natOrch->m_natEntries.end());
+        ASSERT_EQ(m_natOrch->totalEntries, 0);
+        ASSERT_EQ(m_natOrch->totalSnatEntries, 0);
+        ASSERT_EQ(m_natOrch->totalStaticNatEntries, 0);
+        ASSERT_TRUE(m_natOrch->m_natBulkContexts.empty());
+    }
+
+    TEST_F(NatOrchTest, BulkRemoveErasesDnatEntryOnCompletion)
+    {
+        addCachedNatEntry("dnat");
+
+        m_natOrch->m_natBulking = true;
+
+        ASSERT_TRUE(m_natOrch->removeHwDnatEntry(NAT_IP, true));
+        ASSERT_NE(m_natOrch->m_natEntries.find(NAT_IP), m_natOrch->m_natEntries.end());
+        ASSERT_EQ(m_natOrch->totalDnatEntries, 1);
+
+        std::vector<sai_status_t> exp_status{SAI_STATUS_SUCCESS};
+        EXPECT_CALL(*mock_sai_nat_api, remove_nat_entries(1, _, _, _))
+            .WillOnce(DoAll(SetArrayArgument<3>(exp_status.begin(), exp_status.end()), Return(SAI_STATUS_SUCCESS)));
+
+        ASSERT_TRUE(m_natOrch->flushNatBulker());
+        m_natOrch->m_natBulking = false;
+
+        ASSERT_EQ(m_natOrch->m_natEntries.find(NAT_IP), m_natOrch->m_natEntries.end());
+        ASSERT_EQ(m_natOrch->totalEntries, 0);
+        ASSERT_EQ(m_natOrch->totalDnatEntries, 0);
+        ASSERT_EQ(m_natOrch->totalStaticNatEntries, 0);
+    }
+}
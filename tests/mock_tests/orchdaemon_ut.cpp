@@ -1,4 +1,6 @@
+#define private public
 #include "orchdaemon.h"
+#undef private
 #include "dbconnector.h"
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
@@ -19,6 +21,47 @@ namespace orchdaemon_test
     DBConnector config_db("CONFIG_DB", 0);
     DBConnector counters_db("COUNTERS_DB", 0);
 
+    class DepOrch : public Orch
+    {
+        public:
+            DepOrch(DBConnector *db, const string &table, const vector<string> &deps,
+                    function<void(Consumer &)> task = nullptr) :
+                Orch(db, table), m_table(table), m_deps(deps), m_task(task)
+            {
+            }
+
+            vector<string> getWarmStartDependencies() const override
+            {
+                return m_deps;
+            }
+
+            void doTask(Consumer &consumer) override
+            {
+                if (m_task)
+                {
+                    m_task(consumer);
+                }
+            }
+
+            Consumer *consumer()
+            {
+                return dynamic_cast<Consumer *>(getExecutor(m_table));
+            }
+
+            void addTasks(const vector<string> &keys)
+            {
+                for (const auto &key : keys)
+                {
+                    consumer()->addToSync(KeyOpFieldsValuesTuple(key, SET_COMMAND, {}));
+                }
+            }
+
+        private:
+            string m_table;
+            vector<string> m_deps;
+            function<void(Consumer &)> m_task;
+    };
+
     class OrchDaemonTest : public ::testing::Test
     {
         public:
@@ -49,4 +92,87 @@ namespace orchdaemon_test
 
         orchd->logRotate();
     }
+
+    TEST_F(OrchDaemonTest, warmStartOrder)
+    {
+        DepOrch a(&appl_db, "A_TABLE", { "C_TABLE" });
+        DepOrch b(&appl_db, "B_TABLE", {});
+        DepOrch c(&appl_db, "C_TABLE", { "B_TABLE", "UNKNOWN_TABLE" });
+
+        map<Orch *, set<Orch *>> deps;
+        auto order = orchd->getWarmStartOrder({ &a, &b, &c }, deps);
+
+        ASSERT_EQ(order, vector<Orch *>({ &b, &c, &a }));
+        ASSERT_EQ(deps[&a], set<Orch *>({ &c }));
+        ASSERT_EQ(deps[&c], set<Orch *>({ &b }));
+        ASSERT_TRUE(deps[&b].empty());
+
+        // A cycle is broken in list order
+        DepOrch d(&appl_db, "D_TABLE", { "E_TABLE" });
+        DepOrch e(&appl_db, "E_TABLE", { "D_TABLE" });
+
+        deps.clear();
+        order = orchd->getWarmStartOrder({ &d, &e }, deps);
+        ASSERT_EQ(order, vector<Orch *>({ &d, &e }));
+    }
+
+    TEST_F(OrchDaemonTest, warmStartRounds)
+    {
+        // A resolves one task per round
+        DepOrch a(&appl_db, "A_TABLE", {}, [](Consumer &consumer)
+        {
+            consumer.m_toSync.erase(consumer.m_toSync.begin());
+        });
+
+        // B depends on A, and resolves its tasks once A is done
+        DepOrch b(&appl_db, "B_TABLE", { "A_TABLE" }, [&a](Consumer &consumer)
+        {
+            if (a.consumer()->m_toSync.empty())
+            {
+                consumer.m_toSync.clear();
+            }
+        });
+
+        // C replaces its task twice, the number of pending tasks stays the same
+        int steps = 0;
+        DepOrch c(&appl_db, "C_TABLE", {}, [&steps](Consumer &consumer)
+        {
+            if (steps < 2)
+            {
+                consumer.m_toSync.clear();
+                consumer.addToSync(KeyOpFieldsValuesTuple("step" + to_string(++steps), SET_COMMAND, {}));
+            }
+        });
+
+        // D never resolves its task
+        DepOrch d(&appl_db, "D_TABLE", {});
+
+        a.addTasks({ "a1", "a2", "a3" });
+        b.addTasks({ "b1", "b2" });
+        c.addTasks({ "step0" });
+        d.addTasks({ "d1" });
+
+        orchd->m_orchList = { &b, &a, &c, &d };
+
+        map<Orch *, double> taskTimes;
+        map<Orch *, int> taskRounds;
+        int rounds = orchd->runWarmStartRounds(taskTimes, taskRounds);
+
+        // B is held back while A makes progress, then runs in the round A completes
+        ASSERT_EQ(taskRounds[&a], 3);
+        ASSERT_EQ(taskRounds[&b], 1);
+        ASSERT_TRUE(a.consumer()->m_toSync.empty());
+        ASSERT_TRUE(b.consumer()->m_toSync.empty());
+
+        // C makes progress in the first two rounds, the rounds stop when no task changes
+        ASSERT_EQ(taskRounds[&c], 4);
+        ASSERT_EQ(c.consumer()->m_toSync.count("step2"), 1);
+        ASSERT_EQ(rounds, 4);
+
+        // D is retried in every round, and keeps its task
+        ASSERT_EQ(taskRounds[&d], 4);
+        ASSERT_EQ(d.consumer()->m_toSync.size(), 1);
+
+        orchd->m_orchList.clear();
+    }
 }
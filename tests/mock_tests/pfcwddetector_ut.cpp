@@ -0,0 +1,261 @@
+#include "ut_helper.h"
+#include "pfcwddetector.h"
+
+#include <chrono>
+#include <random>
+
+namespace pfcwddetector_test
+{
+    using namespace std;
+
+    // Poll interval of the PFC watchdog, in microseconds
+    const uint64_t pollTime = 100 * 1000;
+
+    const sai_object_id_t queueOid = 0x15000000000010;
+    const sai_object_id_t portOid = 0x1000000000002;
+
+    struct ReplayEvent
+    {
+        size_t poll;
+        sai_object_id_t queueId;
+        PfcWdDetectorEvent event;
+    };
+
+    /*
+     * Synthetic counters of a lossless queue polled every pollTime.
+     * The peer keeps pausing the queue from stormStart up to stormEnd,
+     * during which the queue holds packets but transmits nothing.
+     */
+    vector<PfcWdCounterSample> makeStormTrace(size_t polls, size_t stormStart, size_t stormEnd)
+    {
+        vector<PfcWdCounterSample> trace;
+        PfcWdCounterSample sample;
+        sample.valid = true;
+
+        for (size_t i = 0; i < polls; i++)
+        {
+            if (i > stormStart && i <= stormEnd)
+            {
+                sample.occupancyBytes = 9216;
+                sample.pfcRxPackets += 1000;
+                sample.pfcDuration += pollTime;
+            }
+            else
+            {
+                sample.occupancyBytes = 0;
+                sample.packets += 500;
+            }
+            trace.push_back(sample);
+        }
+
+        return trace;
+    }
+
+    struct PfcWdDetectorTest : public ::testing::Test
+    {
+        shared_ptr<PfcWdDetector> m_detector;
+
+        /*
+         * Feeds the traces, one per queue in the order of getQueues(), to the detector
+         * and takes the actions the orch does on the events.
+         * times[i] is the time of poll i, every pollTime if it is not provided.
+         */
+        vector<ReplayEvent> replay(const vector<vector<PfcWdCounterSample>> &traces, const vector<uint64_t> &times = {})
+        {
+            vector<ReplayEvent> events;
+            vector<PfcWdCounterSample> samples(traces.size());
+            vector<PfcWdDetectorResult> results;
+
+            for (size_t poll = 0; poll < traces[0].size(); poll++)
+            {
+                for (size_t i = 0; i < traces.size(); i++)
+                {
+                    samples[i] = traces[i][poll];
+                }
+
+                results.clear();
+                m_detector->poll(times.empty() ? poll * pollTime : times[poll], samples, results);
+
+                for (const auto &result : results)
+                {
+                    events.push_back({poll, result.queueId, result.event});
+                    m_detector->setOperational(result.queueId, result.event == PfcWdDetectorEvent::PFC_WD_DETECTOR_RESTORE);
+                }
+            }
+
+            return events;
+        }
+    };
+
+    TEST_F(PfcWdDetectorTest, SelectModelByPlatform)
+    {
+        ASSERT_NE(PfcWdDetector::create("mellanox"), nullptr);
+        ASSERT_NE(PfcWdDetector::create("vs"), nullptr);
+        // Vendors without a native model keep the lua plugins
+        ASSERT_EQ(PfcWdDetector::create("broadcom"), nullptr);
+        ASSERT_EQ(PfcWdDetector::create(""), nullptr);
+    }
+
+    TEST_F(PfcWdDetectorTest, DetectAndRestoreLatency)
+    {
+        m_detector = PfcWdDetector::create("mellanox");
+        m_detector->addQueue(queueOid, portOid, 3, 200 * 1000, 400 * 1000, false);
+
+        auto events = replay({ makeStormTrace(60, 10, 30) });
+
+        // Detected once the storm lasts for the detection time, and restored once
+        // no pause frame has been received for the restoration time
+        ASSERT_EQ(events.size(), 2);
+        ASSERT_EQ(events[0].event, PfcWdDetectorEvent::PFC_WD_DETECTOR_STORM);
+        ASSERT_EQ((events[0].poll - 10) * pollTime, 200 * 1000);
+        ASSERT_EQ(events[1].event, PfcWdDetectorEvent::PFC_WD_DETECTOR_RESTORE);
+        ASSERT_EQ((events[1].poll - 30) * pollTime, 400 * 1000);
+        ASSERT_TRUE(m_detector->getQueues()[0].operational);
+    }
+
+    TEST_F(PfcWdDetectorTest, DetectWithJitterAndStaleSamples)
+    {
+        m_detector = PfcWdDetector::create("mellanox");
+        m_detector->setPollInterval(pollTime);
+        m_detector->addQueue(queueOid, portOid, 3, 300 * 1000, 0, false);
+
+        // The samples are taken up to 10ms late, and the one in the middle of the storm
+        // is read before syncd updates the counters
+        mt19937 gen(0);
+        uniform_int_distribution<uint64_t> jitter(0, 10 * 1000);
+        vector<uint64_t> times;
+        for (size_t i = 0; i < 40; i++)
+        {
+            times.push_back(i * pollTime + jitter(gen));
+        }
+
+        auto trace = makeStormTrace(40, 10, 40);
+        trace[12] = trace[11];
+
+        auto events = replay({ trace }, times);
+
+        // Neither the jitter nor the stale sample delays the detection
+        ASSERT_EQ(events.size(), 1);
+        ASSERT_EQ(events[0].event, PfcWdDetectorEvent::PFC_WD_DETECTOR_STORM);
+        ASSERT_EQ(events[0].poll, 13);
+    }
+
+    TEST_F(PfcWdDetectorTest, NoStormOnCongestion)
+    {
+        m_detector = PfcWdDetector::create("mellanox");
+        m_detector->addQueue(queueOid, portOid, 3, 200 * 1000, 200 * 1000, false);
+
+        // The queue is paused most of the time but keeps transmitting
+        vector<PfcWdCounterSample> trace;
+        PfcWdCounterSample sample;
+        sample.valid = true;
+        sample.occupancyBytes = 100000;
+        for (size_t i = 0; i < 1000; i++)
+        {
+            sample.packets += (i % 7 == 0) ? 0 : 10;
+            sample.pfcRxPackets += 500;
+            sample.pfcDuration += pollTime * 95 / 100;
+            trace.push_back(sample);
+        }
+
+        ASSERT_TRUE(replay({ trace }).empty());
+    }
+
+    TEST_F(PfcWdDetectorTest, AlertActionRestoredByDetection)
+    {
+        m_detector = PfcWdDetector::create("mellanox");
+        // No restoration time, the alert is cleared as soon as the storm is gone
+        m_detector->addQueue(queueOid, portOid, 3, 200 * 1000, 0, true);
+
+        auto events = replay({ makeStormTrace(40, 10, 20) });
+
+        // The storm keeps being reported while it lasts, as the detection goes on under the alert action
+        ASSERT_GE(events.size(), 2);
+        ASSERT_EQ(events.front().event, PfcWdDetectorEvent::PFC_WD_DETECTOR_STORM);
+        ASSERT_EQ(events.front().poll, 12);
+        for (size_t i = 0; i < events.size() - 1; i++)
+        {
+            ASSERT_EQ(events[i].event, PfcWdDetectorEvent::PFC_WD_DETECTOR_STORM);
+        }
+        ASSERT_EQ(events.back().event, PfcWdDetectorEvent::PFC_WD_DETECTOR_RESTORE);
+        ASSERT_EQ(events.back().poll, 21);
+    }
+
+    TEST_F(PfcWdDetectorTest, VsModelDetectsPauseFrames)
+    {
+        m_detector = PfcWdDetector::create("vs");
+        m_detector->addQueue(queueOid, portOid, 3, 200 * 1000, 200 * 1000, false);
+
+        // pfc_detect_vs.lua takes any pause frame to a stalled queue holding packets as the storm
+        auto trace = makeStormTrace(30, 10, 30);
+        for (size_t i = 11; i < trace.size(); i++)
+        {
+            trace[i].pfcDuration = trace[10].pfcDuration;
+        }
+
+        auto events = replay({ trace });
+
+        ASSERT_EQ(events.size(), 1);
+        ASSERT_EQ(events[0].event, PfcWdDetectorEvent::PFC_WD_DETECTOR_STORM);
+        ASSERT_EQ(events[0].poll, 12);
+    }
+
+    TEST_F(PfcWdDetectorTest, RemoveQueueKeepsOthers)
+    {
+        m_detector = PfcWdDetector::create("mellanox");
+        for (sai_object_id_t i = 0; i < 3; i++)
+        {
+            m_detector->addQueue(queueOid + i, portOid, (uint8_t)(3 + i), 200 * 1000, 200 * 1000, false);
+        }
+
+        auto stormTrace = makeStormTrace(20, 5, 20);
+        auto idleTrace = makeStormTrace(20, 20, 20);
+        auto events = replay({ idleTrace, idleTrace, idleTrace });
+        ASSERT_TRUE(events.empty());
+
+        // The last queue takes the slot of the removed one with its state
+        m_detector->removeQueue(queueOid + 1);
+        const auto &queues = m_detector->getQueues();
+        ASSERT_EQ(queues.size(), 2);
+        ASSERT_EQ(queues[0].queueId, queueOid);
+        ASSERT_EQ(queues[1].queueId, queueOid + 2);
+        ASSERT_EQ(queues[1].index, 5);
+        ASSERT_TRUE(queues[1].packetsLastValid);
+
+        m_detector->removeQueue(queueOid + 1);
+        ASSERT_EQ(m_detector->getQueues().size(), 2);
+
+        m_detector = PfcWdDetector::create("mellanox");
+        m_detector->addQueue(queueOid, portOid, 3, 200 * 1000, 200 * 1000, false);
+        m_detector->addQueue(queueOid + 2, portOid, 5, 200 * 1000, 200 * 1000, false);
+        events = replay({ idleTrace, stormTrace });
+        ASSERT_EQ(events.size(), 1);
+        ASSERT_EQ(events[0].queueId, queueOid + 2);
+        ASSERT_EQ(events[0].poll, 7);
+    }
+
+    TEST_F(PfcWdDetectorTest, PollScale)
+    {
+        m_detector = PfcWdDetector::create("mellanox");
+
+        // 512 ports with 2 lossless queues each
+        const size_t queueCount = 1024;
+        for (sai_object_id_t i = 0; i < queueCount; i++)
+        {
+            m_detector->addQueue(queueOid + i, portOid + i / 2, (uint8_t)(3 + i % 2), 200 * 1000, 200 * 1000, false);
+        }
+
+        vector<vector<PfcWdCounterSample>> traces(queueCount, makeStormTrace(100, 100, 100));
+        traces[queueCount - 1] = makeStormTrace(100, 50, 100);
+
+        auto start = chrono::steady_clock::now();
+        auto events = replay(traces);
+        auto end = chrono::steady_clock::now();
+
+        ASSERT_EQ(events.size(), 1);
+        ASSERT_EQ(events[0].queueId, queueOid + queueCount - 1);
+
+        cout << "Replayed " << queueCount << " queues x 100 polls in "
+             << chrono::duration_cast<chrono::microseconds>(end - start).count() << "us" << endl;
+    }
+}
@@ -39,6 +39,11 @@ struct Portal
         {
             return aclOrch->m_AclTables;
         }
+
+        static ObjectBulker<sai_acl_api_t> &getAclEntryBulker(AclOrch *aclOrch)
+        {
+            return aclOrch->m_aclEntryBulker;
+        }
     };
 
     struct CrmOrchInternal
@@ -6,6 +6,7 @@
 #include "ut_helper.h"
 #include "mock_orchagent_main.h"
 #include "mock_table.h"
+#include "orchdaemon.h"
 #include "notifier.h"
 #include "mock_sai_bridge.h"
 #define private public
@@ -83,6 +84,7 @@ namespace portsorch_test
     }
 
     uint32_t _sai_set_pfc_mode_count;
+    uint32_t _sai_set_port_pfc_count;
     uint32_t _sai_set_admin_state_up_count;
     uint32_t _sai_set_admin_state_down_count;
     bool set_pt_interface_id_fail = false;
@@ -95,6 +97,8 @@ namespace portsorch_test
     uint32_t set_pt_timestamp_template_failures;
     uint32_t set_port_tam_failures;
     bool set_link_event_damping_success = true;
+    sai_object_id_t set_port_mtu_fail_oid = SAI_NULL_OBJECT_ID;
+    uint32_t set_port_mtu_failures;
     uint32_t _sai_set_link_event_damping_algorithm_count;
     uint32_t _sai_set_link_event_damping_config_count;
     int32_t _sai_link_event_damping_algorithm = 0;
@@ -126,6 +130,19 @@ namespace portsorch_test
 	        _sai_set_admin_state_down_count++;
             }
         }
+        else if (attr[0].id == SAI_PORT_ATTR_PRIORITY_FLOW_CONTROL)
+        {
+            _sai_set_port_pfc_count++;
+        }
+        else if (attr[0].id == SAI_PORT_ATTR_MTU)
+        {
+            /* Simulating failure case */
+            if (port_id == set_port_mtu_fail_oid)
+            {
+                set_port_mtu_failures++;
+                return SAI_STATUS_INVALID_ATTR_VALUE_0;
+            }
+        }
         else if (attr[0].id == SAI_PORT_ATTR_PATH_TRACING_INTF)
         {
             set_pt_interface_id_count++;
@@ -179,6 +196,29 @@ namespace portsorch_test
         return pold_sai_port_api->set_port_attribute(port_id, attr);
     }
 
+    uint32_t _sai_set_ports_attribute_count;
+    sai_status_t _ut_stub_sai_set_ports_attribute(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        sai_status_t status = SAI_STATUS_SUCCESS;
+
+        _sai_set_ports_attribute_count++;
+
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = _ut_stub_sai_set_port_attribute(object_id[i], &attr_list[i]);
+            if (object_statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                status = SAI_STATUS_FAILURE;
+            }
+        }
+        return status;
+    }
+
     vector<sai_object_type_t> supported_sai_objects = {
         SAI_OBJECT_TYPE_PORT,
         SAI_OBJECT_TYPE_LAG,
@@ -245,6 +285,7 @@ namespace portsorch_test
         pold_sai_port_api = sai_port_api;
         ut_sai_port_api.get_port_attribute = _ut_stub_sai_get_port_attribute;
         ut_sai_port_api.set_port_attribute = _ut_stub_sai_set_port_attribute;
+        ut_sai_port_api.set_ports_attribute = _ut_stub_sai_set_ports_attribute;
         sai_port_api = &ut_sai_port_api;
     }
 
@@ -749,6 +790,90 @@ namespace portsorch_test
         ASSERT_TRUE(keys.empty());
     }
 
+    /*
+     * Ports are initialized in bulk: the QoS object counts, lists and the
+     * maximum headroom of all the ports are fetched with one bulk get each
+     */
+    TEST_F(PortsOrchTest, PortBulkInit)
+    {
+        auto portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+
+        static std::uint32_t bulkGetCount;
+        static std::uint32_t bulkGetObjectCount;
+        bulkGetCount = 0;
+        bulkGetObjectCount = 0;
+
+        auto orig_port_api = sai_port_api;
+        sai_port_api_t ut_port_api = *sai_port_api;
+        static sai_port_api_t *pbulk_orig_port_api;
+        pbulk_orig_port_api = orig_port_api;
+        ut_port_api.get_ports_attribute = [](
+            uint32_t object_count, const sai_object_id_t *object_id, uint32_t *attr_count,
+            sai_attribute_t **attr_list, sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses) -> sai_status_t
+        {
+            bulkGetCount++;
+            bulkGetObjectCount += object_count;
+            for (uint32_t i = 0; i < object_count; i++)
+            {
+                object_statuses[i] = pbulk_orig_port_api->get_port_attribute(object_id[i], attr_count[i], attr_list[i]);
+            }
+            return SAI_STATUS_SUCCESS;
+        };
+        sai_port_api = &ut_port_api;
+
+        // Get SAI default ports to populate DB
+        auto ports = ut_helper::getInitialSaiPorts();
+
+        // Populate port table with SAI ports
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+
+        // Set PortConfigDone
+        portTable.set("PortConfigDone", { { "count", std::to_string(ports.size()) } });
+
+        // Refill consumer
+        gPortsOrch->addExistingData(&portTable);
+
+        // Apply configuration
+        static_cast<Orch*>(gPortsOrch)->doTask();
+
+        sai_port_api = orig_port_api;
+
+        // Counts, object lists and maximum headroom of all the ports
+        ASSERT_EQ(bulkGetCount, 3);
+        ASSERT_GE(bulkGetObjectCount, 2 * ports.size());
+
+        auto bufferMaxParameterTable = Table(m_state_db.get(), STATE_BUFFER_MAXIMUM_VALUE_TABLE);
+
+        for (const auto &it : ports)
+        {
+            Port port;
+            ASSERT_TRUE(gPortsOrch->getPort(it.first, port));
+            ASSERT_NE(port.m_hif_id, SAI_NULL_OBJECT_ID);
+
+            sai_attribute_t attr;
+            attr.id = SAI_PORT_ATTR_QOS_NUMBER_OF_QUEUES;
+            ASSERT_EQ(sai_port_api->get_port_attribute(port.m_port_id, 1, &attr), SAI_STATUS_SUCCESS);
+            ASSERT_EQ(port.m_queue_ids.size(), attr.value.u32);
+            for (const auto &queue_id : port.m_queue_ids)
+            {
+                ASSERT_NE(queue_id, SAI_NULL_OBJECT_ID);
+            }
+
+            attr.id = SAI_PORT_ATTR_NUMBER_OF_INGRESS_PRIORITY_GROUPS;
+            ASSERT_EQ(sai_port_api->get_port_attribute(port.m_port_id, 1, &attr), SAI_STATUS_SUCCESS);
+            ASSERT_EQ(port.m_priority_group_ids.size(), attr.value.u32);
+
+            std::string value;
+            ASSERT_TRUE(bufferMaxParameterTable.hget(it.first, "max_queues", value));
+            ASSERT_EQ(value, std::to_string(port.m_queue_ids.size()));
+            ASSERT_TRUE(bufferMaxParameterTable.hget(it.first, "max_priority_groups", value));
+            ASSERT_EQ(value, std::to_string(port.m_priority_group_ids.size()));
+        }
+    }
+
     TEST_F(PortsOrchTest, PortBasicConfig)
     {
         auto portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
@@ -853,6 +978,145 @@ namespace portsorch_test
         cleanupPorts(gPortsOrch);
     }
 
+    /*
+     * MTU and admin status of all the ports of a batch are applied with
+     * a single bulk set each
+     */
+    TEST_F(PortsOrchTest, PortBulkAttributeSet)
+    {
+        auto portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+
+        // Get SAI default ports
+        auto &ports = defaultPortList;
+        ASSERT_TRUE(!ports.empty());
+
+        // Generate port config
+        for (const auto &cit : ports)
+        {
+            portTable.set(cit.first, cit.second);
+        }
+
+        // Set PortConfigDone
+        portTable.set("PortConfigDone", { { "count", std::to_string(ports.size()) } });
+
+        // Refill consumer
+        gPortsOrch->addExistingData(&portTable);
+
+        // Apply configuration
+        static_cast<Orch*>(gPortsOrch)->doTask();
+
+        // Generate port config
+        std::deque<KeyOpFieldsValuesTuple> kfvList;
+        for (const auto &cit : ports)
+        {
+            kfvList.push_back({ cit.first, SET_COMMAND, { { "mtu", "4321" }, { "admin_status", "down" } } });
+        }
+
+        // Refill consumer
+        auto consumer = dynamic_cast<Consumer*>(gPortsOrch->getExecutor(APP_PORT_TABLE_NAME));
+        consumer->addToSync(kfvList);
+
+        _hook_sai_port_api();
+        _sai_set_ports_attribute_count = 0;
+        uint32_t current_sai_api_call_count = _sai_set_admin_state_down_count;
+
+        // Apply configuration
+        static_cast<Orch*>(gPortsOrch)->doTask();
+
+        _unhook_sai_port_api();
+
+        // One bulk call for MTU and one for admin status
+        ASSERT_EQ(_sai_set_ports_attribute_count, 2);
+        ASSERT_EQ(_sai_set_admin_state_down_count, current_sai_api_call_count + ports.size());
+
+        for (const auto &cit : ports)
+        {
+            Port p;
+            ASSERT_TRUE(gPortsOrch->getPort(cit.first, p));
+            ASSERT_EQ(p.m_mtu, 4321);
+            ASSERT_FALSE(p.m_admin_state_up);
+        }
+
+        // Dump pending tasks
+        std::vector<std::string> taskList;
+        gPortsOrch->dumpPendingTasks(taskList);
+        ASSERT_TRUE(taskList.empty());
+    }
+
+    /*
+     * A port failing its bulk MTU set does not fail the other ports of the
+     * batch, and its admin status is still applied
+     */
+    TEST_F(PortsOrchTest, PortBulkAttributeSetFailure)
+    {
+        auto portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+
+        // Get SAI default ports
+        auto &ports = defaultPortList;
+        ASSERT_TRUE(!ports.empty());
+
+        // Generate port config
+        for (const auto &cit : ports)
+        {
+            portTable.set(cit.first, cit.second);
+        }
+
+        // Set PortConfigDone
+        portTable.set("PortConfigDone", { { "count", std::to_string(ports.size()) } });
+
+        // Refill consumer
+        gPortsOrch->addExistingData(&portTable);
+
+        // Apply configuration
+        static_cast<Orch*>(gPortsOrch)->doTask();
+
+        Port failed;
+        ASSERT_TRUE(gPortsOrch->getPort("Ethernet0", failed));
+
+        // Generate port config
+        std::deque<KeyOpFieldsValuesTuple> kfvList;
+        for (const auto &cit : ports)
+        {
+            kfvList.push_back({ cit.first, SET_COMMAND, { { "mtu", "4321" }, { "admin_status", "down" } } });
+        }
+
+        // Refill consumer
+        auto consumer = dynamic_cast<Consumer*>(gPortsOrch->getExecutor(APP_PORT_TABLE_NAME));
+        consumer->addToSync(kfvList);
+
+        _hook_sai_port_api();
+        _sai_set_ports_attribute_count = 0;
+        set_port_mtu_failures = 0;
+        set_port_mtu_fail_oid = failed.m_port_id;
+        uint32_t current_sai_api_call_count = _sai_set_admin_state_down_count;
+
+        // Apply configuration
+        static_cast<Orch*>(gPortsOrch)->doTask();
+
+        set_port_mtu_fail_oid = SAI_NULL_OBJECT_ID;
+        _unhook_sai_port_api();
+
+        ASSERT_EQ(_sai_set_ports_attribute_count, 2);
+        ASSERT_EQ(set_port_mtu_failures, 1);
+        ASSERT_EQ(_sai_set_admin_state_down_count, current_sai_api_call_count + ports.size());
+
+        for (const auto &cit : ports)
+        {
+            Port p;
+            ASSERT_TRUE(gPortsOrch->getPort(cit.first, p));
+            ASSERT_FALSE(p.m_admin_state_up);
+            if (cit.first != failed.m_alias)
+            {
+                ASSERT_EQ(p.m_mtu, 4321);
+            }
+        }
+
+        // An invalid MTU is not retried, and the applied attributes are not replayed
+        std::vector<std::string> taskList;
+        gPortsOrch->dumpPendingTasks(taskList);
+        ASSERT_TRUE(taskList.empty());
+    }
+
     TEST_F(PortsOrchTest, PortAdvancedConfig)
     {
         auto portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
@@ -1140,6 +1404,13 @@ namespace portsorch_test
         ASSERT_TRUE(gPortsOrch->getPort("Ethernet0", port));
         ASSERT_NE(port.m_port_id, SAI_NULL_OBJECT_ID);
 
+        // Non-copying lookups resolve to the same entry by alias and by OID
+        auto portPtr = gPortsOrch->getPortPtr("Ethernet0");
+        ASSERT_NE(portPtr, nullptr);
+        ASSERT_EQ(portPtr, gPortsOrch->getPortPtr(port.m_port_id));
+        ASSERT_EQ(portPtr->m_alias, "Ethernet0");
+        ASSERT_EQ(gPortsOrch->getPortPtr("Ethernet1000"), nullptr);
+
         // Get queue info
         string type;
         uint8_t index;
@@ -1163,6 +1434,8 @@ namespace portsorch_test
         entries.clear();
 
         ASSERT_FALSE(gPortsOrch->getPort(port.m_port_id, port));
+        ASSERT_EQ(gPortsOrch->getPortPtr(port.m_port_id), nullptr);
+        ASSERT_EQ(gPortsOrch->getPortPtr("Ethernet0"), nullptr);
         ASSERT_EQ(gPortsOrch->m_queueInfo.find(queue_id), gPortsOrch->m_queueInfo.end());
         _unhook_sai_queue_api();
     }
@@ -2535,6 +2808,55 @@ namespace portsorch_test
         }
     }
 
+    TEST_F(PortsOrchTest, PortWarmBakePrefetchedData)
+    {
+        Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+        Table lagTable = Table(m_app_db.get(), APP_LAG_TABLE_NAME);
+
+        auto ports = ut_helper::getInitialSaiPorts();
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+        portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+        portTable.set("PortInitDone", { { "lanes", "0" } });
+
+        lagTable.set("PortChannel0001", { { "admin_status", "up" }, { "mtu", "9100" } });
+
+        OrchDaemon::prefetchWarmData({ gPortsOrch });
+
+        // Only the tables bake() refills by name are read ahead
+        auto portConsumer = dynamic_cast<Consumer *>(gPortsOrch->getExecutor(APP_PORT_TABLE_NAME));
+        auto lagConsumer = dynamic_cast<Consumer *>(gPortsOrch->getExecutor(APP_LAG_TABLE_NAME));
+        ASSERT_EQ(portConsumer->getSnapshotEntries(), 0);
+        ASSERT_EQ(lagConsumer->getSnapshotEntries(), 1);
+
+        // bake() replays the read ahead data, not the table as it is now
+        lagTable.set("PortChannel0002", { { "admin_status", "up" }, { "mtu", "9100" } });
+
+        ASSERT_TRUE(gPortsOrch->bake());
+
+        ASSERT_EQ(portConsumer->m_toSync.size(), ports.size() + 2);
+        ASSERT_EQ(lagConsumer->m_toSync.size(), 1);
+        ASSERT_EQ(lagConsumer->m_toSync.count("PortChannel0001"), 1);
+
+        // The read ahead data is used once, a later refill reads the table
+        lagConsumer->m_toSync.clear();
+        ASSERT_EQ(lagConsumer->refillToSync(), 2);
+        ASSERT_EQ(lagConsumer->m_toSync.size(), 2);
+
+        // A refill of a given table drops unused read ahead data
+        lagConsumer->m_toSync.clear();
+        lagConsumer->setPrefetchedData({ KeyOpFieldsValuesTuple{ "PortChannel0003", SET_COMMAND, {} } });
+        ASSERT_EQ(lagConsumer->refillToSync(&lagTable), 2);
+        lagConsumer->m_toSync.clear();
+        ASSERT_EQ(lagConsumer->refillToSync(), 2);
+        ASSERT_EQ(lagConsumer->m_toSync.count("PortChannel0003"), 0);
+
+        lagConsumer->m_toSync.clear();
+        portConsumer->m_toSync.clear();
+    }
+
     TEST_F(PortsOrchTest, PfcDlrHandlerCallingDlrInitAttribute)
     {
         _hook_sai_port_api();
@@ -2738,6 +3060,149 @@ namespace portsorch_test
 	_unhook_sai_switch_api();
     }
 
+    /*
+     * Drive a storm and its restoration through the native PFC watchdog detector:
+     * the orch reads the counters in one pipeline on each poll and starts and stops
+     * the storm action on the queue.
+     */
+    TEST_F(PortsOrchTest, PfcWdDetectorPollStormAndRestore)
+    {
+        _hook_sai_port_api();
+        _hook_sai_queue_api();
+        auto pfcwdOrch = gPfcwdOrch<PfcWdDlrHandler, PfcWdDlrHandler>;
+        Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+        Table countersTable = Table(m_counters_db.get(), COUNTERS_TABLE);
+        Table stormTable = Table(m_app_db.get(), APP_PFC_WD_TABLE_NAME "_INSTORM");
+
+        // Get SAI default ports to populate DB
+        auto ports = ut_helper::getInitialSaiPorts();
+
+        // Populate port table with SAI ports
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+
+        // Set PortConfigDone, PortInitDone
+        portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+        portTable.set("PortInitDone", { { "lanes", "0" } });
+
+        // refill consumer
+        gPortsOrch->addExistingData(&portTable);
+
+        // Apply configuration :
+        //  create ports
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        // Apply configuration
+        //          ports
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        ASSERT_TRUE(gPortsOrch->allPortsReady());
+
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        entries.push_back({"Ethernet0", "SET",
+                          {
+                            {"pfc_enable", "3,4"},
+                            {"pfcwd_sw_enable", "3,4"}
+                          }});
+        auto portQosMapConsumer = dynamic_cast<Consumer *>(gQosOrch->getExecutor(CFG_PORT_QOS_MAP_TABLE_NAME));
+        portQosMapConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gQosOrch)->doTask();
+
+        // Watch the queues with the vs model, polled every 100ms
+        pfcwdOrch->m_detector = PfcWdDetector::create("vs");
+        pfcwdOrch->m_detector->setPollInterval(100 * 1000);
+
+        entries.push_back({"Ethernet0", "SET",
+                          {
+                            {"action", "drop"},
+                            {"detection_time", "200"},
+                            {"restoration_time", "200"}
+                          }});
+        auto pfcwdConsumer = dynamic_cast<Consumer *>(pfcwdOrch->getExecutor(CFG_PFC_WD_TABLE_NAME));
+        pfcwdConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(pfcwdOrch)->doTask();
+        ASSERT_EQ(pfcwdOrch->m_detector->getQueues().size(), 2);
+
+        Port port;
+        gPortsOrch->getPort("Ethernet0", port);
+        sai_object_id_t stormQueue = port.m_queue_ids[3];
+        sai_object_id_t idleQueue = port.m_queue_ids[4];
+
+        uint64_t pfcRxPackets = 0, pfcDuration = 0, packets = 0;
+        auto poll = [&](bool storm)
+        {
+            if (storm)
+            {
+                pfcRxPackets += 1000;
+                pfcDuration += 100 * 1000;
+            }
+            else
+            {
+                packets += 500;
+            }
+
+            countersTable.set(sai_serialize_object_id(stormQueue), {
+                    { "SAI_QUEUE_STAT_PACKETS", to_string(packets) },
+                    { "SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES", storm ? "9216" : "0" } });
+            countersTable.set(sai_serialize_object_id(port.m_port_id), {
+                    { "SAI_PORT_STAT_PFC_3_RX_PKTS", to_string(pfcRxPackets) },
+                    { "SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION_US", to_string(pfcDuration) },
+                    { "SAI_PORT_STAT_PFC_4_RX_PKTS", "0" },
+                    { "SAI_PORT_STAT_PFC_4_RX_PAUSE_DURATION_US", "0" } });
+            // The other queue keeps transmitting
+            countersTable.set(sai_serialize_object_id(idleQueue), {
+                    { "SAI_QUEUE_STAT_PACKETS", to_string(pfcRxPackets + packets) },
+                    { "SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES", "0" } });
+
+            pfcwdOrch->pollDetector();
+        };
+
+        auto inStorm = [&](sai_object_id_t queue)
+        {
+            string status;
+            bool stored = stormTable.hget("Ethernet0", to_string(pfcwdOrch->m_entryMap.at(queue).index), status);
+            EXPECT_EQ(stored, pfcwdOrch->m_entryMap.at(queue).handler != nullptr);
+            return stored && status == "storm";
+        };
+
+        uint8_t pfcMask = 0;
+        ASSERT_TRUE(gPortsOrch->getPortPfc(port.m_port_id, &pfcMask));
+        ASSERT_EQ(pfcMask, 0x18);
+
+        // The first sample only sets the last values, the storm is detected after the detection time
+        poll(true);
+        poll(true);
+        ASSERT_FALSE(inStorm(stormQueue));
+        poll(true);
+        ASSERT_TRUE(inStorm(stormQueue));
+        ASSERT_FALSE(inStorm(idleQueue));
+        ASSERT_TRUE(gPortsOrch->getPortPfc(port.m_port_id, &pfcMask));
+        ASSERT_EQ(pfcMask, 0x10);
+
+        // Restored once no pause frame is received for the restoration time
+        poll(true);
+        poll(false);
+        ASSERT_TRUE(inStorm(stormQueue));
+        poll(false);
+        ASSERT_FALSE(inStorm(stormQueue));
+        ASSERT_FALSE(inStorm(idleQueue));
+        ASSERT_TRUE(gPortsOrch->getPortPfc(port.m_port_id, &pfcMask));
+        ASSERT_EQ(pfcMask, 0x18);
+
+        entries.push_back({"Ethernet0", "DEL", {{}}});
+        pfcwdConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(pfcwdOrch)->doTask();
+        ASSERT_TRUE(pfcwdOrch->m_detector->getQueues().empty());
+
+        _unhook_sai_queue_api();
+        _unhook_sai_port_api();
+    }
+
     TEST_F(PortsOrchTest, PfcZeroBufferHandler)
     {
         Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
@@ -2849,6 +3314,269 @@ namespace portsorch_test
         ts.clear();
     }
 
+    TEST_F(PortsOrchTest, PfcZeroBufferHandlerRestoresSnapshotProfile)
+    {
+        Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+        Table profileTable = Table(m_app_db.get(), APP_BUFFER_PROFILE_TABLE_NAME);
+        Table poolTable = Table(m_app_db.get(), APP_BUFFER_POOL_TABLE_NAME);
+        Table queueTable = Table(m_app_db.get(), APP_BUFFER_QUEUE_TABLE_NAME);
+
+        auto ports = ut_helper::getInitialSaiPorts();
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+        portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+        portTable.set("PortInitDone", { { "lanes", "0" } });
+        gPortsOrch->addExistingData(&portTable);
+        static_cast<Orch *>(gPortsOrch)->doTask();
+        static_cast<Orch *>(gPortsOrch)->doTask();
+        ASSERT_TRUE(gPortsOrch->allPortsReady());
+
+        poolTable.set("egress_pool", { { "type", "egress" },
+                                       { "mode", "dynamic" },
+                                       { "size", "4200000" } });
+        profileTable.set("egress_profile", { { "pool", "egress_pool" },
+                                             { "size", "0" },
+                                             { "dynamic_th", "0" } });
+        profileTable.set("egress_profile_new", { { "pool", "egress_pool" },
+                                                 { "size", "1518" },
+                                                 { "dynamic_th", "0" } });
+        queueTable.set("Ethernet0:3", { { "profile", "egress_profile" } });
+        gBufferOrch->addExistingData(&poolTable);
+        gBufferOrch->addExistingData(&profileTable);
+        gBufferOrch->addExistingData(&queueTable);
+        static_cast<Orch *>(gBufferOrch)->doTask();
+
+        Port port;
+        gPortsOrch->getPort("Ethernet0", port);
+        sai_object_id_t queue = port.m_queue_ids[3];
+
+        auto getQueueProfile = [queue]()
+        {
+            sai_attribute_t attr;
+            attr.id = SAI_QUEUE_ATTR_BUFFER_PROFILE_ID;
+            EXPECT_EQ(sai_queue_api->get_queue_attribute(queue, 1, &attr), SAI_STATUS_SUCCESS);
+            return attr.value.oid;
+        };
+
+        sai_object_id_t originalProfile = getQueueProfile();
+        ASSERT_NE(originalProfile, SAI_NULL_OBJECT_ID);
+
+        // The watchdog starts on the queue
+        PfcWdZeroBufferHandler::snapshotQueueBufferProfiles({ queue });
+
+        auto countersTable = make_shared<Table>(m_counters_db.get(), COUNTERS_TABLE);
+        shared_ptr<PfcWdZeroBufferHandler> dropHandler;
+        {
+            PfcWdActionBatch batch;
+            dropHandler = make_shared<PfcWdZeroBufferHandler>(port.m_port_id, queue, 3, countersTable);
+
+            // The profile to restore is known before the batch is flushed
+            ASSERT_TRUE(dropHandler->m_originalQueueBufferProfile->zeroBufferProfileSet);
+            ASSERT_EQ(dropHandler->m_originalQueueBufferProfile->profile, originalProfile);
+        }
+        ASSERT_NE(getQueueProfile(), originalProfile);
+        gPortsOrch->getPort("Ethernet0", port);
+        ASSERT_TRUE(port.m_queue_lock[3]);
+
+        {
+            PfcWdActionBatch batch;
+            dropHandler.reset();
+        }
+        ASSERT_EQ(getQueueProfile(), originalProfile);
+        gPortsOrch->getPort("Ethernet0", port);
+        ASSERT_FALSE(port.m_queue_lock[3]);
+
+        // The profile BufferOrch applies afterwards is the one restored after the next storm
+        queueTable.set("Ethernet0:3", { { "profile", "egress_profile_new" } });
+        gBufferOrch->addExistingData(&queueTable);
+        static_cast<Orch *>(gBufferOrch)->doTask();
+
+        sai_object_id_t newProfile = getQueueProfile();
+        ASSERT_NE(newProfile, originalProfile);
+
+        dropHandler = make_shared<PfcWdZeroBufferHandler>(port.m_port_id, queue, 3, countersTable);
+        dropHandler.reset();
+        ASSERT_EQ(getQueueProfile(), newProfile);
+
+        // No buffer profile on the queue is restored as well
+        sai_attribute_t attr;
+        attr.id = SAI_QUEUE_ATTR_BUFFER_PROFILE_ID;
+        attr.value.oid = SAI_NULL_OBJECT_ID;
+        ASSERT_EQ(sai_queue_api->set_queue_attribute(queue, &attr), SAI_STATUS_SUCCESS);
+        PfcWdZeroBufferHandler::updateQueueBufferProfile(queue, SAI_NULL_OBJECT_ID);
+
+        dropHandler = make_shared<PfcWdZeroBufferHandler>(port.m_port_id, queue, 3, countersTable);
+        ASSERT_NE(getQueueProfile(), SAI_NULL_OBJECT_ID);
+        dropHandler.reset();
+        ASSERT_EQ(getQueueProfile(), SAI_NULL_OBJECT_ID);
+
+        PfcWdZeroBufferHandler::clearQueueBufferProfiles({ queue });
+    }
+
+    /*
+     * The storm actions of the queues of one detection cycle are programmed together:
+     * the buffer profiles with bulk calls, or per queue if bulk is not available,
+     * and the PFC mask once per port. A queue whose zero buffer profile fails to be set
+     * keeps its own profile and is released as is.
+     */
+    TEST_F(PortsOrchTest, PfcWdActionBatchZeroBufferHandlers)
+    {
+        _hook_sai_port_api();
+        Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+        Table profileTable = Table(m_app_db.get(), APP_BUFFER_PROFILE_TABLE_NAME);
+        Table poolTable = Table(m_app_db.get(), APP_BUFFER_POOL_TABLE_NAME);
+        Table queueTable = Table(m_app_db.get(), APP_BUFFER_QUEUE_TABLE_NAME);
+
+        auto ports = ut_helper::getInitialSaiPorts();
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+        portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+        portTable.set("PortInitDone", { { "lanes", "0" } });
+        gPortsOrch->addExistingData(&portTable);
+        static_cast<Orch *>(gPortsOrch)->doTask();
+        static_cast<Orch *>(gPortsOrch)->doTask();
+        ASSERT_TRUE(gPortsOrch->allPortsReady());
+
+        poolTable.set("egress_pool", { { "type", "egress" },
+                                       { "mode", "dynamic" },
+                                       { "size", "4200000" } });
+        profileTable.set("egress_profile", { { "pool", "egress_pool" },
+                                             { "size", "0" },
+                                             { "dynamic_th", "0" } });
+        queueTable.set("Ethernet0:3-4", { { "profile", "egress_profile" } });
+        gBufferOrch->addExistingData(&poolTable);
+        gBufferOrch->addExistingData(&profileTable);
+        gBufferOrch->addExistingData(&queueTable);
+        static_cast<Orch *>(gBufferOrch)->doTask();
+
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        entries.push_back({"Ethernet0", "SET", { {"pfc_enable", "3,4"} }});
+        auto portQosMapConsumer = dynamic_cast<Consumer *>(gQosOrch->getExecutor(CFG_PORT_QOS_MAP_TABLE_NAME));
+        portQosMapConsumer->addToSync(entries);
+        static_cast<Orch *>(gQosOrch)->doTask();
+
+        Port port;
+        gPortsOrch->getPort("Ethernet0", port);
+        const vector<uint8_t> indexes = { 3, 4 };
+
+        auto getQueueProfile = [&port](uint8_t index)
+        {
+            sai_attribute_t attr;
+            attr.id = SAI_QUEUE_ATTR_BUFFER_PROFILE_ID;
+            EXPECT_EQ(sai_queue_api->get_queue_attribute(port.m_queue_ids[index], 1, &attr), SAI_STATUS_SUCCESS);
+            return attr.value.oid;
+        };
+        auto isLocked = [&port](uint8_t index)
+        {
+            gPortsOrch->getPort("Ethernet0", port);
+            return port.m_queue_lock[index];
+        };
+        auto getPfcMask = [&port]()
+        {
+            uint8_t pfcMask = 0;
+            EXPECT_TRUE(gPortsOrch->getPortPfc(port.m_port_id, &pfcMask));
+            return pfcMask;
+        };
+
+        sai_object_id_t originalProfile = getQueueProfile(3);
+        ASSERT_NE(originalProfile, SAI_NULL_OBJECT_ID);
+        ASSERT_EQ(getQueueProfile(4), originalProfile);
+        ASSERT_EQ(getPfcMask(), 0x18);
+
+        sai_object_id_t zeroProfile = PfcWdZeroBufferHandler::ZeroBufferProfile::getZeroBufferProfile();
+        ASSERT_NE(zeroProfile, SAI_NULL_OBJECT_ID);
+
+        auto countersTable = make_shared<Table>(m_counters_db.get(), COUNTERS_TABLE);
+
+        // Bulk calls first, then per queue calls as if the SAI didn't implement them
+        for (bool bulk : { true, false })
+        {
+            PfcWdActionBatch::m_isBulkGetSupported = bulk;
+            PfcWdActionBatch::m_isBulkSetSupported = bulk;
+
+            vector<shared_ptr<PfcWdZeroBufferHandler>> handlers;
+            auto pfcCount = _sai_set_port_pfc_count;
+            {
+                PfcWdActionBatch batch;
+                for (auto index : indexes)
+                {
+                    handlers.push_back(make_shared<PfcWdZeroBufferHandler>(port.m_port_id, port.m_queue_ids[index], index, countersTable));
+                }
+
+                // Nothing is programmed until the batch is flushed
+                ASSERT_EQ(getQueueProfile(3), originalProfile);
+                ASSERT_EQ(_sai_set_port_pfc_count, pfcCount);
+            }
+            for (auto index : indexes)
+            {
+                ASSERT_EQ(getQueueProfile(index), zeroProfile);
+                ASSERT_TRUE(isLocked(index));
+            }
+            // One PFC mask for both priorities of the port
+            ASSERT_EQ(_sai_set_port_pfc_count, pfcCount + 1);
+            ASSERT_EQ(getPfcMask(), 0);
+
+            {
+                PfcWdActionBatch batch;
+                handlers.clear();
+            }
+            for (auto index : indexes)
+            {
+                ASSERT_EQ(getQueueProfile(index), originalProfile);
+                ASSERT_FALSE(isLocked(index));
+            }
+            ASSERT_EQ(_sai_set_port_pfc_count, pfcCount + 2);
+            ASSERT_EQ(getPfcMask(), 0x18);
+
+            // A handler removed before the batch is flushed settles its queue first
+            {
+                PfcWdActionBatch batch;
+                auto handler = make_shared<PfcWdZeroBufferHandler>(port.m_port_id, port.m_queue_ids[3], 3, countersTable);
+                handler.reset();
+            }
+            ASSERT_EQ(getQueueProfile(3), originalProfile);
+            ASSERT_FALSE(isLocked(3));
+            ASSERT_EQ(getPfcMask(), 0x18);
+
+            // The SAI rejects a zero buffer profile which is not a buffer profile
+            PfcWdZeroBufferHandler::ZeroBufferProfile::getInstance().getProfile() = port.m_port_id;
+            {
+                PfcWdActionBatch batch;
+                for (auto index : indexes)
+                {
+                    handlers.push_back(make_shared<PfcWdZeroBufferHandler>(port.m_port_id, port.m_queue_ids[index], index, countersTable));
+                }
+            }
+            PfcWdZeroBufferHandler::ZeroBufferProfile::getInstance().getProfile() = zeroProfile;
+
+            for (size_t i = 0; i < indexes.size(); i++)
+            {
+                ASSERT_EQ(getQueueProfile(indexes[i]), originalProfile);
+                ASSERT_FALSE(handlers[i]->m_originalQueueBufferProfile->zeroBufferProfileSet);
+                ASSERT_TRUE(isLocked(indexes[i]));
+            }
+
+            {
+                PfcWdActionBatch batch;
+                handlers.clear();
+            }
+            for (auto index : indexes)
+            {
+                ASSERT_EQ(getQueueProfile(index), originalProfile);
+                ASSERT_FALSE(isLocked(index));
+            }
+            ASSERT_EQ(getPfcMask(), 0x18);
+        }
+
+        PfcWdActionBatch::m_isBulkGetSupported = true;
+        PfcWdActionBatch::m_isBulkSetSupported = true;
+        _unhook_sai_port_api();
+    }
+
     /* This test checks that a LAG member validation happens on orchagent level
      * and no SAI call is executed in case a port requested to be a LAG member
      * is already a LAG member.
@@ -7,6 +7,7 @@
 #include "ut_helper.h"
 #include "mock_orchagent_main.h"
 #include "mock_table.h"
+#include "mock_sai_bulk.h"
 
 extern string gMySwitchType;
 
@@ -1626,4 +1627,151 @@ namespace qosorch_test
         static_cast<Orch *>(tunnel_decap_orch)->doTask();
         entries.clear();
     }
+
+    /*
+     * Verify the QoS maps and queue settings of several ports in a batch are applied with bulk calls,
+     * or one by one if bulk is not supported, and the scheduler groups of all the ports are loaded
+     * ahead of handling QUEUE table
+     */
+    TEST_F(QosOrchTest, QosOrchTestBulkPortQosMapAndQueue)
+    {
+        vector<string> ts;
+        std::deque<KeyOpFieldsValuesTuple> entries;
+
+        auto dscpToTcMap = (*QosOrch::getTypeMap()[CFG_DSCP_TO_TC_MAP_TABLE_NAME])["AZURE"].m_saiObjectId;
+        auto tcToQueueMap = (*QosOrch::getTypeMap()[CFG_TC_TO_QUEUE_MAP_TABLE_NAME])["AZURE"].m_saiObjectId;
+        auto wredProfile = (*QosOrch::getTypeMap()[CFG_WRED_PROFILE_TABLE_NAME])["AZURE_LOSSLESS"].m_saiObjectId;
+
+        auto checkPortQosMap = [](const string &alias, sai_attr_id_t id, sai_object_id_t map)
+        {
+            Port port;
+            ASSERT_TRUE(gPortsOrch->getPort(alias, port));
+            sai_attribute_t attr;
+            attr.id = id;
+            ASSERT_EQ(sai_port_api->get_port_attribute(port.m_port_id, 1, &attr), SAI_STATUS_SUCCESS);
+            ASSERT_EQ(attr.value.oid, map);
+        };
+
+        entries.push_back({"Ethernet0,Ethernet4", "SET",
+                           {
+                               {"dscp_to_tc_map", "AZURE"},
+                               {"tc_to_queue_map", "AZURE"}
+                           }});
+        entries.push_back({"Ethernet8", "SET",
+                           {
+                               {"dscp_to_tc_map", "AZURE"}
+                           }});
+        auto portQosMapConsumer = dynamic_cast<Consumer *>(gQosOrch->getExecutor(CFG_PORT_QOS_MAP_TABLE_NAME));
+        portQosMapConsumer->addToSync(entries);
+        entries.clear();
+
+        entries.push_back({"Ethernet0,Ethernet4|3-4", "SET",
+                           {
+                               {"scheduler", "scheduler.1"},
+                               {"wred_profile", "AZURE_LOSSLESS"}
+                           }});
+        auto queueConsumer = dynamic_cast<Consumer *>(gQosOrch->getExecutor(CFG_QUEUE_TABLE_NAME));
+        queueConsumer->addToSync(entries);
+        entries.clear();
+
+        // The maps of the 3 ports in one call
+        _sai_bulk_object_set_attribute_count = 0;
+        gQosOrch->doTask(*portQosMapConsumer);
+        ASSERT_EQ(_sai_bulk_object_set_attribute_count, 1);
+
+        static_cast<Orch *>(gQosOrch)->doTask();
+
+        static_cast<Orch *>(gQosOrch)->dumpPendingTasks(ts);
+        ASSERT_TRUE(ts.empty());
+        ASSERT_TRUE(gQosOrch->m_qosBulkTasks.empty());
+
+        for (const auto &alias : { "Ethernet0", "Ethernet4" })
+        {
+            checkPortQosMap(alias, SAI_PORT_ATTR_QOS_DSCP_TO_TC_MAP, dscpToTcMap);
+            checkPortQosMap(alias, SAI_PORT_ATTR_QOS_TC_TO_QUEUE_MAP, tcToQueueMap);
+
+            Port port;
+            ASSERT_TRUE(gPortsOrch->getPort(alias, port));
+            for (size_t index = 3; index <= 4; index++)
+            {
+                sai_attribute_t attr;
+                attr.id = SAI_QUEUE_ATTR_WRED_PROFILE_ID;
+                ASSERT_EQ(sai_queue_api->get_queue_attribute(port.m_queue_ids[index], 1, &attr), SAI_STATUS_SUCCESS);
+                ASSERT_EQ(attr.value.oid, wredProfile);
+                ASSERT_NE(gQosOrch->getSchedulerGroup(port, port.m_queue_ids[index]), SAI_NULL_OBJECT_ID);
+            }
+        }
+        checkPortQosMap("Ethernet8", SAI_PORT_ATTR_QOS_DSCP_TO_TC_MAP, dscpToTcMap);
+        CheckDependency(CFG_QUEUE_TABLE_NAME, "Ethernet0,Ethernet4|3-4", "wred_profile", CFG_WRED_PROFILE_TABLE_NAME, "AZURE_LOSSLESS");
+
+        // Scheduler groups of all the ports have been loaded, not only the ones configured
+        ASSERT_TRUE(gQosOrch->m_schedulerGroupsPreloaded);
+        size_t physicalPortCount = 0;
+        for (const auto &it : gPortsOrch->getAllPorts())
+        {
+            if (it.second.m_type == Port::PHY)
+            {
+                physicalPortCount++;
+                ASSERT_NE(gQosOrch->m_scheduler_group_port_info.find(it.second.m_port_id), gQosOrch->m_scheduler_group_port_info.end());
+            }
+        }
+        ASSERT_EQ(gQosOrch->m_scheduler_group_port_info.size(), physicalPortCount);
+
+        // DEL followed by SET of the same key in one batch, the DEL is completed first
+        entries.push_back({"Ethernet0,Ethernet4", "DEL", {}});
+        entries.push_back({"Ethernet0,Ethernet4", "SET",
+                           {
+                               {"dscp_to_tc_map", "AZURE"}
+                           }});
+        portQosMapConsumer->addToSync(entries);
+        entries.clear();
+        _sai_bulk_object_set_attribute_count = 0;
+        static_cast<Orch *>(gQosOrch)->doTask();
+        ASSERT_EQ(_sai_bulk_object_set_attribute_count, 2);
+
+        static_cast<Orch *>(gQosOrch)->dumpPendingTasks(ts);
+        ASSERT_TRUE(ts.empty());
+        for (const auto &alias : { "Ethernet0", "Ethernet4" })
+        {
+            checkPortQosMap(alias, SAI_PORT_ATTR_QOS_DSCP_TO_TC_MAP, dscpToTcMap);
+            checkPortQosMap(alias, SAI_PORT_ATTR_QOS_TC_TO_QUEUE_MAP, SAI_NULL_OBJECT_ID);
+        }
+        CheckDependency(CFG_PORT_QOS_MAP_TABLE_NAME, "Ethernet0,Ethernet4", "dscp_to_tc_map", CFG_DSCP_TO_TC_MAP_TABLE_NAME, "AZURE");
+        CheckDependency(CFG_PORT_QOS_MAP_TABLE_NAME, "Ethernet0,Ethernet4", "tc_to_queue_map", CFG_TC_TO_QUEUE_MAP_TABLE_NAME);
+
+        // Bulk set is not supported, the maps are set one by one from now on
+        _sai_bulk_object_set_attribute_status = SAI_STATUS_NOT_IMPLEMENTED;
+        _sai_bulk_object_set_attribute_count = 0;
+        entries.push_back({"Ethernet0,Ethernet4", "SET",
+                           {
+                               {"dscp_to_tc_map", "AZURE"},
+                               {"tc_to_queue_map", "AZURE"}
+                           }});
+        portQosMapConsumer->addToSync(entries);
+        entries.clear();
+        gQosOrch->doTask(*portQosMapConsumer);
+        ASSERT_EQ(_sai_bulk_object_set_attribute_count, 1);
+        ASSERT_FALSE(gQosOrch->m_isBulkSetSupported);
+
+        entries.push_back({"Ethernet8", "SET",
+                           {
+                               {"dscp_to_tc_map", "AZURE"},
+                               {"tc_to_queue_map", "AZURE"}
+                           }});
+        portQosMapConsumer->addToSync(entries);
+        entries.clear();
+        gQosOrch->doTask(*portQosMapConsumer);
+        ASSERT_EQ(_sai_bulk_object_set_attribute_count, 1);
+
+        _sai_bulk_object_set_attribute_status = SAI_STATUS_SUCCESS;
+        gQosOrch->m_isBulkSetSupported = true;
+
+        static_cast<Orch *>(gQosOrch)->dumpPendingTasks(ts);
+        ASSERT_TRUE(ts.empty());
+        for (const auto &alias : { "Ethernet0", "Ethernet4", "Ethernet8" })
+        {
+            checkPortQosMap(alias, SAI_PORT_ATTR_QOS_DSCP_TO_TC_MAP, dscpToTcMap);
+            checkPortQosMap(alias, SAI_PORT_ATTR_QOS_TC_TO_QUEUE_MAP, tcToQueueMap);
+        }
+    }
 }
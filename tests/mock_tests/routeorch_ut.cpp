@@ -452,6 +452,45 @@ namespace routeorch_test
         ASSERT_EQ(sai_fail_count, 0);
     }
 
+    TEST_F(RouteOrchTest, RouteOrchTestResyncRemovesOnlyStaleRoutes)
+    {
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        entries.push_back({"2.2.2.0/24", "SET", { {"ifname", "Ethernet0"},
+                                                  {"nexthop", "10.0.0.2"}}});
+        auto consumer = dynamic_cast<Consumer *>(gRouteOrch->getExecutor(APP_ROUTE_TABLE_NAME));
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+        ASSERT_EQ(gRouteOrch->m_syncdRoutes[gVirtualRouterId].count(IpPrefix("2.2.2.0/24")), 1);
+
+        // Starting a resync must not queue anything
+        entries.clear();
+        entries.push_back({"resync", "SET", { {} }});
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+        ASSERT_TRUE(consumer->m_toSync.empty());
+
+        // Only 1.1.1.0/24 is re-announced before the resync completes
+        entries.clear();
+        entries.push_back({"1.1.1.0/24", "SET", { {"ifname", "Ethernet0"},
+                                                  {"nexthop", "10.0.0.2"}}});
+        entries.push_back({"resync", "DEL", { {} }});
+        consumer->addToSync(entries);
+
+        auto current_create_count = create_route_count;
+        auto current_remove_count = remove_route_count;
+
+        static_cast<Orch *>(gRouteOrch)->doTask();
+        static_cast<Orch *>(gRouteOrch)->doTask();
+
+        ASSERT_TRUE(consumer->m_toSync.empty());
+        ASSERT_EQ(current_create_count, create_route_count);
+        ASSERT_EQ(current_remove_count + 1, remove_route_count);
+        ASSERT_EQ(gRouteOrch->m_syncdRoutes[gVirtualRouterId].count(IpPrefix("1.1.1.0/24")), 1);
+        ASSERT_EQ(gRouteOrch->m_syncdRoutes[gVirtualRouterId].count(IpPrefix("2.2.2.0/24")), 0);
+        // Default routes are kept, only reset to drop
+        ASSERT_EQ(gRouteOrch->m_syncdRoutes[gVirtualRouterId].count(IpPrefix("0.0.0.0/0")), 1);
+    }
+
     TEST_F(RouteOrchTest, RouteOrchTestSetDelResponse)
     {
         gMockResponsePublisher = std::make_unique<MockResponsePublisher>();
@@ -1,6 +1,11 @@
 #include "gtest/gtest.h"
 #include "../mock_table.h"
+#include "../fake_netlink.h"
+#include <netlink/errno.h>
+#include <linux/rtnetlink.h>
+#define private public
 #include "teammgr.h"
+#undef private
 
 extern int (*callback)(const std::string &cmd, std::string &stdout);
 extern std::vector<std::string> mockCallArgs;
@@ -20,6 +25,11 @@ int cb(const std::string &cmd, std::string &stdout)
     return 0;
 }
 
+int nlAdminDownFailure(const FakeNetlinkRequest &req)
+{
+    return (req.type == RTM_NEWLINK && req.ifname == "Ethernet0") ? -NLE_PERM : 0;
+}
+
 namespace teammgr_ut
 {
     struct TeamMgrTest : public ::testing::Test
@@ -54,6 +64,20 @@ namespace teammgr_ut
             cfg_lag_tables = tables;
             mockCallArgs.clear();
             callback = cb;
+            fakeNetlinkReset();
+        }
+
+        int countCalls(const std::string &pattern)
+        {
+            int count = 0;
+            for (const auto &cmd : mockCallArgs)
+            {
+                if (cmd.find(pattern) != std::string::npos)
+                {
+                    count++;
+                }
+            }
+            return count;
         }
     };
 
@@ -75,4 +99,49 @@ namespace teammgr_ut
         }
         ASSERT_EQ(kill_cmd_called, 1);
     }
-}
\ No newline at end of file
+
+    TEST_F(TeamMgrTest, testAddLagMemberNetlink)
+    {
+        swss::TeamMgr teammgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_lag_tables);
+        swss::Table cfg_lag_table = swss::Table(m_config_db.get(), CFG_LAG_TABLE_NAME);
+        cfg_lag_table.set("PortChannel2", { { "mtu", "9100" } });
+
+        ASSERT_EQ(teammgr.addLagMember("PortChannel2", "Ethernet0"), task_success);
+
+        // The member is brought down before teamd enslaves it, then set to its configured admin status
+        int linkRequests = 0;
+        for (const auto &req : fakeNetlinkRequests)
+        {
+            if (req.type == RTM_NEWLINK && req.ifname == "Ethernet0")
+            {
+                linkRequests++;
+            }
+        }
+        ASSERT_EQ(linkRequests, 2);
+        ASSERT_EQ(countCalls("port add \"Ethernet0\""), 1);
+        ASSERT_EQ(countCalls("link set"), 0);
+    }
+
+    TEST_F(TeamMgrTest, testAddLagMemberRetryOnAdminDownFailure)
+    {
+        swss::TeamMgr teammgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_lag_tables);
+        fakeNetlinkCallback = nlAdminDownFailure;
+
+        ASSERT_EQ(teammgr.addLagMember("PortChannel2", "Ethernet0"), task_need_retry);
+        ASSERT_EQ(countCalls("port add"), 0);
+    }
+
+    TEST_F(TeamMgrTest, testSetLagMtuRejectsInvalidValue)
+    {
+        swss::TeamMgr teammgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_lag_tables);
+        fakeNetlinkRequests.clear();
+
+        ASSERT_FALSE(teammgr.setLagMtu("PortChannel2", "9100abc"));
+        ASSERT_FALSE(teammgr.setLagMtu("PortChannel2", "-1"));
+        ASSERT_FALSE(teammgr.setLagMtu("PortChannel2", "99999999999"));
+        ASSERT_TRUE(fakeNetlinkRequests.empty());
+
+        ASSERT_TRUE(teammgr.setLagMtu("PortChannel2", "9100"));
+        ASSERT_EQ(fakeNetlinkRequests.size(), 1);
+    }
+}
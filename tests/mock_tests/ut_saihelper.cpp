@@ -91,6 +91,7 @@ namespace ut_helper
         sai_api_query(SAI_API_FDB, (void**)&sai_fdb_api);
         sai_api_query(SAI_API_TWAMP, (void**)&sai_twamp_api);
         sai_api_query(SAI_API_TAM, (void**)&sai_tam_api);
+        sai_api_query(SAI_API_NAT, (void**)&sai_nat_api);
 
         return SAI_STATUS_SUCCESS;
     }
@@ -122,6 +123,7 @@ namespace ut_helper
         sai_counter_api = nullptr;
         sai_twamp_api = nullptr;
         sai_tam_api = nullptr;
+        sai_nat_api = nullptr;
 
         return SAI_STATUS_SUCCESS;
     }
@@ -0,0 +1,139 @@
+#include "gtest/gtest.h"
+#include "../mock_table.h"
+#include "../fake_netlink.h"
+#include <netlink/errno.h>
+#include <linux/rtnetlink.h>
+#define private public
+#include "vlanmgr.h"
+#undef private
+
+extern int (*callback)(const std::string &cmd, std::string &stdout);
+extern std::vector<std::string> mockCallArgs;
+
+int vlanmgrShellCb(const std::string &cmd, std::string &stdout)
+{
+    mockCallArgs.push_back(cmd);
+    return 0;
+}
+
+int countNetlinkRequests(uint16_t type, uint8_t family, const std::string &ifname)
+{
+    int count = 0;
+    for (auto &req : fakeNetlinkRequests)
+    {
+        if (req.type == type && req.family == family && req.ifname == ifname)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+namespace vlanmgr_ut
+{
+    struct VlanMgrTest : public ::testing::Test
+    {
+        std::shared_ptr<swss::DBConnector> m_config_db;
+        std::shared_ptr<swss::DBConnector> m_app_db;
+        std::shared_ptr<swss::DBConnector> m_state_db;
+        std::vector<std::string> cfg_vlan_tables;
+
+        virtual void SetUp() override
+        {
+            testing_db::reset();
+            m_config_db = std::make_shared<swss::DBConnector>("CONFIG_DB", 0);
+            m_app_db = std::make_shared<swss::DBConnector>("APPL_DB", 0);
+            m_state_db = std::make_shared<swss::DBConnector>("STATE_DB", 0);
+
+            cfg_vlan_tables = {
+                CFG_VLAN_TABLE_NAME,
+                CFG_VLAN_MEMBER_TABLE_NAME,
+            };
+            mockCallArgs.clear();
+            callback = vlanmgrShellCb;
+
+            // The bridge is created by the shell in the constructor
+            fakeNetlinkReset();
+            fakeNetlinkAddLink("Bridge");
+            fakeNetlinkAddLink("Ethernet0");
+        }
+    };
+
+    TEST_F(VlanMgrTest, testAddHostVlanMemberNetlink)
+    {
+        swss::VlanMgr vlanmgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_vlan_tables);
+        mockCallArgs.clear();
+        fakeNetlinkRequests.clear();
+
+        ASSERT_TRUE(vlanmgr.addHostVlanMember(10, "Ethernet0", "untagged"));
+
+        // Enslaved to the bridge, default vlan removed and the vlan added, without forking
+        ASSERT_EQ(countNetlinkRequests(RTM_NEWLINK, AF_UNSPEC, "Ethernet0"), 1);
+        ASSERT_EQ(countNetlinkRequests(RTM_DELLINK, AF_BRIDGE, "Ethernet0"), 1);
+        ASSERT_EQ(countNetlinkRequests(RTM_SETLINK, AF_BRIDGE, "Ethernet0"), 1);
+        ASSERT_TRUE(mockCallArgs.empty());
+    }
+
+    TEST_F(VlanMgrTest, testAddHostVlanMemberUnknownPort)
+    {
+        swss::VlanMgr vlanmgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_vlan_tables);
+
+        EXPECT_THROW(vlanmgr.addHostVlanMember(10, "Ethernet4", "tagged"), std::runtime_error);
+    }
+
+    TEST_F(VlanMgrTest, testAddHostVlanMemberKernelFailure)
+    {
+        swss::VlanMgr vlanmgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_vlan_tables);
+        fakeNetlinkCallback = [](const FakeNetlinkRequest &req) {
+            return req.type == RTM_SETLINK ? -NLE_EXIST : 0;
+        };
+
+        EXPECT_THROW(vlanmgr.addHostVlanMember(10, "Ethernet0", "tagged"), std::runtime_error);
+    }
+
+    TEST_F(VlanMgrTest, testRemoveHostVlanMemberNetlink)
+    {
+        swss::VlanMgr vlanmgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_vlan_tables);
+        fakeNetlinkRequests.clear();
+
+        ASSERT_TRUE(vlanmgr.removeHostVlanMember(10, "Ethernet0"));
+
+        // No vlan is left on the port, so it is detached from the bridge
+        ASSERT_EQ(countNetlinkRequests(RTM_DELLINK, AF_BRIDGE, "Ethernet0"), 1);
+        ASSERT_EQ(countNetlinkRequests(RTM_GETLINK, AF_BRIDGE, ""), 1);
+        ASSERT_EQ(countNetlinkRequests(RTM_NEWLINK, AF_UNSPEC, "Ethernet0"), 1);
+    }
+
+    TEST_F(VlanMgrTest, testRemoveHostVlanMemberUnknownPort)
+    {
+        swss::VlanMgr vlanmgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_vlan_tables);
+        fakeNetlinkRequests.clear();
+
+        EXPECT_THROW(vlanmgr.removeHostVlanMember(10, "Ethernet4"), std::runtime_error);
+        ASSERT_TRUE(fakeNetlinkRequests.empty());
+    }
+
+    TEST_F(VlanMgrTest, testKernelBatchReportsEachRequest)
+    {
+        swss::VlanMgr vlanmgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_vlan_tables);
+        fakeNetlinkCallback = [](const FakeNetlinkRequest &req) {
+            return req.ifname == "Ethernet0" ? -NLE_INVAL : 0;
+        };
+
+        std::vector<int> results;
+        vlanmgr.m_kernelCfg.beginBatch();
+        vlanmgr.m_kernelCfg.setLinkMtu("Bridge", 9100);
+        vlanmgr.m_kernelCfg.setLinkMtu("Ethernet0", 9100);
+        vlanmgr.m_kernelCfg.addBridgeVlan("Ethernet4", 10, false);
+        vlanmgr.m_kernelCfg.setLinkMtu("Bridge", 1500);
+
+        // The first error is returned and every request has its own status, in order
+        ASSERT_EQ(vlanmgr.m_kernelCfg.commitBatch(&results), -NLE_INVAL);
+        ASSERT_EQ(results, std::vector<int>({ 0, -NLE_INVAL, -NLE_OBJ_NOTFOUND, 0 }));
+
+        vlanmgr.m_kernelCfg.beginBatch();
+        vlanmgr.m_kernelCfg.setLinkMtu("Bridge", 9100);
+        ASSERT_EQ(vlanmgr.m_kernelCfg.commitBatch(&results), 0);
+        ASSERT_EQ(results, std::vector<int>({ 0 }));
+    }
+}
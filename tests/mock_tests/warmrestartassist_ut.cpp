@@ -61,4 +61,50 @@ namespace warmrestartassist_test
         ASSERT_EQ(fvField(fvVector[0]), "field");
         ASSERT_EQ(fvValue(fvVector[0]), "value1");
     }
+
+    TEST_F(WarmrestartassistTest, warmRestartAssistReconcileStates)
+    {
+        Table testTable = Table(m_app_db.get(), APP_WRA_TEST_TABLE_NAME);
+        testTable.set("same", { {"f1", "v1"}, {"f2", "v2"} });
+        testTable.set("stale", { {"field", "value"} });
+        testTable.set("deleted", { {"field", "value"} });
+
+        appRestartAssist->readTablesToMap();
+
+        // Field order of a replayed entry does not matter
+        appRestartAssist->insertToMap(APP_WRA_TEST_TABLE_NAME, "same", { {"f2", "v2"}, {"f1", "v1"} }, false);
+        appRestartAssist->insertToMap(APP_WRA_TEST_TABLE_NAME, "deleted", {}, true);
+        appRestartAssist->insertToMap(APP_WRA_TEST_TABLE_NAME, "new", { {"field", "value"} }, false);
+
+        auto &cache = appRestartAssist->appTableCacheMap[APP_WRA_TEST_TABLE_NAME];
+        ASSERT_EQ(cache.at("same").state, AppRestartAssist::SAME);
+        ASSERT_EQ(cache.at("stale").state, AppRestartAssist::STALE);
+        ASSERT_EQ(cache.at("deleted").state, AppRestartAssist::DELETE);
+        ASSERT_EQ(cache.at("new").state, AppRestartAssist::NEW);
+        // Only entries to be written back keep their field/values
+        ASSERT_TRUE(cache.at("same").fvVector.empty());
+        ASSERT_TRUE(cache.at("stale").fvVector.empty());
+
+        appRestartAssist->reconcile();
+        ASSERT_TRUE(appRestartAssist->appTableCacheMap.empty());
+
+        vector<FieldValueTuple> fvVector;
+        ASSERT_TRUE(testTable.get("same", fvVector));
+        ASSERT_FALSE(testTable.get("stale", fvVector));
+        ASSERT_FALSE(testTable.get("deleted", fvVector));
+        ASSERT_TRUE(testTable.get("new", fvVector));
+        ASSERT_EQ(fvValue(fvVector[0]), "value");
+    }
+
+    TEST_F(WarmrestartassistTest, warmRestartAssistColdStart)
+    {
+        AppRestartAssist coldStartAssist(m_app_db_pipeline.get(), "testsyncd", "swss", 0);
+        ASSERT_FALSE(coldStartAssist.isWarmStartInProgress());
+
+        coldStartAssist.registerAppTable(APP_WRA_TEST_TABLE_NAME, m_wra_test_table.get());
+
+        // Nothing to reconcile, the reconcile tables are not created
+        ASSERT_TRUE(coldStartAssist.m_reconcileTables.empty());
+        ASSERT_EQ(coldStartAssist.m_appTables.size(), 1);
+    }
 }
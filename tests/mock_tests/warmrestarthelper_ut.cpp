@@ -1,8 +1,11 @@
 #include "warmRestartHelper.h"
+#include "tablesnapshot.h"
 #include "warm_restart.h"
 #include "mock_table.h"
 #include "ut_helper.h"
 
+#include <chrono>
+
 using namespace testing_db;
 
 namespace wrhelper_test
@@ -103,4 +106,149 @@ namespace wrhelper_test
         m_routeTable->hget("1.2.0.0/24", "protocol", val);
         ASSERT_EQ(val, "kernel");
     }
+
+    TEST_F(WRHelperTest, testFingerprint)
+    {
+        auto fp = swss::WarmStartHelper::getFingerprint({
+                                    {"nexthop", "10.1.1.1,10.1.1.2"},
+                                    {"ifname", "eth1,eth2"}
+                                });
+
+        /* Order of tuples and of comma separated elements does not matter */
+        ASSERT_EQ(fp, swss::WarmStartHelper::getFingerprint({
+                                    {"ifname", "eth2,eth1"},
+                                    {"nexthop", "10.1.1.2,10.1.1.1"}
+                                }));
+
+        ASSERT_NE(fp, swss::WarmStartHelper::getFingerprint({
+                                    {"nexthop", "10.1.1.1,10.1.1.2"},
+                                    {"ifname", "eth1,eth3"}
+                                }));
+        ASSERT_NE(fp, swss::WarmStartHelper::getFingerprint({
+                                    {"nexthop", "10.1.1.1,10.1.1.2"},
+                                    {"ifname", "eth1,eth2"},
+                                    {"protocol", "kernel"}
+                                }));
+        /* Values are not mixed up between fields */
+        ASSERT_NE(fp, swss::WarmStartHelper::getFingerprint({
+                                    {"nexthop", "eth1,eth2"},
+                                    {"ifname", "10.1.1.1,10.1.1.2"}
+                                }));
+    }
+
+    TEST_F(WRHelperTest, testReconciliationScale)
+    {
+        const int routeCount = 100000;
+
+        wrHelper->setState(WarmStart::INITIALIZED);
+
+        for (int i = 0; i < routeCount; i++)
+        {
+            m_routeTable->set("10." + std::to_string(i >> 8) + "." + std::to_string(i & 0xff) + ".0/24",
+                            {
+                                {"ifname", "Ethernet0,Ethernet4"},
+                                {"nexthop", "192.168.0.1,192.168.0.2"}
+                            });
+        }
+
+        ASSERT_TRUE(wrHelper->runRestoration());
+
+        /* Restored in windows of SCAN and pipelined HGETALL, not key by key */
+        ASSERT_EQ(testing_db::getScanCount(),
+                  (routeCount + DEFAULT_SNAPSHOT_WINDOW_SIZE - 1) / DEFAULT_SNAPSHOT_WINDOW_SIZE);
+
+        /* Every 10th route changes its next hops, every 100th one is gone */
+        for (int i = 0; i < routeCount; i++)
+        {
+            if (i % 100 == 0)
+            {
+                continue;
+            }
+
+            std::string nexthop = (i % 10 == 0) ? "192.168.0.3" : "192.168.0.2,192.168.0.1";
+            wrHelper->insertRefreshMap({
+                                        "10." + std::to_string(i >> 8) + "." + std::to_string(i & 0xff) + ".0/24",
+                                        "SET",
+                                        {
+                                            {"nexthop", nexthop},
+                                            {"ifname", "Ethernet4,Ethernet0"}
+                                        }
+                                    });
+        }
+
+        wrHelper->reconcile();
+
+        ASSERT_EQ(wrHelper->getState(), WarmStart::RECONCILED);
+
+        std::string val;
+        ASSERT_FALSE(m_routeTable->hget("10.0.0.0/24", "nexthop", val));
+        ASSERT_TRUE(m_routeTable->hget("10.0.10.0/24", "nexthop", val));
+        ASSERT_EQ(val, "192.168.0.3");
+        /* Unchanged routes keep their original encoding */
+        ASSERT_TRUE(m_routeTable->hget("10.0.1.0/24", "nexthop", val));
+        ASSERT_EQ(val, "192.168.0.1,192.168.0.2");
+    }
+
+    /* Restoration and reconciliation of a full routing table, run with
+     * --gtest_also_run_disabled_tests, the timings are in the test properties */
+    TEST_F(WRHelperTest, DISABLED_testReconciliationBenchmark)
+    {
+        const int routeCount = 1000000;
+
+        auto prefixOf = [](int i) {
+            return "10." + std::to_string(i >> 16) + "." + std::to_string((i >> 8) & 0xff) + "." +
+                   std::to_string(i & 0xff) + "/32";
+        };
+        auto elapsedUs = [](std::chrono::steady_clock::time_point start) {
+            return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                    std::chrono::steady_clock::now() - start).count());
+        };
+
+        wrHelper->setState(WarmStart::INITIALIZED);
+
+        for (int i = 0; i < routeCount; i++)
+        {
+            m_routeTable->set(prefixOf(i),
+                            {
+                                {"ifname", "Ethernet0,Ethernet4"},
+                                {"nexthop", "192.168.0.1,192.168.0.2"}
+                            });
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(wrHelper->runRestoration());
+        RecordProperty("restore_us", elapsedUs(start));
+
+        /* Same mix as the scale test: every 10th route changes, every 100th one is gone */
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < routeCount; i++)
+        {
+            if (i % 100 == 0)
+            {
+                continue;
+            }
+
+            std::string nexthop = (i % 10 == 0) ? "192.168.0.3" : "192.168.0.2,192.168.0.1";
+            wrHelper->insertRefreshMap({
+                                        prefixOf(i),
+                                        "SET",
+                                        {
+                                            {"nexthop", nexthop},
+                                            {"ifname", "Ethernet4,Ethernet0"}
+                                        }
+                                    });
+        }
+        RecordProperty("refresh_us", elapsedUs(start));
+
+        start = std::chrono::steady_clock::now();
+        wrHelper->reconcile();
+        RecordProperty("reconcile_us", elapsedUs(start));
+
+        ASSERT_EQ(wrHelper->getState(), WarmStart::RECONCILED);
+
+        std::string val;
+        ASSERT_FALSE(m_routeTable->hget(prefixOf(0), "nexthop", val));
+        ASSERT_TRUE(m_routeTable->hget(prefixOf(10), "nexthop", val));
+        ASSERT_EQ(val, "192.168.0.3");
+    }
 }
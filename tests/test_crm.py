@@ -730,6 +730,21 @@ class TestCrm(object):
         assert used_counter == 0
         assert avail_counter != 0
 
+    def test_CrmPollStats(self, dvs, testlog):
+
+        crm_update(dvs, "polling_interval", "1")
+        time.sleep(2)
+
+        # every poll publishes its cost along with the counters
+        queries = getCrmCounterValue(dvs, 'STATS', 'poll_sai_queries')
+        assert queries > 0
+
+        counters_db = swsscommon.DBConnector(swsscommon.COUNTERS_DB, dvs.redis_sock, 0)
+        crm_stats_table = swsscommon.Table(counters_db, 'CRM')
+        (status, fvs) = crm_stats_table.get('STATS')
+        assert status
+        assert 'poll_duration_usec' in dict(fvs)
+
     def test_CrmResetThresholdExceedCount(self, dvs, testlog):
 
         config_db = swsscommon.DBConnector(swsscommon.CONFIG_DB, dvs.redis_sock, 0)
@@ -207,6 +207,12 @@ class TestPfcwdFunc(object):
                 queue_name = port + ":" + str(queue)
                 self.counters_db.update_entry("COUNTERS", self.queue_oids[queue_name], fvs)
 
+    def verify_pfcwd_mitigation_stats(self):
+        stats = self.counters_db.wait_for_entry("PFC_WD_STATS", "GLOBAL")
+        assert int(stats["MITIGATION_CYCLES"]) >= 1
+        assert int(stats["LAST_MITIGATION_QUEUES"]) >= 1
+        assert int(stats["MAX_MITIGATION_LATENCY_US"]) >= int(stats["LAST_MITIGATION_LATENCY_US"])
+
     def set_storm_state(self, queues, state="enabled"):
         fvs = {"DEBUG_STORM": state}
         for port in self.test_ports:
@@ -279,6 +285,9 @@ class TestPfcwdFunc(object):
             # verify if queue is disabled. Expected mask is 0
             self.verify_ports_pfc()
 
+            # verify the storms are mitigated in batch
+            self.verify_pfcwd_mitigation_stats()
+
             # stop storm
             self.set_storm_state(test_queues, state="disabled")
 
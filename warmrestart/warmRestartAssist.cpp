@@ -72,6 +72,11 @@ AppRestartAssist::~AppRestartAssist()
     {
         delete (it->second);
     }
+
+    for (auto it = m_reconcileTables.begin(); it != m_reconcileTables.end(); it++)
+    {
+        delete (it->second);
+    }
 }
 
 void AppRestartAssist::registerAppTable(const std::string &tableName, ProducerStateTable *psTable)
@@ -82,6 +87,9 @@ void AppRestartAssist::registerAppTable(const std::string &tableName, ProducerSt
     if (m_warmStartInProgress)
     {
         psTable->clear();
+
+        // Only used by reconcile(), which runs on a warm start only
+        m_reconcileTables[tableName] = new ProducerStateTable(m_pipeLine, tableName, true);
     }
     m_appTables[tableName] = new Table(m_pipeLine, tableName, false);
 }
@@ -97,24 +105,21 @@ string AppRestartAssist::joinVectorString(const vector<FieldValueTuple> &fv)
     return s;
 }
 
-// Set the cache entry state
-void AppRestartAssist::setCacheEntryState(std::vector<FieldValueTuple> &fvVector,
-    cache_state_t state)
+// Sorted hashes of the field-value pairs, to compare entries regardless of the order.
+vector<uint64_t> AppRestartAssist::getFingerprint(const vector<FieldValueTuple> &fv)
 {
-    fvVector.back().second = cacheStateMap.at(state);
-}
+    vector<uint64_t> fingerprint;
+    fingerprint.reserve(fv.size());
 
-// Get the cache entry state
-AppRestartAssist::cache_state_t AppRestartAssist::getCacheEntryState(const std::vector<FieldValueTuple> &fvVector)
-{
-    for (auto &iter : cacheStateMap)
+    for (const auto &temps : fv)
     {
-        if (fvVector.back().second == iter.second)
-        {
-            return iter.first;
-        }
+        uint64_t h = std::hash<string>()(fvField(temps));
+        h ^= std::hash<string>()(fvValue(temps)) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+        fingerprint.push_back(h);
     }
-    throw std::logic_error("cache entry state is invalid");
+    sort(fingerprint.begin(), fingerprint.end());
+
+    return fingerprint;
 }
 
 void AppRestartAssist::appDataReplayed()
@@ -127,7 +132,7 @@ void AppRestartAssist::warmStartDisabled()
     WarmStart::setWarmStartState(m_appName, WarmStart::WSDISABLED);
 }
 
-// Read table(s) from APPDB and append stale flag then insert to cachemap
+// Read table(s) from APPDB and insert them to cachemap as STALE entries
 void AppRestartAssist::readTablesToMap()
 {
     vector<string> keys;
@@ -135,7 +140,8 @@ void AppRestartAssist::readTablesToMap()
     for (auto it = m_appTables.begin(); it != m_appTables.end(); it++)
     {
         (it->second)->getKeys(keys);
-        FieldValueTuple state(CACHE_STATE_FIELD, "");
+        auto &cache = appTableCacheMap[it->first];
+        cache.reserve(cache.size() + keys.size());
 
         for (const auto &key: keys)
         {
@@ -147,19 +153,16 @@ void AppRestartAssist::readTablesToMap()
                 continue;
             }
 
-            fv.push_back(state);
-            setCacheEntryState(fv, STALE);
-
-            string s = joinVectorString(fv);
-
-            SWSS_LOG_INFO("write to cachemap: %s, key: %s, "
-                   "%s", (it->first).c_str(), key.c_str(), s.c_str());
+            SWSS_LOG_INFO("write to cachemap: %s, key: %s", (it->first).c_str(), key.c_str());
 
             // insert to the cache map
-            appTableCacheMap[it->first][key] = fv;
+            auto &entry = cache[key];
+            entry.state = STALE;
+            entry.fingerprint = getFingerprint(fv);
         }
         WarmStart::setWarmStartState(m_appName, WarmStart::RESTORED);
-        SWSS_LOG_NOTICE("Restored appDB table to %s internal cache map", (it->first).c_str());
+        SWSS_LOG_NOTICE("Restored appDB table to %s internal cache map, %zu entries",
+                (it->first).c_str(), cache.size());
     }
     return;
 }
@@ -178,43 +181,44 @@ void AppRestartAssist::readTablesToMap()
  */
 void AppRestartAssist::insertToMap(string tableName, string key, vector<FieldValueTuple> fvVector, bool delete_key)
 {
-    SWSS_LOG_INFO("Received message %s, key: %s, "
-            "%s, delete = %d", tableName.c_str(), key.c_str(), joinVectorString(fvVector).c_str(), delete_key);
+    SWSS_LOG_INFO("Received message %s, key: %s, delete = %d", tableName.c_str(), key.c_str(), delete_key);
 
-    auto found = appTableCacheMap[tableName].find(key);
+    auto &cache = appTableCacheMap[tableName];
+    auto found = cache.find(key);
 
     if (delete_key)
     {
         SWSS_LOG_NOTICE("%s, delete key: %s, ", tableName.c_str(), key.c_str());
         /* mark it as DELETE if exist, otherwise, no-op */
-        if (found != appTableCacheMap[tableName].end())
+        if (found != cache.end())
         {
-            setCacheEntryState(found->second, DELETE);
+            found->second.state = DELETE;
+            found->second.fvVector.clear();
         }
+        return;
     }
-    else if (found != appTableCacheMap[tableName].end())
+
+    auto fingerprint = getFingerprint(fvVector);
+
+    if (found != cache.end())
     {
-        // check only the original vector range (exclude cache-state field/value)
-        if(! contains(found->second, fvVector))
+        if (!contains(found->second.fingerprint, fingerprint))
         {
             SWSS_LOG_NOTICE("%s, found key: %s, new value ", tableName.c_str(), key.c_str());
 
-            FieldValueTuple state(CACHE_STATE_FIELD, "");
-            fvVector.push_back(state);
-
             // mark as NEW flag
-            setCacheEntryState(fvVector, NEW);
-            appTableCacheMap[tableName][key] = fvVector;
+            found->second.state = NEW;
+            found->second.fingerprint = std::move(fingerprint);
+            found->second.fvVector = std::move(fvVector);
         }
         else
         {
-            auto state = getCacheEntryState(found->second);
             /*
              * In case an entry has been updated for more than once with the same value but different from the stored one,
              * keep the state as NEW.
              * Eg.
              * Assume the entry's value that is restored from last warm reboot is V0.
-             * 1. The first update with value V1 is received and handled by the above `if (found != appTableCacheMap[tableName].end())` branch,
+             * 1. The first update with value V1 is received and handled by the above `if (!contains(...))` branch,
              *    - state is set to NEW
              *    - value is updated to V1
              * 2. The second update with the same value V1 is received and handled by this branch
@@ -222,7 +226,7 @@ void AppRestartAssist::insertToMap(string tableName, string key, vector<FieldVal
              *    - The correct logic should be: set the state to same only if the state is not NEW
              * This is a very rare case because in most of times the entry won't be updated for multiple times
              */
-            if (state == NEW)
+            if (found->second.state == NEW)
             {
                 SWSS_LOG_NOTICE("%s, found key: %s, it has been updated for the second time, keep state as NEW",
                                 tableName.c_str(), key.c_str());
@@ -231,7 +235,7 @@ void AppRestartAssist::insertToMap(string tableName, string key, vector<FieldVal
             {
                 SWSS_LOG_INFO("%s, found key: %s, same value", tableName.c_str(), key.c_str());
                 // mark as SAME flag
-                setCacheEntryState(found->second, SAME);
+                found->second.state = SAME;
             }
         }
     }
@@ -239,10 +243,10 @@ void AppRestartAssist::insertToMap(string tableName, string key, vector<FieldVal
     {
         // not found, mark the entry as NEW and insert to map
         SWSS_LOG_NOTICE("%s, not found key: %s, new", tableName.c_str(), key.c_str());
-        FieldValueTuple state(CACHE_STATE_FIELD, "");
-        fvVector.push_back(state);
-        setCacheEntryState(fvVector, NEW);
-        appTableCacheMap[tableName][key] = fvVector;
+        auto &entry = cache[key];
+        entry.state = NEW;
+        entry.fingerprint = std::move(fingerprint);
+        entry.fvVector = std::move(fvVector);
     }
     return;
 }
@@ -254,51 +258,71 @@ void AppRestartAssist::insertToMap(string tableName, string key, vector<FieldVal
  *  if has "STALE/DELETE" flag, delete it from appDB.
  *  else if "NEW" flag,  add it to appDB
  *  else, throw (should never happen)
+ * The changes are written through a buffered producer table and flushed
+ * every RECONCILE_BATCH_SIZE entries, so a pipeline flush is bounded.
+ *
+ * The sweep itself is done in one call, not spread over several select
+ * iterations: the callers keep feeding insertToMap() while the warm start
+ * is in progress, and an event for a key swept by an earlier slice would
+ * never be written to appDB. The cost of a call is one pass over the cache
+ * with no per entry round trip.
  */
 void AppRestartAssist::reconcile()
 {
     std::string tableName;
+    size_t pending = 0;
 
     SWSS_LOG_ENTER();
     for (auto tableIter = appTableCacheMap.begin(); tableIter != appTableCacheMap.end(); ++tableIter)
     {
         tableName = tableIter->first;
+        auto psTable = m_reconcileTables.at(tableName);
+        size_t same = 0, removed = 0, added = 0;
+
         for (auto it = (tableIter->second).begin(); it != (tableIter->second).end(); ++it)
         {
-            string s = joinVectorString(it->second);
-            auto state = getCacheEntryState(it->second);
+            auto state = it->second.state;
 
             if (state == SAME)
             {
-                SWSS_LOG_INFO("%s SAME, key: %s, %s",
-                        tableName.c_str(), it->first.c_str(), s.c_str());
+                same++;
                 continue;
             }
             else if (state == STALE || state == DELETE)
             {
-                SWSS_LOG_NOTICE("%s STALE/DELETE, key: %s, %s",
-                        tableName.c_str(), it->first.c_str(), s.c_str());
+                SWSS_LOG_NOTICE("%s %s, key: %s", tableName.c_str(),
+                        cacheStateMap.at(state).c_str(), it->first.c_str());
 
                 //delete from appDB
-                m_psTables[tableName]->del(it->first);
+                psTable->del(it->first);
+                removed++;
             }
             else if (state == NEW)
             {
-                SWSS_LOG_NOTICE("%s NEW, key: %s, %s",
-                        tableName.c_str(), it->first.c_str(), s.c_str());
+                SWSS_LOG_NOTICE("%s NEW, key: %s, %s", tableName.c_str(),
+                        it->first.c_str(), joinVectorString(it->second.fvVector).c_str());
 
-                //add to appDB, exclude the state
-                it->second.pop_back();
-                m_psTables[tableName]->set(it->first, it->second);
+                //add to appDB
+                psTable->set(it->first, it->second.fvVector);
+                added++;
             }
             else
             {
                 throw std::logic_error("cache entry state is invalid");
             }
+
+            if (++pending >= RECONCILE_BATCH_SIZE)
+            {
+                m_pipeLine->flush();
+                pending = 0;
+            }
         }
+        SWSS_LOG_NOTICE("Reconciled %s: %zu same, %zu removed, %zu added",
+                tableName.c_str(), same, removed, added);
         // reconcile finished, clear the map, mark the warmstart state
         appTableCacheMap[tableName].clear();
     }
+    m_pipeLine->flush();
     appTableCacheMap.clear();
     WarmStart::setWarmStartState(m_appName, WarmStart::RECONCILED);
     m_warmStartInProgress = false;
@@ -336,17 +360,9 @@ bool AppRestartAssist::checkReconcileTimer(Selectable *s)
     return false;
 }
 
-// check if left vector contains all elements of right vector
-bool AppRestartAssist::contains(const std::vector<FieldValueTuple>& left,
-              const std::vector<FieldValueTuple>& right)
+// check if left fingerprint contains all elements of right fingerprint
+bool AppRestartAssist::contains(const std::vector<uint64_t>& left,
+              const std::vector<uint64_t>& right)
 {
-    for (auto const& rv : right)
-    {
-        if (std::find(left.begin(), left.end(), rv) == left.end())
-        {
-            return false;
-        }
-    }
-
-    return true;
+    return std::includes(left.begin(), left.end(), right.begin(), right.end());
 }
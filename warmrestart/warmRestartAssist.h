@@ -94,7 +94,6 @@ private:
     typedef std::map<cache_state_t, std::string> cache_state_map;
     // Enum to string translation map
     static const cache_state_map cacheStateMap;
-    const std::string CACHE_STATE_FIELD = "cache-state";
 
     /*
      * Default timer to be 5 seconds
@@ -102,7 +101,23 @@ private:
      * Precedence ascent order: Default -> loading class with value -> configuration
      */
     static const uint32_t DEFAULT_INTERNAL_TIMER_VALUE = 5;
-    typedef std::map<std::string, std::unordered_map<std::string, std::vector<swss::FieldValueTuple>>> AppTableMap;
+
+    // Number of reconciled entries written to appDB per pipeline flush
+    static const size_t RECONCILE_BATCH_SIZE = 1024;
+
+    /*
+     * Cache entry of an application table key.
+     * Only a sorted list of per field/value hashes is kept to compare against
+     * the replayed entries, the field/values themselves are kept only for the
+     * NEW entries that have to be written back to appDB.
+     */
+    struct CacheEntry
+    {
+        cache_state_t state;
+        std::vector<uint64_t> fingerprint;
+        std::vector<FieldValueTuple> fvVector;
+    };
+    typedef std::map<std::string, std::unordered_map<std::string, CacheEntry>> AppTableMap;
 
     // cache map to store temporary application table
     AppTableMap appTableCacheMap;
@@ -112,17 +127,16 @@ private:
     std::string         m_dockerName; // docker name of the application
     std::string         m_appName;    // application name
     ProducerStateTables m_psTables;   // producer state tables
+    ProducerStateTables m_reconcileTables; // buffered producer state tables used by reconcile, warm start only
 
     bool m_warmStartInProgress;       // indicate if warm start is in progress
     time_t m_reconcileTimer;          // reconcile timer value
     SelectableTimer m_warmStartTimer; // reconcile timer
 
-    // Set or get cache entry state
     std::string joinVectorString(const std::vector<FieldValueTuple> &fv);
-    void setCacheEntryState(std::vector<FieldValueTuple> &fvVector, cache_state_t state);
-    cache_state_t getCacheEntryState(const std::vector<FieldValueTuple> &fvVector);
-    bool contains(const std::vector<FieldValueTuple>& left,
-                  const std::vector<FieldValueTuple>& right);
+    std::vector<uint64_t> getFingerprint(const std::vector<FieldValueTuple> &fv);
+    bool contains(const std::vector<uint64_t>& left,
+                  const std::vector<uint64_t>& right);
 };
 
 }
@@ -2,6 +2,7 @@
 #include <sstream>
 
 #include "warmRestartHelper.h"
+#include "tablesnapshot.h"
 
 
 using namespace swss;
@@ -12,6 +13,7 @@ WarmStartHelper::WarmStartHelper(RedisPipeline      *pipeline,
                                  const std::string  &syncTableName,
                                  const std::string  &dockerName,
                                  const std::string  &appName) :
+    m_pipeline(pipeline),
     m_restorationTable(pipeline, syncTableName, false),
     m_syncTable(syncTable),
     m_syncTableName(syncTableName),
@@ -65,7 +67,7 @@ bool WarmStartHelper::checkAndStart(void)
     }
 
     /* Cleaning state from previous (unsuccessful) warm-restart attempts */
-    m_restorationVector.clear();
+    m_restorationMap.clear();
     m_refreshMap.clear();
 
     /* Keeping track of warm-reboot active/inactive state */
@@ -98,19 +100,53 @@ uint32_t WarmStartHelper::getRestartTimer(void) const
  * are expected to call this method to upload their associated redisDB state into
  * a temporary buffer, which will eventually serve to resolve any conflict between
  * 'old' and 'new' state.
+ *
+ * The table is read with SCAN and pipelined HGETALL, and only the fingerprint of
+ * each restored entry is kept, so the whole table is never held in memory.
  */
 bool WarmStartHelper::runRestoration()
 {
     SWSS_LOG_NOTICE("Warm-Restart: Initiating AppDB restoration process for %s "
                     "application.", m_appName.c_str());
 
-    m_restorationTable.getContent(m_restorationVector);
+    try
+    {
+        readTableSnapshot(m_pipeline->getDBConnector(), m_syncTableName,
+                          m_restorationTable.getTableNameSeparator(), DEFAULT_SNAPSHOT_WINDOW_SIZE,
+                          [this](KeyOpFieldsValuesTuple &&kfv)
+                          {
+                              m_restorationMap[kfvKey(kfv)] = { getFingerprint(kfvFieldsValues(kfv)), false };
+                          });
+    }
+    catch (const std::exception &e)
+    {
+        SWSS_LOG_WARN("Warm-Restart: Failed to read a snapshot of %s: %s, reading it "
+                      "key by key", m_syncTableName.c_str(), e.what());
+
+        m_restorationMap.clear();
+
+        std::vector<std::string> keys;
+        m_restorationTable.getKeys(keys);
+        m_restorationMap.reserve(keys.size());
+
+        for (const auto &key : keys)
+        {
+            std::vector<FieldValueTuple> fv;
+
+            if (!m_restorationTable.get(key, fv))
+            {
+                continue;
+            }
+
+            m_restorationMap[key] = { getFingerprint(fv), false };
+        }
+    }
 
     /*
      * If there's no AppDB state to restore, then alert callee right away to avoid
      * iterating through the 'reconciliation' process.
      */
-    if (!m_restorationVector.size())
+    if (!m_restorationMap.size())
     {
         SWSS_LOG_NOTICE("Warm-Restart: No records received from AppDB for %s "
                         "application.", m_appName.c_str());
@@ -122,7 +158,7 @@ bool WarmStartHelper::runRestoration()
 
     SWSS_LOG_NOTICE("Warm-Restart: Received %zu records from AppDB for %s "
                     "application.",
-                    m_restorationVector.size(),
+                    m_restorationMap.size(),
                     m_appName.c_str());
 
     setState(WarmStart::RESTORED);
@@ -134,9 +170,27 @@ bool WarmStartHelper::runRestoration()
 }
 
 
+/*
+ * Refreshed elements matching their restored counterpart are only flagged as
+ * such, there is nothing to push down to AppDB for them. Any other element is
+ * buffered until reconciliation.
+ */
 void WarmStartHelper::insertRefreshMap(const KeyOpFieldsValuesTuple &kfv)
 {
-    const std::string key = kfvKey(kfv);
+    const std::string &key = kfvKey(kfv);
+
+    auto iter = m_restorationMap.find(key);
+    if (iter != m_restorationMap.end())
+    {
+        iter->second.refreshed = (kfvOp(kfv) == SET_COMMAND &&
+                                  iter->second.fingerprint == getFingerprint(kfvFieldsValues(kfv)));
+
+        if (iter->second.refreshed)
+        {
+            m_refreshMap.erase(key);
+            return;
+        }
+    }
 
     m_refreshMap[key] = kfv;
 }
@@ -156,10 +210,18 @@ void WarmStartHelper::reconcile(void)
 
     assert(getState() == WarmStart::RESTORED);
 
-    for (auto &restoredElem : m_restorationVector)
+    size_t unchanged = 0;
+
+    for (auto &restoredElem : m_restorationMap)
     {
-        std::string restoredKey  = kfvKey(restoredElem);
-        auto restoredFV          = kfvFieldsValues(restoredElem);
+        const std::string &restoredKey = restoredElem.first;
+
+        /* Refreshed with the same content, nothing to do */
+        if (restoredElem.second.refreshed)
+        {
+            unchanged++;
+            continue;
+        }
 
         auto iter = m_refreshMap.find(restoredKey);
 
@@ -170,7 +232,7 @@ void WarmStartHelper::reconcile(void)
         if (iter == m_refreshMap.end())
         {
             SWSS_LOG_NOTICE("Warm-Restart reconciliation: deleting stale entry %s",
-                            printKFV(restoredKey, restoredFV).c_str());
+                            restoredKey.c_str());
 
             m_syncTable->del(restoredKey);
             continue;
@@ -183,37 +245,27 @@ void WarmStartHelper::reconcile(void)
         else if (kfvOp(iter->second) == DEL_COMMAND)
         {
             SWSS_LOG_NOTICE("Warm-Restart reconciliation: deleting entry %s",
-                            printKFV(restoredKey, restoredFV).c_str());
+                            restoredKey.c_str());
 
             m_syncTable->del(restoredKey);
         }
 
         /*
-         * If a matching entry is found in refreshMap, proceed to compare it
-         * with its restored counterpart.
+         * Refreshed entries matching their restored counterpart never make it
+         * to the refreshMap, so this one carries a change.
          */
         else
         {
-            auto refreshedKey = kfvKey(iter->second);
-            auto refreshedFV  = kfvFieldsValues(iter->second);
+            auto &refreshedFV = kfvFieldsValues(iter->second);
 
-            if (compareAllFV(restoredFV, refreshedFV))
-            {
-                SWSS_LOG_NOTICE("Warm-Restart reconciliation: updating entry %s",
-                                printKFV(refreshedKey, refreshedFV).c_str());
+            SWSS_LOG_NOTICE("Warm-Restart reconciliation: updating entry %s",
+                            printKFV(restoredKey, refreshedFV).c_str());
 
-                m_syncTable->set(refreshedKey, refreshedFV);
-            }
-            else
-            {
-                SWSS_LOG_INFO("Warm-Restart reconciliation: no changes needed for "
-                              "existing entry %s",
-                              printKFV(refreshedKey, refreshedFV).c_str());
-            }
+            m_syncTable->set(restoredKey, refreshedFV);
         }
 
         /* Deleting the just-processed restored entry from the refreshMap */
-        m_refreshMap.erase(restoredKey);
+        m_refreshMap.erase(iter);
     }
 
     /*
@@ -222,9 +274,9 @@ void WarmStartHelper::reconcile(void)
      */
     for (auto &kfv : m_refreshMap)
     {
-        auto refreshedKey = kfvKey(kfv.second);
-        auto refreshedOp  = kfvOp(kfv.second);
-        auto refreshedFV  = kfvFieldsValues(kfv.second);
+        auto &refreshedKey = kfvKey(kfv.second);
+        auto &refreshedOp  = kfvOp(kfv.second);
+        auto &refreshedFV  = kfvFieldsValues(kfv.second);
 
         /*
          * During warm-reboot, apps could receive an 'add' and a 'delete' for an
@@ -247,11 +299,14 @@ void WarmStartHelper::reconcile(void)
         }
     }
 
+    SWSS_LOG_NOTICE("Warm-Restart reconciliation: %zu of %zu restored entries "
+                    "unchanged", unchanged, m_restorationMap.size());
+
     /* Clearing pending kfv's from refreshMap */
     m_refreshMap.clear();
 
-    /* Clearing restoration vector */
-    m_restorationVector.clear();
+    /* Clearing restoration map */
+    m_restorationMap.clear();
 
     setState(WarmStart::RECONCILED);
 
@@ -260,90 +315,82 @@ void WarmStartHelper::reconcile(void)
 }
 
 
-/*
- * Compare all field-value-tuples within two vectors.
- *
- * Example: v1 {nexthop: 10.1.1.1, ifname: eth1}
- *          v2 {nexthop: 10.1.1.2, ifname: eth2, protocol: kernel, weight: 1}
- *
- * Returns:
- *
- *    'false' : If the content of both 'fields' and 'values' fully match
- *    'true'  : No full-match is found
- */
-bool WarmStartHelper::compareAllFV(const std::vector<FieldValueTuple> &v1,
-                                   const std::vector<FieldValueTuple> &v2)
+namespace {
+
+uint64_t mix(uint64_t h)
 {
-    /* Size mismatch implies a diff */
-    if (v1.size() != v2.size())
-    {
-        return true;
-    }
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb93fe53b4e87ULL;
+    h ^= h >> 33;
+    return h;
+}
 
-    std::unordered_map<std::string, std::string> v1Map((v1.begin()), v1.end());
+uint64_t hashBytes(const char *data, size_t len)
+{
+    uint64_t h = 0xcbf29ce484222325ULL;
 
-     /* Iterate though all v2 tuples to check if their content match v1 ones */
-    for (auto &v2fv : v2)
+    for (size_t i = 0; i < len; i++)
     {
-        auto v1Iter = v1Map.find(v2fv.first);
-
-        /* Return true when v2 has a new field */
-        if (v1Iter == v1Map.end())
-        {
-            return true;
-        }
-
-        if (compareOneFV(v1Map[fvField(*v1Iter)], fvValue(v2fv)))
-        {
-            return true;
-        }
+        h ^= static_cast<unsigned char>(data[i]);
+        h *= 0x100000001b3ULL;
     }
 
-    return false;
+    return mix(h);
+}
+
 }
 
 
 /*
- * Compare the values of a single field-value within two different KFVs.
+ * Compute a 64-bit fingerprint of a field-value-tuple vector.
  *
- * Example: s1 {nexthop: 10.1.1.1, 10.1.1.2}
- *          s2 {nexthop: 10.1.1.2, 10.1.1.1}
+ * The fingerprint does not depend on the order of the tuples, nor on the order
+ * of the comma separated elements within a value, so that these two entries
+ * share the same fingerprint:
  *
- * Example: s1 {Ethernet1, Ethernet2}
- *          s2 {Ethernet2, Ethernet1}
+ * Example: v1 {nexthop: 10.1.1.1,10.1.1.2 | ifname: eth1,eth2}
+ *          v2 {ifname: eth2,eth1 | nexthop: 10.1.1.2,10.1.1.1}
  *
- * Returns:
- *
- *    'false' : If the content of both strings fully matches
- *    'true'  : No full-match is found
+ * Order-insensitive elements are combined by addition, which unlike xor keeps
+ * repeated elements apart.
  */
-bool WarmStartHelper::compareOneFV(const std::string &s1, const std::string &s2)
+uint64_t WarmStartHelper::getFingerprint(const std::vector<FieldValueTuple> &fv)
 {
-    if (s1.size() != s2.size())
-    {
-        return true;
-    }
-
-    std::vector<std::string> splitValuesS1 = tokenize(s1, ',');
-    std::vector<std::string> splitValuesS2 = tokenize(s2, ',');
+    uint64_t res = mix(fv.size());
 
-    if (splitValuesS1.size() != splitValuesS2.size())
+    for (const auto &tuple : fv)
     {
-        return true;
-    }
+        const std::string &field = fvField(tuple);
+        const std::string &value = fvValue(tuple);
 
-    std::sort(splitValuesS1.begin(), splitValuesS1.end());
-    std::sort(splitValuesS2.begin(), splitValuesS2.end());
+        uint64_t valueHash = 0;
+        size_t count = 0;
+        size_t start = 0;
 
-    for (size_t i = 0; i < splitValuesS1.size(); i++)
-    {
-        if (splitValuesS1[i] != splitValuesS2[i])
+        while (true)
         {
-            return true;
+            size_t end = value.find(',', start);
+            if (end == std::string::npos)
+            {
+                end = value.size();
+            }
+
+            valueHash += hashBytes(value.data() + start, end - start);
+            count++;
+
+            if (end == value.size())
+            {
+                break;
+            }
+            start = end + 1;
         }
+
+        res += mix(hashBytes(field.data(), field.size()) ^ mix(valueHash + count));
     }
 
-    return false;
+    return res;
 }
 
 
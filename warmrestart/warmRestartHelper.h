@@ -29,8 +29,18 @@ class WarmStartHelper {
 
     ~WarmStartHelper();
 
-    /* fvVector type to be used to host AppDB restored elements */
-    using kfvVector = std::vector<KeyOpFieldsValuesTuple>;
+    /*
+     * Restored AppDB element. Only a fingerprint of its field-values is kept,
+     * along with whether the application refreshed it with the same content.
+     */
+    struct RestoredEntry
+    {
+        uint64_t fingerprint;
+        bool     refreshed;
+    };
+
+    /* Map type to be used to host AppDB restored elements */
+    using restoredMap = std::unordered_map<std::string, RestoredEntry>;
 
     /*
      * kfvMap type to be utilized to store all the new/refresh state coming
@@ -59,16 +69,14 @@ class WarmStartHelper {
     const std::string printKFV(const std::string                  &key,
                                const std::vector<FieldValueTuple> &fv);
 
-  private:
-
-    bool compareAllFV(const std::vector<FieldValueTuple> &left,
-                      const std::vector<FieldValueTuple> &right);
+    static uint64_t getFingerprint(const std::vector<FieldValueTuple> &fv);
 
-    bool compareOneFV(const std::string &v1, const std::string &v2);
+  private:
 
+    RedisPipeline            *m_pipeline;          // pipeline of the AppDB connection
     ProducerStateTable       *m_syncTable;         // producer-table to sync/push state to
     Table                     m_restorationTable;  // redis table to import current-state from
-    kfvVector                 m_restorationVector; // buffer struct to hold old state
+    restoredMap               m_restorationMap;    // buffer struct to hold old state
     kfvMap                    m_refreshMap;        // buffer struct to hold new state
     WarmStart::WarmStartState m_state;             // cached value of warmStart's FSM state
     bool                      m_enabled;           // warm-reboot enabled/disabled status